@@ -0,0 +1,231 @@
+#include "engine/public/animation/AnimationClip.h"
+#include "engine/public/core/Engine.h"
+#include "engine/public/rendering/Texture.h"
+#include "engine/public/rendering/TextureAtlas.h"
+#include "engine/public/utils/Assets.h"
+#include "engine/public/utils/ResourceManager.h"
+#include <nlohmann/json.hpp>
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+
+namespace animation {
+
+AnimationClip::AnimationClip(std::string name, std::shared_ptr<rendering::Texture> texture,
+                             std::vector<glm::ivec4> rects, std::vector<float> durations, LoopMode loopMode)
+    : m_name(std::move(name))
+    , m_texture(std::move(texture))
+    , m_loopMode(loopMode)
+    , m_rects(std::move(rects)) {
+    durations.resize(m_rects.size(), durations.empty() ? 0.1f : durations.back());
+
+    m_frameEnds.reserve(durations.size());
+    m_uniformDuration = durations.empty() ? 0.0f : durations.front();
+    for (float duration : durations) {
+        m_duration += std::max(duration, 0.0f);
+        m_frameEnds.push_back(m_duration);
+        if (duration != m_uniformDuration) {
+            m_uniformDuration = 0.0f;
+        }
+    }
+
+    // Any pivot within the frame stays inside this circle around the entity position
+    for (const glm::ivec4& rect : m_rects) {
+        m_boundingRadius = std::max(m_boundingRadius, glm::length(glm::vec2(rect.z, rect.w)));
+    }
+}
+
+size_t AnimationClip::GetFrameIndex(float time) const {
+    if (m_rects.size() < 2 || m_duration <= 0.0f) {
+        return 0;
+    }
+
+    switch (m_loopMode) {
+        case LoopMode::Loop:
+            time = std::fmod(time, m_duration);
+            if (time < 0.0f) time += m_duration;
+            break;
+        case LoopMode::Once:
+            time = std::clamp(time, 0.0f, m_duration);
+            break;
+        case LoopMode::PingPong:
+            time = std::fmod(time, 2.0f * m_duration);
+            if (time < 0.0f) time += 2.0f * m_duration;
+            if (time > m_duration) time = 2.0f * m_duration - time;
+            break;
+    }
+
+    const size_t last = m_rects.size() - 1;
+    if (m_uniformDuration > 0.0f) {
+        return std::min(static_cast<size_t>(time / m_uniformDuration), last);
+    }
+    const auto frame = std::upper_bound(m_frameEnds.begin(), m_frameEnds.end(), time);
+    return std::min(static_cast<size_t>(frame - m_frameEnds.begin()), last);
+}
+
+const rendering::SpriteFrame& AnimationClip::GetFrame(size_t index) const {
+    static const rendering::SpriteFrame empty;
+    if (m_frames.empty()) {
+        BuildFrames();
+    }
+    return index < m_frames.size() ? m_frames[index] : empty;
+}
+
+float AnimationClip::GetPeriod() const {
+    return m_loopMode == LoopMode::PingPong ? 2.0f * m_duration : m_duration;
+}
+
+void AnimationClip::BuildFrames() const {
+    // Texture may still be streaming in - try again on the next draw
+    if (!m_texture || !m_texture->IsValid() || m_texture->GetWidth() <= 0 || m_texture->GetHeight() <= 0) {
+        return;
+    }
+
+    const float invWidth = 1.0f / m_texture->GetWidth();
+    const float invHeight = 1.0f / m_texture->GetHeight();
+    m_frames.reserve(m_rects.size());
+    for (const glm::ivec4& rect : m_rects) {
+        rendering::SpriteFrame frame;
+        frame.uvRect = {rect.x * invWidth, rect.y * invHeight, (rect.x + rect.z) * invWidth, (rect.y + rect.w) * invHeight};
+        frame.size = glm::vec2(rect.z, rect.w);
+        m_frames.push_back(frame);
+    }
+}
+
+LoopMode AnimationClip::ParseLoopMode(const std::string& name) {
+    if (name == "once") return LoopMode::Once;
+    if (name == "pingpong") return LoopMode::PingPong;
+    return LoopMode::Loop;
+}
+
+namespace {
+
+bool ParseRect(const nlohmann::json& value, glm::ivec4& rect) {
+    if (!value.is_array() || value.size() != 4) {
+        return false;
+    }
+    rect = {value[0].get<int>(), value[1].get<int>(), value[2].get<int>(), value[3].get<int>()};
+    return rect.z > 0 && rect.w > 0;
+}
+
+} // namespace
+
+std::shared_ptr<AnimationSet> AnimationSet::Load(const std::string& path) {
+    std::string text;
+    if (!utils::ReadAssetText(path, text)) {
+        spdlog::error("Animation set not found: {}", path);
+        return nullptr;
+    }
+
+    nlohmann::json root = nlohmann::json::parse(text, nullptr, false);
+    if (root.is_discarded() || !root.contains("clips") || !root["clips"].is_object()) {
+        spdlog::error("Invalid animation set (expected a \"clips\" object): {}", path);
+        return nullptr;
+    }
+
+    auto& resources = core::Engine::Resources();
+    const std::filesystem::path directory = std::filesystem::path(path).parent_path();
+
+    std::shared_ptr<rendering::TextureAtlas> atlas;
+    std::shared_ptr<rendering::Texture> sheet;
+    if (root.contains("atlas")) {
+        const std::string atlasDirectory = (directory / root["atlas"].get<std::string>()).generic_string();
+        std::string atlasName = atlasDirectory;
+        std::replace(atlasName.begin(), atlasName.end(), '/', '_'); // Also names its layout cache file
+        atlas = resources.LoadAtlas(atlasName, atlasDirectory);
+    } else if (root.contains("texture")) {
+        sheet = resources.LoadTexture((directory / root["texture"].get<std::string>()).generic_string());
+    }
+    if (!atlas && !sheet) {
+        spdlog::error("Animation set {} has no usable \"texture\" or \"atlas\"", path);
+        return nullptr;
+    }
+
+    auto set = std::make_shared<AnimationSet>();
+    try {
+        for (const auto& [name, clip] : root["clips"].items()) {
+            const float defaultDuration = 1.0f / std::max(clip.value("fps", 10.0f), 0.001f);
+            std::shared_ptr<rendering::Texture> texture = sheet;
+            std::vector<glm::ivec4> rects;
+            std::vector<float> durations;
+
+            for (const auto& frame : clip.value("frames", nlohmann::json::array())) {
+                glm::ivec4 rect;
+                float duration = defaultDuration;
+                if (frame.is_object()) {
+                    duration = frame.value("duration_ms", defaultDuration * 1000.0f) / 1000.0f;
+                }
+
+                if (atlas) {
+                    const std::string regionName = frame.is_object() ? frame.value("region", "") : frame.get<std::string>();
+                    const rendering::TextureAtlas::Region* region = atlas->GetRegion(regionName);
+                    if (!region) {
+                        spdlog::warn("Animation '{}' in {}: atlas has no region '{}'", name, path, regionName);
+                        continue;
+                    }
+                    const auto page = atlas->GetPageTexture(region->page);
+                    if (texture && page != texture) {
+                        spdlog::warn("Animation '{}' in {}: region '{}' is on another atlas page, skipped", name, path, regionName);
+                        continue;
+                    }
+                    texture = page;
+                    rect = region->rect;
+                } else if (!ParseRect(frame.is_object() ? frame.value("rect", nlohmann::json()) : frame, rect)) {
+                    spdlog::warn("Animation '{}' in {}: frame without a valid [x, y, width, height] rect", name, path);
+                    continue;
+                }
+
+                rects.push_back(rect);
+                durations.push_back(duration);
+            }
+
+            if (clip.contains("grid") && !atlas) {
+                const auto& grid = clip["grid"];
+                const glm::ivec2 start(grid.value("x", 0), grid.value("y", 0));
+                const glm::ivec2 size(grid.value("width", 0), grid.value("height", 0));
+                const int count = grid.value("count", 0);
+                const int columns = std::max(grid.value("columns", count), 1);
+                for (int i = 0; i < count && size.x > 0 && size.y > 0; ++i) {
+                    rects.push_back({start.x + (i % columns) * size.x, start.y + (i / columns) * size.y, size.x, size.y});
+                    durations.push_back(defaultDuration);
+                }
+            }
+
+            if (rects.empty()) {
+                spdlog::warn("Animation '{}' in {} has no frames, skipped", name, path);
+                continue;
+            }
+
+            set->m_clips[name] = std::make_shared<const AnimationClip>(
+                name, texture, std::move(rects), std::move(durations), AnimationClip::ParseLoopMode(clip.value("loop", "loop")));
+        }
+    } catch (const nlohmann::json::exception& e) {
+        spdlog::error("Failed to parse animation set {}: {}", path, e.what());
+        return nullptr;
+    }
+
+    spdlog::info("Loaded {} animations from {}", set->m_clips.size(), path);
+    return set;
+}
+
+std::shared_ptr<const AnimationClip> AnimationSet::GetClip(const std::string& name) const {
+    auto it = m_clips.find(name);
+    if (it == m_clips.end()) {
+        spdlog::warn("Animation '{}' not found", name);
+        return nullptr;
+    }
+    return it->second;
+}
+
+std::vector<std::string> AnimationSet::GetClipNames() const {
+    std::vector<std::string> names;
+    names.reserve(m_clips.size());
+    for (const auto& [name, clip] : m_clips) {
+        names.push_back(name);
+    }
+    std::sort(names.begin(), names.end());
+    return names;
+}
+
+} // namespace animation
@@ -0,0 +1,50 @@
+#include "engine/public/animation/Animator.h"
+#include <algorithm>
+
+namespace animation {
+
+Animator::Animator(std::shared_ptr<const AnimationClip> clip, float speed)
+    : m_speed(speed) {
+    Play(std::move(clip), true);
+}
+
+void Animator::Play(std::shared_ptr<const AnimationClip> clip, bool restart) {
+    if (clip == m_clip && !restart) {
+        m_playing = m_clip != nullptr;
+        return;
+    }
+
+    m_clip = std::move(clip);
+    m_time = 0.0f;
+    m_period = m_clip ? m_clip->GetPeriod() : 0.0f;
+    m_loops = !m_clip || m_clip->GetLoopMode() != LoopMode::Once;
+    m_playing = m_clip != nullptr;
+}
+
+void Animator::Stop() {
+    m_playing = false;
+    m_time = 0.0f;
+}
+
+void Animator::SetTime(float time) {
+    m_time = time;
+    Wrap();
+}
+
+void Animator::Wrap() {
+    if (m_period <= 0.0f) {
+        m_time = 0.0f;
+        return;
+    }
+
+    if (m_loops) {
+        // Keep the clock small so float precision holds up over long play times
+        m_time = std::fmod(m_time, m_period);
+        if (m_time < 0.0f) m_time += m_period;
+    } else {
+        m_time = std::clamp(m_time, 0.0f, m_period);
+        if (m_time >= m_period) m_playing = false;
+    }
+}
+
+} // namespace animation
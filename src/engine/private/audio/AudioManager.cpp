@@ -1,9 +1,44 @@
 #include "engine/public/audio/AudioManager.h"
+#include "engine/public/audio/SoundBank.h"
+#include "engine/public/core/Engine.h"
+#include "engine/public/core/JobSystem.h"
+#include "engine/public/utils/Assets.h"
+#include "engine/public/utils/Config.h"
+#include <nlohmann/json.hpp>
 #include <spdlog/spdlog.h>
+#include <algorithm>
 #include <filesystem>
 
 namespace audio {
 
+namespace {
+
+// Handle = generation << VOICE_INDEX_BITS | voice index (always >= 0)
+constexpr int VOICE_INDEX_BITS = 8;
+constexpr int VOICE_INDEX_MASK = (1 << VOICE_INDEX_BITS) - 1;
+constexpr uint32_t GENERATION_MASK = 0x7FFFFF;
+constexpr int MAX_VOICES = VOICE_INDEX_MASK; // Last index is the music slot
+
+int CategoryIndex(AudioCategory category) {
+    return static_cast<int>(category);
+}
+
+bool ParseCategory(const std::string& name, AudioCategory& category) {
+    if (name == "sfx") category = AudioCategory::SFX;
+    else if (name == "music") category = AudioCategory::Music;
+    else if (name == "ambient") category = AudioCategory::Ambient;
+    else return false;
+    return true;
+}
+
+SoundBankFormat QueryDeviceFormat() {
+    SoundBankFormat format;
+    Mix_QuerySpec(&format.frequency, &format.format, &format.channels);
+    return format;
+}
+
+} // anonymous namespace
+
 AudioManager::AudioManager() = default;
 
 AudioManager::~AudioManager() {
@@ -13,14 +48,43 @@ AudioManager::~AudioManager() {
 bool AudioManager::Initialize() {
     spdlog::info("Initializing audio manager...");
     
-    // Initialize SDL_mixer
-    if (Mix_OpenAudio(44100, MIX_DEFAULT_FORMAT, 2, 1024) < 0) {
+    auto& config = *utils::Config::Instance();
+    const int sampleRate = std::clamp(config.GetInt("audio.sample_rate", 44100), 8000, 192000);
+    const int bufferSize = std::clamp(config.GetInt("audio.buffer_size", 1024), 64, 8192);
+    const bool useMixer = config.GetBool("audio.mixer.enabled", true);
+    
+    // Initialize SDL_mixer (float output keeps the bus stage free of conversions)
+    if (Mix_OpenAudio(sampleRate, useMixer ? AUDIO_F32SYS : MIX_DEFAULT_FORMAT, 2, bufferSize) < 0) {
         spdlog::error("Failed to initialize SDL_mixer: {}", Mix_GetError());
         return false;
     }
     
-    // Set number of mixing channels
-    Mix_AllocateChannels(32);
+    // One voice per mixing channel, plus the music slot
+    const int voiceCount = std::clamp(config.GetInt("audio.voices", 32), 1, MAX_VOICES);
+    Mix_AllocateChannels(voiceCount);
+    m_voices.assign(voiceCount + 1, Voice{});
+    m_voiceStats = VoiceStats{};
+    m_voiceStats.voices = voiceCount;
+    
+    SetCategoryVoiceLimit(AudioCategory::SFX, config.GetInt("audio.voice_limits.sfx", 0));
+    SetCategoryVoiceLimit(AudioCategory::Music, config.GetInt("audio.voice_limits.music", 0));
+    SetCategoryVoiceLimit(AudioCategory::Ambient, config.GetInt("audio.voice_limits.ambient", 0));
+    m_minDistance = std::max(config.GetFloat("audio.min_distance", 100.0f), 0.0f);
+    m_maxDistance = std::max(config.GetFloat("audio.max_distance", 1000.0f), m_minDistance + 1.0f);
+    m_cullVolume = std::max(config.GetFloat("audio.cull_volume", 0.01f), 0.0f);
+    
+    if (useMixer) {
+        m_mixer = std::make_unique<AudioMixer>();
+        if (m_mixer->Initialize(voiceCount, bufferSize)) {
+            m_mixer->SetMasterVolume(m_muted ? 0.0f : m_masterVolume);
+            m_mixer->SetBusVolume(CategoryIndex(AudioCategory::SFX), m_sfxVolume);
+            m_mixer->SetBusVolume(CategoryIndex(AudioCategory::Music), m_musicVolume);
+            m_mixer->SetBusVolume(CategoryIndex(AudioCategory::Ambient), m_ambientVolume);
+        } else {
+            spdlog::warn("Audio mixer unavailable, using per-channel volumes");
+            m_mixer.reset();
+        }
+    }
     
     // Initialize supported audio formats
     int flags = MIX_INIT_OGG | MIX_INIT_MP3;
@@ -30,10 +94,16 @@ bool AudioManager::Initialize() {
         spdlog::warn("Some audio formats may not be supported: {}", Mix_GetError());
     }
     
+    m_loadCounter = std::make_unique<core::JobCounter>();
+    
     m_initialized = true;
     spdlog::info("Audio manager initialized successfully");
-    spdlog::info("Audio format: 44100 Hz, {} channels, {} mixing channels", 
-                Mix_QuerySpec(nullptr, nullptr, nullptr), Mix_AllocateChannels(-1));
+    int frequency = 0;
+    Uint16 format = 0;
+    int channels = 0;
+    Mix_QuerySpec(&frequency, &format, &channels);
+    spdlog::info("Audio format: {} Hz, {} channels, {} sample buffer, {} mixing channels", 
+                frequency, channels, bufferSize, Mix_AllocateChannels(-1));
     
     return true;
 }
@@ -45,6 +115,12 @@ void AudioManager::Shutdown() {
         // Stop all audio
         StopAll();
         
+        // Finish outstanding async loads so their chunks can be freed below
+        if (m_loadCounter && !m_loadCounter->IsDone()) {
+            core::Engine::Jobs().Wait(*m_loadCounter);
+        }
+        ProcessLoadedSounds();
+        
         // Unload all sounds
         for (auto& [name, sound] : m_sounds) {
             if (sound.chunk) {
@@ -52,6 +128,7 @@ void AudioManager::Shutdown() {
             }
         }
         m_sounds.clear();
+        m_banks.clear(); // Only after the chunks pointing into them
         
         // Unload all streams
         for (auto& [name, stream] : m_streams) {
@@ -61,11 +138,16 @@ void AudioManager::Shutdown() {
         }
         m_streams.clear();
         
-        m_playingAudio.clear();
+        // Detach the bus stage before the device goes away
+        if (m_mixer) {
+            m_mixer->Shutdown();
+            m_mixer.reset();
+        }
         
         // Shutdown SDL_mixer
         Mix_Quit();
         Mix_CloseAudio();
+        m_voices.clear();
         
         m_initialized = false;
         spdlog::info("Audio manager shutdown complete");
@@ -75,7 +157,27 @@ void AudioManager::Shutdown() {
 void AudioManager::Update() {
     if (!m_initialized) return;
     
+    ProcessLoadedSounds();
     CleanupFinishedSounds();
+    
+    // Follow the listener (and positions set since last frame)
+    for (int i = 0; i < GetMusicVoice(); ++i) {
+        Voice& voice = m_voices[i];
+        if (voice.active && voice.positional) {
+            voice.attenuation = CalculateAttenuation(voice.position, voice.minDistance, voice.maxDistance);
+            ApplyVoiceVolume(i);
+            ApplyVoicePanning(i);
+        }
+    }
+}
+
+std::string AudioManager::GetSoundPath(const std::string& filepath, AudioCategory category) {
+    std::string fullPath = "assets/audio/";
+    if (category == AudioCategory::SFX) {
+        fullPath += "sfx/";
+    }
+    fullPath += filepath;
+    return fullPath;
 }
 
 bool AudioManager::LoadSound(const std::string& filepath, const std::string& name, AudioCategory category) {
@@ -91,20 +193,16 @@ bool AudioManager::LoadSound(const std::string& filepath, const std::string& nam
     }
     
     // Construct full path
-    std::string fullPath = "assets/audio/";
-    if (category == AudioCategory::SFX) {
-        fullPath += "sfx/";
-    }
-    fullPath += filepath;
+    std::string fullPath = GetSoundPath(filepath, category);
     
     // Check if file exists
-    if (!std::filesystem::exists(fullPath)) {
+    if (!utils::AssetExists(fullPath)) {
         spdlog::error("Sound file not found: {}", fullPath);
         return false;
     }
     
     // Load the sound
-    Mix_Chunk* chunk = Mix_LoadWAV(fullPath.c_str());
+    Mix_Chunk* chunk = Mix_LoadWAV_RW(utils::OpenAsset(fullPath), 1);
     if (!chunk) {
         spdlog::error("Failed to load sound '{}': {}", name, Mix_GetError());
         return false;
@@ -122,6 +220,83 @@ bool AudioManager::LoadSound(const std::string& filepath, const std::string& nam
     return true;
 }
 
+std::shared_future<bool> AudioManager::LoadSoundAsync(const std::string& filepath, const std::string& name, AudioCategory category) {
+    auto pendingSound = std::make_shared<PendingSound>();
+    std::shared_future<bool> future = pendingSound->promise.get_future().share();
+    
+    if (!m_initialized) {
+        spdlog::warn("Audio manager not initialized, cannot load sound: {}", name);
+        pendingSound->promise.set_value(false);
+        return future;
+    }
+    
+    // Already loaded, or already loading
+    if (m_sounds.find(name) != m_sounds.end()) {
+        pendingSound->promise.set_value(true);
+        return future;
+    }
+    auto pending = m_pendingSounds.find(name);
+    if (pending != m_pendingSounds.end()) {
+        return pending->second;
+    }
+    
+    pendingSound->name = name;
+    pendingSound->fullPath = GetSoundPath(filepath, category);
+    pendingSound->category = category;
+    m_pendingSounds[name] = future;
+    
+    // Decoding only converts to the already opened device format, so it is safe off the main thread
+    core::Engine::Jobs().Submit([this, pendingSound] {
+        if (!utils::AssetExists(pendingSound->fullPath)) {
+            pendingSound->error = "file not found";
+        } else {
+            pendingSound->chunk = Mix_LoadWAV_RW(utils::OpenAsset(pendingSound->fullPath), 1);
+            if (!pendingSound->chunk) {
+                pendingSound->error = Mix_GetError();
+            }
+        }
+        
+        std::lock_guard<std::mutex> lock(m_loadedMutex);
+        m_loadedSounds.push_back(pendingSound);
+    }, m_loadCounter.get());
+    
+    return future;
+}
+
+void AudioManager::ProcessLoadedSounds() {
+    std::deque<std::shared_ptr<PendingSound>> loaded;
+    {
+        std::lock_guard<std::mutex> lock(m_loadedMutex);
+        loaded.swap(m_loadedSounds);
+    }
+    
+    for (auto& pendingSound : loaded) {
+        m_pendingSounds.erase(pendingSound->name);
+        
+        if (!pendingSound->chunk) {
+            spdlog::error("Failed to load sound '{}' from '{}': {}", pendingSound->name, pendingSound->fullPath, pendingSound->error);
+            pendingSound->promise.set_value(false);
+            continue;
+        }
+        
+        // Loaded synchronously in the meantime - keep the existing chunk
+        if (m_sounds.find(pendingSound->name) != m_sounds.end()) {
+            Mix_FreeChunk(pendingSound->chunk);
+            pendingSound->promise.set_value(true);
+            continue;
+        }
+        
+        SoundData soundData;
+        soundData.chunk = pendingSound->chunk;
+        soundData.category = pendingSound->category;
+        soundData.filepath = pendingSound->fullPath;
+        m_sounds[pendingSound->name] = soundData;
+        
+        spdlog::info("Loaded sound '{}' from '{}'", pendingSound->name, pendingSound->fullPath);
+        pendingSound->promise.set_value(true);
+    }
+}
+
 bool AudioManager::LoadStream(const std::string& filepath, const std::string& name, AudioCategory category) {
     if (!m_initialized) {
         spdlog::warn("Audio manager not initialized, cannot load stream: {}", name);
@@ -144,13 +319,14 @@ bool AudioManager::LoadStream(const std::string& filepath, const std::string& na
     fullPath += filepath;
     
     // Check if file exists
-    if (!std::filesystem::exists(fullPath)) {
+    if (!utils::AssetExists(fullPath)) {
         spdlog::error("Stream file not found: {}", fullPath);
         return false;
     }
     
     // Load the music (don't load into memory yet - SDL_mixer handles streaming)
-    Mix_Music* music = Mix_LoadMUS(fullPath.c_str());
+    // Streams keep reading from the RWops (the archive mapping when packed)
+    Mix_Music* music = Mix_LoadMUS_RW(utils::OpenAsset(fullPath), 1);
     if (!music) {
         spdlog::error("Failed to load stream '{}': {}", name, Mix_GetError());
         return false;
@@ -171,6 +347,14 @@ bool AudioManager::LoadStream(const std::string& filepath, const std::string& na
 void AudioManager::UnloadSound(const std::string& name) {
     auto it = m_sounds.find(name);
     if (it != m_sounds.end()) {
+        // SDL_mixer must not keep mixing a freed chunk
+        for (int i = 0; i < GetMusicVoice(); ++i) {
+            if (m_voices[i].active && m_voices[i].chunk == it->second.chunk) {
+                Mix_HaltChannel(i);
+                ReleaseVoice(i);
+            }
+        }
+        
         if (it->second.chunk) {
             Mix_FreeChunk(it->second.chunk);
         }
@@ -179,16 +363,232 @@ void AudioManager::UnloadSound(const std::string& name) {
     }
 }
 
+size_t AudioManager::ReloadSoundFile(const std::string& path) {
+    if (!m_initialized) {
+        return 0;
+    }
+    
+    const std::string normalized = std::filesystem::path(path).lexically_normal().generic_string();
+    size_t reloaded = 0;
+    for (auto& [name, sound] : m_sounds) {
+        // Bank sounds point into the bank's mapping - rebuild the bank instead
+        if (!sound.bank.empty() || std::filesystem::path(sound.filepath).lexically_normal().generic_string() != normalized) {
+            continue;
+        }
+        
+        // Keep the old chunk if the new file isn't decodable yet
+        Mix_Chunk* chunk = Mix_LoadWAV_RW(utils::OpenAsset(sound.filepath), 1);
+        if (!chunk) {
+            spdlog::warn("Keeping the previous version of sound '{}': {}", name, Mix_GetError());
+            continue;
+        }
+        
+        // Same as UnloadSound: nothing may keep mixing the old chunk
+        for (int i = 0; i < GetMusicVoice(); ++i) {
+            if (m_voices[i].active && m_voices[i].chunk == sound.chunk) {
+                Mix_HaltChannel(i);
+                ReleaseVoice(i);
+            }
+        }
+        if (sound.chunk) {
+            Mix_FreeChunk(sound.chunk);
+        }
+        sound.chunk = chunk;
+        ++reloaded;
+        spdlog::info("Reloaded sound '{}' from '{}'", name, sound.filepath);
+    }
+    return reloaded;
+}
+
+bool AudioManager::LoadSoundBank(const std::string& bankPath, const std::string& bankName) {
+    if (!m_initialized) {
+        spdlog::warn("Audio manager not initialized, cannot load sound bank: {}", bankName);
+        return false;
+    }
+    
+    if (m_banks.find(bankName) != m_banks.end()) {
+        spdlog::warn("Sound bank '{}' already loaded", bankName);
+        return true;
+    }
+    
+    const std::string fullPath = "assets/audio/" + bankPath;
+    const std::string manifestPath = fullPath + ".json";
+    
+    // Packed builds carry the bank the asset packer built - read it in place, nothing to rebuild
+    auto bank = std::make_unique<SoundBank>();
+    if (const utils::AssetView packed = utils::FindPackedAsset(fullPath)) {
+        if (!bank->Open(packed, fullPath)) {
+            return false;
+        }
+        if (bank->GetFormat() != QueryDeviceFormat()) {
+            spdlog::error("Packed sound bank '{}' was built for a different audio device format ({} Hz, {} channels) - "
+                          "repack with matching audio settings", fullPath, bank->GetFormat().frequency, bank->GetFormat().channels);
+            return false;
+        }
+        return RegisterSoundBank(std::move(bank), bankName, fullPath);
+    }
+    
+    // Rebuild when the manifest changed since the bank was written
+    std::error_code ec;
+    const bool hasManifest = utils::AssetExists(manifestPath);
+    bool rebuilt = false;
+    if (hasManifest && (!std::filesystem::exists(fullPath, ec) ||
+                        std::filesystem::last_write_time(manifestPath, ec) > std::filesystem::last_write_time(fullPath, ec))) {
+        if (!BuildSoundBank(bankPath)) {
+            return false;
+        }
+        rebuilt = true;
+    }
+    
+    if (!bank->Open(fullPath)) {
+        return false;
+    }
+    
+    // PCM must be at the device format - SDL_mixer plays chunk bytes as they are
+    if (bank->GetFormat() != QueryDeviceFormat()) {
+        bank->Close();
+        if (!hasManifest || rebuilt) {
+            spdlog::error("Sound bank '{}' was built for a different audio device format ({} Hz, {} channels)",
+                         fullPath, bank->GetFormat().frequency, bank->GetFormat().channels);
+            return false;
+        }
+        
+        spdlog::info("Sound bank '{}' does not match the audio device, rebuilding", fullPath);
+        if (!BuildSoundBank(bankPath) || !bank->Open(fullPath) || bank->GetFormat() != QueryDeviceFormat()) {
+            return false;
+        }
+    }
+    
+    return RegisterSoundBank(std::move(bank), bankName, fullPath);
+}
+
+bool AudioManager::RegisterSoundBank(std::unique_ptr<SoundBank> bank, const std::string& bankName, const std::string& fullPath) {
+    LoadedBank loaded;
+    for (const auto& sound : bank->GetSounds()) {
+        if (m_sounds.find(sound.name) != m_sounds.end()) {
+            spdlog::warn("Sound '{}' already loaded, skipping the copy in bank '{}'", sound.name, bankName);
+            continue;
+        }
+        
+        // SDL_mixer never writes to chunk data, so the read-only mapping is safe
+        Mix_Chunk* chunk = Mix_QuickLoad_RAW(const_cast<Uint8*>(sound.data), sound.size);
+        if (!chunk) {
+            spdlog::warn("Failed to create sound '{}' from bank '{}': {}", sound.name, bankName, Mix_GetError());
+            continue;
+        }
+        
+        SoundData soundData;
+        soundData.chunk = chunk;
+        soundData.category = static_cast<AudioCategory>(std::clamp(sound.category, 0, 2));
+        soundData.filepath = fullPath;
+        soundData.priority = sound.priority;
+        soundData.bank = bankName;
+        m_sounds[sound.name] = soundData;
+        loaded.sounds.push_back(sound.name);
+    }
+    
+    spdlog::info("Loaded sound bank '{}' from '{}' ({} sounds, {:.1f} MB mapped)",
+                 bankName, fullPath, loaded.sounds.size(), static_cast<double>(bank->GetSize()) / (1024.0 * 1024.0));
+    loaded.bank = std::move(bank);
+    m_banks[bankName] = std::move(loaded);
+    return true;
+}
+
+void AudioManager::UnloadSoundBank(const std::string& bankName) {
+    auto it = m_banks.find(bankName);
+    if (it == m_banks.end()) return;
+    
+    // Sounds first: their chunks point into the mapping
+    for (const auto& name : it->second.sounds) {
+        auto sound = m_sounds.find(name);
+        if (sound != m_sounds.end() && sound->second.bank == bankName) {
+            UnloadSound(name);
+        }
+    }
+    
+    m_banks.erase(it);
+    spdlog::info("Unloaded sound bank '{}'", bankName);
+}
+
+bool AudioManager::BuildSoundBank(const std::string& bankPath, const std::string& outputPath) {
+    if (!m_initialized) {
+        spdlog::warn("Audio manager not initialized, cannot build sound bank: {}", bankPath);
+        return false;
+    }
+    
+    const std::string fullPath = "assets/audio/" + bankPath;
+    const std::string manifestPath = fullPath + ".json";
+    
+    std::string manifestText;
+    if (!utils::ReadAssetText(manifestPath, manifestText)) {
+        spdlog::error("Sound bank manifest not found: {}", manifestPath);
+        return false;
+    }
+    
+    nlohmann::json manifest = nlohmann::json::parse(manifestText, nullptr, false);
+    if (manifest.is_discarded() || !manifest.contains("sounds") || !manifest["sounds"].is_array()) {
+        spdlog::error("Invalid sound bank manifest (expected a \"sounds\" array): {}", manifestPath);
+        return false;
+    }
+    
+    // Mix_LoadWAV decodes and converts to the open device's format
+    std::vector<Mix_Chunk*> chunks;
+    std::vector<SoundBankSound> sounds;
+    for (const auto& entry : manifest["sounds"]) {
+        const std::string soundFile = entry.value("file", "");
+        if (soundFile.empty()) {
+            spdlog::warn("Skipping sound bank entry without a file in {}", manifestPath);
+            continue;
+        }
+        
+        AudioCategory category = AudioCategory::SFX;
+        const std::string categoryName = entry.value("category", "sfx");
+        if (!ParseCategory(categoryName, category)) {
+            spdlog::warn("Unknown audio category '{}' for '{}', using sfx", categoryName, soundFile);
+        }
+        
+        const std::string soundPath = GetSoundPath(soundFile, category);
+        Mix_Chunk* chunk = Mix_LoadWAV_RW(utils::OpenAsset(soundPath), 1);
+        if (!chunk) {
+            spdlog::error("Failed to decode '{}' for sound bank: {}", soundPath, Mix_GetError());
+            continue;
+        }
+        chunks.push_back(chunk);
+        
+        SoundBankSound sound;
+        sound.name = entry.value("name", std::filesystem::path(soundFile).stem().string());
+        sound.category = CategoryIndex(category);
+        sound.priority = std::max(entry.value("priority", 0), 0);
+        sound.data = chunk->abuf;
+        sound.size = chunk->alen;
+        sounds.push_back(std::move(sound));
+    }
+    
+    const std::string bankFile = outputPath.empty() ? fullPath : outputPath;
+    const bool written = SoundBank::Write(bankFile, QueryDeviceFormat(), sounds);
+    
+    size_t bytes = 0;
+    for (Mix_Chunk* chunk : chunks) {
+        bytes += chunk->alen;
+        Mix_FreeChunk(chunk);
+    }
+    
+    if (written) {
+        spdlog::info("Built sound bank '{}' ({} sounds, {:.1f} MB PCM)", bankFile, sounds.size(),
+                     static_cast<double>(bytes) / (1024.0 * 1024.0));
+    }
+    return written;
+}
+
 void AudioManager::UnloadStream(const std::string& name) {
     auto it = m_streams.find(name);
     if (it != m_streams.end()) {
-        // Stop the music if it's currently playing
-        if (m_currentMusicHandle != INVALID_AUDIO_HANDLE) {
-            auto playingIt = m_playingAudio.find(m_currentMusicHandle);
-            if (playingIt != m_playingAudio.end() && playingIt->second.isStream) {
+        // Stop the music if it's this stream
+        if (!m_voices.empty()) {
+            const int musicVoice = GetMusicVoice();
+            if (m_voices[musicVoice].active && m_voices[musicVoice].music == it->second.music) {
                 Mix_HaltMusic();
-                m_playingAudio.erase(playingIt);
-                m_currentMusicHandle = INVALID_AUDIO_HANDLE;
+                ReleaseVoice(musicVoice);
             }
         }
         
@@ -201,6 +601,20 @@ void AudioManager::UnloadStream(const std::string& name) {
 }
 
 AudioHandle AudioManager::PlaySound(const std::string& name, float volume) {
+    SoundParams params;
+    params.volume = volume;
+    return PlaySound(name, params);
+}
+
+AudioHandle AudioManager::PlaySoundAt(const std::string& name, const glm::vec2& position, float volume) {
+    SoundParams params;
+    params.volume = volume;
+    params.positional = true;
+    params.position = position;
+    return PlaySound(name, params);
+}
+
+AudioHandle AudioManager::PlaySound(const std::string& name, const SoundParams& params) {
     if (!m_initialized) {
         spdlog::warn("Audio manager not initialized, cannot play sound: {}", name);
         return INVALID_AUDIO_HANDLE;
@@ -213,29 +627,60 @@ AudioHandle AudioManager::PlaySound(const std::string& name, float volume) {
     }
     
     const SoundData& soundData = it->second;
+    const int priority = params.priority >= 0 ? params.priority : soundData.priority;
+    const float minDistance = params.minDistance >= 0.0f ? params.minDistance : m_minDistance;
+    const float maxDistance = params.maxDistance >= 0.0f ? std::max(params.maxDistance, minDistance) : std::max(m_maxDistance, minDistance);
+    const float attenuation = params.positional ? CalculateAttenuation(params.position, minDistance, maxDistance) : 1.0f;
     
-    // Play the sound on any available channel
-    int channel = Mix_PlayChannel(-1, soundData.chunk, 0);
-    if (channel == -1) {
-        spdlog::warn("Failed to play sound '{}': {}", name, Mix_GetError());
+    // Master volume and mute are left out - they change what is heard, not what matters
+    const float audibility = std::clamp(params.volume, 0.0f, 1.0f) * attenuation * GetCategoryVolume(soundData.category);
+    if (audibility < m_cullVolume) {
+        m_voiceStats.culled++;
+        spdlog::debug("Culled inaudible sound '{}' (volume {:.3f})", name, audibility);
+        return INVALID_AUDIO_HANDLE;
+    }
+    
+    const int index = AcquireVoice(soundData.category, priority, audibility);
+    if (index < 0) {
+        m_voiceStats.dropped++;
+        spdlog::debug("No voice for sound '{}' (priority {}) - all candidates are more important", name, priority);
         return INVALID_AUDIO_HANDLE;
     }
     
-    // Create handle and track playing audio
-    AudioHandle handle = GetNextHandle();
-    PlayingAudio playingAudio;
-    playingAudio.category = soundData.category;
-    playingAudio.volume = volume;
-    playingAudio.channel = channel;
-    playingAudio.isStream = false;
-    playingAudio.isPaused = false;
+    Voice& voice = m_voices[index];
+    voice.active = true;
+    voice.isStream = false;
+    voice.isPaused = false;
+    voice.category = soundData.category;
+    voice.chunk = soundData.chunk;
+    voice.music = nullptr;
+    voice.volume = params.volume;
+    voice.attenuation = attenuation;
+    voice.priority = priority;
+    voice.positional = params.positional;
+    voice.position = params.position;
+    voice.minDistance = minDistance;
+    voice.maxDistance = maxDistance;
+    m_categoryVoices[CategoryIndex(voice.category)]++;
     
-    m_playingAudio[handle] = playingAudio;
+    // Volume and panning before the first samples are mixed
+    ApplyVoiceVolume(index);
+    ApplyVoicePanning(index);
+    if (m_mixer) {
+        const float gain = voice.volume * voice.attenuation;
+        const float pan = GetVoicePan(voice);
+        m_mixer->StartVoice(index, CategoryIndex(voice.category),
+                            {gain * std::min(1.0f, 1.0f - pan), gain * std::min(1.0f, 1.0f + pan)});
+    }
     
-    // Set the volume
-    UpdateChannelVolume(channel, soundData.category, volume);
+    if (Mix_PlayChannel(index, soundData.chunk, 0) == -1) {
+        spdlog::warn("Failed to play sound '{}': {}", name, Mix_GetError());
+        ReleaseVoice(index);
+        return INVALID_AUDIO_HANDLE;
+    }
     
-    spdlog::debug("Playing sound '{}' on channel {} with handle {}", name, channel, handle);
+    AudioHandle handle = MakeHandle(index);
+    spdlog::debug("Playing sound '{}' on voice {} with handle {}", name, index, handle);
     return handle;
 }
 
@@ -252,10 +697,16 @@ AudioHandle AudioManager::PlayStream(const std::string& name, float volume, bool
     }
     
     const StreamData& streamData = it->second;
+    const int index = GetMusicVoice();
     
     // Stop current music if any
-    if (m_currentMusicHandle != INVALID_AUDIO_HANDLE) {
-        StopAudio(m_currentMusicHandle);
+    if (m_voices[index].active) {
+        StopAudio(MakeHandle(index));
+    }
+    
+    // Ambient streams go through the ambient bus
+    if (m_mixer) {
+        m_mixer->SetMusicBus(CategoryIndex(streamData.category));
     }
     
     // Play the music
@@ -265,114 +716,121 @@ AudioHandle AudioManager::PlayStream(const std::string& name, float volume, bool
         return INVALID_AUDIO_HANDLE;
     }
     
-    // Create handle and track playing audio
-    AudioHandle handle = GetNextHandle();
-    PlayingAudio playingAudio;
-    playingAudio.category = streamData.category;
-    playingAudio.volume = volume;
-    playingAudio.channel = -1; // Music doesn't use channels
-    playingAudio.isStream = true;
-    playingAudio.isPaused = false;
-    
-    m_playingAudio[handle] = playingAudio;
-    m_currentMusicHandle = handle;
+    Voice& voice = m_voices[index];
+    voice.active = true;
+    voice.isStream = true;
+    voice.isPaused = false;
+    voice.category = streamData.category;
+    voice.chunk = nullptr;
+    voice.music = streamData.music;
+    voice.volume = volume;
+    voice.attenuation = 1.0f;
+    voice.positional = false;
     
     // Set the volume
-    float finalVolume = CalculateFinalVolume(streamData.category, volume);
-    Mix_VolumeMusic(static_cast<int>(finalVolume * MIX_MAX_VOLUME));
+    ApplyVoiceVolume(index);
     
+    AudioHandle handle = MakeHandle(index);
     spdlog::debug("Playing stream '{}' with handle {}", name, handle);
     return handle;
 }
 
-void AudioManager::PauseAudio(AudioHandle handle) {
-    auto it = m_playingAudio.find(handle);
-    if (it == m_playingAudio.end()) return;
+void AudioManager::SetSoundPriority(const std::string& name, int priority) {
+    auto it = m_sounds.find(name);
+    if (it == m_sounds.end()) {
+        spdlog::warn("Sound '{}' not found", name);
+        return;
+    }
+    it->second.priority = std::max(priority, 0);
+}
+
+void AudioManager::SetCategoryVoiceLimit(AudioCategory category, int voices) {
+    m_categoryVoiceLimits[CategoryIndex(category)] = std::max(voices, 0);
+}
+
+void AudioManager::SetAudioPosition(AudioHandle handle, const glm::vec2& position) {
+    Voice* voice = FindVoice(handle);
+    if (!voice || !voice->positional) return;
+    
+    voice->position = position;
+    voice->attenuation = CalculateAttenuation(position, voice->minDistance, voice->maxDistance);
     
-    PlayingAudio& audio = it->second;
-    if (audio.isPaused) return;
+    const int index = handle & VOICE_INDEX_MASK;
+    ApplyVoiceVolume(index);
+    ApplyVoicePanning(index);
+}
+
+void AudioManager::PauseAudio(AudioHandle handle) {
+    Voice* voice = FindVoice(handle);
+    if (!voice || voice->isPaused) return;
     
-    if (audio.isStream) {
+    if (voice->isStream) {
         Mix_PauseMusic();
     } else {
-        Mix_Pause(audio.channel);
+        Mix_Pause(handle & VOICE_INDEX_MASK);
     }
     
-    audio.isPaused = true;
+    voice->isPaused = true;
 }
 
 void AudioManager::ResumeAudio(AudioHandle handle) {
-    auto it = m_playingAudio.find(handle);
-    if (it == m_playingAudio.end()) return;
-    
-    PlayingAudio& audio = it->second;
-    if (!audio.isPaused) return;
+    Voice* voice = FindVoice(handle);
+    if (!voice || !voice->isPaused) return;
     
-    if (audio.isStream) {
+    if (voice->isStream) {
         Mix_ResumeMusic();
     } else {
-        Mix_Resume(audio.channel);
+        Mix_Resume(handle & VOICE_INDEX_MASK);
     }
     
-    audio.isPaused = false;
+    voice->isPaused = false;
 }
 
 void AudioManager::StopAudio(AudioHandle handle) {
-    auto it = m_playingAudio.find(handle);
-    if (it == m_playingAudio.end()) return;
+    Voice* voice = FindVoice(handle);
+    if (!voice) return;
     
-    const PlayingAudio& audio = it->second;
-    
-    if (audio.isStream) {
+    const int index = handle & VOICE_INDEX_MASK;
+    if (voice->isStream) {
         Mix_HaltMusic();
-        if (m_currentMusicHandle == handle) {
-            m_currentMusicHandle = INVALID_AUDIO_HANDLE;
-        }
     } else {
-        Mix_HaltChannel(audio.channel);
+        Mix_HaltChannel(index);
     }
     
-    m_playingAudio.erase(it);
+    ReleaseVoice(index);
 }
 
 void AudioManager::SetAudioVolume(AudioHandle handle, float volume) {
-    auto it = m_playingAudio.find(handle);
-    if (it == m_playingAudio.end()) return;
+    Voice* voice = FindVoice(handle);
+    if (!voice) return;
     
-    PlayingAudio& audio = it->second;
-    audio.volume = volume;
-    
-    if (audio.isStream) {
-        float finalVolume = CalculateFinalVolume(audio.category, volume);
-        Mix_VolumeMusic(static_cast<int>(finalVolume * MIX_MAX_VOLUME));
-    } else {
-        UpdateChannelVolume(audio.channel, audio.category, volume);
-    }
+    voice->volume = volume;
+    ApplyVoiceVolume(handle & VOICE_INDEX_MASK);
 }
 
 bool AudioManager::IsAudioPlaying(AudioHandle handle) const {
-    auto it = m_playingAudio.find(handle);
-    if (it == m_playingAudio.end()) return false;
+    const Voice* voice = FindVoice(handle);
+    if (!voice) return false;
     
-    const PlayingAudio& audio = it->second;
-    
-    if (audio.isStream) {
+    if (voice->isStream) {
         return Mix_PlayingMusic() != 0;
     } else {
-        return Mix_Playing(audio.channel) != 0;
+        return Mix_Playing(handle & VOICE_INDEX_MASK) != 0;
     }
 }
 
 void AudioManager::SetMasterVolume(float volume) {
     m_masterVolume = std::clamp(volume, 0.0f, 1.0f);
     
+    if (m_mixer) {
+        m_mixer->SetMasterVolume(m_muted ? 0.0f : m_masterVolume);
+        return;
+    }
+    
     // Update all currently playing audio
-    for (auto& [handle, audio] : m_playingAudio) {
-        if (audio.isStream) {
-            float finalVolume = CalculateFinalVolume(audio.category, audio.volume);
-            Mix_VolumeMusic(static_cast<int>(finalVolume * MIX_MAX_VOLUME));
-        } else {
-            UpdateChannelVolume(audio.channel, audio.category, audio.volume);
+    for (int i = 0; i < static_cast<int>(m_voices.size()); ++i) {
+        if (m_voices[i].active) {
+            ApplyVoiceVolume(i);
         }
     }
 }
@@ -392,15 +850,15 @@ void AudioManager::SetCategoryVolume(AudioCategory category, float volume) {
             break;
     }
     
+    if (m_mixer) {
+        m_mixer->SetBusVolume(CategoryIndex(category), volume);
+        return;
+    }
+    
     // Update all currently playing audio of this category
-    for (auto& [handle, audio] : m_playingAudio) {
-        if (audio.category == category) {
-            if (audio.isStream) {
-                float finalVolume = CalculateFinalVolume(audio.category, audio.volume);
-                Mix_VolumeMusic(static_cast<int>(finalVolume * MIX_MAX_VOLUME));
-            } else {
-                UpdateChannelVolume(audio.channel, audio.category, audio.volume);
-            }
+    for (int i = 0; i < static_cast<int>(m_voices.size()); ++i) {
+        if (m_voices[i].active && m_voices[i].category == category) {
+            ApplyVoiceVolume(i);
         }
     }
 }
@@ -417,6 +875,11 @@ float AudioManager::GetCategoryVolume(AudioCategory category) const {
 void AudioManager::SetMuted(bool muted) {
     m_muted = muted;
     
+    if (m_mixer) {
+        m_mixer->SetMasterVolume(m_muted ? 0.0f : m_masterVolume);
+        return;
+    }
+    
     if (muted) {
         Mix_VolumeMusic(0);
         for (int i = 0; i < Mix_AllocateChannels(-1); ++i) {
@@ -424,12 +887,9 @@ void AudioManager::SetMuted(bool muted) {
         }
     } else {
         // Restore volumes
-        for (auto& [handle, audio] : m_playingAudio) {
-            if (audio.isStream) {
-                float finalVolume = CalculateFinalVolume(audio.category, audio.volume);
-                Mix_VolumeMusic(static_cast<int>(finalVolume * MIX_MAX_VOLUME));
-            } else {
-                UpdateChannelVolume(audio.channel, audio.category, audio.volume);
+        for (int i = 0; i < static_cast<int>(m_voices.size()); ++i) {
+            if (m_voices[i].active) {
+                ApplyVoiceVolume(i);
             }
         }
     }
@@ -439,8 +899,10 @@ void AudioManager::PauseAll() {
     Mix_PauseMusic();
     Mix_Pause(-1); // Pause all channels
     
-    for (auto& [handle, audio] : m_playingAudio) {
-        audio.isPaused = true;
+    for (auto& voice : m_voices) {
+        if (voice.active) {
+            voice.isPaused = true;
+        }
     }
 }
 
@@ -448,8 +910,8 @@ void AudioManager::ResumeAll() {
     Mix_ResumeMusic();
     Mix_Resume(-1); // Resume all channels
     
-    for (auto& [handle, audio] : m_playingAudio) {
-        audio.isPaused = false;
+    for (auto& voice : m_voices) {
+        voice.isPaused = false;
     }
 }
 
@@ -457,8 +919,27 @@ void AudioManager::StopAll() {
     Mix_HaltMusic();
     Mix_HaltChannel(-1); // Stop all channels
     
-    m_playingAudio.clear();
-    m_currentMusicHandle = INVALID_AUDIO_HANDLE;
+    for (int i = 0; i < static_cast<int>(m_voices.size()); ++i) {
+        ReleaseVoice(i);
+    }
+}
+
+void AudioManager::SetCategoryLowPass(AudioCategory category, float cutoffHz) {
+    if (m_mixer) {
+        m_mixer->SetBusLowPass(CategoryIndex(category), cutoffHz);
+    }
+}
+
+void AudioManager::SetDucking(const DuckingSettings& settings) {
+    if (m_mixer) {
+        m_mixer->SetDucking(settings);
+    }
+}
+
+void AudioManager::SetLimiterCeiling(float ceiling) {
+    if (m_mixer) {
+        m_mixer->SetLimiterCeiling(ceiling);
+    }
 }
 
 float AudioManager::CalculateFinalVolume(AudioCategory category, float soundVolume) const {
@@ -468,36 +949,178 @@ float AudioManager::CalculateFinalVolume(AudioCategory category, float soundVolu
     return m_masterVolume * categoryVolume * soundVolume;
 }
 
-void AudioManager::UpdateChannelVolume(int channel, AudioCategory category, float soundVolume) {
-    float finalVolume = CalculateFinalVolume(category, soundVolume);
-    Mix_Volume(channel, static_cast<int>(finalVolume * MIX_MAX_VOLUME));
+void AudioManager::ApplyVoiceVolume(int index) {
+    const Voice& voice = m_voices[index];
+    
+    // Category, master and mute are bus gains in the mixer stage
+    if (m_mixer) {
+        if (voice.isStream) {
+            Mix_VolumeMusic(static_cast<int>(std::clamp(voice.volume, 0.0f, 1.0f) * MIX_MAX_VOLUME));
+        } else {
+            const float gain = voice.volume * voice.attenuation;
+            const float pan = GetVoicePan(voice);
+            m_mixer->SetVoiceGain(index, {gain * std::min(1.0f, 1.0f - pan), gain * std::min(1.0f, 1.0f + pan)});
+        }
+        return;
+    }
+    
+    const float finalVolume = CalculateFinalVolume(voice.category, voice.volume) * voice.attenuation;
+    
+    if (voice.isStream) {
+        Mix_VolumeMusic(static_cast<int>(finalVolume * MIX_MAX_VOLUME));
+    } else {
+        Mix_Volume(index, static_cast<int>(finalVolume * MIX_MAX_VOLUME));
+    }
+}
+
+void AudioManager::ApplyVoicePanning(int index) {
+    if (m_mixer) return; // Part of the voice gain
+    
+    Voice& voice = m_voices[index];
+    if (!voice.positional) {
+        if (voice.panned) {
+            Mix_SetPanning(index, 255, 255); // Unregisters the effect
+            voice.panned = false;
+        }
+        return;
+    }
+    
+    const float pan = GetVoicePan(voice);
+    const auto left = static_cast<Uint8>(255.0f * std::min(1.0f, 1.0f - pan));
+    const auto right = static_cast<Uint8>(255.0f * std::min(1.0f, 1.0f + pan));
+    Mix_SetPanning(index, left, right);
+    voice.panned = true;
 }
 
-AudioHandle AudioManager::GetNextHandle() {
-    return m_nextHandle++;
+float AudioManager::GetVoicePan(const Voice& voice) const {
+    if (!voice.positional) return 0.0f;
+    
+    // Horizontal offset from the listener, full left/right at max distance
+    return std::clamp((voice.position.x - m_listenerPosition.x) / std::max(voice.maxDistance, 1.0f), -1.0f, 1.0f);
 }
 
-void AudioManager::CleanupFinishedSounds() {
-    auto it = m_playingAudio.begin();
-    while (it != m_playingAudio.end()) {
-        const PlayingAudio& audio = it->second;
-        
-        bool isFinished = false;
-        if (audio.isStream) {
-            isFinished = (Mix_PlayingMusic() == 0);
-            if (isFinished && m_currentMusicHandle == it->first) {
-                m_currentMusicHandle = INVALID_AUDIO_HANDLE;
+float AudioManager::CalculateAttenuation(const glm::vec2& position, float minDistance, float maxDistance) const {
+    // Linear falloff between min and max distance
+    const float distance = glm::length(position - m_listenerPosition);
+    if (distance <= minDistance) return 1.0f;
+    if (distance >= maxDistance) return 0.0f;
+    return 1.0f - (distance - minDistance) / (maxDistance - minDistance);
+}
+
+AudioManager::Voice* AudioManager::FindVoice(AudioHandle handle) {
+    return const_cast<Voice*>(static_cast<const AudioManager*>(this)->FindVoice(handle));
+}
+
+const AudioManager::Voice* AudioManager::FindVoice(AudioHandle handle) const {
+    if (handle < 0) return nullptr;
+    
+    const int index = handle & VOICE_INDEX_MASK;
+    if (index >= static_cast<int>(m_voices.size())) return nullptr;
+    
+    const Voice& voice = m_voices[index];
+    if (!voice.active || (voice.generation & GENERATION_MASK) != static_cast<uint32_t>(handle >> VOICE_INDEX_BITS)) {
+        return nullptr; // Finished, stopped or stolen since
+    }
+    return &voice;
+}
+
+AudioHandle AudioManager::MakeHandle(int index) const {
+    return static_cast<AudioHandle>(((m_voices[index].generation & GENERATION_MASK) << VOICE_INDEX_BITS) | static_cast<uint32_t>(index));
+}
+
+int AudioManager::AcquireVoice(AudioCategory category, int priority, float audibility) {
+    const int voiceCount = GetMusicVoice();
+    const int categoryIndex = CategoryIndex(category);
+    const int limit = m_categoryVoiceLimits[categoryIndex];
+    const bool atLimit = limit > 0 && m_categoryVoices[categoryIndex] >= limit;
+    
+    if (!atLimit) {
+        for (int i = 0; i < voiceCount; ++i) {
+            if (!m_voices[i].active) {
+                return i;
             }
-        } else {
-            isFinished = (Mix_Playing(audio.channel) == 0);
+        }
+    }
+    
+    // Voices that finished since the last Update() are free too
+    for (int i = 0; i < voiceCount; ++i) {
+        const Voice& voice = m_voices[i];
+        if (voice.active && (!atLimit || voice.category == category) && Mix_Playing(i) == 0) {
+            ReleaseVoice(i);
+            return i;
+        }
+    }
+    
+    // Steal the least important voice: lowest priority, then quietest
+    int victim = -1;
+    int victimPriority = 0;
+    float victimAudibility = 0.0f;
+    for (int i = 0; i < voiceCount; ++i) {
+        const Voice& voice = m_voices[i];
+        if (!voice.active || (atLimit && voice.category != category)) {
+            continue;
         }
         
-        if (isFinished) {
-            it = m_playingAudio.erase(it);
-        } else {
-            ++it;
+        const float voiceAudibility = voice.volume * voice.attenuation * GetCategoryVolume(voice.category);
+        if (victim < 0 || voice.priority < victimPriority ||
+            (voice.priority == victimPriority && voiceAudibility < victimAudibility)) {
+            victim = i;
+            victimPriority = voice.priority;
+            victimAudibility = voiceAudibility;
+        }
+    }
+    
+    if (victim < 0 || victimPriority > priority || (victimPriority == priority && victimAudibility > audibility)) {
+        return -1;
+    }
+    
+    Mix_HaltChannel(victim);
+    ReleaseVoice(victim);
+    m_voiceStats.stolen++;
+    return victim;
+}
+
+void AudioManager::ReleaseVoice(int index) {
+    Voice& voice = m_voices[index];
+    if (!voice.active) {
+        return;
+    }
+    
+    if (!voice.isStream) {
+        m_categoryVoices[CategoryIndex(voice.category)]--;
+    }
+    if (voice.panned) {
+        Mix_SetPanning(index, 255, 255);
+        voice.panned = false;
+    }
+    
+    // Invalidates every handle to this voice
+    voice.generation++;
+    voice.active = false;
+    voice.isPaused = false;
+    voice.chunk = nullptr;
+    voice.music = nullptr;
+}
+
+void AudioManager::CleanupFinishedSounds() {
+    if (m_voices.empty()) return;
+    
+    const int musicVoice = GetMusicVoice();
+    for (int i = 0; i < musicVoice; ++i) {
+        if (m_voices[i].active && Mix_Playing(i) == 0) {
+            ReleaseVoice(i);
         }
     }
+    
+    if (m_voices[musicVoice].active && Mix_PlayingMusic() == 0) {
+        ReleaseVoice(musicVoice);
+    }
+    
+    int active = 0;
+    for (const auto& voice : m_voices) {
+        active += voice.active ? 1 : 0;
+    }
+    m_voiceStats.active = active;
 }
 
-} // namespace audio
\ No newline at end of file
+} // namespace audio
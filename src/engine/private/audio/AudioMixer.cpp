@@ -0,0 +1,268 @@
+#include "engine/public/audio/AudioMixer.h"
+#include <SDL_mixer.h>
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace audio {
+
+namespace {
+
+// Bus indices match AudioCategory
+constexpr int SFX_BUS = 0;
+constexpr int MUSIC_BUS = 1;
+constexpr int AMBIENT_BUS = 2;
+
+// Limiter recovery after a peak has passed
+constexpr float LIMITER_RELEASE_MS = 100.0f;
+
+float SmoothingCoefficient(float blockSeconds, float timeMs) {
+    return std::exp(-blockSeconds * 1000.0f / std::max(timeMs, 0.1f));
+}
+
+} // anonymous namespace
+
+AudioMixer::AudioMixer() = default;
+
+AudioMixer::~AudioMixer() {
+    Shutdown();
+}
+
+bool AudioMixer::Initialize(int channels, int bufferFrames) {
+    if (m_initialized) return true;
+
+    int frequency = 0;
+    Uint16 format = 0;
+    int outputChannels = 0;
+    if (Mix_QuerySpec(&frequency, &format, &outputChannels) == 0) {
+        spdlog::warn("Audio mixer: audio device not open");
+        return false;
+    }
+
+    if (outputChannels != 2) {
+        spdlog::warn("Audio mixer: {} output channels not supported (stereo only)", outputChannels);
+        return false;
+    }
+
+    if (format == AUDIO_F32SYS) {
+        m_floatOutput = true;
+        m_bytesPerSample = sizeof(float);
+    } else if (format == AUDIO_S16SYS) {
+        m_floatOutput = false;
+        m_bytesPerSample = sizeof(int16_t);
+    } else {
+        spdlog::warn("Audio mixer: output format 0x{:04x} not supported", format);
+        return false;
+    }
+
+    // The device may round its buffer up - leave plenty of room, nothing grows on the audio thread
+    m_sampleRate = frequency;
+    m_capacityFrames = std::max<size_t>(static_cast<size_t>(std::max(bufferFrames, 0)) * 4, 8192);
+    for (auto& bus : m_buses) {
+        bus.buffer.assign(m_capacityFrames * 2, 0.0f);
+        bus.lowPassState[0] = bus.lowPassState[1] = 0.0f;
+    }
+    m_mix.assign(m_capacityFrames * 2, 0.0f);
+    m_scratch.assign(m_capacityFrames * 2, 0.0f);
+
+    m_channelCount = std::max(channels, 0);
+    m_channels = std::make_unique<Channel[]>(m_channelCount);
+
+    Mix_SetPostMix(&AudioMixer::PostMix, this);
+
+    m_initialized = true;
+    spdlog::info("Audio mixer: {} buses, {} voices, {} Hz {} output, {} kernels",
+                 BUS_COUNT, m_channelCount, m_sampleRate, m_floatOutput ? "float" : "16-bit",
+                 dsp::GetInstructionSet());
+    return true;
+}
+
+void AudioMixer::Shutdown() {
+    if (!m_initialized) return;
+
+    Mix_SetPostMix(nullptr, nullptr);
+    for (int i = 0; i < m_channelCount; ++i) {
+        Mix_UnregisterEffect(i, &AudioMixer::ChannelEffect);
+    }
+
+    m_channels.reset();
+    m_channelCount = 0;
+    m_initialized = false;
+}
+
+void AudioMixer::StartVoice(int channel, int bus, dsp::StereoGain gain) {
+    if (!m_initialized || channel < 0 || channel >= m_channelCount) return;
+
+    // The channel is not playing, so the audio thread is not touching its state
+    Channel& state = m_channels[channel];
+    state.bus.store(std::clamp(bus, 0, BUS_COUNT - 1), std::memory_order_relaxed);
+    state.gainLeft.store(gain.left, std::memory_order_relaxed);
+    state.gainRight.store(gain.right, std::memory_order_relaxed);
+    state.applied = gain;
+
+    // Never register twice (a voice reused before SDL_mixer removed the old effect)
+    Mix_UnregisterEffect(channel, &AudioMixer::ChannelEffect);
+    if (Mix_RegisterEffect(channel, &AudioMixer::ChannelEffect, nullptr, this) == 0) {
+        spdlog::warn("Audio mixer: failed to register effect on channel {}: {}", channel, Mix_GetError());
+    }
+}
+
+void AudioMixer::SetVoiceGain(int channel, dsp::StereoGain gain) {
+    if (!m_initialized || channel < 0 || channel >= m_channelCount) return;
+
+    m_channels[channel].gainLeft.store(gain.left, std::memory_order_relaxed);
+    m_channels[channel].gainRight.store(gain.right, std::memory_order_relaxed);
+}
+
+void AudioMixer::SetMusicBus(int bus) {
+    m_musicBus.store(std::clamp(bus, 0, BUS_COUNT - 1), std::memory_order_relaxed);
+}
+
+void AudioMixer::SetBusVolume(int bus, float volume) {
+    if (bus < 0 || bus >= BUS_COUNT) return;
+    m_buses[bus].volume.store(std::clamp(volume, 0.0f, 1.0f), std::memory_order_relaxed);
+}
+
+void AudioMixer::SetBusLowPass(int bus, float cutoffHz) {
+    if (bus < 0 || bus >= BUS_COUNT) return;
+    m_buses[bus].lowPassCutoff.store(std::max(cutoffHz, 0.0f), std::memory_order_relaxed);
+}
+
+void AudioMixer::SetMasterVolume(float volume) {
+    m_masterVolume.store(std::clamp(volume, 0.0f, 1.0f), std::memory_order_relaxed);
+}
+
+void AudioMixer::SetDucking(const DuckingSettings& settings) {
+    m_duckAmount.store(std::clamp(settings.amount, 0.0f, 1.0f), std::memory_order_relaxed);
+    m_duckThreshold.store(std::max(settings.threshold, 0.0f), std::memory_order_relaxed);
+    m_duckAttackMs.store(std::max(settings.attackMs, 0.0f), std::memory_order_relaxed);
+    m_duckReleaseMs.store(std::max(settings.releaseMs, 0.0f), std::memory_order_relaxed);
+    m_duckingEnabled.store(settings.enabled, std::memory_order_relaxed);
+}
+
+void AudioMixer::SetLimiterCeiling(float ceiling) {
+    m_limiterCeiling.store(std::clamp(ceiling, 0.0f, 1.0f), std::memory_order_relaxed);
+}
+
+float AudioMixer::GetBusPeak(int bus) const {
+    if (bus < 0 || bus >= BUS_COUNT) return 0.0f;
+    return m_buses[bus].peak.load(std::memory_order_relaxed);
+}
+
+void AudioMixer::ChannelEffect(int channel, void* stream, int len, void* udata) {
+    static_cast<AudioMixer*>(udata)->ProcessChannel(channel, stream, len);
+}
+
+void AudioMixer::PostMix(void* udata, unsigned char* stream, int len) {
+    static_cast<AudioMixer*>(udata)->ProcessMix(stream, len);
+}
+
+const float* AudioMixer::ToFloat(const void* stream, size_t samples) {
+    if (m_floatOutput) {
+        return static_cast<const float*>(stream);
+    }
+    dsp::S16ToFloat(static_cast<const int16_t*>(stream), m_scratch.data(), samples);
+    return m_scratch.data();
+}
+
+void AudioMixer::ProcessChannel(int channel, void* stream, int bytes) {
+    if (channel < 0 || channel >= m_channelCount || bytes <= 0) return;
+
+    Channel& state = m_channels[channel];
+    Bus& bus = m_buses[state.bus.load(std::memory_order_relaxed)];
+
+    // A channel can be mixed in several pieces per buffer (loops), so append
+    const size_t frames = std::min(static_cast<size_t>(bytes) / (m_bytesPerSample * 2),
+                                   m_capacityFrames - std::min(state.offset, m_capacityFrames));
+    const dsp::StereoGain target{state.gainLeft.load(std::memory_order_relaxed),
+                                 state.gainRight.load(std::memory_order_relaxed)};
+
+    dsp::MixStereo(bus.buffer.data() + state.offset * 2, ToFloat(stream, frames * 2), frames, state.applied, target);
+    state.applied = target;
+    state.offset += frames;
+
+    // SDL_mixer adds this to the output - the bus carries the sound now
+    std::memset(stream, 0, static_cast<size_t>(bytes));
+}
+
+void AudioMixer::ProcessMix(unsigned char* stream, int bytes) {
+    if (bytes <= 0) return;
+
+    const size_t frames = std::min(static_cast<size_t>(bytes) / (m_bytesPerSample * 2), m_capacityFrames);
+    const size_t samples = frames * 2;
+    const float blockSeconds = static_cast<float>(frames) / static_cast<float>(m_sampleRate);
+
+    // Channel output was silenced, so what SDL_mixer produced is the music stream
+    const dsp::StereoGain unity;
+    dsp::MixStereo(m_buses[m_musicBus.load(std::memory_order_relaxed)].buffer.data(), ToFloat(stream, samples), frames, unity, unity);
+
+    // Bus effects and meters
+    for (auto& bus : m_buses) {
+        const float coefficient = dsp::LowPassCoefficient(bus.lowPassCutoff.load(std::memory_order_relaxed), m_sampleRate);
+        if (coefficient < 1.0f) {
+            dsp::LowPass(bus.buffer.data(), frames, coefficient, bus.lowPassState);
+        }
+        bus.peak.store(dsp::Peak(bus.buffer.data(), samples), std::memory_order_relaxed);
+    }
+
+    // Ducking follows the audible SFX level
+    const float sidechain = m_buses[SFX_BUS].peak.load(std::memory_order_relaxed) *
+                            m_buses[SFX_BUS].volume.load(std::memory_order_relaxed);
+    const bool ducking = m_duckingEnabled.load(std::memory_order_relaxed) &&
+                         sidechain > m_duckThreshold.load(std::memory_order_relaxed);
+    const float duckTarget = ducking ? m_duckAmount.load(std::memory_order_relaxed) : 1.0f;
+    const float duckTime = duckTarget < m_duckGain ? m_duckAttackMs.load(std::memory_order_relaxed)
+                                                   : m_duckReleaseMs.load(std::memory_order_relaxed);
+    m_duckGain = duckTarget + (m_duckGain - duckTarget) * SmoothingCoefficient(blockSeconds, duckTime);
+    m_duckGainMeter.store(m_duckGain, std::memory_order_relaxed);
+
+    // Sum the buses
+    std::fill(m_mix.begin(), m_mix.begin() + samples, 0.0f);
+    for (int i = 0; i < BUS_COUNT; ++i) {
+        Bus& bus = m_buses[i];
+        float gain = bus.volume.load(std::memory_order_relaxed);
+        if (i == MUSIC_BUS || i == AMBIENT_BUS) {
+            gain *= m_duckGain;
+        }
+
+        dsp::MixStereo(m_mix.data(), bus.buffer.data(), frames, {bus.appliedGain, bus.appliedGain}, {gain, gain});
+        bus.appliedGain = gain;
+        std::fill(bus.buffer.begin(), bus.buffer.begin() + samples, 0.0f);
+    }
+
+    const float master = m_masterVolume.load(std::memory_order_relaxed);
+    if (master != 1.0f || m_appliedMaster != 1.0f) {
+        dsp::ApplyGain(m_mix.data(), samples, m_appliedMaster, master);
+        m_appliedMaster = master;
+    }
+
+    // Peak limiter: instant attack (no overs), smooth release
+    const float ceiling = m_limiterCeiling.load(std::memory_order_relaxed);
+    if (ceiling > 0.0f) {
+        const float peak = dsp::Peak(m_mix.data(), samples);
+        const float needed = peak > ceiling ? ceiling / peak : 1.0f;
+        const float released = 1.0f + (m_limiterGain - 1.0f) * SmoothingCoefficient(blockSeconds, LIMITER_RELEASE_MS);
+
+        if (needed < released) {
+            dsp::ApplyGain(m_mix.data(), samples, needed, needed);
+            m_limiterGain = needed;
+        } else if (m_limiterGain < 1.0f) {
+            dsp::ApplyGain(m_mix.data(), samples, m_limiterGain, released);
+            m_limiterGain = released > 0.9999f ? 1.0f : released;
+        }
+    }
+
+    if (m_floatOutput) {
+        dsp::Clamp(m_mix.data(), samples, 1.0f);
+        std::memcpy(stream, m_mix.data(), samples * sizeof(float));
+    } else {
+        dsp::FloatToS16(m_mix.data(), reinterpret_cast<int16_t*>(stream), samples);
+    }
+
+    for (int i = 0; i < m_channelCount; ++i) {
+        m_channels[i].offset = 0;
+    }
+}
+
+} // namespace audio
@@ -0,0 +1,233 @@
+#include "engine/public/audio/DSP.h"
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define ENGINE_DSP_SSE2 1
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define ENGINE_DSP_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace audio {
+namespace dsp {
+
+namespace {
+
+constexpr float S16_TO_FLOAT = 1.0f / 32768.0f;
+constexpr float FLOAT_TO_S16 = 32767.0f;
+constexpr float DENORMAL_THRESHOLD = 1.0e-15f;
+
+} // anonymous namespace
+
+const char* GetInstructionSet() {
+#if defined(ENGINE_DSP_SSE2)
+    return "SSE2";
+#elif defined(ENGINE_DSP_NEON)
+    return "NEON";
+#else
+    return "scalar";
+#endif
+}
+
+void MixStereo(float* dst, const float* src, size_t frames, StereoGain from, StereoGain to) {
+    if (frames == 0) return;
+
+    const float stepLeft = (to.left - from.left) / static_cast<float>(frames);
+    const float stepRight = (to.right - from.right) / static_cast<float>(frames);
+    size_t frame = 0;
+
+    // Two frames per vector: gain = [L0, R0, L1, R1]
+#if defined(ENGINE_DSP_SSE2)
+    __m128 gain = _mm_setr_ps(from.left, from.right, from.left + stepLeft, from.right + stepRight);
+    const __m128 step = _mm_setr_ps(2.0f * stepLeft, 2.0f * stepRight, 2.0f * stepLeft, 2.0f * stepRight);
+    for (; frame + 2 <= frames; frame += 2) {
+        const __m128 in = _mm_loadu_ps(src + frame * 2);
+        const __m128 out = _mm_loadu_ps(dst + frame * 2);
+        _mm_storeu_ps(dst + frame * 2, _mm_add_ps(out, _mm_mul_ps(in, gain)));
+        gain = _mm_add_ps(gain, step);
+    }
+#elif defined(ENGINE_DSP_NEON)
+    const float gainInit[4] = {from.left, from.right, from.left + stepLeft, from.right + stepRight};
+    const float stepInit[4] = {2.0f * stepLeft, 2.0f * stepRight, 2.0f * stepLeft, 2.0f * stepRight};
+    float32x4_t gain = vld1q_f32(gainInit);
+    const float32x4_t step = vld1q_f32(stepInit);
+    for (; frame + 2 <= frames; frame += 2) {
+        const float32x4_t in = vld1q_f32(src + frame * 2);
+        const float32x4_t out = vld1q_f32(dst + frame * 2);
+        vst1q_f32(dst + frame * 2, vmlaq_f32(out, in, gain));
+        gain = vaddq_f32(gain, step);
+    }
+#endif
+
+    for (; frame < frames; ++frame) {
+        const float t = static_cast<float>(frame);
+        dst[frame * 2] += src[frame * 2] * (from.left + stepLeft * t);
+        dst[frame * 2 + 1] += src[frame * 2 + 1] * (from.right + stepRight * t);
+    }
+}
+
+void ApplyGain(float* buffer, size_t count, float from, float to) {
+    if (count == 0) return;
+
+    const float step = (to - from) / static_cast<float>(count);
+    size_t i = 0;
+
+#if defined(ENGINE_DSP_SSE2)
+    __m128 gain = _mm_setr_ps(from, from + step, from + 2.0f * step, from + 3.0f * step);
+    const __m128 stepVec = _mm_set1_ps(4.0f * step);
+    for (; i + 4 <= count; i += 4) {
+        _mm_storeu_ps(buffer + i, _mm_mul_ps(_mm_loadu_ps(buffer + i), gain));
+        gain = _mm_add_ps(gain, stepVec);
+    }
+#elif defined(ENGINE_DSP_NEON)
+    const float gainInit[4] = {from, from + step, from + 2.0f * step, from + 3.0f * step};
+    float32x4_t gain = vld1q_f32(gainInit);
+    const float32x4_t stepVec = vdupq_n_f32(4.0f * step);
+    for (; i + 4 <= count; i += 4) {
+        vst1q_f32(buffer + i, vmulq_f32(vld1q_f32(buffer + i), gain));
+        gain = vaddq_f32(gain, stepVec);
+    }
+#endif
+
+    for (; i < count; ++i) {
+        buffer[i] *= from + step * static_cast<float>(i);
+    }
+}
+
+float Peak(const float* buffer, size_t count) {
+    float peak = 0.0f;
+    size_t i = 0;
+
+#if defined(ENGINE_DSP_SSE2)
+    const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+    __m128 peakVec = _mm_setzero_ps();
+    for (; i + 4 <= count; i += 4) {
+        peakVec = _mm_max_ps(peakVec, _mm_and_ps(_mm_loadu_ps(buffer + i), absMask));
+    }
+    peakVec = _mm_max_ps(peakVec, _mm_shuffle_ps(peakVec, peakVec, _MM_SHUFFLE(1, 0, 3, 2)));
+    peakVec = _mm_max_ps(peakVec, _mm_shuffle_ps(peakVec, peakVec, _MM_SHUFFLE(2, 3, 0, 1)));
+    peak = _mm_cvtss_f32(peakVec);
+#elif defined(ENGINE_DSP_NEON)
+    float32x4_t peakVec = vdupq_n_f32(0.0f);
+    for (; i + 4 <= count; i += 4) {
+        peakVec = vmaxq_f32(peakVec, vabsq_f32(vld1q_f32(buffer + i)));
+    }
+    float32x2_t half = vpmax_f32(vget_low_f32(peakVec), vget_high_f32(peakVec));
+    half = vpmax_f32(half, half);
+    peak = vget_lane_f32(half, 0);
+#endif
+
+    for (; i < count; ++i) {
+        peak = std::max(peak, std::fabs(buffer[i]));
+    }
+    return peak;
+}
+
+void Clamp(float* buffer, size_t count, float limit) {
+    size_t i = 0;
+
+#if defined(ENGINE_DSP_SSE2)
+    const __m128 high = _mm_set1_ps(limit);
+    const __m128 low = _mm_set1_ps(-limit);
+    for (; i + 4 <= count; i += 4) {
+        _mm_storeu_ps(buffer + i, _mm_max_ps(low, _mm_min_ps(high, _mm_loadu_ps(buffer + i))));
+    }
+#elif defined(ENGINE_DSP_NEON)
+    const float32x4_t high = vdupq_n_f32(limit);
+    const float32x4_t low = vdupq_n_f32(-limit);
+    for (; i + 4 <= count; i += 4) {
+        vst1q_f32(buffer + i, vmaxq_f32(low, vminq_f32(high, vld1q_f32(buffer + i))));
+    }
+#endif
+
+    for (; i < count; ++i) {
+        buffer[i] = std::clamp(buffer[i], -limit, limit);
+    }
+}
+
+void LowPass(float* buffer, size_t frames, float coefficient, float state[2]) {
+    // Recursive filter - each output depends on the previous one, so stays scalar
+    float left = state[0];
+    float right = state[1];
+    for (size_t frame = 0; frame < frames; ++frame) {
+        left += coefficient * (buffer[frame * 2] - left);
+        right += coefficient * (buffer[frame * 2 + 1] - right);
+        buffer[frame * 2] = left;
+        buffer[frame * 2 + 1] = right;
+    }
+
+    // Keep a decaying tail from turning into denormals after the input goes silent
+    state[0] = std::fabs(left) < DENORMAL_THRESHOLD ? 0.0f : left;
+    state[1] = std::fabs(right) < DENORMAL_THRESHOLD ? 0.0f : right;
+}
+
+float LowPassCoefficient(float cutoffHz, int sampleRate) {
+    if (cutoffHz <= 0.0f || sampleRate <= 0 || cutoffHz >= 0.5f * static_cast<float>(sampleRate)) {
+        return 1.0f; // Pass through
+    }
+    constexpr float TWO_PI = 6.28318530718f;
+    return 1.0f - std::exp(-TWO_PI * cutoffHz / static_cast<float>(sampleRate));
+}
+
+void S16ToFloat(const int16_t* src, float* dst, size_t count) {
+    size_t i = 0;
+
+#if defined(ENGINE_DSP_SSE2)
+    const __m128 scale = _mm_set1_ps(S16_TO_FLOAT);
+    for (; i + 8 <= count; i += 8) {
+        const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        // Sign extend by unpacking into the high half and shifting back down
+        const __m128i low = _mm_srai_epi32(_mm_unpacklo_epi16(in, in), 16);
+        const __m128i high = _mm_srai_epi32(_mm_unpackhi_epi16(in, in), 16);
+        _mm_storeu_ps(dst + i, _mm_mul_ps(_mm_cvtepi32_ps(low), scale));
+        _mm_storeu_ps(dst + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(high), scale));
+    }
+#elif defined(ENGINE_DSP_NEON)
+    const float32x4_t scale = vdupq_n_f32(S16_TO_FLOAT);
+    for (; i + 8 <= count; i += 8) {
+        const int16x8_t in = vld1q_s16(src + i);
+        vst1q_f32(dst + i, vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(in))), scale));
+        vst1q_f32(dst + i + 4, vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(in))), scale));
+    }
+#endif
+
+    for (; i < count; ++i) {
+        dst[i] = static_cast<float>(src[i]) * S16_TO_FLOAT;
+    }
+}
+
+void FloatToS16(const float* src, int16_t* dst, size_t count) {
+    size_t i = 0;
+
+#if defined(ENGINE_DSP_SSE2)
+    const __m128 scale = _mm_set1_ps(FLOAT_TO_S16);
+    const __m128 high = _mm_set1_ps(1.0f);
+    const __m128 low = _mm_set1_ps(-1.0f);
+    for (; i + 8 <= count; i += 8) {
+        // Clamp first: out of range conversions return INT_MIN for either sign
+        const __m128 a = _mm_max_ps(low, _mm_min_ps(high, _mm_loadu_ps(src + i)));
+        const __m128 b = _mm_max_ps(low, _mm_min_ps(high, _mm_loadu_ps(src + i + 4)));
+        const __m128i packed = _mm_packs_epi32(_mm_cvtps_epi32(_mm_mul_ps(a, scale)),
+                                               _mm_cvtps_epi32(_mm_mul_ps(b, scale)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), packed);
+    }
+#elif defined(ENGINE_DSP_NEON)
+    const float32x4_t scale = vdupq_n_f32(FLOAT_TO_S16);
+    for (; i + 8 <= count; i += 8) {
+        // Float to int conversion saturates on NEON, narrowing saturates again
+        const int32x4_t a = vcvtq_s32_f32(vmulq_f32(vld1q_f32(src + i), scale));
+        const int32x4_t b = vcvtq_s32_f32(vmulq_f32(vld1q_f32(src + i + 4), scale));
+        vst1q_s16(dst + i, vcombine_s16(vqmovn_s32(a), vqmovn_s32(b)));
+    }
+#endif
+
+    for (; i < count; ++i) {
+        const float sample = std::clamp(src[i], -1.0f, 1.0f) * FLOAT_TO_S16;
+        dst[i] = static_cast<int16_t>(sample >= 0.0f ? sample + 0.5f : sample - 0.5f);
+    }
+}
+
+} // namespace dsp
+} // namespace audio
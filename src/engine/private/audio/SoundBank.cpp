@@ -0,0 +1,213 @@
+#include "engine/public/audio/SoundBank.h"
+#include <spdlog/spdlog.h>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+namespace audio {
+
+namespace {
+
+constexpr char BANK_MAGIC[4] = {'S', 'B', 'N', 'K'};
+constexpr uint32_t BANK_VERSION = 1;
+constexpr uint64_t DATA_ALIGNMENT = 16;
+
+struct BankHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t frequency;
+    uint16_t format;
+    uint16_t channels;
+    uint32_t soundCount;
+    uint32_t namesSize;
+    uint64_t fileSize;
+};
+static_assert(sizeof(BankHeader) == 32, "Sound bank header layout");
+
+struct BankEntry {
+    uint64_t dataOffset;
+    uint32_t dataSize;
+    uint32_t nameOffset;   // Into the names block
+    uint16_t nameLength;
+    uint8_t category;
+    uint8_t reserved0;
+    int32_t priority;
+    uint32_t reserved1[2];
+};
+static_assert(sizeof(BankEntry) == 32, "Sound bank entry layout");
+
+uint64_t AlignUp(uint64_t value) {
+    return (value + DATA_ALIGNMENT - 1) & ~(DATA_ALIGNMENT - 1);
+}
+
+} // anonymous namespace
+
+bool SoundBank::Open(const std::string& path) {
+    Close();
+
+    if (!m_file.Open(path)) {
+        return false;
+    }
+
+    m_data = m_file.GetData();
+    m_size = m_file.GetSize();
+    return Parse(path);
+}
+
+bool SoundBank::Open(const utils::AssetView& packed, const std::string& path) {
+    Close();
+
+    if (!packed) {
+        spdlog::error("Sound bank not in the asset archive: {}", path);
+        return false;
+    }
+
+    m_data = packed.data;
+    m_size = packed.size;
+    return Parse(path);
+}
+
+bool SoundBank::Parse(const std::string& path) {
+    const uint8_t* data = m_data;
+    const size_t size = m_size;
+
+    BankHeader header;
+    if (!data || size < sizeof(header)) {
+        spdlog::error("Sound bank too small: {}", path);
+        Close();
+        return false;
+    }
+    std::memcpy(&header, data, sizeof(header));
+
+    if (std::memcmp(header.magic, BANK_MAGIC, sizeof(BANK_MAGIC)) != 0 || header.version != BANK_VERSION) {
+        spdlog::error("Not a sound bank (or an unsupported version): {}", path);
+        Close();
+        return false;
+    }
+
+    const uint64_t tableSize = static_cast<uint64_t>(header.soundCount) * sizeof(BankEntry);
+    const uint64_t namesOffset = sizeof(BankHeader) + tableSize;
+    if (header.fileSize != size || namesOffset + header.namesSize > size) {
+        spdlog::error("Sound bank is truncated or corrupt: {}", path);
+        Close();
+        return false;
+    }
+
+    m_format.frequency = static_cast<int>(header.frequency);
+    m_format.format = header.format;
+    m_format.channels = header.channels;
+
+    const char* names = reinterpret_cast<const char*>(data + namesOffset);
+    m_sounds.reserve(header.soundCount);
+    for (uint32_t i = 0; i < header.soundCount; ++i) {
+        BankEntry entry;
+        std::memcpy(&entry, data + sizeof(BankHeader) + static_cast<size_t>(i) * sizeof(BankEntry), sizeof(entry));
+
+        // Checked as integers - forming an out-of-range pointer first would already be undefined
+        if (static_cast<uint64_t>(entry.nameOffset) + entry.nameLength > header.namesSize ||
+            entry.dataOffset > size || entry.dataSize > size - entry.dataOffset) {
+            spdlog::error("Sound bank entry {} is out of range: {}", i, path);
+            Close();
+            return false;
+        }
+
+        SoundBankSound sound;
+        sound.name.assign(names + entry.nameOffset, entry.nameLength);
+        sound.category = entry.category;
+        sound.priority = entry.priority;
+        sound.data = data + entry.dataOffset;
+        sound.size = entry.dataSize;
+        m_sounds.push_back(std::move(sound));
+    }
+
+    return true;
+}
+
+void SoundBank::Close() {
+    m_sounds.clear();
+    m_format = SoundBankFormat{};
+    m_data = nullptr;
+    m_size = 0;
+    m_file.Close();
+}
+
+bool SoundBank::Write(const std::string& path, const SoundBankFormat& format, const std::vector<SoundBankSound>& sounds) {
+    // Lay out names and data first so the table can be written in one pass
+    std::string names;
+    std::vector<BankEntry> entries(sounds.size());
+    for (size_t i = 0; i < sounds.size(); ++i) {
+        if (sounds[i].name.size() > UINT16_MAX) {
+            spdlog::error("Sound name too long for a bank: {}", sounds[i].name);
+            return false;
+        }
+        entries[i] = BankEntry{};
+        entries[i].nameOffset = static_cast<uint32_t>(names.size());
+        entries[i].nameLength = static_cast<uint16_t>(sounds[i].name.size());
+        entries[i].category = static_cast<uint8_t>(sounds[i].category);
+        entries[i].priority = sounds[i].priority;
+        entries[i].dataSize = sounds[i].size;
+        names += sounds[i].name;
+    }
+
+    uint64_t offset = AlignUp(sizeof(BankHeader) + entries.size() * sizeof(BankEntry) + names.size());
+    for (auto& entry : entries) {
+        entry.dataOffset = offset;
+        offset = AlignUp(offset + entry.dataSize);
+    }
+
+    BankHeader header{};
+    std::memcpy(header.magic, BANK_MAGIC, sizeof(BANK_MAGIC));
+    header.version = BANK_VERSION;
+    header.frequency = static_cast<uint32_t>(format.frequency);
+    header.format = format.format;
+    header.channels = static_cast<uint16_t>(format.channels);
+    header.soundCount = static_cast<uint32_t>(entries.size());
+    header.namesSize = static_cast<uint32_t>(names.size());
+    header.fileSize = offset;
+
+    const std::string tempPath = path + ".tmp";
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            spdlog::error("Failed to open file for writing: {}", tempPath);
+            return false;
+        }
+
+        static const char padding[DATA_ALIGNMENT] = {};
+        auto padTo = [&file](uint64_t position) {
+            const uint64_t current = static_cast<uint64_t>(file.tellp());
+            if (position > current) {
+                file.write(padding, static_cast<std::streamsize>(position - current));
+            }
+        };
+
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(entries.data()), static_cast<std::streamsize>(entries.size() * sizeof(BankEntry)));
+        file.write(names.data(), static_cast<std::streamsize>(names.size()));
+        for (size_t i = 0; i < sounds.size(); ++i) {
+            padTo(entries[i].dataOffset);
+            file.write(reinterpret_cast<const char*>(sounds[i].data), sounds[i].size);
+        }
+        padTo(header.fileSize);
+
+        file.flush();
+        if (!file) {
+            spdlog::error("Failed to write sound bank: {}", tempPath);
+            file.close();
+            std::error_code ec;
+            std::filesystem::remove(tempPath, ec);
+            return false;
+        }
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(tempPath, path, ec);
+    if (ec) {
+        spdlog::error("Failed to replace sound bank '{}': {}", path, ec.message());
+        std::filesystem::remove(tempPath, ec);
+        return false;
+    }
+    return true;
+}
+
+} // namespace audio
@@ -1,19 +1,34 @@
 #include "engine/public/core/Engine.h"
+#include "engine/public/core/FrameArena.h"
+#include "engine/public/core/FramePacer.h"
 #include "engine/public/core/IGameApplication.h"
+#include "engine/public/core/InitGraph.h"
+#include "engine/public/core/JobSystem.h"
 #include "engine/public/audio/AudioManager.h"
+#include "engine/public/debug/Profiler.h"
+#include "engine/public/debug/ProfilerOverlay.h"
+#include "engine/public/ecs/Registry.h"
+#include "engine/public/ecs/StaticSpriteIndex.h"
+#include "engine/public/ecs/Systems.h"
 #include "engine/public/input/Input.h"
+#include "engine/public/particles/ParticleSystem.h"
 #include "engine/public/physics/Physics.h"
 #include "engine/public/rendering/Renderer.h"
 #include "engine/public/rendering/Window.h"
 #include "engine/public/save/SaveManager.h"
 #include "engine/public/text/FontManager.h"
 #include "engine/public/text/TextRenderer.h"
+#include "engine/public/utils/Assets.h"
 #include "engine/public/utils/Config.h"
+#include "engine/public/utils/HotReloader.h"
 #include "engine/public/utils/Logger.h"
 #include "engine/public/utils/ResourceManager.h"
+#include "engine/public/world/WorldStreamer.h"
 
 #include <SDL.h>
 #include <spdlog/spdlog.h>
+#include <algorithm>
+#include <filesystem>
 #include <memory>
 #include <cassert>
 
@@ -21,7 +36,7 @@ namespace core {
 
 Engine* Engine::s_instance = nullptr;
 
-bool Engine::Initialize() {
+bool Engine::Initialize(const EngineOptions& options) {
     if (s_instance) {
         spdlog::warn("Engine already initialized");
         return true;
@@ -30,6 +45,7 @@ bool Engine::Initialize() {
     spdlog::info("Initializing Engine...");
     
     s_instance = new Engine();
+    s_instance->m_options = options;
     
     // Initialize SDL first
     if (SDL_Init(SDL_INIT_VIDEO | SDL_INIT_AUDIO) != 0) {
@@ -46,126 +62,217 @@ bool Engine::Initialize() {
         spdlog::warn("Failed to load config, using defaults");
     }
     
-    // Initialize ResourceManager
-    s_instance->m_resourceManager = std::make_unique<utils::ResourceManager>();
-    if (!s_instance->m_resourceManager->Initialize()) {
-        spdlog::error("Failed to initialize ResourceManager");
-        return false;
-    }
-    
-    // Initialize audio manager
-    s_instance->m_audioManager = std::make_unique<audio::AudioManager>();
-    if (!s_instance->m_audioManager->Initialize()) {
-        spdlog::warn("Failed to initialize audio manager - continuing without audio");
+    // Mount the asset archive when there is one (loose files otherwise)
+    const std::string archivePath = configPtr->GetString("resources.archive", "assets.pak");
+    if (!archivePath.empty() && std::filesystem::exists(archivePath)) {
+        if (!utils::MountAssetArchive(archivePath)) {
+            spdlog::warn("Failed to mount asset archive '{}', using loose files", archivePath);
+        }
     }
     
-    // Initialize input system
-    s_instance->m_input = std::make_unique<input::Input>();
+    // Per-frame scratch memory (grows by itself if a frame needs more)
+    s_instance->m_frameArena = std::make_unique<FrameArena>(
+        static_cast<size_t>(std::max(configPtr->GetInt("memory.frame_arena_kb", 1024), 1)) * 1024);
     
-    // Initialize physics system
-    s_instance->m_physics = std::make_unique<physics::Physics>();
-    if (!s_instance->m_physics->Initialize()) {
-        spdlog::error("Failed to initialize physics");
+    // Initialize job system (first, so every other system can use it)
+    s_instance->m_jobSystem = std::make_unique<JobSystem>();
+    if (!s_instance->m_jobSystem->Initialize(configPtr->GetInt("jobs.worker_threads", 0))) {
+        spdlog::error("Failed to initialize job system");
         return false;
     }
     
-    // Create window
-    s_instance->m_window = std::make_unique<rendering::Window>();
-    
-    // Get window settings from config
     auto& config = *utils::Config::Instance();
-    int width = config.GetInt("window.width", 1280);
-    int height = config.GetInt("window.height", 720);
-    std::string title = config.GetString("window.title", "SDL2 Game");
     
-    spdlog::info("Creating window: {}x{} titled '{}'", width, height, title);
-    
-    if (!s_instance->m_window->Initialize(title, width, height)) {
-        spdlog::error("Failed to initialize window");
-        return false;
-    }
+    // Fixed timestep from configuration
+    s_instance->m_fixedTimestep = config.GetFloat("physics.fixed_timestep", 1.0f / 60.0f);
+    s_instance->m_maxFixedSteps = config.GetInt("physics.max_fixed_steps", 5);
+    s_instance->m_interpolationEnabled = config.GetBool("physics.interpolation", true);
+    s_instance->m_maxDeltaTime = config.GetFloat("game.max_delta_time", 0.05f);
+    
+    // Subsystems as a dependency graph: independent steps (audio device, font files, save directory,
+    // Box2D world) run on the job system while the window and GL context come up on this thread.
+    // Worker steps may only read config - anything that writes it or subscribes runs on the main thread.
+    InitGraph graph;
+    
+    graph.Add("resources", {}, [] {
+        s_instance->m_resourceManager = std::make_unique<utils::ResourceManager>();
+        if (!s_instance->m_resourceManager->Initialize()) {
+            spdlog::error("Failed to initialize ResourceManager");
+            return false;
+        }
+        return true;
+    });
     
-    // Initialize renderer (requires window)
-    s_instance->m_renderer = std::make_unique<rendering::Renderer>();
-    if (!s_instance->m_renderer->Initialize(s_instance->m_window.get())) {
-        spdlog::error("Failed to initialize renderer");
-        return false;
-    }
+    graph.Add("audio", {}, [] {
+        s_instance->m_audioManager = std::make_unique<audio::AudioManager>();
+        if (!s_instance->m_audioManager->Initialize()) {
+            spdlog::warn("Failed to initialize audio manager - continuing without audio");
+        }
+        return true;
+    });
     
-    // Initialize text systems
-    s_instance->m_fontManager = std::make_unique<text::FontManager>();
-    if (!s_instance->m_fontManager->Initialize()) {
-        spdlog::warn("Failed to initialize font manager - continuing without text rendering");
-    }
+    // Load audio settings from config, and follow later changes (e.g. an options menu writing to config)
+    graph.AddOnMainThread("audio.settings", {"audio"}, [&config] {
+        if (s_instance->m_audioManager->IsInitialized()) {
+            ApplyAudioConfig();
+            s_instance->m_audioConfigSubscription = config.Subscribe("audio", [](const std::string&) { ApplyAudioConfig(); });
+        }
+        return true;
+    });
+    
+    // Subscribes to its key bindings
+    graph.AddOnMainThread("input", {}, [] {
+        s_instance->m_input = std::make_unique<input::Input>();
+        if (!s_instance->m_input->Initialize()) {
+            spdlog::error("Failed to initialize input");
+            return false;
+        }
+        return true;
+    });
     
-    s_instance->m_textRenderer = std::make_unique<text::TextRenderer>();
-    if (!s_instance->m_textRenderer->Initialize(s_instance->m_fontManager.get(), s_instance->m_renderer.get())) {
-        spdlog::warn("Failed to initialize text renderer");
-    }
+    graph.Add("physics", {}, [] {
+        s_instance->m_physics = std::make_unique<physics::Physics>();
+        if (!s_instance->m_physics->Initialize()) {
+            spdlog::error("Failed to initialize physics");
+            return false;
+        }
+        return true;
+    });
     
-    // Initialize SaveManager
-    s_instance->m_saveManager = std::make_unique<save::SaveManager>();
-    std::string gameName = config.GetString("window.title", "SDL2Game");
-    s_instance->m_saveManager->SetGameName(gameName);
+    // Entity registry (components may own physics bodies, so it lives inside the physics lifetime)
+    graph.Add("entities", {"physics"}, [&config] {
+        s_instance->m_registry = std::make_unique<ecs::Registry>();
+        s_instance->m_staticSprites = std::make_unique<ecs::StaticSpriteIndex>(
+            config.GetFloat("graphics.static_grid_cell_size", 256.0f));
+        return true;
+    });
+    
+    // World streaming (parses on the job system, owns static bodies in the physics world)
+    graph.Add("world", {"physics"}, [] {
+        s_instance->m_worldStreamer = std::make_unique<world::WorldStreamer>();
+        if (!s_instance->m_worldStreamer->Initialize()) {
+            spdlog::error("Failed to initialize world streamer");
+            return false;
+        }
+        return true;
+    });
     
-    if (!s_instance->m_saveManager->Initialize()) {
-        spdlog::warn("Failed to initialize save manager - saves will not work");
-    } else {
-        spdlog::info("Save manager initialized - saves location: {}", s_instance->m_saveManager->GetSaveDirectory());
-    }
+    graph.Add("particles", {}, [] {
+        s_instance->m_particleSystem = std::make_unique<particles::ParticleSystem>();
+        if (!s_instance->m_particleSystem->Initialize()) {
+            spdlog::error("Failed to initialize particle system");
+            return false;
+        }
+        return true;
+    });
     
-    // Load audio settings from config
-    if (s_instance->m_audioManager->IsInitialized()) {
-        float masterVolume = config.GetFloat("audio.master_volume", 1.0f);
-        float musicVolume = config.GetFloat("audio.music_volume", 0.8f);
-        float sfxVolume = config.GetFloat("audio.sfx_volume", 1.0f);
-        float ambientVolume = config.GetFloat("audio.ambient_volume", 0.8f);
-        bool muted = config.GetBool("audio.muted", false);
+    graph.AddOnMainThread("window", {}, [&config, &options] {
+        s_instance->m_window = std::make_unique<rendering::Window>();
         
-        s_instance->m_audioManager->SetMasterVolume(masterVolume);
-        s_instance->m_audioManager->SetCategoryVolume(audio::AudioCategory::Music, musicVolume);
-        s_instance->m_audioManager->SetCategoryVolume(audio::AudioCategory::SFX, sfxVolume);
-        s_instance->m_audioManager->SetCategoryVolume(audio::AudioCategory::Ambient, ambientVolume);
-        s_instance->m_audioManager->SetMuted(muted);
+        int width = config.GetInt("window.width", 1280);
+        int height = config.GetInt("window.height", 720);
+        std::string title = config.GetString("window.title", "SDL2 Game");
         
-        spdlog::info("Audio initialized - Master: {:.1f}, Music: {:.1f}, SFX: {:.1f}, Ambient: {:.1f}, Muted: {}", 
-                    masterVolume, musicVolume, sfxVolume, ambientVolume, muted);
-    }
-    
-    // Load default font
-    bool fontLoaded = false;
-    std::string defaultFont = config.GetString("text.default_font", "arial.ttf");
-    int defaultSize = config.GetInt("text.default_size", 16);
-    
-    if (s_instance->m_fontManager->LoadFont(defaultFont, "default", defaultSize)) {
-        fontLoaded = true;
-    } else {
-        // Try common system fonts as fallbacks
-        std::vector<std::pair<std::string, std::string>> fallbacks = {
-            {"Arial.ttf", "Arial"},
-            {"arial.ttf", "Arial"},
-            {"Helvetica.ttc", "Helvetica"},
-            {"DejaVuSans.ttf", "DejaVu Sans"},
-            {"LiberationSans-Regular.ttf", "Liberation Sans"},
-            {"calibri.ttf", "Calibri"},
-            {"tahoma.ttf", "Tahoma"}
-        };
+        spdlog::info("Creating window: {}x{} titled '{}'", width, height, title);
         
-        for (const auto& [filename, displayName] : fallbacks) {
-            if (s_instance->m_fontManager->LoadFont(filename, "default", defaultSize)) {
-                fontLoaded = true;
-                break;
+        if (!s_instance->m_window->Initialize(title, width, height, options.hiddenWindow)) {
+            spdlog::error("Failed to initialize window");
+            return false;
+        }
+        return true;
+    });
+    
+    // Creates the GL context - GL work stays on this thread from here on
+    graph.AddOnMainThread("renderer", {"window"}, [] {
+        s_instance->m_renderer = std::make_unique<rendering::Renderer>();
+        if (!s_instance->m_renderer->Initialize(s_instance->m_window.get())) {
+            spdlog::error("Failed to initialize renderer");
+            return false;
+        }
+        return true;
+    });
+    
+#ifdef ENGINE_PROFILER_ENABLED
+    // Profiler GPU timers and overlay (requires the GL context)
+    graph.AddOnMainThread("profiler", {"renderer"}, [] {
+        if (s_instance->m_renderer->IsRenderThreadEnabled()) {
+            // Both would issue GL calls on the main context while frames execute on the render thread
+            spdlog::info("Render thread enabled - profiler GPU timers and overlay disabled");
+        } else {
+            debug::Profiler::Instance().InitializeGpuTimers();
+            s_instance->m_profilerOverlay = std::make_unique<debug::ProfilerOverlay>();
+            if (!s_instance->m_profilerOverlay->Initialize(s_instance->m_window->GetSDLWindow(), s_instance->m_renderer->GetContext())) {
+                spdlog::warn("Failed to initialize profiler overlay");
             }
         }
-    }
+        return true;
+    });
+#endif
+    
+    // Font files are opened and probed here, off the main thread
+    graph.Add("fonts", {}, [&config] {
+        s_instance->m_fontManager = std::make_unique<text::FontManager>();
+        if (!s_instance->m_fontManager->Initialize()) {
+            spdlog::warn("Failed to initialize font manager - continuing without text rendering");
+        }
+        
+        // Load default font (common system fonts as fallbacks, probed once)
+        std::string defaultFont = config.GetString("text.default_font", "arial.ttf");
+        int defaultSize = config.GetInt("text.default_size", 16);
+        
+        const std::vector<std::string> fontCandidates = {
+            defaultFont, "Arial.ttf", "arial.ttf", "Helvetica.ttc", "DejaVuSans.ttf",
+            "LiberationSans-Regular.ttf", "calibri.ttf", "tahoma.ttf"
+        };
+        if (!s_instance->m_fontManager->LoadFont(fontCandidates, "default", defaultSize)) {
+            spdlog::warn("Could not load any font - text rendering may not work");
+        }
+        return true;
+    });
     
-    if (!fontLoaded) {
-        spdlog::warn("Could not load any font - text rendering may not work");
-    }
+    graph.AddOnMainThread("text", {"fonts", "renderer"}, [] {
+        s_instance->m_textRenderer = std::make_unique<text::TextRenderer>();
+        if (!s_instance->m_textRenderer->Initialize(s_instance->m_fontManager.get(), s_instance->m_renderer.get())) {
+            spdlog::warn("Failed to initialize text renderer");
+        }
+        return true;
+    });
+    
+    graph.Add("saves", {}, [&config] {
+        s_instance->m_saveManager = std::make_unique<save::SaveManager>();
+        std::string gameName = config.GetString("window.title", "SDL2Game");
+        s_instance->m_saveManager->SetGameName(gameName);
+        s_instance->m_saveManager->SetFormat(save::SaveManager::ParseFormat(config.GetString("save.format", "json")));
+        s_instance->m_saveManager->SetCompressionEnabled(config.GetBool("save.compression", false));
+        s_instance->m_saveManager->SetMaxDeltas(static_cast<size_t>(std::max(config.GetInt("save.max_deltas", 16), 0)));
+        
+        if (!s_instance->m_saveManager->Initialize()) {
+            spdlog::warn("Failed to initialize save manager - saves will not work");
+        } else {
+            spdlog::info("Save manager initialized - saves location: {}", s_instance->m_saveManager->GetSaveDirectory());
+        }
+        return true;
+    });
+    
+    // Starts the asset watcher thread; handlers only run from Update
+    graph.Add("hot_reload", {}, [&options] {
+        s_instance->m_hotReloader = std::make_unique<utils::HotReloader>();
+        return s_instance->m_hotReloader->Initialize(options.hotReload);
+    });
+    
+    // Frame pacing ("auto" keeps the old behaviour: vsync, or a 60 FPS cap when vsync is off)
+    graph.AddOnMainThread("frame_pacing", {"renderer"}, [] {
+        s_instance->m_framePacer = std::make_unique<FramePacer>();
+        ConfigureFramePacing();
+        return true;
+    });
     
-    // Load fixed timestep from configuration
-    s_instance->m_fixedTimestep = config.GetFloat("physics.fixed_timestep", 1.0f / 60.0f);
-    s_instance->m_maxFixedSteps = config.GetInt("physics.max_fixed_steps", 5);
+    const bool initialized = graph.Run(config.GetBool("jobs.parallel_init", true) ? s_instance->m_jobSystem.get() : nullptr);
+    graph.LogTimeline();
+    if (!initialized) {
+        spdlog::error("Engine initialization failed");
+        return false;
+    }
     
     // Create user's game application
     s_instance->m_gameApp = CreateGameApplication();
@@ -198,8 +305,15 @@ void Engine::Shutdown() {
         s_instance->m_gameApp.reset();
     }
     
+    // No reloads while systems go away (and the config save below is not a change)
+    s_instance->m_hotReloader.reset();
+    
     // Save configuration
     auto& config = *utils::Config::Instance();
+    if (s_instance->m_audioConfigSubscription) {
+        config.Unsubscribe(s_instance->m_audioConfigSubscription);
+        s_instance->m_audioConfigSubscription = 0;
+    }
     
     // Save current audio settings to config
     if (s_instance->m_audioManager && s_instance->m_audioManager->IsInitialized()) {
@@ -210,11 +324,22 @@ void Engine::Shutdown() {
         config.SetBool("audio.muted", s_instance->m_audioManager->IsMuted());
     }
     
-    config.Save("assets/settings.json");
+    if (s_instance->m_options.saveConfigOnExit) {
+        config.Save("assets/settings.json");
+    }
     
     // Cleanup systems in reverse order of initialization
+    s_instance->m_worldStreamer.reset();
+    s_instance->m_particleSystem.reset();
+    s_instance->m_staticSprites.reset();
+    s_instance->m_registry.reset();
+    s_instance->m_framePacer.reset();
     s_instance->m_textRenderer.reset();
     s_instance->m_fontManager.reset();
+#ifdef ENGINE_PROFILER_ENABLED
+    s_instance->m_profilerOverlay.reset();
+    debug::Profiler::Instance().ShutdownGpuTimers();
+#endif
     s_instance->m_renderer.reset();
     s_instance->m_saveManager.reset();
     s_instance->m_window.reset();
@@ -222,6 +347,11 @@ void Engine::Shutdown() {
     s_instance->m_input.reset();
     s_instance->m_audioManager.reset();
     s_instance->m_resourceManager.reset();
+    s_instance->m_jobSystem.reset();
+    s_instance->m_frameArena.reset();
+    
+    // Nothing reads assets any more
+    utils::UnmountAssetArchive();
     
     spdlog::info("Engine shutdown complete");
     
@@ -236,10 +366,24 @@ void Engine::Shutdown() {
     s_instance = nullptr;
 }
 
+void Engine::RequestQuit() {
+    if (s_instance) {
+        s_instance->m_isRunning = false;
+    }
+}
+
 bool Engine::IsInitialized() {
     return s_instance && s_instance->m_initialized;
 }
 
+float Engine::GetInterpolationAlpha() {
+    return s_instance ? s_instance->m_interpolationAlpha : 1.0f;
+}
+
+float Engine::GetFixedTimestep() {
+    return s_instance ? s_instance->m_fixedTimestep : 1.0f / 60.0f;
+}
+
 Engine& Engine::Instance() {
     assert(s_instance && "Engine not initialized");
     return *s_instance;
@@ -251,16 +395,56 @@ audio::AudioManager& Engine::Audio() {
     return *s_instance->m_audioManager;
 }
 
+ecs::Registry& Engine::Entities() {
+    assert(s_instance && s_instance->m_registry && "Engine not initialized or entity registry not available");
+    return *s_instance->m_registry;
+}
+
+world::WorldStreamer& Engine::World() {
+    assert(s_instance && s_instance->m_worldStreamer && "Engine not initialized or world streamer not available");
+    return *s_instance->m_worldStreamer;
+}
+
+ecs::StaticSpriteIndex& Engine::StaticSprites() {
+    assert(s_instance && s_instance->m_staticSprites && "Engine not initialized or static sprite index not available");
+    return *s_instance->m_staticSprites;
+}
+
 input::Input& Engine::Input() {
     assert(s_instance && s_instance->m_input && "Engine not initialized or Input not available");
     return *s_instance->m_input;
 }
 
+utils::HotReloader& Engine::HotReload() {
+    assert(s_instance && s_instance->m_hotReloader && "Engine not initialized or HotReloader not available");
+    return *s_instance->m_hotReloader;
+}
+
+particles::ParticleSystem& Engine::Particles() {
+    assert(s_instance && s_instance->m_particleSystem && "Engine not initialized or ParticleSystem not available");
+    return *s_instance->m_particleSystem;
+}
+
 utils::Logger& Engine::Logger() {
     static utils::Logger logger;
     return logger;
 }
 
+FrameArena& Engine::FrameMemory() {
+    assert(s_instance && s_instance->m_frameArena && "Engine not initialized or FrameArena not available");
+    return *s_instance->m_frameArena;
+}
+
+FramePacer& Engine::FramePacing() {
+    assert(s_instance && s_instance->m_framePacer && "Engine not initialized or FramePacer not available");
+    return *s_instance->m_framePacer;
+}
+
+JobSystem& Engine::Jobs() {
+    assert(s_instance && s_instance->m_jobSystem && "Engine not initialized or JobSystem not available");
+    return *s_instance->m_jobSystem;
+}
+
 physics::Physics& Engine::Physics() {
     assert(s_instance && s_instance->m_physics && "Engine not initialized or Physics not available");
     return *s_instance->m_physics;
@@ -310,63 +494,101 @@ void Engine::Run() {
     
     spdlog::info("Starting game loop...");
     
-    auto& config = *utils::Config::Instance();
-    bool vsync = config.GetBool("window.vsync", true);
-    bool showFPS = config.GetBool("game.show_fps", false);
-    
-    Uint64 lastTime = SDL_GetPerformanceCounter();
-    const float targetFPS = 60.0f;
-    const float targetFrameTime = 1.0f / targetFPS;
+    // Read every frame so the F1 toggle takes effect (one compare unless config changed)
+    const utils::ConfigKey<bool> showFPS("game.show_fps", false);
+    FramePacer& pacer = *s_instance->m_framePacer;
     
     // FPS tracking
-    Uint64 fpsTimer = 0;
+    float fpsTimer = 0.0f;
     int frameCount = 0;
     float currentFPS = 0.0f;
     
     s_instance->m_isRunning = true;
     
     while (s_instance->m_isRunning) {
-        // Calculate delta time
-        Uint64 currentTime = SDL_GetPerformanceCounter();
-        float deltaTime = (float)(currentTime - lastTime) / SDL_GetPerformanceFrequency();
-        lastTime = currentTime;
+        // Last frame's scratch memory is free again
+        s_instance->m_frameArena->Reset();
         
-        // Cap delta time to prevent spiral of death
-        if (deltaTime > 0.05f) {
-            deltaTime = 0.05f;
-        }
+        // Low-latency mode sleeps in here, before input is sampled - keep that out of the profiled frame
+        float deltaTime = pacer.BeginFrame();
+        
+#ifdef ENGINE_PROFILER_ENABLED
+        debug::Profiler::Instance().BeginFrame();
+#endif
         
-        // FPS calculation
-        if (showFPS) {
+        // FPS calculation (on the real frame time, before the cap)
+        if (showFPS.Get()) {
             frameCount++;
-            fpsTimer += (Uint64)(deltaTime * SDL_GetPerformanceFrequency());
+            fpsTimer += deltaTime;
             
-            if (fpsTimer >= SDL_GetPerformanceFrequency()) { // 1 second
-                currentFPS = frameCount;
+            if (fpsTimer >= 1.0f) {
+                currentFPS = frameCount / fpsTimer;
                 frameCount = 0;
-                fpsTimer = 0;
-                spdlog::info("FPS: {:.1f}", currentFPS);
+                fpsTimer = 0.0f;
+                const auto& stats = s_instance->m_renderer->GetLastFrameStats();
+                const FrameTimeStats frameTimes = pacer.GetStats();
+                spdlog::info("FPS: {:.1f} | Frame p50: {:.2f} ms, p99: {:.2f} ms, max: {:.2f} ms | Draw calls: {}, Batch flushes: {}, Sprites: {}", 
+                            currentFPS, frameTimes.p50Ms, frameTimes.p99Ms, frameTimes.maxMs,
+                            stats.drawCalls, stats.flushes, stats.sprites);
             }
         }
         
+        // Cap delta time to prevent spiral of death
+        if (deltaTime > s_instance->m_maxDeltaTime) {
+            deltaTime = s_instance->m_maxDeltaTime;
+        }
+        
         s_instance->HandleEvents();
         s_instance->Update(deltaTime);
         s_instance->Render();
         
-        // Frame rate limiting (only if vsync is disabled)
-        if (!vsync) {
-            float frameTime = (float)(SDL_GetPerformanceCounter() - currentTime) / SDL_GetPerformanceFrequency();
-            if (frameTime < targetFrameTime) {
-                SDL_Delay((Uint32)((targetFrameTime - frameTime) * 1000.0f));
-            }
-        }
+#ifdef ENGINE_PROFILER_ENABLED
+        // Frame limiter wait is excluded from the profiled frame time
+        debug::Profiler::Instance().EndFrame(s_instance->m_renderer->GetLastFrameStats(), s_instance->m_frameArena->GetUsed());
+#endif
+        
+        // Frame rate limiting (target-rate mode waits here)
+        pacer.EndFrame();
     }
     
     spdlog::info("Game loop ended");
 }
 
+void Engine::ConfigureFramePacing() {
+    auto& config = *utils::Config::Instance();
+    
+    const LoopMode fallback = config.GetBool("window.vsync", true) ? LoopMode::Vsync : LoopMode::TargetRate;
+    const std::string modeName = config.GetString("game.loop_mode", "auto");
+    LoopMode mode = modeName == "auto" ? fallback : FramePacer::ParseMode(modeName, fallback);
+    
+    // Fall back when the driver can't do what the mode needs
+    if (mode == LoopMode::AdaptiveVsync && !s_instance->m_renderer->SetSwapInterval(-1)) {
+        spdlog::warn("Adaptive vsync not supported - using vsync");
+        mode = LoopMode::Vsync;
+    }
+    if (mode == LoopMode::Vsync && !s_instance->m_renderer->SetSwapInterval(1)) {
+        spdlog::warn("Vsync not supported - capping the frame rate instead");
+        mode = LoopMode::TargetRate;
+    }
+    if (mode != LoopMode::Vsync && mode != LoopMode::AdaptiveVsync) {
+        s_instance->m_renderer->SetSwapInterval(0);
+    }
+    
+    const float targetFps = config.GetFloat("game.target_fps", 60.0f);
+    s_instance->m_framePacer->Configure(mode, targetFps, config.GetFloat("game.spin_threshold_ms", 2.0f));
+    spdlog::info("Game loop mode: {} (target {:.0f} FPS)", FramePacer::GetModeName(mode), targetFps);
+}
+
 void Engine::Update(float deltaTime) {
-    // Update input system
+    ENGINE_PROFILE_SCOPE("Update");
+    
+    // Changed asset files, before anything this frame uses them
+    {
+        ENGINE_PROFILE_SCOPE("HotReload::Update");
+        s_instance->m_hotReloader->Update();
+    }
+    
+    // Apply this frame's buffered input events
     s_instance->m_input->Update();
     
     // Update audio system (cleanup finished sounds)
@@ -375,53 +597,187 @@ void Engine::Update(float deltaTime) {
     // Update text renderer (cache management)
     s_instance->m_textRenderer->Update();
     
+    // Report async saves that finished writing
+    if (s_instance->m_saveManager->IsInitialized()) {
+        s_instance->m_saveManager->Update();
+    }
+    
     // Fixed timestep accumulator with protection against spiral of death
     s_instance->m_physicsAccumulator += deltaTime;
     int fixedSteps = 0;
     
+    // Start a fresh moved-body list for this frame's steps
+    s_instance->m_physics->ClearMovedBodies();
+    
     // Run fixed timestep logic at consistent intervals
     while (s_instance->m_physicsAccumulator >= s_instance->m_fixedTimestep && fixedSteps < s_instance->m_maxFixedSteps) {
+        ENGINE_PROFILE_SCOPE("FixedStep");
+        
+        // Input pressed since the previous step is reported to this one
+        s_instance->m_input->BeginFixedStep();
+        
         // 1. Engine physics fixed update
-        s_instance->m_physics->FixedUpdate(s_instance->m_fixedTimestep);
+        {
+            ENGINE_PROFILE_SCOPE("Physics");
+            s_instance->m_physics->FixedUpdate(s_instance->m_fixedTimestep);
+        }
         
         // 2. User's fixed update (physics-dependent logic)
         if (s_instance->m_gameApp) {
+            ENGINE_PROFILE_SCOPE("Game::FixedUpdate");
             s_instance->m_gameApp->FixedUpdate(s_instance->m_fixedTimestep);
         }
         
+        s_instance->m_input->EndFixedStep();
         s_instance->m_physicsAccumulator -= s_instance->m_fixedTimestep;
         fixedSteps++;
     }
     
+    // How far we are between the last fixed step and the next one (what's left in the accumulator)
+    s_instance->m_interpolationAlpha = s_instance->m_interpolationEnabled
+        ? std::clamp(s_instance->m_physicsAccumulator / s_instance->m_fixedTimestep, 0.0f, 1.0f)
+        : 1.0f;
+    
+    // Pull simulated poses into entity transforms before game logic sees them
+    if (fixedSteps > 0) {
+        ENGINE_PROFILE_SCOPE("ECS::SyncPhysicsTransforms");
+        ecs::SyncPhysicsTransforms(*s_instance->m_registry, *s_instance->m_physics);
+    }
+    
+    {
+        ENGINE_PROFILE_SCOPE("ECS::UpdateAnimations");
+        ecs::UpdateAnimations(*s_instance->m_registry, deltaTime);
+    }
+    
     // 3. User's variable update (frame-dependent logic)
     if (s_instance->m_gameApp) {
+        ENGINE_PROFILE_SCOPE("Game::Update");
         s_instance->m_gameApp->Update(deltaTime);
     }
+    
+    // 4. Stream world regions around what the camera showed last frame
+    if (s_instance->m_worldStreamer->HasRegions()) {
+        ENGINE_PROFILE_SCOPE("World::Update");
+        s_instance->m_worldStreamer->Update(s_instance->m_renderer->GetViewBounds(), deltaTime);
+    }
+    
+    // 5. Particles (including emitters the game created or moved this frame)
+    if (s_instance->m_particleSystem->GetEmitterCount() > 0) {
+        ENGINE_PROFILE_SCOPE("Particles::Update");
+        s_instance->m_particleSystem->Update(deltaTime);
+    }
 }
 
 void Engine::Render() {
+    ENGINE_PROFILE_SCOPE("Render");
+    
+#ifdef ENGINE_PROFILER_ENABLED
+    debug::Profiler::Instance().BeginGpuTimer();
+#endif
+    
+    // Upload textures finished by async loads (time-budgeted)
+    {
+        ENGINE_PROFILE_SCOPE("Resources::ProcessUploads");
+        s_instance->m_resourceManager->ProcessUploads();
+    }
+    
     // Clear the screen with a nice blue color
     s_instance->m_renderer->Clear(0.2f, 0.3f, 0.4f, 1.0f);
     s_instance->m_renderer->BeginFrame();
     
+    // Streamed world tiles at the bottom
+    if (s_instance->m_worldStreamer->HasRegions()) {
+        ENGINE_PROFILE_SCOPE("World::Draw");
+        s_instance->m_worldStreamer->Draw(*s_instance->m_renderer);
+    }
+    
+    // Entity sprites first so game-drawn content lands on top
+    {
+        ENGINE_PROFILE_SCOPE("ECS::SubmitSprites");
+        ecs::SubmitSprites(*s_instance->m_registry, *s_instance->m_renderer, s_instance->m_interpolationAlpha,
+                           s_instance->m_staticSprites.get());
+    }
+    
+    // Particles over entities, under game-drawn content
+    if (s_instance->m_particleSystem->GetEmitterCount() > 0) {
+        ENGINE_PROFILE_SCOPE("Particles::Draw");
+        s_instance->m_particleSystem->Draw(*s_instance->m_renderer);
+    }
+    
     // User rendering
     if (s_instance->m_gameApp) {
+        ENGINE_PROFILE_SCOPE("Game::Render");
         s_instance->m_gameApp->Render();
     }
     
-    s_instance->m_renderer->EndFrame();
+    // Physics debug shapes on top of everything
+    if (s_instance->m_physics->IsDebugDrawEnabled()) {
+        ENGINE_PROFILE_SCOPE("Physics::DebugDraw");
+        s_instance->m_physics->DebugDraw(*s_instance->m_renderer);
+    }
+    
+    {
+        ENGINE_PROFILE_SCOPE("Renderer::EndFrame");
+        s_instance->m_renderer->EndFrame();
+    }
+    
+#ifdef ENGINE_PROFILER_ENABLED
+    debug::Profiler::Instance().EndGpuTimer();
     
-    // Present the frame
-    if (s_instance->m_window) {
-        SDL_GL_SwapWindow(s_instance->m_window->GetSDLWindow());
+    if (s_instance->m_profilerOverlay) {
+        s_instance->m_profilerOverlay->Render();
+    }
+#endif
+    
+    // Present the frame (hands it to the render thread when that is enabled)
+    {
+        ENGINE_PROFILE_SCOPE("Present");
+        s_instance->m_renderer->Present();
     }
 }
 
-void Engine::HandleEvents() {
+void Engine::ApplyAudioConfig() {
     auto& config = *utils::Config::Instance();
+    auto& audioManager = *s_instance->m_audioManager;
+    
+    float masterVolume = config.GetFloat("audio.master_volume", 1.0f);
+    float musicVolume = config.GetFloat("audio.music_volume", 0.8f);
+    float sfxVolume = config.GetFloat("audio.sfx_volume", 1.0f);
+    float ambientVolume = config.GetFloat("audio.ambient_volume", 0.8f);
+    bool muted = config.GetBool("audio.muted", false);
+    
+    audioManager.SetMasterVolume(masterVolume);
+    audioManager.SetCategoryVolume(audio::AudioCategory::Music, musicVolume);
+    audioManager.SetCategoryVolume(audio::AudioCategory::SFX, sfxVolume);
+    audioManager.SetCategoryVolume(audio::AudioCategory::Ambient, ambientVolume);
+    audioManager.SetMuted(muted);
+    
+    audio::DuckingSettings ducking;
+    ducking.enabled = config.GetBool("audio.mixer.ducking.enabled", false);
+    ducking.amount = config.GetFloat("audio.mixer.ducking.amount", 0.5f);
+    ducking.threshold = config.GetFloat("audio.mixer.ducking.threshold", 0.1f);
+    ducking.attackMs = config.GetFloat("audio.mixer.ducking.attack_ms", 10.0f);
+    ducking.releaseMs = config.GetFloat("audio.mixer.ducking.release_ms", 300.0f);
+    audioManager.SetDucking(ducking);
+    audioManager.SetLimiterCeiling(config.GetFloat("audio.mixer.limiter_ceiling", 0.98f));
+    
+    spdlog::info("Audio settings - Master: {:.1f}, Music: {:.1f}, SFX: {:.1f}, Ambient: {:.1f}, Muted: {}", 
+                masterVolume, musicVolume, sfxVolume, ambientVolume, muted);
+}
+
+void Engine::HandleEvents() {
+    ENGINE_PROFILE_SCOPE("HandleEvents");
+    
+    static const utils::ConfigKey<bool> showFPS("game.show_fps", false);
     
     SDL_Event event;
     while (SDL_PollEvent(&event)) {
+#ifdef ENGINE_PROFILER_ENABLED
+        if (s_instance->m_profilerOverlay && s_instance->m_profilerOverlay->ProcessEvent(event)) {
+            continue;
+        }
+#endif
+        
         // Handle window close
         if (event.type == SDL_QUIT) {
             s_instance->m_isRunning = false;
@@ -434,9 +790,9 @@ void Engine::HandleEvents() {
         
         // Example: Toggle FPS display with F1
         if (event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_F1) {
-            bool showFPS = config.GetBool("game.show_fps", false);
-            config.SetBool("game.show_fps", !showFPS);
-            spdlog::info("FPS display {}", !showFPS ? "enabled" : "disabled");
+            const bool enabled = !showFPS.Get();
+            showFPS.Set(enabled);
+            spdlog::info("FPS display {}", enabled ? "enabled" : "disabled");
         }
         
         // Example: Audio controls for testing
@@ -468,7 +824,7 @@ void Engine::HandleEvents() {
             }
         }
         
-        // Pass events to input system
+        // Buffer input events (applied in Update)
         s_instance->m_input->HandleEvent(event);
     }
 }
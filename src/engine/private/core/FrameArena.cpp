@@ -0,0 +1,117 @@
+#include "engine/public/core/FrameArena.h"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+
+namespace core {
+
+namespace {
+
+size_t AlignUp(uintptr_t value, size_t alignment) {
+    return static_cast<size_t>((value + alignment - 1) & ~static_cast<uintptr_t>(alignment - 1));
+}
+
+std::byte* AllocateBlock(size_t size, size_t alignment) {
+    return static_cast<std::byte*>(::operator new(size, std::align_val_t(alignment)));
+}
+
+void FreeBlock(std::byte* block, size_t alignment) {
+    ::operator delete(block, std::align_val_t(alignment));
+}
+
+} // namespace
+
+FrameArena::FrameArena(size_t capacity) {
+    Reserve(capacity);
+}
+
+FrameArena::~FrameArena() {
+    ReleaseOverflow();
+    if (m_buffer) {
+        FreeBlock(m_buffer, BUFFER_ALIGNMENT);
+    }
+}
+
+void* FrameArena::Allocate(size_t size, size_t alignment) {
+    alignment = std::max<size_t>(alignment, 1);
+    size = std::max<size_t>(size, 1);
+
+    const uintptr_t base = reinterpret_cast<uintptr_t>(m_buffer);
+    const size_t offset = AlignUp(base + m_offset, alignment) - static_cast<size_t>(base);
+    if (m_buffer && offset + size <= m_capacity) {
+        m_frameBytes += offset + size - m_offset;
+        m_offset = offset + size;
+        return m_buffer + offset;
+    }
+
+    m_frameBytes += size;
+    return AllocateOverflow(size, alignment);
+}
+
+void FrameArena::Reset() {
+    m_peakBytes = std::max(m_peakBytes, m_frameBytes);
+
+    // Grow so a frame like this one fits next time
+    if (m_overflowed) {
+        ReleaseOverflow();
+        m_overflowCount++;
+        const size_t capacity = std::bit_ceil(m_frameBytes + m_frameBytes / 4);
+        spdlog::debug("Frame arena: {} KB frame did not fit, growing to {} KB", m_frameBytes / 1024, capacity / 1024);
+        Reserve(capacity);
+    }
+
+    m_offset = 0;
+    m_frameBytes = 0;
+}
+
+void FrameArena::Reserve(size_t capacity) {
+    if (capacity <= m_capacity) return;
+
+    // Only between frames - outstanding pointers would dangle
+    if (m_buffer) {
+        FreeBlock(m_buffer, BUFFER_ALIGNMENT);
+    }
+    m_buffer = AllocateBlock(capacity, BUFFER_ALIGNMENT);
+    m_capacity = capacity;
+    m_offset = 0;
+}
+
+void* FrameArena::do_allocate(size_t bytes, size_t alignment) {
+    return Allocate(bytes, alignment);
+}
+
+void* FrameArena::AllocateOverflow(size_t size, size_t alignment) {
+    m_overflowed = true;
+
+    if (!m_overflow.empty()) {
+        Chunk& chunk = m_overflow.back();
+        const uintptr_t base = reinterpret_cast<uintptr_t>(chunk.data);
+        const size_t offset = AlignUp(base + m_overflowOffset, alignment) - static_cast<size_t>(base);
+        if (offset + size <= chunk.size) {
+            m_overflowOffset = offset + size;
+            return chunk.data + offset;
+        }
+    }
+
+    Chunk chunk;
+    chunk.size = std::max(OVERFLOW_CHUNK_SIZE, size + alignment);
+    chunk.data = AllocateBlock(chunk.size, BUFFER_ALIGNMENT);
+    m_overflow.push_back(chunk);
+
+    const uintptr_t base = reinterpret_cast<uintptr_t>(chunk.data);
+    const size_t offset = AlignUp(base, alignment) - static_cast<size_t>(base);
+    m_overflowOffset = offset + size;
+    return chunk.data + offset;
+}
+
+void FrameArena::ReleaseOverflow() {
+    for (const Chunk& chunk : m_overflow) {
+        FreeBlock(chunk.data, BUFFER_ALIGNMENT);
+    }
+    m_overflow.clear();
+    m_overflowOffset = 0;
+    m_overflowed = false;
+}
+
+} // namespace core
@@ -0,0 +1,154 @@
+#include "engine/public/core/FramePacer.h"
+#include <SDL.h>
+#include <spdlog/spdlog.h>
+#include <algorithm>
+
+namespace core {
+
+FramePacer::FramePacer() {
+    m_frequency = SDL_GetPerformanceFrequency();
+    Configure(LoopMode::Vsync, 60.0f, 2.0f);
+}
+
+void FramePacer::Configure(LoopMode mode, float targetFps, float spinThresholdMs) {
+    m_mode = mode;
+    m_targetFps = std::max(1.0f, targetFps);
+    m_frameTicks = static_cast<uint64_t>(m_frequency / m_targetFps);
+    m_spinTicks = static_cast<uint64_t>(m_frequency * std::max(0.0f, spinThresholdMs) / 1000.0);
+    m_nextDeadline = 0;
+    m_workCount = 0;
+}
+
+float FramePacer::BeginFrame() {
+    // Sleep first so input is sampled just in time to finish the frame by its deadline
+    if (m_mode == LoopMode::LowLatency && m_nextDeadline != 0) {
+        const uint64_t work = EstimateWorkTicks();
+        if (m_nextDeadline > work) {
+            WaitUntil(m_nextDeadline - work);
+        }
+    }
+
+    const uint64_t now = SDL_GetPerformanceCounter();
+    float deltaTime = 0.0f;
+    if (m_lastFrameStart != 0) {
+        deltaTime = static_cast<float>(static_cast<double>(now - m_lastFrameStart) / m_frequency);
+
+        m_frameTimesMs[m_frameTimeNext] = deltaTime * 1000.0f;
+        m_frameTimeNext = (m_frameTimeNext + 1) % HISTORY_SIZE;
+        m_frameTimeCount = std::min(m_frameTimeCount + 1, HISTORY_SIZE);
+    }
+
+    m_lastFrameStart = now;
+    m_frameStart = now;
+    return deltaTime;
+}
+
+void FramePacer::EndFrame() {
+    uint64_t now = SDL_GetPerformanceCounter();
+    m_workTicks[m_workCount % WORK_HISTORY_SIZE] = now - m_frameStart;
+    m_workCount++;
+
+    if (m_mode != LoopMode::TargetRate && m_mode != LoopMode::LowLatency) {
+        return;
+    }
+
+    // Deadline = when this frame's work should be done; frames are scheduled back to back from it
+    if (m_nextDeadline == 0) {
+        m_nextDeadline = m_frameStart + m_frameTicks;
+    }
+
+    if (m_mode == LoopMode::TargetRate) {
+        WaitUntil(m_nextDeadline);
+        now = SDL_GetPerformanceCounter();
+    }
+
+    m_nextDeadline += m_frameTicks;
+    if (m_nextDeadline <= now) {
+        // More than a frame behind (hitch, breakpoint) - restart the schedule instead of rushing to catch up
+        m_nextDeadline = now + m_frameTicks;
+    }
+}
+
+FrameTimeStats FramePacer::GetStats() const {
+    FrameTimeStats stats;
+    stats.sampleCount = m_frameTimeCount;
+    if (m_frameTimeCount == 0) {
+        return stats;
+    }
+
+    std::array<float, HISTORY_SIZE> sorted;
+    std::copy_n(m_frameTimesMs.begin(), m_frameTimeCount, sorted.begin());
+    std::sort(sorted.begin(), sorted.begin() + m_frameTimeCount);
+
+    float total = 0.0f;
+    for (size_t i = 0; i < m_frameTimeCount; ++i) {
+        total += sorted[i];
+    }
+
+    const size_t last = m_frameTimeCount - 1;
+    stats.averageMs = total / m_frameTimeCount;
+    stats.p50Ms = sorted[last / 2];
+    stats.p99Ms = sorted[(last * 99 + 99) / 100];
+    stats.maxMs = sorted[last];
+    return stats;
+}
+
+int FramePacer::GetSwapInterval() const {
+    switch (m_mode) {
+        case LoopMode::Vsync:         return 1;
+        case LoopMode::AdaptiveVsync: return -1;
+        default:                      return 0;
+    }
+}
+
+LoopMode FramePacer::ParseMode(const std::string& name, LoopMode fallback) {
+    if (name == "vsync") return LoopMode::Vsync;
+    if (name == "adaptive_vsync") return LoopMode::AdaptiveVsync;
+    if (name == "uncapped") return LoopMode::Uncapped;
+    if (name == "target") return LoopMode::TargetRate;
+    if (name == "low_latency") return LoopMode::LowLatency;
+
+    spdlog::warn("Unknown loop mode '{}' - using {}", name, GetModeName(fallback));
+    return fallback;
+}
+
+const char* FramePacer::GetModeName(LoopMode mode) {
+    switch (mode) {
+        case LoopMode::Vsync:         return "vsync";
+        case LoopMode::AdaptiveVsync: return "adaptive_vsync";
+        case LoopMode::Uncapped:      return "uncapped";
+        case LoopMode::TargetRate:    return "target";
+        case LoopMode::LowLatency:    return "low_latency";
+    }
+    return "unknown";
+}
+
+void FramePacer::WaitUntil(uint64_t deadline) const {
+    // Coarse sleeps while there is plenty of time left (SDL_Delay may overshoot by a millisecond or two)
+    uint64_t now = SDL_GetPerformanceCounter();
+    while (now < deadline && deadline - now > m_spinTicks) {
+        SDL_Delay(1);
+        now = SDL_GetPerformanceCounter();
+    }
+
+    // Spin out the remainder for an accurate wake-up
+    while (SDL_GetPerformanceCounter() < deadline) {
+    }
+}
+
+uint64_t FramePacer::EstimateWorkTicks() const {
+    const size_t count = std::min(m_workCount, WORK_HISTORY_SIZE);
+    if (count == 0) {
+        return m_frameTicks / 2;
+    }
+
+    std::array<uint64_t, WORK_HISTORY_SIZE> sorted;
+    std::copy_n(m_workTicks.begin(), count, sorted.begin());
+    std::nth_element(sorted.begin(), sorted.begin() + count / 2, sorted.begin() + count);
+
+    // Median plus a quarter and half a millisecond of headroom, so an ordinary frame doesn't miss the deadline
+    const uint64_t estimate = sorted[count / 2] + sorted[count / 2] / 4 + m_frequency / 2000;
+    return std::min(estimate, m_frameTicks);
+}
+
+} // namespace core
@@ -0,0 +1,203 @@
+#include "engine/public/core/InitGraph.h"
+#include "engine/public/core/JobSystem.h"
+#include <SDL.h>
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <exception>
+
+namespace core {
+
+void InitGraph::Add(std::string name, std::vector<std::string> dependencies, StepFunction step) {
+    AddStep(std::move(name), std::move(dependencies), std::move(step), false);
+}
+
+void InitGraph::AddOnMainThread(std::string name, std::vector<std::string> dependencies, StepFunction step) {
+    AddStep(std::move(name), std::move(dependencies), std::move(step), true);
+}
+
+void InitGraph::AddStep(std::string name, std::vector<std::string> dependencies, StepFunction step, bool mainThread) {
+    Step& added = m_steps.emplace_back();
+    added.timing.name = name;
+    added.name = std::move(name);
+    added.dependencies = std::move(dependencies);
+    added.function = std::move(step);
+    added.mainThread = mainThread;
+}
+
+bool InitGraph::Run(JobSystem* jobs) {
+    if (!ResolveDependencies()) {
+        return false;
+    }
+
+    // Queued jobs only run on workers while nobody waits on the main queue
+    const bool parallel = jobs && jobs->IsInitialized() && jobs->GetWorkerCount() > 0;
+
+    m_jobs = parallel ? jobs : nullptr;
+    m_startTicks = SDL_GetPerformanceCounter();
+    m_running = 0;
+    m_failed = false;
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    for (;;) {
+        // Hand every ready worker step to the job system, and pick one main-thread step for us
+        size_t mainStep = m_steps.size();
+        for (size_t i = 0; i < m_steps.size() && !m_failed; ++i) {
+            Step& step = m_steps[i];
+            if (step.state != State::Pending || !IsReady(step)) continue;
+
+            if (parallel && !step.mainThread) {
+                step.state = State::Running;
+                m_running++;
+                jobs->Submit([this, i] { Execute(i); });
+            } else if (mainStep == m_steps.size()) {
+                mainStep = i;
+            }
+        }
+
+        if (mainStep < m_steps.size()) {
+            m_steps[mainStep].state = State::Running;
+            m_running++;
+            lock.unlock();
+            Execute(mainStep);
+            lock.lock();
+            continue;
+        }
+
+        if (m_running == 0) {
+            break; // Everything finished, failed, or is stuck behind a cycle
+        }
+        m_stepFinished.wait(lock);
+    }
+
+    m_totalMs = ElapsedMs();
+
+    bool complete = !m_failed;
+    for (Step& step : m_steps) {
+        if (step.state == State::Pending) {
+            step.state = State::Skipped;
+            if (!m_failed) {
+                spdlog::error("Init step '{}' never became ready (dependency cycle)", step.name);
+                complete = false;
+            }
+        }
+    }
+    return complete;
+}
+
+bool InitGraph::ResolveDependencies() {
+    bool valid = true;
+    for (Step& step : m_steps) {
+        step.dependencyIndices.clear();
+        for (const std::string& dependency : step.dependencies) {
+            const auto found = std::find_if(m_steps.begin(), m_steps.end(),
+                                            [&](const Step& other) { return other.name == dependency; });
+            if (found == m_steps.end()) {
+                spdlog::error("Init step '{}' depends on unknown step '{}'", step.name, dependency);
+                valid = false;
+                continue;
+            }
+            step.dependencyIndices.push_back(static_cast<size_t>(found - m_steps.begin()));
+        }
+    }
+    return valid;
+}
+
+bool InitGraph::IsReady(const Step& step) const {
+    for (size_t dependency : step.dependencyIndices) {
+        if (m_steps[dependency].state != State::Done) return false;
+    }
+    return true;
+}
+
+void InitGraph::Execute(size_t index) {
+    Step& step = m_steps[index];
+    const float start = ElapsedMs();
+
+    bool succeeded = false;
+    try {
+        succeeded = step.function();
+    } catch (const std::exception& e) {
+        spdlog::error("Init step '{}' threw: {}", step.name, e.what());
+    }
+
+    const float end = ElapsedMs();
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        step.timing.startMs = start;
+        step.timing.endMs = end;
+        step.timing.threadIndex = m_jobs ? m_jobs->GetCurrentThreadIndex() : 0;
+        step.timing.ran = true;
+        step.timing.succeeded = succeeded;
+        step.state = succeeded ? State::Done : State::Failed;
+        if (!succeeded) {
+            spdlog::error("Init step '{}' failed", step.name);
+            m_failed = true;
+        }
+        m_running--;
+        m_stepFinished.notify_one(); // Under the lock: Run() may return (and the graph go away) right after
+    }
+}
+
+float InitGraph::ElapsedMs() const {
+    return static_cast<float>(static_cast<double>(SDL_GetPerformanceCounter() - m_startTicks) * 1000.0 /
+                              static_cast<double>(SDL_GetPerformanceFrequency()));
+}
+
+std::vector<InitGraph::StepTiming> InitGraph::GetTimeline() const {
+    std::vector<StepTiming> timeline;
+    timeline.reserve(m_steps.size());
+    for (const Step& step : m_steps) {
+        timeline.push_back(step.timing);
+    }
+    std::stable_sort(timeline.begin(), timeline.end(),
+                     [](const StepTiming& a, const StepTiming& b) { return a.ran && (!b.ran || a.startMs < b.startMs); });
+    return timeline;
+}
+
+std::vector<std::string> InitGraph::GetCriticalPath() const {
+    // Walk back from the step that finished last through whichever dependency finished last
+    const Step* current = nullptr;
+    for (const Step& step : m_steps) {
+        if (step.timing.ran && (!current || step.timing.endMs > current->timing.endMs)) {
+            current = &step;
+        }
+    }
+
+    std::vector<std::string> path;
+    while (current) {
+        path.push_back(current->name);
+        const Step* latest = nullptr;
+        for (size_t dependency : current->dependencyIndices) {
+            const Step& candidate = m_steps[dependency];
+            if (candidate.timing.ran && (!latest || candidate.timing.endMs > latest->timing.endMs)) {
+                latest = &candidate;
+            }
+        }
+        current = latest;
+    }
+    std::reverse(path.begin(), path.end());
+    return path;
+}
+
+void InitGraph::LogTimeline() const {
+    const std::vector<std::string> criticalPath = GetCriticalPath();
+    std::string pathText;
+    for (const std::string& name : criticalPath) {
+        if (!pathText.empty()) pathText += " -> ";
+        pathText += name;
+    }
+
+    spdlog::info("Startup timeline ({:.1f} ms, critical path: {})", m_totalMs, pathText);
+    for (const StepTiming& timing : GetTimeline()) {
+        if (!timing.ran) {
+            spdlog::info("  {:<18} skipped", timing.name);
+            continue;
+        }
+        const bool critical = std::find(criticalPath.begin(), criticalPath.end(), timing.name) != criticalPath.end();
+        const std::string thread = timing.threadIndex == 0 ? "main" : fmt::format("worker {}", timing.threadIndex);
+        spdlog::info("  {:<18} {:7.1f} - {:7.1f} ms ({:6.1f} ms) on {}{}{}", timing.name, timing.startMs, timing.endMs,
+                     timing.endMs - timing.startMs, thread, timing.succeeded ? "" : " FAILED", critical ? " *" : "");
+    }
+}
+
+} // namespace core
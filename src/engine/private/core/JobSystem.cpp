@@ -0,0 +1,284 @@
+#include "engine/public/core/JobSystem.h"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <limits>
+
+namespace core {
+
+namespace {
+
+constexpr size_t NO_QUEUE = std::numeric_limits<size_t>::max();
+
+// Which deque the current thread owns (per job system, so a second instance doesn't get confused)
+thread_local const JobSystem* t_ownerSystem = nullptr;
+thread_local size_t t_queueIndex = NO_QUEUE;
+
+} // namespace
+
+JobSystem::JobSystem() = default;
+
+JobSystem::~JobSystem() {
+    Shutdown();
+}
+
+bool JobSystem::Initialize(int workerCount) {
+    if (m_initialized) {
+        spdlog::warn("Job system already initialized");
+        return true;
+    }
+
+    if (workerCount <= 0) {
+        unsigned int hardwareThreads = std::thread::hardware_concurrency();
+        workerCount = hardwareThreads > 1 ? static_cast<int>(hardwareThreads) - 1 : 1;
+    }
+
+    spdlog::info("Initializing job system with {} worker threads...", workerCount);
+
+    // Queue 0 belongs to the thread that initializes the system (the main thread)
+    m_queues.clear();
+    for (int i = 0; i <= workerCount; ++i) {
+        m_queues.push_back(std::make_unique<WorkQueue>());
+    }
+    t_ownerSystem = this;
+    t_queueIndex = 0;
+
+    m_running = true;
+    m_workers.reserve(workerCount);
+    for (int i = 1; i <= workerCount; ++i) {
+        m_workers.emplace_back(&JobSystem::WorkerLoop, this, static_cast<size_t>(i));
+    }
+
+    m_initialized = true;
+    spdlog::info("Job system initialized successfully");
+    return true;
+}
+
+void JobSystem::Shutdown() {
+    if (!m_initialized) {
+        return;
+    }
+
+    spdlog::info("Shutting down job system...");
+
+    // Finish whatever is still queued so no counter is left waiting forever
+    while (TryRunOne()) {}
+
+    {
+        std::lock_guard<std::mutex> lock(m_sleepMutex);
+        m_running = false;
+    }
+    m_wakeCondition.notify_all();
+
+    for (auto& worker : m_workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+    m_workers.clear();
+    m_queues.clear();
+
+    if (t_ownerSystem == this) {
+        t_ownerSystem = nullptr;
+        t_queueIndex = NO_QUEUE;
+    }
+
+    m_initialized = false;
+    spdlog::info("Job system shutdown complete");
+}
+
+void JobSystem::Submit(JobFunction job, JobCounter* counter) {
+    if (!job) {
+        return;
+    }
+
+    if (counter) {
+        counter->m_pending.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    Enqueue({std::move(job), counter});
+}
+
+void JobSystem::SubmitAfter(JobCounter& dependency, JobFunction job, JobCounter* counter) {
+    if (!job) {
+        return;
+    }
+
+    // Count the job now so waiting on its counter also covers the deferred part
+    if (counter) {
+        counter->m_pending.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(dependency.m_continuationMutex);
+        if (!dependency.IsDone()) {
+            dependency.m_continuations.emplace_back(std::move(job), counter);
+            return;
+        }
+    }
+
+    Enqueue({std::move(job), counter});
+}
+
+void JobSystem::Wait(JobCounter& counter) {
+    while (!counter.IsDone()) {
+        if (!TryRunOne()) {
+            std::this_thread::yield();
+        }
+    }
+
+    // The finishing thread may still hold the lock; don't let the caller destroy the counter under it
+    std::lock_guard<std::mutex> lock(counter.m_continuationMutex);
+}
+
+void JobSystem::ParallelFor(size_t count, size_t batchSize, const std::function<void(size_t begin, size_t end)>& body) {
+    if (count == 0) {
+        return;
+    }
+
+    batchSize = std::max<size_t>(1, batchSize);
+
+    // Not worth (or not able to) spreading out - run inline
+    if (!m_initialized || count <= batchSize) {
+        body(0, count);
+        return;
+    }
+
+    JobCounter counter;
+    for (size_t begin = 0; begin < count; begin += batchSize) {
+        size_t end = std::min(count, begin + batchSize);
+        Submit([&body, begin, end] { body(begin, end); }, &counter);
+    }
+
+    Wait(counter);
+}
+
+bool JobSystem::IsWorkerThread() const {
+    return t_ownerSystem == this && t_queueIndex != NO_QUEUE && t_queueIndex != 0;
+}
+
+size_t JobSystem::GetCurrentThreadIndex() const {
+    return CurrentQueueIndex();
+}
+
+void JobSystem::WorkerLoop(size_t queueIndex) {
+    t_ownerSystem = this;
+    t_queueIndex = queueIndex;
+
+    while (true) {
+        Job job;
+        if (PopLocal(queueIndex, job) || Steal(queueIndex, job)) {
+            Execute(job);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(m_sleepMutex);
+        m_wakeCondition.wait(lock, [this] {
+            return !m_running || m_queuedJobs.load(std::memory_order_acquire) > 0;
+        });
+
+        if (!m_running && m_queuedJobs.load(std::memory_order_acquire) == 0) {
+            break;
+        }
+    }
+}
+
+void JobSystem::Enqueue(Job job) {
+    if (!m_initialized) {
+        // No workers - run synchronously so callers still get their results
+        Execute(job);
+        return;
+    }
+
+    size_t queueIndex = CurrentQueueIndex();
+    {
+        std::lock_guard<std::mutex> lock(m_queues[queueIndex]->mutex);
+        m_queues[queueIndex]->jobs.push_back(std::move(job));
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_sleepMutex);
+        m_queuedJobs.fetch_add(1, std::memory_order_release);
+    }
+    m_wakeCondition.notify_one();
+}
+
+bool JobSystem::TryRunOne() {
+    if (m_queues.empty()) {
+        return false;
+    }
+
+    size_t queueIndex = CurrentQueueIndex();
+
+    Job job;
+    if (PopLocal(queueIndex, job) || Steal(queueIndex, job)) {
+        Execute(job);
+        return true;
+    }
+    return false;
+}
+
+bool JobSystem::PopLocal(size_t queueIndex, Job& job) {
+    WorkQueue& queue = *m_queues[queueIndex];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.jobs.empty()) {
+        return false;
+    }
+
+    // Newest first - its data is most likely still in cache
+    job = std::move(queue.jobs.back());
+    queue.jobs.pop_back();
+    m_queuedJobs.fetch_sub(1, std::memory_order_relaxed);
+    return true;
+}
+
+bool JobSystem::Steal(size_t thiefIndex, Job& job) {
+    const size_t queueCount = m_queues.size();
+    for (size_t offset = 1; offset < queueCount; ++offset) {
+        WorkQueue& victim = *m_queues[(thiefIndex + offset) % queueCount];
+        std::unique_lock<std::mutex> lock(victim.mutex, std::try_to_lock);
+        if (!lock.owns_lock() || victim.jobs.empty()) {
+            continue;
+        }
+
+        // Oldest first - usually the biggest remaining chunk of work
+        job = std::move(victim.jobs.front());
+        victim.jobs.pop_front();
+        m_queuedJobs.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+    return false;
+}
+
+void JobSystem::Execute(Job& job) {
+    job.function();
+    FinishJob(job.counter);
+}
+
+void JobSystem::FinishJob(JobCounter* counter) {
+    if (!counter) {
+        return;
+    }
+
+    std::vector<std::pair<JobFunction, JobCounter*>> continuations;
+    {
+        std::lock_guard<std::mutex> lock(counter->m_continuationMutex);
+        if (counter->m_pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            continuations.swap(counter->m_continuations);
+        }
+    }
+
+    // Dependents were already counted by SubmitAfter - queue them as is
+    for (auto& [function, dependentCounter] : continuations) {
+        Enqueue({std::move(function), dependentCounter});
+    }
+}
+
+size_t JobSystem::CurrentQueueIndex() const {
+    // Threads the system doesn't own (e.g. loader threads) share the main thread's queue
+    if (t_ownerSystem == this && t_queueIndex < m_queues.size()) {
+        return t_queueIndex;
+    }
+    return 0;
+}
+
+} // namespace core
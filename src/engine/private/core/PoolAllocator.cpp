@@ -0,0 +1,69 @@
+#include "engine/public/core/PoolAllocator.h"
+#include <algorithm>
+
+namespace core {
+
+PoolAllocator::PoolAllocator(size_t blockSize, size_t blocksPerChunk, size_t alignment, std::pmr::memory_resource* upstream)
+    : m_blockSize(0)
+    , m_blocksPerChunk(std::max<size_t>(blocksPerChunk, 1))
+    , m_alignment(std::max(alignment, alignof(FreeBlock)))
+    , m_upstream(upstream ? upstream : std::pmr::new_delete_resource()) {
+    // Every block must hold a free-list link and keep the next block aligned
+    const size_t size = std::max(blockSize, sizeof(FreeBlock));
+    m_blockSize = (size + m_alignment - 1) / m_alignment * m_alignment;
+}
+
+PoolAllocator::~PoolAllocator() {
+    for (void* chunk : m_chunks) {
+        m_upstream->deallocate(chunk, m_blockSize * m_blocksPerChunk, m_alignment);
+    }
+}
+
+void* PoolAllocator::Allocate() {
+    if (!m_freeList) {
+        AddChunk();
+    }
+
+    FreeBlock* block = m_freeList;
+    m_freeList = block->next;
+    m_usedBlocks++;
+    return block;
+}
+
+void PoolAllocator::Deallocate(void* block) {
+    if (!block) return;
+
+    auto* freeBlock = static_cast<FreeBlock*>(block);
+    freeBlock->next = m_freeList;
+    m_freeList = freeBlock;
+    m_usedBlocks--;
+}
+
+void* PoolAllocator::do_allocate(size_t bytes, size_t alignment) {
+    if (!Fits(bytes, alignment)) {
+        return m_upstream->allocate(bytes, alignment);
+    }
+    return Allocate();
+}
+
+void PoolAllocator::do_deallocate(void* pointer, size_t bytes, size_t alignment) {
+    if (!Fits(bytes, alignment)) {
+        m_upstream->deallocate(pointer, bytes, alignment);
+        return;
+    }
+    Deallocate(pointer);
+}
+
+void PoolAllocator::AddChunk() {
+    auto* chunk = static_cast<std::byte*>(m_upstream->allocate(m_blockSize * m_blocksPerChunk, m_alignment));
+    m_chunks.push_back(chunk);
+
+    // Thread the new blocks onto the free list in address order
+    for (size_t i = m_blocksPerChunk; i-- > 0;) {
+        auto* block = reinterpret_cast<FreeBlock*>(chunk + i * m_blockSize);
+        block->next = m_freeList;
+        m_freeList = block;
+    }
+}
+
+} // namespace core
@@ -0,0 +1,104 @@
+#include "engine/public/core/SpatialGrid.h"
+#include <algorithm>
+#include <cmath>
+
+namespace core {
+
+SpatialGrid::SpatialGrid(float cellSize) : m_cellSize(std::max(1.0f, cellSize)) {
+}
+
+void SpatialGrid::SetCellSize(float cellSize) {
+    m_cellSize = std::max(1.0f, cellSize);
+    Clear();
+}
+
+void SpatialGrid::Clear() {
+    m_items.clear();
+    m_cells.clear();
+    m_visitStamps.clear();
+    m_queryStamp = 0;
+}
+
+void SpatialGrid::Reserve(size_t itemCount) {
+    m_items.reserve(itemCount);
+    m_visitStamps.reserve(itemCount);
+}
+
+void SpatialGrid::Insert(uint32_t id, const Bounds& bounds) {
+    const uint32_t index = static_cast<uint32_t>(m_items.size());
+    m_items.push_back({id, bounds});
+    m_visitStamps.push_back(0);
+
+    const CellRange range = GetCellRange(bounds);
+    for (int32_t y = range.minY; y <= range.maxY; ++y) {
+        for (int32_t x = range.minX; x <= range.maxX; ++x) {
+            m_cells[MakeKey(x, y)].push_back(index);
+        }
+    }
+}
+
+void SpatialGrid::Query(const Bounds& area, std::vector<uint32_t>& results) const {
+    if (m_items.empty()) {
+        return;
+    }
+
+    // New stamp per query; on wrap-around reset so stale stamps can't match
+    if (++m_queryStamp == 0) {
+        std::fill(m_visitStamps.begin(), m_visitStamps.end(), 0);
+        m_queryStamp = 1;
+    }
+
+    m_hits.clear();
+    auto visitCell = [&](const std::vector<uint32_t>& cell) {
+        for (uint32_t index : cell) {
+            if (m_visitStamps[index] == m_queryStamp) {
+                continue;
+            }
+            m_visitStamps[index] = m_queryStamp;
+            if (m_items[index].bounds.Overlaps(area)) {
+                m_hits.push_back(index);
+            }
+        }
+    };
+
+    // Walk the covered cells, or the allocated ones if that is fewer (zoomed far out over a sparse world)
+    const CellRange range = GetCellRange(area);
+    const double coveredCells = (static_cast<double>(range.maxX) - range.minX + 1) * (static_cast<double>(range.maxY) - range.minY + 1);
+    if (coveredCells > static_cast<double>(m_cells.size())) {
+        for (const auto& [key, cell] : m_cells) {
+            visitCell(cell);
+        }
+    } else {
+        for (int32_t y = range.minY; y <= range.maxY; ++y) {
+            for (int32_t x = range.minX; x <= range.maxX; ++x) {
+                auto it = m_cells.find(MakeKey(x, y));
+                if (it != m_cells.end()) {
+                    visitCell(it->second);
+                }
+            }
+        }
+    }
+
+    // Item indices follow insertion order
+    std::sort(m_hits.begin(), m_hits.end());
+    results.reserve(results.size() + m_hits.size());
+    for (uint32_t index : m_hits) {
+        results.push_back(m_items[index].id);
+    }
+}
+
+SpatialGrid::CellRange SpatialGrid::GetCellRange(const Bounds& bounds) const {
+    const float inverseSize = 1.0f / m_cellSize;
+    return {
+        static_cast<int32_t>(std::floor(bounds.min.x * inverseSize)),
+        static_cast<int32_t>(std::floor(bounds.min.y * inverseSize)),
+        static_cast<int32_t>(std::floor(bounds.max.x * inverseSize)),
+        static_cast<int32_t>(std::floor(bounds.max.y * inverseSize))
+    };
+}
+
+uint64_t SpatialGrid::MakeKey(int32_t x, int32_t y) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(y);
+}
+
+} // namespace core
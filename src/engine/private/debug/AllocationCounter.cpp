@@ -0,0 +1,100 @@
+#include "engine/public/debug/Profiler.h"
+
+#ifdef ENGINE_PROFILER_ENABLED
+
+// Global operator new/delete replacements that count heap allocations for the profiler.
+// Only compiled into profiled builds; shipping builds keep the standard library's.
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace debug {
+
+namespace {
+
+std::atomic<uint64_t> s_allocationCount{0};
+std::atomic<uint64_t> s_allocatedBytes{0};
+
+void* AllocateCounted(std::size_t size, std::size_t alignment) {
+    s_allocationCount.fetch_add(1, std::memory_order_relaxed);
+    s_allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+
+    if (size == 0) size = 1;
+    if (alignment <= alignof(std::max_align_t)) {
+        return std::malloc(size);
+    }
+#ifdef _WIN32
+    return _aligned_malloc(size, alignment);
+#else
+    void* pointer = nullptr;
+    return posix_memalign(&pointer, alignment, size) == 0 ? pointer : nullptr;
+#endif
+}
+
+void FreeCounted(void* pointer, std::size_t alignment) noexcept {
+#ifdef _WIN32
+    if (alignment > alignof(std::max_align_t)) {
+        _aligned_free(pointer);
+        return;
+    }
+#else
+    (void)alignment;
+#endif
+    std::free(pointer);
+}
+
+// Throwing new: retry through the new handler like the standard version
+void* AllocateOrThrow(std::size_t size, std::size_t alignment) {
+    for (;;) {
+        if (void* pointer = AllocateCounted(size, alignment)) {
+            return pointer;
+        }
+        std::new_handler handler = std::get_new_handler();
+        if (!handler) {
+            throw std::bad_alloc();
+        }
+        handler();
+    }
+}
+
+constexpr std::size_t DEFAULT_ALIGNMENT = alignof(std::max_align_t);
+
+} // namespace
+
+uint64_t GetAllocationCount() {
+    return s_allocationCount.load(std::memory_order_relaxed);
+}
+
+uint64_t GetAllocatedBytes() {
+    return s_allocatedBytes.load(std::memory_order_relaxed);
+}
+
+} // namespace debug
+
+void* operator new(std::size_t size) { return debug::AllocateOrThrow(size, debug::DEFAULT_ALIGNMENT); }
+void* operator new[](std::size_t size) { return debug::AllocateOrThrow(size, debug::DEFAULT_ALIGNMENT); }
+void* operator new(std::size_t size, std::align_val_t alignment) { return debug::AllocateOrThrow(size, static_cast<std::size_t>(alignment)); }
+void* operator new[](std::size_t size, std::align_val_t alignment) { return debug::AllocateOrThrow(size, static_cast<std::size_t>(alignment)); }
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept { return debug::AllocateCounted(size, debug::DEFAULT_ALIGNMENT); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return debug::AllocateCounted(size, debug::DEFAULT_ALIGNMENT); }
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return debug::AllocateCounted(size, static_cast<std::size_t>(alignment)); }
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return debug::AllocateCounted(size, static_cast<std::size_t>(alignment)); }
+
+void operator delete(void* pointer) noexcept { debug::FreeCounted(pointer, debug::DEFAULT_ALIGNMENT); }
+void operator delete[](void* pointer) noexcept { debug::FreeCounted(pointer, debug::DEFAULT_ALIGNMENT); }
+void operator delete(void* pointer, std::size_t) noexcept { debug::FreeCounted(pointer, debug::DEFAULT_ALIGNMENT); }
+void operator delete[](void* pointer, std::size_t) noexcept { debug::FreeCounted(pointer, debug::DEFAULT_ALIGNMENT); }
+void operator delete(void* pointer, const std::nothrow_t&) noexcept { debug::FreeCounted(pointer, debug::DEFAULT_ALIGNMENT); }
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept { debug::FreeCounted(pointer, debug::DEFAULT_ALIGNMENT); }
+
+void operator delete(void* pointer, std::align_val_t alignment) noexcept { debug::FreeCounted(pointer, static_cast<std::size_t>(alignment)); }
+void operator delete[](void* pointer, std::align_val_t alignment) noexcept { debug::FreeCounted(pointer, static_cast<std::size_t>(alignment)); }
+void operator delete(void* pointer, std::size_t, std::align_val_t alignment) noexcept { debug::FreeCounted(pointer, static_cast<std::size_t>(alignment)); }
+void operator delete[](void* pointer, std::size_t, std::align_val_t alignment) noexcept { debug::FreeCounted(pointer, static_cast<std::size_t>(alignment)); }
+void operator delete(void* pointer, std::align_val_t alignment, const std::nothrow_t&) noexcept { debug::FreeCounted(pointer, static_cast<std::size_t>(alignment)); }
+void operator delete[](void* pointer, std::align_val_t alignment, const std::nothrow_t&) noexcept { debug::FreeCounted(pointer, static_cast<std::size_t>(alignment)); }
+
+#endif // ENGINE_PROFILER_ENABLED
@@ -0,0 +1,199 @@
+#include "engine/public/debug/Profiler.h"
+
+#ifdef ENGINE_PROFILER_ENABLED
+
+#include "engine/public/rendering/Renderer.h"
+#include <glad/glad.h>
+#include <spdlog/spdlog.h>
+#include <SDL.h>
+#include <algorithm>
+#include <utility>
+
+namespace debug {
+
+namespace {
+
+float TicksToMs(uint64_t ticks) {
+    return static_cast<float>(static_cast<double>(ticks) * 1000.0 / SDL_GetPerformanceFrequency());
+}
+
+} // namespace
+
+Profiler& Profiler::Instance() {
+    static Profiler profiler;
+    return profiler;
+}
+
+void Profiler::BeginFrame() {
+    m_current.index = m_completedFrames;
+    m_current.cpuMs = 0.0f;
+    m_current.gpuMs = -1.0f;
+    m_current.scopes.clear();
+    m_scopeStack.clear();
+    m_scopeStartTicks.clear();
+
+    m_frameThread = std::this_thread::get_id();
+    m_frameStartTicks = SDL_GetPerformanceCounter();
+    m_frameStartAllocations = GetAllocationCount();
+    m_frameStartBytes = GetAllocatedBytes();
+    m_inFrame = true;
+}
+
+void Profiler::EndFrame(const rendering::RenderStats& renderStats, size_t frameArenaBytes) {
+    if (!m_inFrame) {
+        return;
+    }
+
+    // Close any scopes left open (e.g. early returns through a manual Push/Pop pair)
+    while (!m_scopeStack.empty()) {
+        PopScope();
+    }
+
+    m_current.cpuMs = TicksToMs(SDL_GetPerformanceCounter() - m_frameStartTicks);
+    m_current.drawCalls = renderStats.drawCalls;
+    m_current.flushes = renderStats.flushes;
+    m_current.sprites = renderStats.sprites;
+    m_current.allocations = static_cast<uint32_t>(GetAllocationCount() - m_frameStartAllocations);
+    m_current.allocatedBytes = GetAllocatedBytes() - m_frameStartBytes;
+    m_current.frameArenaBytes = frameArenaBytes;
+
+    // Swap into the ring so the slot's scope vector keeps its capacity
+    std::swap(m_history[m_completedFrames % HISTORY_SIZE], m_current);
+    m_completedFrames++;
+    m_inFrame = false;
+
+    CollectGpuResults();
+}
+
+void Profiler::PushScope(const char* name) {
+    if (!m_inFrame || std::this_thread::get_id() != m_frameThread) {
+        return;
+    }
+
+    uint64_t now = SDL_GetPerformanceCounter();
+
+    ProfileScope scope;
+    scope.name = name;
+    scope.depth = static_cast<uint16_t>(m_scopeStack.size());
+    scope.startMs = TicksToMs(now - m_frameStartTicks);
+
+    m_scopeStack.push_back(m_current.scopes.size());
+    m_scopeStartTicks.push_back(now);
+    m_current.scopes.push_back(scope);
+}
+
+void Profiler::PopScope() {
+    if (!m_inFrame || m_scopeStack.empty() || std::this_thread::get_id() != m_frameThread) {
+        return;
+    }
+
+    uint64_t elapsed = SDL_GetPerformanceCounter() - m_scopeStartTicks.back();
+    m_current.scopes[m_scopeStack.back()].durationMs = TicksToMs(elapsed);
+
+    m_scopeStack.pop_back();
+    m_scopeStartTicks.pop_back();
+}
+
+void Profiler::InitializeGpuTimers() {
+    if (m_gpuAvailable) {
+        return;
+    }
+
+    if (!GLAD_GL_VERSION_3_3 && !GLAD_GL_ARB_timer_query) {
+        spdlog::info("GPU timer queries not supported - profiler will report CPU times only");
+        return;
+    }
+
+    glGenQueries(GPU_QUERY_COUNT, m_gpuQueries);
+    for (int i = 0; i < GPU_QUERY_COUNT; ++i) {
+        m_gpuQueryPending[i] = false;
+    }
+    m_gpuQueryIndex = 0;
+    m_gpuAvailable = true;
+}
+
+void Profiler::ShutdownGpuTimers() {
+    if (!m_gpuAvailable) {
+        return;
+    }
+
+    glDeleteQueries(GPU_QUERY_COUNT, m_gpuQueries);
+    m_gpuAvailable = false;
+    m_gpuTimerActive = false;
+}
+
+void Profiler::BeginGpuTimer() {
+    if (!m_gpuAvailable || m_gpuTimerActive || !m_inFrame) {
+        return;
+    }
+
+    // Query still in flight from GPU_QUERY_COUNT frames ago - skip this frame rather than stall
+    if (m_gpuQueryPending[m_gpuQueryIndex]) {
+        return;
+    }
+
+    glBeginQuery(GL_TIME_ELAPSED, m_gpuQueries[m_gpuQueryIndex]);
+    m_gpuQueryFrame[m_gpuQueryIndex] = m_current.index;
+    m_gpuTimerActive = true;
+}
+
+void Profiler::EndGpuTimer() {
+    if (!m_gpuTimerActive) {
+        return;
+    }
+
+    glEndQuery(GL_TIME_ELAPSED);
+    m_gpuQueryPending[m_gpuQueryIndex] = true;
+    m_gpuQueryIndex = (m_gpuQueryIndex + 1) % GPU_QUERY_COUNT;
+    m_gpuTimerActive = false;
+}
+
+size_t Profiler::GetFrameCount() const {
+    return static_cast<size_t>(std::min<uint64_t>(m_completedFrames, HISTORY_SIZE));
+}
+
+const ProfileFrame& Profiler::GetFrame(size_t framesAgo) const {
+    static const ProfileFrame empty;
+    if (framesAgo >= GetFrameCount()) {
+        return empty;
+    }
+    return m_history[(m_completedFrames - 1 - framesAgo) % HISTORY_SIZE];
+}
+
+void Profiler::CollectGpuResults() {
+    if (!m_gpuAvailable) {
+        return;
+    }
+
+    for (int i = 0; i < GPU_QUERY_COUNT; ++i) {
+        if (!m_gpuQueryPending[i]) {
+            continue;
+        }
+
+        GLint available = 0;
+        glGetQueryObjectiv(m_gpuQueries[i], GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available) {
+            continue;
+        }
+
+        GLuint64 elapsedNs = 0;
+        glGetQueryObjectui64v(m_gpuQueries[i], GL_QUERY_RESULT, &elapsedNs);
+        m_gpuQueryPending[i] = false;
+
+        if (ProfileFrame* frame = FindFrame(m_gpuQueryFrame[i])) {
+            frame->gpuMs = static_cast<float>(elapsedNs / 1.0e6);
+        }
+    }
+}
+
+ProfileFrame* Profiler::FindFrame(uint64_t index) {
+    if (index >= m_completedFrames || m_completedFrames - index > HISTORY_SIZE) {
+        return nullptr;
+    }
+    ProfileFrame& frame = m_history[index % HISTORY_SIZE];
+    return frame.index == index ? &frame : nullptr;
+}
+
+} // namespace debug
+
+#endif // ENGINE_PROFILER_ENABLED
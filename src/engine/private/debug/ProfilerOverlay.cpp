@@ -0,0 +1,224 @@
+#include "engine/public/debug/ProfilerOverlay.h"
+
+#ifdef ENGINE_PROFILER_ENABLED
+
+#include "engine/public/core/Engine.h"
+#include "engine/public/debug/Profiler.h"
+#include "engine/public/rendering/ShaderProgram.h"
+#include "engine/public/rendering/Texture.h"
+#include "engine/public/utils/Config.h"
+#include "engine/public/utils/ResourceManager.h"
+#include <imgui.h>
+#include <imgui_impl_sdl2.h>
+#include <imgui_impl_opengl3.h>
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <array>
+
+namespace debug {
+
+ProfilerOverlay::ProfilerOverlay() = default;
+
+ProfilerOverlay::~ProfilerOverlay() {
+    Shutdown();
+}
+
+bool ProfilerOverlay::Initialize(SDL_Window* window, void* glContext) {
+    if (m_initialized) {
+        return true;
+    }
+
+    if (!window || !glContext) {
+        spdlog::error("Profiler overlay requires a window and GL context");
+        return false;
+    }
+
+    ImGui::CreateContext();
+    ImGui::StyleColorsDark();
+
+    if (!ImGui_ImplSDL2_InitForOpenGL(window, glContext)) {
+        spdlog::error("Failed to initialize ImGui SDL2 backend");
+        ImGui::DestroyContext();
+        return false;
+    }
+
+    // Match the renderer's OpenGL 2.1 context
+    if (!ImGui_ImplOpenGL3_Init("#version 120")) {
+        spdlog::error("Failed to initialize ImGui OpenGL backend");
+        ImGui_ImplSDL2_Shutdown();
+        ImGui::DestroyContext();
+        return false;
+    }
+
+    m_visible = utils::Config::Instance()->GetBool("debug.profiler_overlay", false);
+    m_initialized = true;
+    spdlog::info("Profiler overlay initialized (F3 to toggle)");
+    return true;
+}
+
+void ProfilerOverlay::Shutdown() {
+    if (m_initialized) {
+        ImGui_ImplOpenGL3_Shutdown();
+        ImGui_ImplSDL2_Shutdown();
+        ImGui::DestroyContext();
+        m_initialized = false;
+    }
+}
+
+bool ProfilerOverlay::ProcessEvent(const SDL_Event& event) {
+    if (!m_initialized) {
+        return false;
+    }
+
+    if (event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_F3 && !event.key.repeat) {
+        m_visible = !m_visible;
+        return true;
+    }
+
+    ImGui_ImplSDL2_ProcessEvent(&event);
+    return false;
+}
+
+void ProfilerOverlay::Render() {
+    if (!m_initialized || !m_visible) {
+        return;
+    }
+
+    ImGui_ImplOpenGL3_NewFrame();
+    ImGui_ImplSDL2_NewFrame();
+    ImGui::NewFrame();
+
+    DrawWindow();
+
+    ImGui::Render();
+    ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+
+    // ImGui changed the bound program/textures behind our caches' backs
+    rendering::ShaderProgram::InvalidateBindingCache();
+    rendering::Texture::InvalidateBindingCache();
+}
+
+void ProfilerOverlay::DrawWindow() {
+    const Profiler& profiler = Profiler::Instance();
+    const size_t frameCount = profiler.GetFrameCount();
+    if (frameCount == 0) {
+        return;
+    }
+
+    // Oldest to newest for the graphs
+    std::array<float, Profiler::HISTORY_SIZE> cpuTimes = {};
+    std::array<float, Profiler::HISTORY_SIZE> gpuTimes = {};
+    float cpuMax = 0.0f;
+    float cpuTotal = 0.0f;
+    for (size_t i = 0; i < frameCount; ++i) {
+        const ProfileFrame& frame = profiler.GetFrame(frameCount - 1 - i);
+        cpuTimes[i] = frame.cpuMs;
+        gpuTimes[i] = std::max(frame.gpuMs, 0.0f);
+        cpuMax = std::max(cpuMax, frame.cpuMs);
+        cpuTotal += frame.cpuMs;
+    }
+
+    const ProfileFrame& last = profiler.GetFrame(0);
+    const float cpuAverage = cpuTotal / frameCount;
+
+    ImGui::SetNextWindowPos(ImVec2(10.0f, 10.0f), ImGuiCond_FirstUseEver);
+    ImGui::SetNextWindowBgAlpha(0.8f);
+    if (ImGui::Begin("Profiler", &m_visible, ImGuiWindowFlags_AlwaysAutoResize | ImGuiWindowFlags_NoFocusOnAppearing)) {
+        ImGui::Text("Frame: %.2f ms (avg %.2f, max %.2f) | %.0f FPS", last.cpuMs, cpuAverage, cpuMax,
+                    cpuAverage > 0.0f ? 1000.0f / cpuAverage : 0.0f);
+        if (profiler.IsGpuTimingAvailable()) {
+            // Latest resolved GPU sample (results arrive a few frames late)
+            float gpuMs = -1.0f;
+            for (size_t i = 0; i < frameCount && gpuMs < 0.0f; ++i) {
+                gpuMs = profiler.GetFrame(i).gpuMs;
+            }
+            ImGui::Text("GPU render pass: %.2f ms", std::max(gpuMs, 0.0f));
+        } else {
+            ImGui::Text("GPU render pass: n/a");
+        }
+        ImGui::Text("Draw calls: %u | Flushes: %u | Sprites: %u", last.drawCalls, last.flushes, last.sprites);
+        ImGui::Text("Heap allocations: %u (%.1f KB) | Frame arena: %.1f KB", last.allocations,
+                    last.allocatedBytes / 1024.0f, last.frameArenaBytes / 1024.0f);
+
+        ImGui::PlotLines("CPU ms", cpuTimes.data(), static_cast<int>(frameCount), 0, nullptr,
+                         0.0f, std::max(cpuMax, 16.7f), ImVec2(320.0f, 60.0f));
+        if (profiler.IsGpuTimingAvailable()) {
+            ImGui::PlotLines("GPU ms", gpuTimes.data(), static_cast<int>(frameCount), 0, nullptr,
+                             0.0f, std::max(cpuMax, 16.7f), ImVec2(320.0f, 60.0f));
+        }
+
+        ImGui::Separator();
+        if (ImGui::BeginTable("scopes", 3, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+            ImGui::TableSetupColumn("Scope");
+            ImGui::TableSetupColumn("ms");
+            ImGui::TableSetupColumn("% frame");
+            ImGui::TableHeadersRow();
+
+            for (const ProfileScope& scope : last.scopes) {
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::Text("%*s%s", scope.depth * 2, "", scope.name);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.3f", scope.durationMs);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.1f", last.cpuMs > 0.0f ? scope.durationMs * 100.0f / last.cpuMs : 0.0f);
+            }
+
+            ImGui::EndTable();
+        }
+
+        DrawTextureStats();
+    }
+    ImGui::End();
+}
+
+void ProfilerOverlay::DrawTextureStats() {
+    if (!ImGui::CollapsingHeader("Textures")) {
+        return;
+    }
+
+    const utils::ResourceManager& resources = core::Engine::Resources();
+    constexpr float MB = 1024.0f * 1024.0f;
+    ImGui::Text("%.1f MB (%.1f MB retained) / budget %.1f MB", resources.GetMemoryUsage() / MB,
+                resources.GetRetainedMemoryUsage() / MB, resources.GetTextureBudget() / MB);
+    ImGui::SameLine();
+    if (ImGui::SmallButton("Dump to log")) {
+        resources.DumpTextureStats();
+    }
+
+    const ImGuiTableFlags flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollY;
+    if (ImGui::BeginTable("textures", 5, flags, ImVec2(520.0f, 200.0f))) {
+        ImGui::TableSetupScrollFreeze(0, 1);
+        ImGui::TableSetupColumn("Texture");
+        ImGui::TableSetupColumn("Size");
+        ImGui::TableSetupColumn("KB");
+        ImGui::TableSetupColumn("Refs");
+        ImGui::TableSetupColumn("State");
+        ImGui::TableHeadersRow();
+
+        for (const utils::TextureStats& entry : resources.GetTextureStats()) {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(entry.name.c_str());
+            ImGui::TableNextColumn();
+            ImGui::Text("%dx%d", entry.width, entry.height);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.1f", entry.bytes / 1024.0f);
+            ImGui::TableNextColumn();
+            ImGui::Text("%ld", entry.references);
+            ImGui::TableNextColumn();
+            if (entry.pending) {
+                ImGui::TextUnformatted("loading");
+            } else if (entry.retained) {
+                ImGui::Text("retained (%llu frames)", static_cast<unsigned long long>(entry.framesSinceUse));
+            } else {
+                ImGui::TextUnformatted("in use");
+            }
+        }
+        ImGui::EndTable();
+    }
+}
+
+} // namespace debug
+
+#endif // ENGINE_PROFILER_ENABLED
@@ -0,0 +1,79 @@
+#include "engine/public/ecs/Registry.h"
+#include <spdlog/spdlog.h>
+
+namespace ecs {
+
+Registry::Registry() = default;
+
+Registry::~Registry() {
+    Clear();
+}
+
+Entity Registry::Create() {
+    if (!m_freeIndices.empty()) {
+        const uint32_t index = m_freeIndices.back();
+        m_freeIndices.pop_back();
+        m_slots[index].alive = true;
+        m_aliveCount++;
+        return m_slots[index].handle; // Version was already bumped on destroy
+    }
+
+    if (m_slots.size() >= EntityTraits::MAX_ENTITIES) {
+        spdlog::error("Entity limit reached ({})", EntityTraits::MAX_ENTITIES);
+        return NULL_ENTITY;
+    }
+
+    const Entity entity = EntityTraits::Make(static_cast<uint32_t>(m_slots.size()), 0);
+    m_slots.push_back({entity, true});
+    m_aliveCount++;
+    return entity;
+}
+
+void Registry::Destroy(Entity entity) {
+    if (!IsAlive(entity)) {
+        return;
+    }
+
+    for (auto& pool : m_pools) {
+        if (pool) {
+            pool->Remove(entity);
+        }
+    }
+
+    // Bump the version so existing handles to this slot go stale
+    const uint32_t index = EntityTraits::GetIndex(entity);
+    m_slots[index] = {EntityTraits::Make(index, EntityTraits::GetVersion(entity) + 1), false};
+    m_freeIndices.push_back(index);
+    m_aliveCount--;
+}
+
+bool Registry::IsAlive(Entity entity) const {
+    const uint32_t index = EntityTraits::GetIndex(entity);
+    return entity != NULL_ENTITY && index < m_slots.size() && m_slots[index].alive && m_slots[index].handle == entity;
+}
+
+void Registry::Clear() {
+    for (auto& pool : m_pools) {
+        if (pool) {
+            pool->Clear();
+        }
+    }
+
+    // Recycle every slot with a new version so handles from before the clear stay dead
+    m_freeIndices.clear();
+    for (uint32_t index = static_cast<uint32_t>(m_slots.size()); index-- > 0;) {
+        Slot& slot = m_slots[index];
+        if (slot.alive) {
+            slot = {EntityTraits::Make(index, EntityTraits::GetVersion(slot.handle) + 1), false};
+        }
+        m_freeIndices.push_back(index);
+    }
+    m_aliveCount = 0;
+}
+
+size_t Registry::NextTypeId() {
+    static size_t nextId = 0;
+    return nextId++;
+}
+
+} // namespace ecs
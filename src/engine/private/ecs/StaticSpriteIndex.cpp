@@ -0,0 +1,77 @@
+#include "engine/public/ecs/StaticSpriteIndex.h"
+#include "engine/public/ecs/Registry.h"
+#include "engine/public/core/Transform.h"
+#include "engine/public/rendering/Sprite.h"
+#include <spdlog/spdlog.h>
+#include <utility>
+
+namespace ecs {
+
+StaticSpriteIndex::StaticSpriteIndex(float cellSize) : m_grid(cellSize) {
+}
+
+void StaticSpriteIndex::SetCellSize(float cellSize) {
+    m_grid.SetCellSize(cellSize);
+    m_dirty = true;
+}
+
+void StaticSpriteIndex::Update(Registry& registry) {
+    const ComponentPool<StaticSprite>* tags = registry.FindPool<StaticSprite>();
+    const uint32_t revision = tags ? tags->GetRevision() : 0;
+    if (revision != m_tagRevision) {
+        m_dirty = true;
+    }
+
+    // Sprites indexed before their texture arrived have a real size now
+    if (!m_dirty && !m_loading.empty()) {
+        for (Entity entity : m_loading) {
+            const rendering::Sprite* sprite = registry.TryGet<rendering::Sprite>(entity);
+            if (!sprite || !sprite->IsLoading()) {
+                m_dirty = true;
+                break;
+            }
+        }
+    }
+
+    if (m_dirty) {
+        Rebuild(registry);
+        m_tagRevision = revision;
+        m_dirty = false;
+    }
+}
+
+const std::vector<Entity>& StaticSpriteIndex::Query(const core::Bounds& area) {
+    m_results.clear();
+    m_grid.Query(area, m_results);
+    return m_results;
+}
+
+void StaticSpriteIndex::Rebuild(Registry& registry) {
+    m_grid.Clear();
+    m_loading.clear();
+
+    ComponentPool<StaticSprite>* tags = registry.FindPool<StaticSprite>();
+    ComponentPool<rendering::Sprite>* sprites = registry.FindPool<rendering::Sprite>();
+    ComponentPool<core::Transform>* transforms = registry.FindPool<core::Transform>();
+    if (!tags || !sprites || !transforms) {
+        return;
+    }
+
+    m_grid.Reserve(tags->Size());
+    for (Entity entity : tags->GetEntities()) {
+        const rendering::Sprite* sprite = sprites->TryGet(entity);
+        const uint32_t slot = transforms->Find(entity);
+        if (!sprite || slot == ComponentPool<core::Transform>::NPOS) {
+            continue;
+        }
+
+        if (sprite->IsLoading()) {
+            m_loading.push_back(entity);
+        }
+        m_grid.Insert(entity, sprite->GetWorldBounds(std::as_const(*transforms).GetAt(slot)));
+    }
+
+    spdlog::debug("Static sprite index rebuilt: {} sprites in {} cells", m_grid.GetItemCount(), m_grid.GetCellCount());
+}
+
+} // namespace ecs
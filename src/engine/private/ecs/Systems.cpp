@@ -0,0 +1,137 @@
+#include "engine/public/ecs/Systems.h"
+#include "engine/public/animation/Animator.h"
+#include "engine/public/ecs/Registry.h"
+#include "engine/public/ecs/StaticSpriteIndex.h"
+#include "engine/public/core/Transform.h"
+#include "engine/public/physics/Physics.h"
+#include "engine/public/physics/RigidBody.h"
+#include "engine/public/rendering/Renderer.h"
+#include "engine/public/rendering/Sprite.h"
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+namespace ecs {
+
+namespace {
+
+void DrawEntitySprite(rendering::Renderer& renderer, const rendering::Sprite& sprite, const core::Transform& transform,
+                      const animation::Animator* animator) {
+    const animation::AnimationClip* clip = animator ? animator->GetClip().get() : nullptr;
+    if (!clip) {
+        renderer.DrawSprite(&sprite, transform);
+        return;
+    }
+    
+    // Skip the frame lookup for sprites that cannot reach the view (the renderer would cull them anyway)
+    if (renderer.IsCullingEnabled()) {
+        const float radius = clip->GetBoundingRadius() * std::max(std::abs(transform.scale.x), std::abs(transform.scale.y));
+        const core::Bounds reach(transform.position - glm::vec2(radius), transform.position + glm::vec2(radius));
+        if (!renderer.GetViewBounds().Overlaps(reach)) {
+            return;
+        }
+    }
+    
+    renderer.DrawSprite(&sprite, transform, clip->GetTexture(), clip->GetFrame(animator->GetFrameIndex()));
+}
+
+} // namespace
+
+void SyncPhysicsTransforms(Registry& registry, const physics::Physics& physics) {
+    ComponentPool<physics::RigidBody>* bodies = registry.FindPool<physics::RigidBody>();
+    ComponentPool<core::Transform>* transforms = registry.FindPool<core::Transform>();
+    if (!bodies || !transforms) {
+        return;
+    }
+    
+    // Only bodies that actually moved, already converted to engine units - one pass, no Box2D queries.
+    // Writes touch only the position and rotation arrays of the transform pool.
+    std::vector<glm::vec2>& positions = transforms->GetPositions();
+    std::vector<float>& rotations = transforms->GetRotations();
+    for (const physics::BodyMove& move : physics.GetMovedBodies()) {
+        // Body may have been destroyed since the step (or not belong to the registry at all)
+        const physics::RigidBody* body = physics::RigidBody::FromBodyId(move.bodyId);
+        if (!body) {
+            continue;
+        }
+        
+        const Entity entity = body->GetEntity();
+        if (entity == NULL_ENTITY || bodies->TryGet(entity) != body) {
+            continue;
+        }
+        
+        const uint32_t slot = transforms->Find(entity);
+        if (slot != ComponentPool<core::Transform>::NPOS) {
+            positions[slot] = move.position;
+            rotations[slot] = move.rotation;
+        }
+    }
+}
+
+void UpdateAnimations(Registry& registry, float deltaTime) {
+    ComponentPool<animation::Animator>* animators = registry.FindPool<animation::Animator>();
+    if (!animators) {
+        return;
+    }
+    
+    for (animation::Animator& animator : animators->GetComponents()) {
+        animator.Advance(deltaTime);
+    }
+}
+
+void SubmitSprites(Registry& registry, rendering::Renderer& renderer, float alpha, StaticSpriteIndex* staticIndex) {
+    ComponentPool<rendering::Sprite>* sprites = registry.FindPool<rendering::Sprite>();
+    ComponentPool<core::Transform>* transforms = registry.FindPool<core::Transform>();
+    if (!sprites || !transforms) {
+        return;
+    }
+    
+    ComponentPool<animation::Animator>* animators = registry.FindPool<animation::Animator>();
+    
+    // Static sprites: only the grid cells under the view (without culling there's nothing to skip)
+    ComponentPool<StaticSprite>* staticTags = nullptr;
+    if (staticIndex && renderer.IsCullingEnabled()) {
+        staticIndex->Update(registry);
+        staticTags = registry.FindPool<StaticSprite>();
+        
+        for (Entity entity : staticIndex->Query(renderer.GetViewBounds())) {
+            const rendering::Sprite* sprite = sprites->TryGet(entity);
+            const uint32_t slot = transforms->Find(entity);
+            if (sprite && slot != ComponentPool<core::Transform>::NPOS) {
+                DrawEntitySprite(renderer, *sprite, std::as_const(*transforms).GetAt(slot),
+                                 animators ? animators->TryGet(entity) : nullptr);
+            }
+        }
+    }
+    
+    ComponentPool<physics::RigidBody>* bodies = registry.FindPool<physics::RigidBody>();
+    const std::vector<Entity>& entities = sprites->GetEntities();
+    const std::vector<rendering::Sprite>& spriteComponents = sprites->GetComponents();
+    const std::vector<glm::vec2>& positions = std::as_const(*transforms).GetPositions();
+    const std::vector<float>& rotations = std::as_const(*transforms).GetRotations();
+    const std::vector<glm::vec2>& scales = std::as_const(*transforms).GetScales();
+    
+    for (size_t i = 0; i < entities.size(); ++i) {
+        if (staticTags && staticTags->Contains(entities[i])) {
+            continue;
+        }
+        
+        const uint32_t slot = transforms->Find(entities[i]);
+        if (slot == ComponentPool<core::Transform>::NPOS) {
+            continue;
+        }
+        
+        const animation::Animator* animator = animators ? animators->TryGet(entities[i]) : nullptr;
+        
+        // Simulated entities draw between their last two physics steps (only the scale comes from the transform)
+        const physics::RigidBody* body = bodies ? bodies->TryGet(entities[i]) : nullptr;
+        if (body && body->IsValid() && body->GetType() != physics::RigidBody::Type::Static) {
+            DrawEntitySprite(renderer, spriteComponents[i], body->GetInterpolatedTransform(alpha, scales[slot]), animator);
+        } else {
+            DrawEntitySprite(renderer, spriteComponents[i], core::Transform(positions[slot], rotations[slot], scales[slot]), animator);
+        }
+    }
+}
+
+} // namespace ecs
@@ -1,57 +1,253 @@
 #include "engine/public/input/Input.h"
 #include <spdlog/spdlog.h>
-#include <cstring>
+#include <bit>
 
 namespace input {
 
-Input::Input() : m_currentKeyState(nullptr), m_previousKeyState(nullptr), 
-                 m_numKeys(0), m_currentMouseState(0), m_previousMouseState(0),
-                 m_mouseX(0), m_mouseY(0) {
+Input::Input() {
+    m_frameEvents.reserve(EVENT_CAPACITY);
 }
 
 Input::~Input() {
-    delete[] m_previousKeyState;
+    Shutdown();
+}
+
+bool Input::Initialize() {
+    if (m_initialized) return true;
+
+    // Start from whatever SDL thinks the mouse is at; motion events keep it current
+    SDL_GetMouseState(&m_mouseX, &m_mouseY);
+
+    LoadBindings();
+    m_bindingsSubscription = utils::Config::Instance()->Subscribe("input.key_bindings",
+        [this](const std::string&) { LoadBindings(); });
+
+    m_initialized = true;
+    return true;
+}
+
+void Input::Shutdown() {
+    if (!m_initialized) return;
+
+    if (m_bindingsSubscription) {
+        utils::Config::Instance()->Unsubscribe(m_bindingsSubscription);
+        m_bindingsSubscription = 0;
+    }
+    m_initialized = false;
 }
 
 void Input::Update() {
-    // Store previous key state
-    if (m_currentKeyState && m_previousKeyState) {
-        memcpy(m_previousKeyState, m_currentKeyState, m_numKeys);
-    }
-    
-    // Get current key state
-    m_currentKeyState = SDL_GetKeyboardState(&m_numKeys);
-    
-    // Initialize previous state if needed
-    if (!m_previousKeyState) {
-        m_previousKeyState = new Uint8[m_numKeys];
-        memcpy(m_previousKeyState, m_currentKeyState, m_numKeys);
-    }
-    
-    // Store previous mouse state
-    m_previousMouseState = m_currentMouseState;
-    
-    // Get current mouse state
-    m_currentMouseState = SDL_GetMouseState(&m_mouseX, &m_mouseY);
+    m_frame++;
+    m_wheelX = m_wheelY = 0;
+
+    // Events arrive in the order SDL queued them, which is timestamp order
+    m_frameEvents.clear();
+    InputEvent event;
+    while (m_events.Pop(event)) {
+        ApplyEvent(event);
+        m_frameEvents.push_back(event);
+    }
+
+    // Merged events are newer than anything queued before them
+    if (m_hasPendingMotion) {
+        ApplyEvent(m_pendingMotion);
+        m_frameEvents.push_back(m_pendingMotion);
+        m_hasPendingMotion = false;
+    }
+    if (m_hasPendingWheel) {
+        ApplyEvent(m_pendingWheel);
+        m_frameEvents.push_back(m_pendingWheel);
+        m_hasPendingWheel = false;
+    }
+    m_reportDrops = true;
 }
 
 void Input::HandleEvent(const SDL_Event& event) {
-    // TODO: Handle specific events if needed
-    // This method can be used for events that need immediate handling
+    InputEvent captured;
+    captured.timestamp = event.common.timestamp;
+
+    switch (event.type) {
+        case SDL_KEYDOWN:
+        case SDL_KEYUP:
+            captured.type = event.type == SDL_KEYDOWN ? InputEventType::KeyDown : InputEventType::KeyUp;
+            captured.code = event.key.keysym.scancode;
+            captured.repeat = event.key.repeat != 0;
+            break;
+        case SDL_MOUSEBUTTONDOWN:
+        case SDL_MOUSEBUTTONUP:
+            captured.type = event.type == SDL_MOUSEBUTTONDOWN ? InputEventType::MouseButtonDown : InputEventType::MouseButtonUp;
+            captured.code = event.button.button;
+            captured.x = event.button.x;
+            captured.y = event.button.y;
+            break;
+        case SDL_MOUSEMOTION:
+            captured.type = InputEventType::MouseMotion;
+            captured.x = event.motion.x;
+            captured.y = event.motion.y;
+            break;
+        case SDL_MOUSEWHEEL:
+            captured.type = InputEventType::MouseWheel;
+            captured.x = event.wheel.x;
+            captured.y = event.wheel.y;
+            if (event.wheel.direction == SDL_MOUSEWHEEL_FLIPPED) {
+                captured.x = -captured.x;
+                captured.y = -captured.y;
+            }
+            break;
+        default:
+            return;
+    }
+
+    const bool pointer = captured.type == InputEventType::MouseMotion || captured.type == InputEventType::MouseWheel;
+    if (pointer && m_events.Size() + BUTTON_EVENT_RESERVE >= EVENT_CAPACITY) {
+        MergeEvent(captured);
+        return;
+    }
+    if (captured.type == InputEventType::MouseButtonDown || captured.type == InputEventType::MouseButtonUp) {
+        m_hasPendingMotion = false; // The button event carries a newer position
+    }
+
+    if (!m_events.Push(captured)) {
+        m_droppedEvents++;
+        if (m_reportDrops) {
+            spdlog::warn("Input event buffer full ({} events) - dropping input until the next frame", EVENT_CAPACITY);
+            m_reportDrops = false;
+        }
+    }
+}
+
+void Input::MergeEvent(const InputEvent& event) {
+    if (event.type == InputEventType::MouseMotion) {
+        m_pendingMotion = event; // Only the latest position matters
+        m_hasPendingMotion = true;
+        return;
+    }
+
+    if (!m_hasPendingWheel) {
+        m_pendingWheel = event;
+        m_hasPendingWheel = true;
+        return;
+    }
+    m_pendingWheel.x += event.x;
+    m_pendingWheel.y += event.y;
+    m_pendingWheel.timestamp = event.timestamp;
+}
+
+void Input::BeginFixedStep() {
+    m_step++;
+    m_inFixedStep = true;
+}
+
+void Input::EndFixedStep() {
+    m_inFixedStep = false;
+}
+
+void Input::ApplyEvent(const InputEvent& event) {
+    switch (event.type) {
+        case InputEventType::KeyDown:
+        case InputEventType::KeyUp: {
+            if (event.repeat || event.code < 0 || event.code >= SDL_NUM_SCANCODES) break;
+
+            const bool down = event.type == InputEventType::KeyDown;
+            ButtonState& key = m_keys[event.code];
+            if (key.down == down) break;
+
+            SetButton(key, down, event.timestamp);
+            SetKeyActions(static_cast<SDL_Scancode>(event.code), down, event.timestamp);
+            break;
+        }
+        case InputEventType::MouseButtonDown:
+        case InputEventType::MouseButtonUp: {
+            m_mouseX = event.x;
+            m_mouseY = event.y;
+            if (event.code < 0 || event.code >= MOUSE_BUTTON_COUNT) break;
+
+            const bool down = event.type == InputEventType::MouseButtonDown;
+            if (m_mouseButtons[event.code].down != down) {
+                SetButton(m_mouseButtons[event.code], down, event.timestamp);
+            }
+            break;
+        }
+        case InputEventType::MouseMotion:
+            m_mouseX = event.x;
+            m_mouseY = event.y;
+            break;
+        case InputEventType::MouseWheel:
+            m_wheelX += event.x;
+            m_wheelY += event.y;
+            break;
+    }
+}
+
+void Input::SetButton(ButtonState& state, bool down, Uint32 timestamp) {
+    // The next fixed step to run reports it, however many frames that takes
+    state.down = down;
+    if (down) {
+        state.pressedFrame = m_frame;
+        state.pressedStep = m_step + 1;
+        state.pressTime = timestamp;
+    } else {
+        state.releasedFrame = m_frame;
+        state.releasedStep = m_step + 1;
+    }
+}
+
+void Input::SetKeyActions(SDL_Scancode key, bool down, Uint32 timestamp) {
+    for (uint64_t mask = m_keyActions[key]; mask != 0; mask &= mask - 1) {
+        ActionState& action = m_actions[std::countr_zero(mask)];
+
+        // An action is held while any of its keys is
+        const int previouslyHeld = action.heldKeys;
+        action.heldKeys += down ? 1 : -1;
+        if (previouslyHeld == 0 && action.heldKeys > 0) {
+            SetButton(action.state, true, timestamp);
+        } else if (previouslyHeld > 0 && action.heldKeys == 0) {
+            SetButton(action.state, false, timestamp);
+        }
+    }
+}
+
+bool Input::WasPressed(const ButtonState& state) const {
+    return m_inFixedStep ? state.pressedStep == m_step : state.pressedFrame == m_frame;
+}
+
+bool Input::WasReleased(const ButtonState& state) const {
+    return m_inFixedStep ? state.releasedStep == m_step : state.releasedFrame == m_frame;
 }
 
 bool Input::IsKeyPressed(SDL_Scancode key) const {
-    if (!m_currentKeyState || key >= m_numKeys) return false;
-    return m_currentKeyState[key] != 0;
+    if (key < 0 || key >= SDL_NUM_SCANCODES) return false;
+    return m_keys[key].down;
 }
 
 bool Input::IsKeyJustPressed(SDL_Scancode key) const {
-    if (!m_currentKeyState || !m_previousKeyState || key >= m_numKeys) return false;
-    return m_currentKeyState[key] && !m_previousKeyState[key];
+    if (key < 0 || key >= SDL_NUM_SCANCODES) return false;
+    return WasPressed(m_keys[key]);
+}
+
+bool Input::IsKeyJustReleased(SDL_Scancode key) const {
+    if (key < 0 || key >= SDL_NUM_SCANCODES) return false;
+    return WasReleased(m_keys[key]);
+}
+
+const Input::ButtonState* Input::GetMouseButton(int button) const {
+    if (button < 0 || button >= MOUSE_BUTTON_COUNT) return nullptr;
+    return &m_mouseButtons[button];
 }
 
 bool Input::IsMouseButtonPressed(int button) const {
-    return (m_currentMouseState & SDL_BUTTON(button)) != 0;
+    const ButtonState* state = GetMouseButton(button);
+    return state && state->down;
+}
+
+bool Input::IsMouseButtonJustPressed(int button) const {
+    const ButtonState* state = GetMouseButton(button);
+    return state && WasPressed(*state);
+}
+
+bool Input::IsMouseButtonJustReleased(int button) const {
+    const ButtonState* state = GetMouseButton(button);
+    return state && WasReleased(*state);
 }
 
 void Input::GetMousePosition(int& x, int& y) const {
@@ -59,4 +255,113 @@ void Input::GetMousePosition(int& x, int& y) const {
     y = m_mouseY;
 }
 
-} // namespace input
\ No newline at end of file
+void Input::GetMouseWheel(int& x, int& y) const {
+    x = m_wheelX;
+    y = m_wheelY;
+}
+
+int Input::GetActionId(const std::string& action) const {
+    auto it = m_actionIds.find(action);
+    return it != m_actionIds.end() ? it->second : -1;
+}
+
+const Input::ActionState* Input::GetAction(int action) const {
+    if (action < 0 || action >= static_cast<int>(m_actions.size())) return nullptr;
+    return &m_actions[action];
+}
+
+bool Input::IsActionPressed(int action) const {
+    const ActionState* state = GetAction(action);
+    return state && state->state.down;
+}
+
+bool Input::IsActionJustPressed(int action) const {
+    const ActionState* state = GetAction(action);
+    return state && WasPressed(state->state);
+}
+
+bool Input::IsActionJustReleased(int action) const {
+    const ActionState* state = GetAction(action);
+    return state && WasReleased(state->state);
+}
+
+Uint32 Input::GetActionPressTime(int action) const {
+    const ActionState* state = GetAction(action);
+    return state ? state->state.pressTime : 0;
+}
+
+bool Input::IsActionPressed(const std::string& action) const {
+    return IsActionPressed(GetActionId(action));
+}
+
+bool Input::IsActionJustPressed(const std::string& action) const {
+    return IsActionJustPressed(GetActionId(action));
+}
+
+bool Input::IsActionJustReleased(const std::string& action) const {
+    return IsActionJustReleased(GetActionId(action));
+}
+
+void Input::LoadBindings() {
+    const nlohmann::json bindings = utils::Config::Instance()->GetSection("input.key_bindings");
+
+    // Ids stay stable for actions that keep existing across a reload
+    std::vector<ActionState> actions;
+    std::unordered_map<std::string, int> actionIds;
+    for (const auto& previous : m_actions) {
+        actionIds.emplace(previous.name, static_cast<int>(actions.size()));
+        actions.push_back({previous.name, 0, previous.state});
+    }
+    m_keyActions.fill(0);
+
+    auto bindKey = [&](int action, const std::string& keyName) {
+        const SDL_Scancode key = SDL_GetScancodeFromName(keyName.c_str());
+        if (key == SDL_SCANCODE_UNKNOWN) {
+            spdlog::warn("Input binding '{}': unknown key '{}'", actions[action].name, keyName);
+            return;
+        }
+        m_keyActions[key] |= uint64_t(1) << action;
+    };
+
+    if (bindings.is_object()) {
+        for (const auto& [name, keys] : bindings.items()) {
+            auto it = actionIds.find(name);
+            if (it == actionIds.end()) {
+                if (static_cast<int>(actions.size()) >= MAX_ACTIONS) {
+                    spdlog::warn("Input binding '{}' ignored - at most {} actions", name, MAX_ACTIONS);
+                    continue;
+                }
+                it = actionIds.emplace(name, static_cast<int>(actions.size())).first;
+                actions.push_back({name, 0, ButtonState{}});
+            }
+
+            if (keys.is_string()) {
+                bindKey(it->second, keys.get<std::string>());
+            } else if (keys.is_array()) {
+                for (const auto& key : keys) {
+                    if (key.is_string()) bindKey(it->second, key.get<std::string>());
+                }
+            }
+        }
+    }
+
+    m_actions = std::move(actions);
+    m_actionIds = std::move(actionIds);
+
+    // Keys already held count towards their new actions
+    for (int key = 0; key < SDL_NUM_SCANCODES; ++key) {
+        if (!m_keys[key].down) continue;
+        for (uint64_t mask = m_keyActions[key]; mask != 0; mask &= mask - 1) {
+            m_actions[std::countr_zero(mask)].heldKeys++;
+        }
+    }
+    for (auto& action : m_actions) {
+        if (action.state.down != (action.heldKeys > 0)) {
+            SetButton(action.state, action.heldKeys > 0, SDL_GetTicks());
+        }
+    }
+
+    spdlog::info("Input: {} actions bound", m_actions.size());
+}
+
+} // namespace input
@@ -0,0 +1,168 @@
+#include "engine/public/particles/ParticleSystem.h"
+#include "engine/public/core/Engine.h"
+#include "engine/public/core/JobSystem.h"
+#include "engine/public/rendering/Renderer.h"
+#include "engine/public/utils/Config.h"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+
+namespace particles {
+
+ParticleSystem::ParticleSystem() = default;
+
+ParticleSystem::~ParticleSystem() {
+    Shutdown();
+}
+
+bool ParticleSystem::Initialize() {
+    if (m_initialized) {
+        return true;
+    }
+
+    auto& config = core::Engine::Config();
+    m_batchSize = static_cast<size_t>(std::max(config.GetInt("particles.job_batch_size", 4096), 256));
+    m_jobs = &core::Engine::Jobs();
+
+    m_initialized = true;
+    spdlog::info("Particle system initialized ({} particles per job)", m_batchSize);
+    return true;
+}
+
+void ParticleSystem::Shutdown() {
+    if (!m_initialized) {
+        return;
+    }
+
+    Clear();
+    m_settings.clear();
+    m_jobs = nullptr;
+    m_initialized = false;
+}
+
+std::shared_ptr<const EmitterSettings> ParticleSystem::LoadEmitter(const std::string& path) {
+    auto it = m_settings.find(path);
+    if (it != m_settings.end()) {
+        return it->second;
+    }
+
+    std::shared_ptr<const EmitterSettings> settings = EmitterSettings::Load(path);
+    if (settings) {
+        m_settings[path] = settings;
+    }
+    return settings;
+}
+
+void ParticleSystem::UnloadEmitter(const std::string& path) {
+    m_settings.erase(path);
+}
+
+std::shared_ptr<ParticleEmitter> ParticleSystem::CreateEmitter(std::shared_ptr<const EmitterSettings> settings, const glm::vec2& position) {
+    if (!m_initialized || !settings) {
+        return nullptr;
+    }
+
+    // Every emitter gets its own random sequence, reproducible for the same creation order
+    auto emitter = std::make_shared<ParticleEmitter>(std::move(settings), position, m_nextSeed++);
+    m_emitters.push_back(emitter);
+    return emitter;
+}
+
+void ParticleSystem::DestroyEmitter(const std::shared_ptr<ParticleEmitter>& emitter) {
+    m_emitters.erase(std::remove(m_emitters.begin(), m_emitters.end(), emitter), m_emitters.end());
+}
+
+void ParticleSystem::Clear() {
+    m_emitters.clear();
+    m_active.clear();
+    m_ranges.clear();
+}
+
+size_t ParticleSystem::GetParticleCount() const {
+    size_t count = 0;
+    for (const auto& emitter : m_emitters) {
+        count += emitter->GetParticleCount();
+    }
+    return count;
+}
+
+bool ParticleSystem::BuildRanges(const std::vector<ParticleEmitter*>& emitters) {
+    m_ranges.clear();
+    size_t total = 0;
+    for (ParticleEmitter* emitter : emitters) {
+        const size_t count = emitter->GetParticleCount();
+        for (size_t begin = 0; begin < count; begin += m_batchSize) {
+            m_ranges.push_back({emitter, begin, std::min(count, begin + m_batchSize)});
+        }
+        total += count;
+    }
+    return m_jobs && m_jobs->GetWorkerCount() > 0 && total > m_batchSize;
+}
+
+void ParticleSystem::Update(float deltaTime) {
+    if (!m_initialized || m_emitters.empty()) {
+        return;
+    }
+
+    // Finished emitters nobody else holds on to
+    m_emitters.erase(std::remove_if(m_emitters.begin(), m_emitters.end(), [](const std::shared_ptr<ParticleEmitter>& emitter) {
+        return !emitter->IsAlive() && emitter.use_count() == 1;
+    }), m_emitters.end());
+
+    m_active.clear();
+    for (const auto& emitter : m_emitters) {
+        m_active.push_back(emitter.get());
+    }
+
+    // Integrate in fixed-size ranges, spread across the job system when there are enough of them
+    if (BuildRanges(m_active)) {
+        m_jobs->ParallelFor(m_ranges.size(), 1, [this, deltaTime](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                m_ranges[i].emitter->Simulate(m_ranges[i].begin, m_ranges[i].end, deltaTime);
+            }
+        });
+    } else {
+        for (const Range& range : m_ranges) {
+            range.emitter->Simulate(range.begin, range.end, deltaTime);
+        }
+    }
+
+    // Compaction and emission change the particle count, so they stay per emitter on this thread
+    for (ParticleEmitter* emitter : m_active) {
+        emitter->Retire();
+        emitter->UpdateEmission(deltaTime);
+    }
+}
+
+void ParticleSystem::Draw(rendering::Renderer& renderer) {
+    if (!m_initialized || m_emitters.empty()) {
+        return;
+    }
+
+    // Whole emitters are culled by their bounds
+    m_active.clear();
+    for (const auto& emitter : m_emitters) {
+        if (emitter->GetParticleCount() > 0 && renderer.IsVisible(emitter->GetBounds())) {
+            emitter->m_vertices.resize(emitter->GetParticleCount() * 4);
+            m_active.push_back(emitter.get());
+        }
+    }
+
+    // Quads are built into each emitter's own vertex array, so ranges never share memory
+    if (BuildRanges(m_active)) {
+        m_jobs->ParallelFor(m_ranges.size(), 1, [this](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                m_ranges[i].emitter->BuildVertices(m_ranges[i].begin, m_ranges[i].end);
+            }
+        });
+    } else {
+        for (const Range& range : m_ranges) {
+            range.emitter->BuildVertices(range.begin, range.end);
+        }
+    }
+
+    for (ParticleEmitter* emitter : m_active) {
+        renderer.DrawQuads(emitter->GetSettings().texture, emitter->m_vertices.data(), emitter->GetParticleCount());
+    }
+}
+
+} // namespace particles
@@ -1,8 +1,105 @@
 #include "engine/public/physics/Physics.h"
+#include "engine/public/physics/RigidBody.h"
+#include "engine/public/core/Engine.h"
+#include "engine/public/core/JobSystem.h"
+#include "engine/public/rendering/Renderer.h"
+#include "engine/public/utils/Config.h"
 #include <spdlog/spdlog.h>
+#include <glm/gtc/constants.hpp>
+#include <algorithm>
+#include <bit>
+#include <thread>
 
 namespace physics {
 
+namespace {
+
+constexpr float DEBUG_FILL_ALPHA = 0.35f;
+constexpr float DEBUG_LINE_THICKNESS = 1.0f;
+constexpr int DEBUG_MAX_POLYGON_VERTICES = 8; // B2_MAX_POLYGON_VERTICES
+
+glm::vec4 ToColor(b2HexColor color, float alpha) {
+    const uint32_t rgb = static_cast<uint32_t>(color);
+    return {((rgb >> 16) & 0xFF) / 255.0f, ((rgb >> 8) & 0xFF) / 255.0f, (rgb & 0xFF) / 255.0f, alpha};
+}
+
+glm::vec2 ToVec2(b2Vec2 v) {
+    return {v.x, v.y};
+}
+
+rendering::Renderer& GetRenderer(void* context) {
+    return *static_cast<rendering::Renderer*>(context);
+}
+
+void DrawPolygon(const b2Vec2* vertices, int vertexCount, b2HexColor color, void* context) {
+    glm::vec2 points[DEBUG_MAX_POLYGON_VERTICES];
+    const int count = std::min(vertexCount, DEBUG_MAX_POLYGON_VERTICES);
+    for (int i = 0; i < count; ++i) {
+        points[i] = ToVec2(vertices[i]);
+    }
+    GetRenderer(context).DrawPolygonOutline(points, count, ToColor(color, 1.0f), DEBUG_LINE_THICKNESS);
+}
+
+void DrawSolidPolygon(b2Transform transform, const b2Vec2* vertices, int vertexCount, float radius, b2HexColor color, void* context) {
+    // Rounded polygons are drawn without their rounding
+    (void)radius;
+    glm::vec2 points[DEBUG_MAX_POLYGON_VERTICES];
+    const int count = std::min(vertexCount, DEBUG_MAX_POLYGON_VERTICES);
+    for (int i = 0; i < count; ++i) {
+        points[i] = ToVec2(b2TransformPoint(transform, vertices[i]));
+    }
+    rendering::Renderer& renderer = GetRenderer(context);
+    renderer.DrawPolygon(points, count, ToColor(color, DEBUG_FILL_ALPHA));
+    renderer.DrawPolygonOutline(points, count, ToColor(color, 1.0f), DEBUG_LINE_THICKNESS);
+}
+
+void DrawCircle(b2Vec2 center, float radius, b2HexColor color, void* context) {
+    GetRenderer(context).DrawCircleOutline(ToVec2(center), radius, ToColor(color, 1.0f), DEBUG_LINE_THICKNESS);
+}
+
+void DrawSolidCircle(b2Transform transform, float radius, b2HexColor color, void* context) {
+    rendering::Renderer& renderer = GetRenderer(context);
+    const glm::vec2 center = ToVec2(transform.p);
+    renderer.DrawCircle(center, radius, ToColor(color, DEBUG_FILL_ALPHA));
+    renderer.DrawCircleOutline(center, radius, ToColor(color, 1.0f), DEBUG_LINE_THICKNESS);
+    
+    // Radius line shows the rotation
+    renderer.DrawLine(center, center + glm::vec2(transform.q.c, transform.q.s) * radius, ToColor(color, 1.0f), DEBUG_LINE_THICKNESS);
+}
+
+void DrawSolidCapsule(b2Vec2 p1, b2Vec2 p2, float radius, b2HexColor color, void* context) {
+    rendering::Renderer& renderer = GetRenderer(context);
+    const glm::vec2 a = ToVec2(p1);
+    const glm::vec2 b = ToVec2(p2);
+    const glm::vec4 fill = ToColor(color, DEBUG_FILL_ALPHA);
+    const glm::vec4 outline = ToColor(color, 1.0f);
+    
+    // Body as a thick line, caps as circles (the overlaps blend a little darker - fine for debugging)
+    renderer.DrawLine(a, b, fill, radius * 2.0f);
+    renderer.DrawCircle(a, radius, fill);
+    renderer.DrawCircle(b, radius, fill);
+    renderer.DrawCircleOutline(a, radius, outline, DEBUG_LINE_THICKNESS);
+    renderer.DrawCircleOutline(b, radius, outline, DEBUG_LINE_THICKNESS);
+    
+    const glm::vec2 delta = b - a;
+    const float length = glm::length(delta);
+    if (length > 0.0f) {
+        const glm::vec2 offset = glm::vec2(-delta.y, delta.x) * (radius / length);
+        renderer.DrawLine(a + offset, b + offset, outline, DEBUG_LINE_THICKNESS);
+        renderer.DrawLine(a - offset, b - offset, outline, DEBUG_LINE_THICKNESS);
+    }
+}
+
+void DrawSegment(b2Vec2 p1, b2Vec2 p2, b2HexColor color, void* context) {
+    GetRenderer(context).DrawLine(ToVec2(p1), ToVec2(p2), ToColor(color, 1.0f), DEBUG_LINE_THICKNESS);
+}
+
+void DrawPoint(b2Vec2 p, float size, b2HexColor color, void* context) {
+    GetRenderer(context).DrawCircle(ToVec2(p), size * 0.5f, ToColor(color, 1.0f), 8);
+}
+
+} // namespace
+
 Physics::Physics() : m_initialized(false) {
     m_worldId = b2_nullWorldId;
 }
@@ -14,10 +111,38 @@ Physics::~Physics() {
 bool Physics::Initialize() {
     spdlog::info("Initializing physics...");
     
+    auto config = utils::Config::Instance();
+    SetSubStepCount(config->GetInt("physics.substep_count", 4));
+    m_debugDrawEnabled = config->GetBool("physics.debug_draw", false);
+    
     // Create Box2D world with no gravity by default
     b2WorldDef worldDef = b2DefaultWorldDef();
     worldDef.gravity = {0.0f, 0.0f}; // No gravity by default - set it if needed
     
+    // Hand Box2D's solver tasks to the job system. Box2D indexes per-worker scratch data by
+    // workerIndex, so every running range takes a slot of its own below the worker count (one
+    // per job system thread, not the thread index - threads outside the system all report 0);
+    // worker_count only caps how many ranges each task is split into.
+    core::JobSystem& jobs = core::Engine::Jobs();
+    const int threadCount = std::min(static_cast<int>(jobs.GetThreadCount()), MAX_PHYSICS_WORKERS);
+    const int configuredWorkers = config->GetInt("physics.worker_count", 0);
+    m_workerCount = configuredWorkers > 0 ? std::min(configuredWorkers, threadCount) : threadCount;
+    
+    if (jobs.IsInitialized() && m_workerCount > 1) {
+        for (auto& counter : m_taskCounters) {
+            if (!counter) {
+                counter = std::make_unique<core::JobCounter>();
+            }
+        }
+        m_freeWorkerSlots.store(threadCount >= 64 ? ~uint64_t{0} : (uint64_t{1} << threadCount) - 1, std::memory_order_relaxed);
+        worldDef.workerCount = threadCount;
+        worldDef.enqueueTask = &Physics::EnqueueTask;
+        worldDef.finishTask = &Physics::FinishTask;
+        worldDef.userTaskContext = this;
+    } else {
+        m_workerCount = 1;
+    }
+    
     m_worldId = b2CreateWorld(&worldDef);
     if (m_worldId.index1 == 0) { // Check if world creation failed
         spdlog::error("Failed to create Box2D world");
@@ -25,12 +150,15 @@ bool Physics::Initialize() {
     }
     
     m_initialized = true;
-    spdlog::info("Physics initialized successfully (no gravity - use SetGravity() to enable)");
+    spdlog::info("Physics initialized successfully ({} worker threads, {} substeps, no gravity - use SetGravity() to enable)",
+                 m_workerCount, m_subStepCount);
     return true;
 }
 
 void Physics::Shutdown() {
     if (m_initialized && m_worldId.index1 != 0) {
+        ClearMovedBodies();
+        m_lastStepMoved.clear();
         b2DestroyWorld(m_worldId);
         m_worldId = b2_nullWorldId;
         m_initialized = false;
@@ -41,9 +169,158 @@ void Physics::Shutdown() {
 void Physics::FixedUpdate(float fixedDeltaTime) {
     if (!m_initialized) return;
     
+    // Bodies that moved last step start this one from where they ended up (all others already have
+    // previous == current), so interpolation always blends the last two steps
+    for (b2BodyId bodyId : m_lastStepMoved) {
+        if (RigidBody* body = RigidBody::FromBodyId(bodyId)) {
+            body->SavePreviousPose();
+        }
+    }
+    m_lastStepMoved.clear();
+    
     // Step the physics simulation with fixed timestep
-    int32_t subStepCount = 4;
-    b2World_Step(m_worldId, fixedDeltaTime, subStepCount);
+    b2World_Step(m_worldId, fixedDeltaTime, m_subStepCount);
+    m_taskCount = 0; // Every task was finished inside the step
+    
+    CollectMoveEvents();
+}
+
+void Physics::SetSubStepCount(int subStepCount) {
+    m_subStepCount = std::max(1, subStepCount);
+}
+
+void* Physics::EnqueueTask(b2TaskCallback* task, int32_t itemCount, int32_t minRange, void* taskContext, void* userContext) {
+    Physics* physics = static_cast<Physics*>(userContext);
+    core::JobSystem& jobs = core::Engine::Jobs();
+    
+    // Out of fences - run on the stepping thread
+    if (physics->m_taskCount >= MAX_PHYSICS_TASKS) {
+        const uint32_t slot = physics->AcquireWorkerSlot();
+        task(0, itemCount, slot, taskContext);
+        physics->ReleaseWorkerSlot(slot);
+        return nullptr;
+    }
+    
+    // Always a job, even for one item: the solver enqueues one single-item task per worker and
+    // those must run side by side
+    const int32_t rangeCount = std::max<int32_t>(1, std::min<int32_t>(physics->m_workerCount, itemCount / std::max(1, minRange)));
+    core::JobCounter* counter = physics->m_taskCounters[physics->m_taskCount++].get();
+    const int32_t rangeSize = (itemCount + rangeCount - 1) / rangeCount;
+    
+    for (int32_t start = 0; start < itemCount; start += rangeSize) {
+        const int32_t end = std::min(itemCount, start + rangeSize);
+        jobs.Submit([physics, task, start, end, taskContext] {
+            const uint32_t slot = physics->AcquireWorkerSlot();
+            task(start, end, slot, taskContext);
+            physics->ReleaseWorkerSlot(slot);
+        }, counter);
+    }
+    
+    return counter;
+}
+
+void Physics::FinishTask(void* userTask, [[maybe_unused]] void* userContext) {
+    if (!userTask) {
+        return; // Ran inline
+    }
+    
+    // Helps run the remaining ranges while waiting
+    core::Engine::Jobs().Wait(*static_cast<core::JobCounter*>(userTask));
+}
+
+uint32_t Physics::AcquireWorkerSlot() {
+    // Every running range holds one slot, and at most one range runs per job system thread,
+    // so a free slot always exists - the loop only retries lost races
+    uint64_t free = m_freeWorkerSlots.load(std::memory_order_acquire);
+    while (true) {
+        if (free == 0) {
+            std::this_thread::yield();
+            free = m_freeWorkerSlots.load(std::memory_order_acquire);
+            continue;
+        }
+        const uint64_t lowest = free & (~free + 1);
+        if (m_freeWorkerSlots.compare_exchange_weak(free, free & ~lowest, std::memory_order_acquire)) {
+            return static_cast<uint32_t>(std::countr_zero(lowest));
+        }
+    }
+}
+
+void Physics::ReleaseWorkerSlot(uint32_t slot) {
+    m_freeWorkerSlots.fetch_or(uint64_t{1} << slot, std::memory_order_release);
+}
+
+void Physics::ClearMovedBodies() {
+    m_movedBodies.clear();
+    m_movedBodyIndex.clear();
+    m_stepsSinceClear = 0;
+}
+
+void Physics::CollectMoveEvents() {
+    // Move events are only valid until the next step - copy out what we need now
+    const b2BodyEvents events = b2World_GetBodyEvents(m_worldId);
+    constexpr float radiansToDegrees = 180.0f / glm::pi<float>();
+    
+    // First step since the clear can't produce duplicates - only index bodies once a second step merges in
+    const bool merge = m_stepsSinceClear > 0;
+    if (merge && m_movedBodyIndex.empty()) {
+        for (size_t slot = 0; slot < m_movedBodies.size(); ++slot) {
+            m_movedBodyIndex.emplace(m_movedBodies[slot].bodyId.index1, slot);
+        }
+    }
+    m_stepsSinceClear++;
+    
+    m_movedBodies.reserve(m_movedBodies.size() + events.moveCount);
+    m_lastStepMoved.reserve(events.moveCount);
+    for (int i = 0; i < events.moveCount; ++i) {
+        const b2BodyMoveEvent& event = events.moveEvents[i];
+        
+        BodyMove move;
+        move.bodyId = event.bodyId;
+        move.userData = event.userData;
+        move.position = {event.transform.p.x, event.transform.p.y};
+        move.rotation = b2Rot_GetAngle(event.transform.q) * radiansToDegrees;
+        move.fellAsleep = event.fellAsleep;
+        
+        // Nothing can destroy a body between the step and here, so the back pointer is safe to use
+        if (RigidBody* body = static_cast<RigidBody*>(event.userData)) {
+            body->SetCurrentPose(move.position, move.rotation);
+        }
+        m_lastStepMoved.push_back(event.bodyId);
+        
+        if (!merge) {
+            m_movedBodies.push_back(move);
+            continue;
+        }
+        
+        // Several steps per frame: keep one entry per body with its latest pose
+        auto [it, inserted] = m_movedBodyIndex.try_emplace(event.bodyId.index1, m_movedBodies.size());
+        if (inserted) {
+            m_movedBodies.push_back(move);
+        } else {
+            m_movedBodies[it->second] = move;
+        }
+    }
+}
+
+void Physics::DebugDraw(rendering::Renderer& renderer) {
+    if (!m_initialized) {
+        return;
+    }
+    
+    // Callbacks not set here keep Box2D's no-op defaults (transforms, strings)
+    b2DebugDraw debugDraw = b2DefaultDebugDraw();
+    debugDraw.DrawPolygonFcn = DrawPolygon;
+    debugDraw.DrawSolidPolygonFcn = DrawSolidPolygon;
+    debugDraw.DrawCircleFcn = DrawCircle;
+    debugDraw.DrawSolidCircleFcn = DrawSolidCircle;
+    debugDraw.DrawSolidCapsuleFcn = DrawSolidCapsule;
+    debugDraw.DrawSegmentFcn = DrawSegment;
+    debugDraw.DrawPointFcn = DrawPoint;
+    debugDraw.drawShapes = true;
+    debugDraw.drawJoints = true;
+    debugDraw.context = &renderer;
+    
+    b2World_Draw(m_worldId, &debugDraw);
 }
 
 void Physics::SetGravity(float x, float y) {
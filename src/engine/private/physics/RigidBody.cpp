@@ -30,6 +30,9 @@ RigidBody::RigidBody(const core::Transform& initialTransform, Type type) : m_typ
     
     if (m_bodyId.index1 != 0) {
         m_valid = true;
+        b2Body_SetUserData(m_bodyId, this);
+        m_previousPosition = m_currentPosition = initialTransform.position;
+        m_previousRotation = m_currentRotation = initialTransform.rotation;
     } else {
         spdlog::error("Failed to create physics body");
     }
@@ -41,27 +44,90 @@ RigidBody::~RigidBody() {
     }
 }
 
+RigidBody::RigidBody(RigidBody&& other) noexcept
+    : m_bodyId(other.m_bodyId)
+    , m_type(other.m_type)
+    , m_valid(other.m_valid)
+    , m_entity(other.m_entity)
+    , m_previousPosition(other.m_previousPosition)
+    , m_currentPosition(other.m_currentPosition)
+    , m_previousRotation(other.m_previousRotation)
+    , m_currentRotation(other.m_currentRotation) {
+    
+    // Box2D's back pointer has to follow the object
+    if (m_valid) {
+        b2Body_SetUserData(m_bodyId, this);
+    }
+    
+    other.m_bodyId = b2_nullBodyId;
+    other.m_valid = false;
+}
+
+RigidBody& RigidBody::operator=(RigidBody&& other) noexcept {
+    if (this != &other) {
+        if (m_valid && m_bodyId.index1 != 0) {
+            b2DestroyBody(m_bodyId);
+        }
+        
+        m_bodyId = other.m_bodyId;
+        m_type = other.m_type;
+        m_valid = other.m_valid;
+        m_entity = other.m_entity;
+        m_previousPosition = other.m_previousPosition;
+        m_currentPosition = other.m_currentPosition;
+        m_previousRotation = other.m_previousRotation;
+        m_currentRotation = other.m_currentRotation;
+        
+        if (m_valid) {
+            b2Body_SetUserData(m_bodyId, this);
+        }
+        
+        other.m_bodyId = b2_nullBodyId;
+        other.m_valid = false;
+    }
+    return *this;
+}
+
 void RigidBody::SetPosition(const glm::vec2& position) {
     if (!m_valid) return;
     b2Body_SetTransform(m_bodyId, {position.x, position.y}, b2Body_GetRotation(m_bodyId));
+    m_previousPosition = m_currentPosition = position;
 }
 
 void RigidBody::SetRotation(float degrees) {
     if (!m_valid) return;
     float radians = degrees * glm::pi<float>() / 180.0f;
     b2Body_SetTransform(m_bodyId, b2Body_GetPosition(m_bodyId), b2MakeRot(radians));
+    m_previousRotation = m_currentRotation = degrees;
 }
 
-glm::vec2 RigidBody::GetPosition() const {
-    if (!m_valid) return {0, 0};
-    b2Vec2 pos = b2Body_GetPosition(m_bodyId);
-    return {pos.x, pos.y};
+glm::vec2 RigidBody::GetInterpolatedPosition(float alpha) const {
+    return m_previousPosition + (m_currentPosition - m_previousPosition) * alpha;
+}
+
+float RigidBody::GetInterpolatedRotation(float alpha) const {
+    return core::Transform::LerpDegrees(m_previousRotation, m_currentRotation, alpha);
+}
+
+core::Transform RigidBody::GetInterpolatedTransform(float alpha, const glm::vec2& scale) const {
+    return core::Transform(GetInterpolatedPosition(alpha), GetInterpolatedRotation(alpha), scale);
+}
+
+RigidBody* RigidBody::FromBodyId(b2BodyId bodyId) {
+    if (!b2Body_IsValid(bodyId)) {
+        return nullptr;
+    }
+    return static_cast<RigidBody*>(b2Body_GetUserData(bodyId));
+}
+
+void RigidBody::SavePreviousPose() {
+    m_previousPosition = m_currentPosition;
+    m_previousRotation = m_currentRotation;
 }
 
-float RigidBody::GetRotation() const {
-    if (!m_valid) return 0.0f;
-    b2Rot rotation = b2Body_GetRotation(m_bodyId);
-    return b2Rot_GetAngle(rotation) * 180.0f / glm::pi<float>();
+void RigidBody::SetCurrentPose(const glm::vec2& position, float rotation) {
+    m_currentPosition = position;
+    m_currentRotation = rotation;
 }
 
 void RigidBody::ApplyForce(const glm::vec2& force) {
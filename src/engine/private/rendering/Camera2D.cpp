@@ -0,0 +1,65 @@
+#include "engine/public/rendering/Camera2D.h"
+#include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
+#include <cmath>
+
+namespace rendering {
+
+Camera2D::Camera2D(float viewportWidth, float viewportHeight) {
+    SetViewportSize(viewportWidth, viewportHeight);
+
+    // Start out showing the same area as the renderer's default projection
+    m_position = m_viewportSize * 0.5f;
+}
+
+void Camera2D::SetViewportSize(float width, float height) {
+    m_viewportSize = {std::max(1.0f, width), std::max(1.0f, height)};
+}
+
+void Camera2D::SetZoom(float zoom) {
+    m_zoom = std::max(MIN_ZOOM, zoom);
+}
+
+glm::mat4 Camera2D::GetViewMatrix() const {
+    // World -> centred on the camera -> rotated -> zoomed -> moved to the viewport centre
+    glm::mat4 view(1.0f);
+    view = glm::translate(view, glm::vec3(m_viewportSize * 0.5f, 0.0f));
+    view = glm::scale(view, glm::vec3(m_zoom, m_zoom, 1.0f));
+    view = glm::rotate(view, glm::radians(-m_rotation), glm::vec3(0.0f, 0.0f, 1.0f));
+    view = glm::translate(view, glm::vec3(-m_position, 0.0f));
+    return view;
+}
+
+glm::mat4 Camera2D::GetProjectionMatrix() const {
+    return glm::ortho(0.0f, m_viewportSize.x, m_viewportSize.y, 0.0f, -1.0f, 1.0f);
+}
+
+core::Bounds Camera2D::GetViewBounds() const {
+    const glm::vec2 corners[4] = {
+        ScreenToWorld({0.0f, 0.0f}),
+        ScreenToWorld({m_viewportSize.x, 0.0f}),
+        ScreenToWorld(m_viewportSize),
+        ScreenToWorld({0.0f, m_viewportSize.y})
+    };
+    return core::Bounds::FromPoints(corners, 4);
+}
+
+glm::vec2 Camera2D::ScreenToWorld(const glm::vec2& screen) const {
+    // Inverse of the view matrix, done directly
+    const glm::vec2 local = (screen - m_viewportSize * 0.5f) / m_zoom;
+    const float radians = glm::radians(m_rotation);
+    const float cosR = std::cos(radians);
+    const float sinR = std::sin(radians);
+    return m_position + glm::vec2(local.x * cosR - local.y * sinR, local.x * sinR + local.y * cosR);
+}
+
+glm::vec2 Camera2D::WorldToScreen(const glm::vec2& world) const {
+    const glm::vec2 offset = world - m_position;
+    const float radians = glm::radians(-m_rotation);
+    const float cosR = std::cos(radians);
+    const float sinR = std::sin(radians);
+    const glm::vec2 rotated(offset.x * cosR - offset.y * sinR, offset.x * sinR + offset.y * cosR);
+    return rotated * m_zoom + m_viewportSize * 0.5f;
+}
+
+} // namespace rendering
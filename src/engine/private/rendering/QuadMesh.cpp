@@ -0,0 +1,51 @@
+#include "engine/public/rendering/QuadMesh.h"
+#include <spdlog/spdlog.h>
+#include <glad/glad.h>
+#include <algorithm>
+
+namespace rendering {
+
+QuadMesh::~QuadMesh() {
+    Destroy();
+}
+
+bool QuadMesh::Build(const MeshVertex* vertices, size_t vertexCount) {
+    Destroy();
+
+    const size_t quadCount = vertexCount / 4;
+    if (!vertices || quadCount == 0) {
+        return false;
+    }
+    if (quadCount > MAX_QUADS) {
+        spdlog::error("Quad mesh too large ({} quads, max {})", quadCount, MAX_QUADS);
+        return false;
+    }
+
+    glGenBuffers(1, &m_buffer);
+    glBindBuffer(GL_ARRAY_BUFFER, m_buffer);
+    glBufferData(GL_ARRAY_BUFFER, quadCount * 4 * sizeof(MeshVertex), vertices, GL_STATIC_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    m_quadCount = quadCount;
+
+    m_bounds = core::Bounds(vertices[0].position, vertices[0].position);
+    for (size_t i = 1; i < quadCount * 4; ++i) {
+        const glm::vec2& position = vertices[i].position;
+        m_bounds.min.x = std::min(m_bounds.min.x, position.x);
+        m_bounds.min.y = std::min(m_bounds.min.y, position.y);
+        m_bounds.max.x = std::max(m_bounds.max.x, position.x);
+        m_bounds.max.y = std::max(m_bounds.max.y, position.y);
+    }
+    return true;
+}
+
+void QuadMesh::Destroy() {
+    if (m_buffer) {
+        glDeleteBuffers(1, &m_buffer);
+        m_buffer = 0;
+    }
+    m_quadCount = 0;
+    m_bounds = core::Bounds();
+}
+
+} // namespace rendering
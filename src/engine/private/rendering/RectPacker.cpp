@@ -0,0 +1,126 @@
+#include "engine/public/rendering/RectPacker.h"
+#include <limits>
+#include <algorithm>
+
+namespace rendering {
+
+namespace {
+
+bool ContainsRect(const glm::ivec4& outer, const glm::ivec4& inner) {
+    return inner.x >= outer.x && inner.y >= outer.y &&
+           inner.x + inner.z <= outer.x + outer.z &&
+           inner.y + inner.w <= outer.y + outer.w;
+}
+
+} // namespace
+
+RectPacker::RectPacker(int width, int height) {
+    Reset(width, height);
+}
+
+void RectPacker::Reset(int width, int height) {
+    m_width = width;
+    m_height = height;
+    m_usedArea = 0;
+    m_freeRects.clear();
+    m_freeRects.push_back({0, 0, width, height});
+}
+
+bool RectPacker::Insert(int width, int height, glm::ivec2& outPosition) {
+    if (width <= 0 || height <= 0) {
+        return false;
+    }
+
+    // Best short side fit: pick the free rectangle that leaves the smallest leftover edge
+    int bestShortSide = std::numeric_limits<int>::max();
+    int bestLongSide = std::numeric_limits<int>::max();
+    glm::ivec4 bestRect = {0, 0, 0, 0};
+    bool found = false;
+
+    for (const auto& freeRect : m_freeRects) {
+        if (freeRect.z >= width && freeRect.w >= height) {
+            int leftoverX = freeRect.z - width;
+            int leftoverY = freeRect.w - height;
+            int shortSide = std::min(leftoverX, leftoverY);
+            int longSide = std::max(leftoverX, leftoverY);
+
+            if (shortSide < bestShortSide || (shortSide == bestShortSide && longSide < bestLongSide)) {
+                bestRect = {freeRect.x, freeRect.y, width, height};
+                bestShortSide = shortSide;
+                bestLongSide = longSide;
+                found = true;
+            }
+        }
+    }
+
+    if (!found) {
+        return false;
+    }
+
+    SplitFreeRects(bestRect);
+    PruneFreeRects();
+
+    m_usedArea += static_cast<size_t>(width) * height;
+    outPosition = {bestRect.x, bestRect.y};
+    return true;
+}
+
+float RectPacker::GetOccupancy() const {
+    if (m_width <= 0 || m_height <= 0) return 0.0f;
+    return static_cast<float>(m_usedArea) / (static_cast<float>(m_width) * m_height);
+}
+
+void RectPacker::SplitFreeRects(const glm::ivec4& usedRect) {
+    std::vector<glm::ivec4> newRects;
+
+    for (size_t i = 0; i < m_freeRects.size();) {
+        const glm::ivec4 freeRect = m_freeRects[i];
+
+        // No overlap - keep as is
+        if (usedRect.x >= freeRect.x + freeRect.z || usedRect.x + usedRect.z <= freeRect.x ||
+            usedRect.y >= freeRect.y + freeRect.w || usedRect.y + usedRect.w <= freeRect.y) {
+            ++i;
+            continue;
+        }
+
+        // Split the overlapped free rectangle into up to four maximal pieces
+        if (usedRect.x > freeRect.x) {
+            newRects.push_back({freeRect.x, freeRect.y, usedRect.x - freeRect.x, freeRect.w});
+        }
+        if (usedRect.x + usedRect.z < freeRect.x + freeRect.z) {
+            int x = usedRect.x + usedRect.z;
+            newRects.push_back({x, freeRect.y, freeRect.x + freeRect.z - x, freeRect.w});
+        }
+        if (usedRect.y > freeRect.y) {
+            newRects.push_back({freeRect.x, freeRect.y, freeRect.z, usedRect.y - freeRect.y});
+        }
+        if (usedRect.y + usedRect.w < freeRect.y + freeRect.w) {
+            int y = usedRect.y + usedRect.w;
+            newRects.push_back({freeRect.x, y, freeRect.z, freeRect.y + freeRect.w - y});
+        }
+
+        m_freeRects[i] = m_freeRects.back();
+        m_freeRects.pop_back();
+    }
+
+    m_freeRects.insert(m_freeRects.end(), newRects.begin(), newRects.end());
+}
+
+void RectPacker::PruneFreeRects() {
+    // Remove free rectangles fully contained in another one
+    for (size_t i = 0; i < m_freeRects.size(); ++i) {
+        for (size_t j = i + 1; j < m_freeRects.size();) {
+            if (ContainsRect(m_freeRects[i], m_freeRects[j])) {
+                m_freeRects.erase(m_freeRects.begin() + j);
+            } else if (ContainsRect(m_freeRects[j], m_freeRects[i])) {
+                m_freeRects.erase(m_freeRects.begin() + i);
+                --i;
+                break;
+            } else {
+                ++j;
+            }
+        }
+    }
+}
+
+} // namespace rendering
@@ -1,57 +1,54 @@
 #include "engine/public/rendering/Renderer.h"
+#include "engine/public/rendering/Camera2D.h"
 #include "engine/public/rendering/Window.h"
 #include "engine/public/rendering/Sprite.h"
 #include "engine/public/rendering/Texture.h"
 #include "engine/public/core/Transform.h"
+#include "engine/public/utils/Config.h"
 #include <spdlog/spdlog.h>
 #include <SDL.h>
 #include <glad/glad.h>
 #include <glm/gtc/matrix_transform.hpp>
-#include <glm/gtc/type_ptr.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
 
 namespace rendering {
 
-// Vertex shader source for sprite rendering (OpenGL 2.1 compatible)
+// Vertex shader source for batched sprite rendering (OpenGL 2.1 compatible)
+// Vertices arrive already transformed to world space, so only the view-projection is applied here.
 const char* spriteVertexShader = R"(
 #version 120
 attribute vec2 aPos;
 attribute vec2 aTexCoord;
+attribute vec4 aColor;
 
 uniform mat4 u_MVP;
-uniform vec2 u_spriteSize;
-uniform vec2 u_origin;
 
 varying vec2 TexCoord;
+varying vec4 Color;
 
 void main()
 {
-    // Apply origin offset to vertex position
-    vec2 offsetPos = aPos - u_origin;
-    
-    // Scale by sprite size
-    vec2 scaledPos = offsetPos * u_spriteSize;
-    
-    gl_Position = u_MVP * vec4(scaledPos, 0.0, 1.0);
+    gl_Position = u_MVP * vec4(aPos, 0.0, 1.0);
     TexCoord = aTexCoord;
+    Color = aColor;
 }
 )";
 
-// Fragment shader source for sprite rendering (OpenGL 2.1 compatible)
+// Fragment shader source for batched sprite rendering (OpenGL 2.1 compatible)
 const char* spriteFragmentShader = R"(
 #version 120
 varying vec2 TexCoord;
+varying vec4 Color;
 
 uniform sampler2D u_texture;
-uniform vec4 u_tint;
-uniform vec4 u_sourceRect; // x, y, width, height in texture coordinates
 
 void main()
 {
-    // Calculate texture coordinates based on source rectangle
-    vec2 adjustedTexCoord = u_sourceRect.xy + TexCoord * u_sourceRect.zw;
-    
-    vec4 texColor = texture2D(u_texture, adjustedTexCoord);
-    gl_FragColor = texColor * u_tint;
+    vec4 texColor = texture2D(u_texture, TexCoord);
+    gl_FragColor = texColor * Color;
     
     // Discard fully transparent pixels
     if (gl_FragColor.a < 0.01)
@@ -59,6 +56,63 @@ void main()
 }
 )";
 
+// Shaders for untextured primitives (rectangles, lines, circles, polygons)
+const char* primitiveVertexShader = R"(
+#version 120
+attribute vec2 aPos;
+attribute vec4 aColor;
+
+uniform mat4 u_MVP;
+
+varying vec4 Color;
+
+void main()
+{
+    gl_Position = u_MVP * vec4(aPos, 0.0, 1.0);
+    Color = aColor;
+}
+)";
+
+const char* primitiveFragmentShader = R"(
+#version 120
+varying vec4 Color;
+
+void main()
+{
+    gl_FragColor = Color;
+}
+)";
+
+namespace {
+
+constexpr float TWO_PI = 6.28318530718f;
+
+// Circle tessellation: roughly one segment per 4 pixels of circumference, within sane bounds
+int CircleSegments(float radius, int requested) {
+    if (requested > 0) {
+        return std::clamp(requested, 3, 256);
+    }
+    return std::clamp(static_cast<int>(TWO_PI * radius / 4.0f), 12, 64);
+}
+
+// Pack a normalized RGBA color into bytes (matches GL_UNSIGNED_BYTE attribute layout in memory)
+uint32_t PackColor(const glm::vec4& color) {
+    auto toByte = [](float value) {
+        return static_cast<uint32_t>(std::clamp(value, 0.0f, 1.0f) * 255.0f + 0.5f);
+    };
+    uint8_t bytes[4] = {
+        static_cast<uint8_t>(toByte(color.r)),
+        static_cast<uint8_t>(toByte(color.g)),
+        static_cast<uint8_t>(toByte(color.b)),
+        static_cast<uint8_t>(toByte(color.a))
+    };
+    uint32_t packed;
+    std::memcpy(&packed, bytes, sizeof(packed));
+    return packed;
+}
+
+} // namespace
+
 Renderer::Renderer() : m_context(nullptr) {
 }
 
@@ -93,36 +147,68 @@ bool Renderer::Initialize(Window* window) {
         return false;
     }
     
+    // Fresh context - forget any binding state tracked for a previous one
+    ShaderProgram::InvalidateBindingCache();
+    Texture::InvalidateBindingCache();
+    
     // Set OpenGL settings
     glViewport(0, 0, window->GetWidth(), window->GetHeight());
     glEnable(GL_BLEND);
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
     
+    m_cullingEnabled = utils::Config::Instance()->GetBool("graphics.culling", true);
+    
+    // Texture sampling defaults, applied to every texture created from here on
+    Texture::SetDefaultFilter(Texture::ParseFilter(utils::Config::Instance()->GetString("graphics.texture_filtering", "linear")));
+    Texture::SetGenerateMipmaps(utils::Config::Instance()->GetBool("graphics.generate_mipmaps", false));
+    
     // Setup default orthographic projection
     SetOrthographicProjection(0.0f, (float)window->GetWidth(), (float)window->GetHeight(), 0.0f);
     
     // Setup sprite rendering
     SetupSpriteShader();
     SetupQuadMesh();
+    SetupPlaceholderTexture();
+    SetupPrimitiveBatch();
     
+    m_window = window;
     m_initialized = true;
     spdlog::info("Renderer initialized successfully");
     spdlog::info("OpenGL Version: {}", (char*)glGetString(GL_VERSION));
     
+    auto config = utils::Config::Instance();
+    if (config->GetBool("graphics.render_thread", false)) {
+        StartRenderThread(config->GetInt("graphics.frames_in_flight", 2), config->GetBool("window.vsync", true) ? 1 : 0);
+    }
+    
     return true;
 }
 
 void Renderer::Shutdown() {
+    StopRenderThread();
+    
     if (m_initialized) {
         // Cleanup OpenGL resources
+        m_batchVertices.clear();
+        m_batchTexture.reset();
+        m_placeholderTexture.reset();
+        
         if (m_quadVBO) {
             glDeleteBuffers(1, &m_quadVBO);
             m_quadVBO = 0;
         }
-        if (m_spriteShader) {
-            glDeleteProgram(m_spriteShader);
-            m_spriteShader = 0;
+        if (m_quadIBO) {
+            glDeleteBuffers(1, &m_quadIBO);
+            m_quadIBO = 0;
+        }
+        m_spriteShader.Destroy();
+        
+        m_primitiveVertices.clear();
+        if (m_primitiveVBO) {
+            glDeleteBuffers(1, &m_primitiveVBO);
+            m_primitiveVBO = 0;
         }
+        m_primitiveShader.Destroy();
         
         m_initialized = false;
     }
@@ -134,92 +220,253 @@ void Renderer::Shutdown() {
     }
 }
 
+void Renderer::SetupPlaceholderTexture() {
+    // Grey checkerboard shown for sprites whose texture is still loading
+    constexpr int size = 32;
+    constexpr int cellSize = 8;
+    std::vector<unsigned char> pixels(size * size * 4);
+    for (int y = 0; y < size; ++y) {
+        for (int x = 0; x < size; ++x) {
+            const bool light = ((x / cellSize) + (y / cellSize)) % 2 == 0;
+            unsigned char* pixel = &pixels[(y * size + x) * 4];
+            pixel[0] = pixel[1] = pixel[2] = light ? 96 : 64;
+            pixel[3] = 255;
+        }
+    }
+    
+    auto placeholder = std::make_shared<Texture>();
+    if (!placeholder->LoadFromMemory(pixels.data(), size, size, 4)) {
+        spdlog::warn("Failed to create placeholder texture - loading sprites will not be drawn");
+        return;
+    }
+    placeholder->SetFilterMode(GL_NEAREST, GL_NEAREST);
+    m_placeholderTexture = placeholder;
+}
+
+void Renderer::SetPlaceholderTexture(std::shared_ptr<Texture> texture) {
+    m_placeholderTexture = std::move(texture);
+}
+
 void Renderer::BeginFrame() {
-    // Set viewport and clear any state if needed
+    m_frameStats = RenderStats{};
+    if (m_renderThreadEnabled) {
+        // Draws recorded before the bracket already belong to this frame's command list
+        FlushBatches();
+    } else {
+        m_batchVertices.clear();
+        m_primitiveVertices.clear();
+    }
+    m_batchTexture.reset();
+    m_inFrame = true;
 }
 
 void Renderer::EndFrame() {
-    // Present frame operations if needed
+    FlushBatches();
+    m_inFrame = false;
+    m_lastFrameStats = m_frameStats;
 }
 
 void Renderer::Clear(float r, float g, float b, float a) {
+    if (m_renderThreadEnabled) {
+        // Keep ordering with anything already recorded
+        FlushBatches();
+        RenderCommand command;
+        command.type = RenderCommand::Type::Clear;
+        command.clearColor = {r, g, b, a};
+        m_frames[m_recordFrame].commands.push_back(command);
+        return;
+    }
+    
     glClearColor(r, g, b, a);
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 }
 
 void Renderer::DrawSprite(const Sprite* sprite, const core::Transform& transform) {
-    if (!sprite || !sprite->IsValid() || !m_initialized) {
+    if (!sprite || !m_initialized) {
         return;
     }
     
-    // Create model matrix from transform
-    glm::mat4 model = glm::mat4(1.0f);
-    model = glm::translate(model, glm::vec3(transform.GetPosition(), 0.0f));
-    model = glm::rotate(model, glm::radians(transform.GetRotation()), glm::vec3(0.0f, 0.0f, 1.0f));
-    model = glm::scale(model, glm::vec3(transform.GetScale(), 1.0f));
+    std::shared_ptr<Texture> texture = sprite->GetTexture();
+    glm::ivec4 sourceRect = sprite->GetSourceRect();
+    bool usePlaceholder = false;
     
-    glm::mat4 mvp = m_projectionMatrix * m_viewMatrix * model;
+    if (!sprite->IsValid()) {
+        // Texture still streaming in - stand in with the placeholder at the sprite's intended size
+        if (!sprite->IsLoading() || !sprite->IsPlaceholderEnabled() || !m_placeholderTexture) {
+            return;
+        }
+        texture = m_placeholderTexture;
+        if (sourceRect.z <= 0 || sourceRect.w <= 0) {
+            sourceRect = {0, 0, texture->GetWidth(), texture->GetHeight()};
+        }
+        usePlaceholder = true;
+    }
     
-    // Use sprite shader
-    glUseProgram(m_spriteShader);
+    // Source rectangle normalized to texture coordinates (placeholder always shows in full)
+    glm::vec4 uvRect = {0.0f, 0.0f, 1.0f, 1.0f};
+    if (!usePlaceholder) {
+        const float invWidth = 1.0f / texture->GetWidth();
+        const float invHeight = 1.0f / texture->GetHeight();
+        uvRect = {
+            sourceRect.x * invWidth,
+            sourceRect.y * invHeight,
+            (sourceRect.x + sourceRect.z) * invWidth,
+            (sourceRect.y + sourceRect.w) * invHeight
+        };
+    }
     
-    // Set uniforms
-    glUniformMatrix4fv(glGetUniformLocation(m_spriteShader, "u_MVP"), 1, GL_FALSE, glm::value_ptr(mvp));
+    SubmitSpriteQuad(texture, glm::vec2(sourceRect.z, sourceRect.w), sprite->GetOrigin(), transform, uvRect, sprite->GetTint());
+}
+
+void Renderer::DrawSprite(const Sprite* sprite, const core::Transform& transform,
+                          const std::shared_ptr<Texture>& texture, const SpriteFrame& frame) {
+    if (!sprite || !m_initialized) {
+        return;
+    }
+    SubmitSpriteQuad(texture, frame.size, sprite->GetOrigin(), transform, frame.uvRect, sprite->GetTint());
+}
+
+void Renderer::SubmitSpriteQuad(const std::shared_ptr<Texture>& texture, const glm::vec2& size, const glm::vec2& origin,
+                                const core::Transform& transform, const glm::vec4& uvRect, const glm::vec4& tint) {
+    const glm::vec2 originOffset = origin * size;
     
-    // Sprite size
-    glm::vec2 spriteSize = glm::vec2(sprite->GetSize());
-    glUniform2fv(glGetUniformLocation(m_spriteShader, "u_spriteSize"), 1, glm::value_ptr(spriteSize));
+    // Build the model transform on the CPU (translate * rotate * scale)
+    const glm::vec2& scale = transform.GetScale();
+    const glm::vec2& position = transform.GetPosition();
+    const float radians = glm::radians(transform.GetRotation());
+    const float cosR = std::cos(radians);
+    const float sinR = std::sin(radians);
     
-    // Origin
-    glm::vec2 origin = sprite->GetOrigin();
-    glUniform2fv(glGetUniformLocation(m_spriteShader, "u_origin"), 1, glm::value_ptr(origin));
+    auto toWorld = [&](float localX, float localY) {
+        float x = (localX - originOffset.x) * scale.x;
+        float y = (localY - originOffset.y) * scale.y;
+        return glm::vec2(position.x + x * cosR - y * sinR, position.y + x * sinR + y * cosR);
+    };
     
-    // Tint
-    glUniform4fv(glGetUniformLocation(m_spriteShader, "u_tint"), 1, glm::value_ptr(sprite->GetTint()));
+    // Top-left, top-right, bottom-right, bottom-left (y-down screen space)
+    const glm::vec2 corners[4] = {
+        toWorld(0.0f, 0.0f),
+        toWorld(size.x, 0.0f),
+        toWorld(size.x, size.y),
+        toWorld(0.0f, size.y)
+    };
     
-    // Source rectangle (normalized to texture coordinates)
-    auto texture = sprite->GetTexture();
-    auto sourceRect = sprite->GetSourceRect();
-    glm::vec4 normalizedSourceRect = {
-        (float)sourceRect.x / texture->GetWidth(),
-        (float)sourceRect.y / texture->GetHeight(),
-        (float)sourceRect.z / texture->GetWidth(),
-        (float)sourceRect.w / texture->GetHeight()
+    DrawQuad(texture, corners, uvRect, tint);
+}
+
+void Renderer::DrawQuad(const std::shared_ptr<Texture>& texture, const glm::vec2 corners[4],
+                        const glm::vec4& uvRect, const glm::vec4& color) {
+    const glm::vec2 texCoords[4] = {
+        {uvRect.x, uvRect.y},
+        {uvRect.z, uvRect.y},
+        {uvRect.z, uvRect.w},
+        {uvRect.x, uvRect.w}
     };
-    glUniform4fv(glGetUniformLocation(m_spriteShader, "u_sourceRect"), 1, glm::value_ptr(normalizedSourceRect));
+    DrawQuad(texture, corners, texCoords, color);
+}
+
+void Renderer::DrawQuad(const std::shared_ptr<Texture>& texture, const glm::vec2 corners[4],
+                        const glm::vec2 texCoords[4], const glm::vec4& color) {
+    if (!texture || !texture->IsValid() || !m_initialized) {
+        return;
+    }
     
-    // Bind texture
-    texture->Bind(0);
-    glUniform1i(glGetUniformLocation(m_spriteShader, "u_texture"), 0);
+    if (m_cullingEnabled && !m_viewBounds.Overlaps(core::Bounds::FromPoints(corners, 4))) {
+        m_frameStats.culled++;
+        return;
+    }
     
-    // Setup vertex data (OpenGL 2.1 style - no VAO)
-    glBindBuffer(GL_ARRAY_BUFFER, m_quadVBO);
+    // Shapes drawn before this quad must land underneath it
+    if (m_primitiveVertices.size() > m_primitiveStart) {
+        FlushPrimitiveBatch();
+    }
+    
+    // Texture change (or full buffer) ends the current batch
+    if (m_batchTexture != texture || m_batchVertices.size() - m_batchStart + VERTICES_PER_SPRITE > MAX_BATCH_SPRITES * VERTICES_PER_SPRITE) {
+        FlushSpriteBatch();
+        m_batchTexture = texture;
+    }
+    
+    const uint32_t packedColor = PackColor(color);
+    
+    for (int i = 0; i < 4; ++i) {
+        m_batchVertices.push_back({corners[i], texCoords[i], packedColor});
+    }
+    
+    m_frameStats.sprites++;
+    
+    // Outside a frame bracket (or with batching disabled) draw right away
+    if (!m_inFrame || !m_batchingEnabled) {
+        FlushSpriteBatch();
+    }
+}
+
+void Renderer::DrawQuads(const std::shared_ptr<Texture>& texture, const MeshVertex* vertices, size_t quadCount) {
+    if (!texture || !texture->IsValid() || !vertices || quadCount == 0 || !m_initialized) {
+        return;
+    }
     
-    // Get attribute locations
-    GLint posAttrib = glGetAttribLocation(m_spriteShader, "aPos");
-    GLint texAttrib = glGetAttribLocation(m_spriteShader, "aTexCoord");
+    if (m_primitiveVertices.size() > m_primitiveStart) {
+        FlushPrimitiveBatch();
+    }
     
-    // Enable and set vertex attributes
-    if (posAttrib >= 0) {
-        glEnableVertexAttribArray(posAttrib);
-        glVertexAttribPointer(posAttrib, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)0);
+    if (m_batchTexture != texture) {
+        FlushSpriteBatch();
+        m_batchTexture = texture;
     }
     
-    if (texAttrib >= 0) {
-        glEnableVertexAttribArray(texAttrib);
-        glVertexAttribPointer(texAttrib, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)(2 * sizeof(float)));
+    // Copied in runs that fill the open batch, flushing in between
+    while (quadCount > 0) {
+        const size_t batchedQuads = (m_batchVertices.size() - m_batchStart) / VERTICES_PER_SPRITE;
+        if (batchedQuads >= MAX_BATCH_SPRITES) {
+            FlushSpriteBatch();
+            m_batchTexture = texture;
+            continue;
+        }
+        
+        const size_t count = std::min(quadCount, MAX_BATCH_SPRITES - batchedQuads);
+        m_batchVertices.insert(m_batchVertices.end(), vertices, vertices + count * VERTICES_PER_SPRITE);
+        vertices += count * VERTICES_PER_SPRITE;
+        quadCount -= count;
+        m_frameStats.sprites += static_cast<uint32_t>(count);
+        
+        if (!m_inFrame || !m_batchingEnabled) {
+            FlushSpriteBatch();
+        }
+    }
+}
+
+void Renderer::DrawMesh(const std::shared_ptr<QuadMesh>& mesh, const std::shared_ptr<Texture>& texture) {
+    if (!mesh || !mesh->IsValid() || !texture || !texture->IsValid() || !m_initialized || !m_spriteShader.IsValid()) {
+        return;
     }
     
-    // Draw quad
-    glDrawArrays(GL_TRIANGLES, 0, 6);
+    if (m_cullingEnabled && !m_viewBounds.Overlaps(mesh->GetBounds())) {
+        m_frameStats.culled++;
+        return;
+    }
     
-    // Cleanup
-    if (posAttrib >= 0) glDisableVertexAttribArray(posAttrib);
-    if (texAttrib >= 0) glDisableVertexAttribArray(texAttrib);
+    // Keep submission order with whatever was batched before
+    FlushBatches();
     
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    texture->Unbind();
-    glUseProgram(0);
+    if (m_renderThreadEnabled) {
+        RenderFrame& frame = m_frames[m_recordFrame];
+        
+        RenderCommand command;
+        command.type = RenderCommand::Type::DrawMesh;
+        command.vertexCount = static_cast<uint32_t>(mesh->GetQuadCount() * VERTICES_PER_SPRITE);
+        command.matrixIndex = RecordViewProjection(frame);
+        command.texture = texture.get();
+        command.mesh = mesh.get();
+        frame.commands.push_back(command);
+        frame.textures.push_back(texture);
+        frame.meshes.push_back(mesh);
+    } else {
+        DrawQuadBuffer(mesh->GetBuffer(), mesh->GetQuadCount(), *texture, m_projectionMatrix * m_viewMatrix);
+    }
+    
+    m_frameStats.drawCalls++;
+    m_frameStats.meshes++;
 }
 
 void Renderer::DrawSprite(const Sprite* sprite, const glm::vec2& position) {
@@ -237,104 +484,733 @@ void Renderer::DrawSprite(const Sprite* sprite, const glm::vec2& position, float
     DrawSprite(sprite, transform);
 }
 
+namespace {
+
+// Two triangles covering the quad a-b-c-d (in winding order)
+template<typename Vertex>
+void WriteQuad(Vertex* out, const glm::vec2& a, const glm::vec2& b,
+               const glm::vec2& c, const glm::vec2& d, uint32_t color) {
+    out[0] = {a, color};
+    out[1] = {b, color};
+    out[2] = {c, color};
+    out[3] = {c, color};
+    out[4] = {d, color};
+    out[5] = {a, color};
+}
+
+} // namespace
+
 void Renderer::DrawRectangle(const glm::vec2& position, const glm::vec2& size, const glm::vec4& color) {
-    // TODO: Implement primitive rectangle rendering
-    // For now, this is a placeholder for future primitive rendering
+    PrimitiveVertex* out = BeginPrimitive(6);
+    if (!out) {
+        return;
+    }
+    
+    WriteQuad(out, position, {position.x + size.x, position.y}, position + size, {position.x, position.y + size.y}, PackColor(color));
+    EndPrimitive();
+}
+
+void Renderer::DrawRectangleOutline(const glm::vec2& position, const glm::vec2& size, const glm::vec4& color, float thickness) {
+    // Four strips inside the rectangle (top/bottom full width, sides between them) so corners don't overlap
+    const float t = std::min(thickness, std::min(size.x, size.y) * 0.5f);
+    if (t <= 0.0f) {
+        return;
+    }
+    
+    PrimitiveVertex* out = BeginPrimitive(24);
+    if (!out) {
+        return;
+    }
+    
+    const uint32_t packed = PackColor(color);
+    const glm::vec2 min = position;
+    const glm::vec2 max = position + size;
+    WriteQuad(out + 0,  {min.x, min.y}, {max.x, min.y}, {max.x, min.y + t}, {min.x, min.y + t}, packed);
+    WriteQuad(out + 6,  {min.x, max.y - t}, {max.x, max.y - t}, {max.x, max.y}, {min.x, max.y}, packed);
+    WriteQuad(out + 12, {min.x, min.y + t}, {min.x + t, min.y + t}, {min.x + t, max.y - t}, {min.x, max.y - t}, packed);
+    WriteQuad(out + 18, {max.x - t, min.y + t}, {max.x, min.y + t}, {max.x, max.y - t}, {max.x - t, max.y - t}, packed);
+    EndPrimitive();
 }
 
 void Renderer::DrawLine(const glm::vec2& start, const glm::vec2& end, const glm::vec4& color, float thickness) {
-    // TODO: Implement line rendering
-    // For now, this is a placeholder for future primitive rendering
+    const glm::vec2 delta = end - start;
+    const float length = glm::length(delta);
+    if (length <= 0.0f || thickness <= 0.0f) {
+        return;
+    }
+    
+    PrimitiveVertex* out = BeginPrimitive(6);
+    if (!out) {
+        return;
+    }
+    
+    // Offset both ends along the normal by half the thickness
+    const glm::vec2 offset = glm::vec2(-delta.y, delta.x) * (thickness * 0.5f / length);
+    WriteQuad(out, start + offset, end + offset, end - offset, start - offset, PackColor(color));
+    EndPrimitive();
+}
+
+void Renderer::DrawCircle(const glm::vec2& center, float radius, const glm::vec4& color, int segments) {
+    if (radius <= 0.0f) {
+        return;
+    }
+    
+    segments = CircleSegments(radius, segments);
+    PrimitiveVertex* out = BeginPrimitive(static_cast<size_t>(segments) * 3);
+    if (!out) {
+        return;
+    }
+    
+    const uint32_t packed = PackColor(color);
+    const float step = TWO_PI / segments;
+    glm::vec2 previous = center + glm::vec2(radius, 0.0f);
+    for (int i = 1; i <= segments; ++i) {
+        const float angle = step * i;
+        const glm::vec2 current = center + glm::vec2(std::cos(angle), std::sin(angle)) * radius;
+        *out++ = {center, packed};
+        *out++ = {previous, packed};
+        *out++ = {current, packed};
+        previous = current;
+    }
+    EndPrimitive();
+}
+
+void Renderer::DrawCircleOutline(const glm::vec2& center, float radius, const glm::vec4& color, float thickness, int segments) {
+    if (radius <= 0.0f || thickness <= 0.0f) {
+        return;
+    }
+    
+    segments = CircleSegments(radius, segments);
+    PrimitiveVertex* out = BeginPrimitive(static_cast<size_t>(segments) * 6);
+    if (!out) {
+        return;
+    }
+    
+    // Ring centred on the radius
+    const uint32_t packed = PackColor(color);
+    const float outer = radius + thickness * 0.5f;
+    const float inner = std::max(0.0f, radius - thickness * 0.5f);
+    const float step = TWO_PI / segments;
+    glm::vec2 previousDir(1.0f, 0.0f);
+    for (int i = 1; i <= segments; ++i) {
+        const float angle = step * i;
+        const glm::vec2 dir(std::cos(angle), std::sin(angle));
+        WriteQuad(out, center + previousDir * outer, center + dir * outer, center + dir * inner, center + previousDir * inner, packed);
+        out += 6;
+        previousDir = dir;
+    }
+    EndPrimitive();
+}
+
+void Renderer::DrawPolygon(const glm::vec2* points, size_t count, const glm::vec4& color) {
+    if (!points || count < 3) {
+        return;
+    }
+    
+    PrimitiveVertex* out = BeginPrimitive((count - 2) * 3);
+    if (!out) {
+        return;
+    }
+    
+    // Triangle fan from the first point (valid for convex polygons)
+    const uint32_t packed = PackColor(color);
+    for (size_t i = 1; i + 1 < count; ++i) {
+        *out++ = {points[0], packed};
+        *out++ = {points[i], packed};
+        *out++ = {points[i + 1], packed};
+    }
+    EndPrimitive();
+}
+
+void Renderer::DrawPolygonOutline(const glm::vec2* points, size_t count, const glm::vec4& color, float thickness) {
+    if (!points || count < 2 || thickness <= 0.0f) {
+        return;
+    }
+    
+    PrimitiveVertex* out = BeginPrimitive(count * 6);
+    if (!out) {
+        return;
+    }
+    
+    const uint32_t packed = PackColor(color);
+    const float halfThickness = thickness * 0.5f;
+    for (size_t i = 0; i < count; ++i) {
+        const glm::vec2& start = points[i];
+        const glm::vec2& end = points[(i + 1) % count];
+        const glm::vec2 delta = end - start;
+        const float length = glm::length(delta);
+        
+        // Degenerate edges still fill their slot so the vertex count stays as reserved
+        const glm::vec2 offset = length > 0.0f ? glm::vec2(-delta.y, delta.x) * (halfThickness / length) : glm::vec2(0.0f);
+        WriteQuad(out, start + offset, end + offset, end - offset, start - offset, packed);
+        out += 6;
+    }
+    EndPrimitive();
+}
+
+void Renderer::Flush() {
+    FlushBatches();
+}
+
+void Renderer::SetBatchingEnabled(bool enabled) {
+    if (m_batchingEnabled != enabled) {
+        FlushBatches();
+        m_batchingEnabled = enabled;
+        spdlog::info("Sprite batching {}", enabled ? "enabled" : "disabled");
+    }
+}
+
+void Renderer::SetCamera(const Camera2D& camera) {
+    FlushBatches();
+    m_viewMatrix = camera.GetViewMatrix();
+    m_projectionMatrix = camera.GetProjectionMatrix();
+    UpdateViewBounds();
 }
 
 void Renderer::SetViewMatrix(const glm::mat4& view) {
+    // Pending sprites were submitted against the previous matrices
+    FlushBatches();
     m_viewMatrix = view;
+    UpdateViewBounds();
 }
 
 void Renderer::SetProjectionMatrix(const glm::mat4& projection) {
+    FlushBatches();
     m_projectionMatrix = projection;
+    UpdateViewBounds();
 }
 
 void Renderer::SetOrthographicProjection(float left, float right, float bottom, float top) {
+    FlushBatches();
     m_projectionMatrix = glm::ortho(left, right, bottom, top, -1.0f, 1.0f);
+    UpdateViewBounds();
 }
 
-void Renderer::SetupSpriteShader() {
-    // Compile vertex shader
-    unsigned int vertexShader = glCreateShader(GL_VERTEX_SHADER);
-    glShaderSource(vertexShader, 1, &spriteVertexShader, nullptr);
-    glCompileShader(vertexShader);
+void Renderer::UpdateViewBounds() {
+    // Unproject the clip-space corners - works for any 2D view/projection pair, not just Camera2D's
+    const glm::mat4 inverseViewProjection = glm::inverse(m_projectionMatrix * m_viewMatrix);
+    glm::vec2 corners[4];
+    const glm::vec2 clipCorners[4] = {{-1.0f, -1.0f}, {1.0f, -1.0f}, {1.0f, 1.0f}, {-1.0f, 1.0f}};
+    for (int i = 0; i < 4; ++i) {
+        const glm::vec4 world = inverseViewProjection * glm::vec4(clipCorners[i], 0.0f, 1.0f);
+        corners[i] = glm::vec2(world) / world.w;
+    }
+    m_viewBounds = core::Bounds::FromPoints(corners, 4);
+}
+
+void Renderer::FlushSpriteBatch() {
+    if (m_renderThreadEnabled) {
+        RecordBatch();
+        return;
+    }
     
-    // Check vertex shader compilation
-    int success;
-    char infoLog[512];
-    glGetShaderiv(vertexShader, GL_COMPILE_STATUS, &success);
-    if (!success) {
-        glGetShaderInfoLog(vertexShader, 512, nullptr, infoLog);
-        spdlog::error("Vertex shader compilation failed: {}", infoLog);
-        glDeleteShader(vertexShader);
+    if (m_batchVertices.empty() || !m_batchTexture || !m_spriteShader.IsValid()) {
+        m_batchVertices.clear();
         return;
     }
     
-    // Compile fragment shader
-    unsigned int fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
-    glShaderSource(fragmentShader, 1, &spriteFragmentShader, nullptr);
-    glCompileShader(fragmentShader);
+    DrawBatch(m_batchVertices.data(), m_batchVertices.size(), *m_batchTexture, m_projectionMatrix * m_viewMatrix);
+    
+    m_frameStats.drawCalls++;
+    m_frameStats.flushes++;
+    m_frameStats.vertices += static_cast<uint32_t>(m_batchVertices.size());
     
-    // Check fragment shader compilation
-    glGetShaderiv(fragmentShader, GL_COMPILE_STATUS, &success);
-    if (!success) {
-        glGetShaderInfoLog(fragmentShader, 512, nullptr, infoLog);
-        spdlog::error("Fragment shader compilation failed: {}", infoLog);
-        glDeleteShader(vertexShader);
-        glDeleteShader(fragmentShader);
+    m_batchVertices.clear();
+}
+
+void Renderer::RecordBatch() {
+    const size_t vertexCount = m_batchVertices.size() - m_batchStart;
+    if (vertexCount == 0 || !m_batchTexture || !m_spriteShader.IsValid()) {
+        m_batchVertices.resize(m_batchStart);
         return;
     }
     
-    // Create shader program
-    m_spriteShader = glCreateProgram();
-    glAttachShader(m_spriteShader, vertexShader);
-    glAttachShader(m_spriteShader, fragmentShader);
-    glLinkProgram(m_spriteShader);
+    RenderFrame& frame = m_frames[m_recordFrame];
     
-    // Check program linking
-    glGetProgramiv(m_spriteShader, GL_LINK_STATUS, &success);
-    if (!success) {
-        glGetProgramInfoLog(m_spriteShader, 512, nullptr, infoLog);
-        spdlog::error("Shader program linking failed: {}", infoLog);
-        glDeleteProgram(m_spriteShader);
-        m_spriteShader = 0;
+    const uint32_t matrixIndex = RecordViewProjection(frame);
+    if (frame.textures.empty() || frame.textures.back() != m_batchTexture) {
+        frame.textures.push_back(m_batchTexture);
     }
     
-    // Cleanup shaders (they're linked into the program now)
-    glDeleteShader(vertexShader);
-    glDeleteShader(fragmentShader);
+    RenderCommand command;
+    command.type = RenderCommand::Type::DrawBatch;
+    command.firstVertex = static_cast<uint32_t>(m_batchStart);
+    command.vertexCount = static_cast<uint32_t>(vertexCount);
+    command.matrixIndex = matrixIndex;
+    command.texture = m_batchTexture.get();
+    frame.commands.push_back(command);
+    
+    m_batchStart = m_batchVertices.size();
     
-    if (m_spriteShader) {
-        spdlog::info("Sprite shader compiled and linked successfully");
+    m_frameStats.drawCalls++;
+    m_frameStats.flushes++;
+    m_frameStats.vertices += static_cast<uint32_t>(vertexCount);
+}
+
+uint32_t Renderer::RecordViewProjection(RenderFrame& frame) {
+    // Consecutive batches usually share the matrices - only store changes
+    const glm::mat4 viewProjection = m_projectionMatrix * m_viewMatrix;
+    if (frame.matrices.empty() || frame.matrices.back() != viewProjection) {
+        frame.matrices.push_back(viewProjection);
     }
+    return static_cast<uint32_t>(frame.matrices.size() - 1);
 }
 
-void Renderer::SetupQuadMesh() {
-    // Quad vertices (position + texture coordinates)
-    // Using unit quad that will be scaled by sprite size
-    float quadVertices[] = {
-        // positions   // texture coords
-        0.0f, 1.0f,    0.0f, 1.0f,   // top left
-        1.0f, 1.0f,    1.0f, 1.0f,   // top right
-        0.0f, 0.0f,    0.0f, 0.0f,   // bottom left
+void Renderer::FlushBatches() {
+    FlushSpriteBatch();
+    FlushPrimitiveBatch();
+}
+
+Renderer::PrimitiveVertex* Renderer::BeginPrimitive(size_t vertexCount) {
+    if (!m_initialized || !m_primitiveShader.IsValid() || vertexCount == 0 || vertexCount > MAX_PRIMITIVE_VERTICES) {
+        return nullptr;
+    }
+    
+    // Sprites drawn before this shape must land underneath it
+    if (m_batchVertices.size() > m_batchStart) {
+        FlushSpriteBatch();
+    }
+    if (m_primitiveVertices.size() - m_primitiveStart + vertexCount > MAX_PRIMITIVE_VERTICES) {
+        FlushPrimitiveBatch();
+    }
+    
+    const size_t offset = m_primitiveVertices.size();
+    m_primitiveVertices.resize(offset + vertexCount);
+    return m_primitiveVertices.data() + offset;
+}
+
+void Renderer::EndPrimitive() {
+    m_frameStats.primitives++;
+    
+    // Outside a frame bracket (or with batching disabled) draw right away
+    if (!m_inFrame || !m_batchingEnabled) {
+        FlushPrimitiveBatch();
+    }
+}
+
+void Renderer::FlushPrimitiveBatch() {
+    if (m_renderThreadEnabled) {
+        RecordPrimitives();
+        return;
+    }
+    
+    if (m_primitiveVertices.empty()) {
+        return;
+    }
+    
+    DrawPrimitives(m_primitiveVertices.data(), m_primitiveVertices.size(), m_projectionMatrix * m_viewMatrix);
+    
+    m_frameStats.drawCalls++;
+    m_frameStats.flushes++;
+    m_frameStats.vertices += static_cast<uint32_t>(m_primitiveVertices.size());
+    
+    m_primitiveVertices.clear();
+}
+
+void Renderer::RecordPrimitives() {
+    const size_t vertexCount = m_primitiveVertices.size() - m_primitiveStart;
+    if (vertexCount == 0) {
+        return;
+    }
+    
+    RenderFrame& frame = m_frames[m_recordFrame];
+    
+    RenderCommand command;
+    command.type = RenderCommand::Type::DrawPrimitives;
+    command.firstVertex = static_cast<uint32_t>(m_primitiveStart);
+    command.vertexCount = static_cast<uint32_t>(vertexCount);
+    command.matrixIndex = RecordViewProjection(frame);
+    frame.commands.push_back(command);
+    
+    m_primitiveStart = m_primitiveVertices.size();
+    
+    m_frameStats.drawCalls++;
+    m_frameStats.flushes++;
+    m_frameStats.vertices += static_cast<uint32_t>(vertexCount);
+}
+
+void Renderer::DrawPrimitives(const PrimitiveVertex* vertices, size_t vertexCount, const glm::mat4& viewProjection) {
+    m_primitiveShader.Bind();
+    m_primitiveShader.SetUniform(m_uPrimitiveMVP, viewProjection);
+    
+    // Orphan and refill, same as the sprite batch
+    glBindBuffer(GL_ARRAY_BUFFER, m_primitiveVBO);
+    glBufferData(GL_ARRAY_BUFFER, MAX_PRIMITIVE_VERTICES * sizeof(PrimitiveVertex), nullptr, GL_STREAM_DRAW);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, vertexCount * sizeof(PrimitiveVertex), vertices);
+    
+    if (m_aPrimitivePos >= 0) {
+        glEnableVertexAttribArray(m_aPrimitivePos);
+        glVertexAttribPointer(m_aPrimitivePos, 2, GL_FLOAT, GL_FALSE, sizeof(PrimitiveVertex), (void*)offsetof(PrimitiveVertex, position));
+    }
+    
+    if (m_aPrimitiveColor >= 0) {
+        glEnableVertexAttribArray(m_aPrimitiveColor);
+        glVertexAttribPointer(m_aPrimitiveColor, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(PrimitiveVertex), (void*)offsetof(PrimitiveVertex, color));
+    }
+    
+    glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(vertexCount));
+    
+    if (m_aPrimitivePos >= 0) glDisableVertexAttribArray(m_aPrimitivePos);
+    if (m_aPrimitiveColor >= 0) glDisableVertexAttribArray(m_aPrimitiveColor);
+    
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void Renderer::DrawBatch(const SpriteVertex* vertices, size_t vertexCount, const Texture& texture, const glm::mat4& viewProjection) {
+    // Upload vertex data (orphan the buffer so the driver doesn't stall on the previous draw)
+    glBindBuffer(GL_ARRAY_BUFFER, m_quadVBO);
+    glBufferData(GL_ARRAY_BUFFER, MAX_BATCH_SPRITES * VERTICES_PER_SPRITE * sizeof(SpriteVertex), nullptr, GL_STREAM_DRAW);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, vertexCount * sizeof(SpriteVertex), vertices);
+    
+    DrawQuadBuffer(m_quadVBO, vertexCount / VERTICES_PER_SPRITE, texture, viewProjection);
+}
+
+void Renderer::DrawQuadBuffer(unsigned int vertexBuffer, size_t quadCount, const Texture& texture, const glm::mat4& viewProjection) {
+    // Use sprite shader (program, texture and unchanged uniforms are only re-uploaded when they differ)
+    m_spriteShader.Bind();
+    m_spriteShader.SetUniform(m_uMVP, viewProjection);
+    
+    // Bind texture
+    texture.Bind(0);
+    m_spriteShader.SetUniform(m_uTexture, 0);
+    
+    glBindBuffer(GL_ARRAY_BUFFER, vertexBuffer);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_quadIBO);
+    
+    // Enable and set vertex attributes (OpenGL 2.1 style - no VAO)
+    if (m_aPos >= 0) {
+        glEnableVertexAttribArray(m_aPos);
+        glVertexAttribPointer(m_aPos, 2, GL_FLOAT, GL_FALSE, sizeof(SpriteVertex), (void*)offsetof(SpriteVertex, position));
+    }
+    
+    if (m_aTexCoord >= 0) {
+        glEnableVertexAttribArray(m_aTexCoord);
+        glVertexAttribPointer(m_aTexCoord, 2, GL_FLOAT, GL_FALSE, sizeof(SpriteVertex), (void*)offsetof(SpriteVertex, texCoord));
+    }
+    
+    if (m_aColor >= 0) {
+        glEnableVertexAttribArray(m_aColor);
+        glVertexAttribPointer(m_aColor, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(SpriteVertex), (void*)offsetof(SpriteVertex, color));
+    }
+    
+    // Draw all quads in the buffer
+    glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(quadCount * INDICES_PER_SPRITE), GL_UNSIGNED_SHORT, nullptr);
+    
+    // Cleanup
+    if (m_aPos >= 0) glDisableVertexAttribArray(m_aPos);
+    if (m_aTexCoord >= 0) glDisableVertexAttribArray(m_aTexCoord);
+    if (m_aColor >= 0) glDisableVertexAttribArray(m_aColor);
+    
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void Renderer::Present() {
+    if (m_renderThreadEnabled) {
+        SubmitFrame();
+        return;
+    }
+    
+    if (m_window) {
+        SDL_GL_SwapWindow(m_window->GetSDLWindow());
+    }
+}
+
+bool Renderer::SetSwapInterval(int interval) {
+    if (m_renderThreadEnabled) {
+        // Swap interval is per context - the render thread applies it between frames and reports back,
+        // so callers can still fall back (vsync -> frame cap) when the driver refuses
+        std::unique_lock<std::mutex> lock(m_frameMutex);
+        const int previous = m_swapInterval;
+        m_swapInterval = interval;
+        m_swapIntervalPending = true;
+        m_frameSubmitted.notify_one();
+        m_frameFreed.wait(lock, [this] { return !m_swapIntervalPending; });
+        if (!m_swapIntervalResult) {
+            spdlog::warn("Swap interval {} not supported on the render thread", interval);
+            m_swapInterval = previous;
+            return false;
+        }
+        return true;
+    }
+    
+    if (SDL_GL_SetSwapInterval(interval) != 0) {
+        spdlog::warn("Swap interval {} not supported: {}", interval, SDL_GetError());
+        return false;
+    }
+    m_swapInterval = interval;
+    return true;
+}
+
+bool Renderer::StartRenderThread(int framesInFlight, int swapInterval) {
+    SDL_Window* sdlWindow = m_window->GetSDLWindow();
+    
+    // Everything created so far (shader, buffers, textures) must exist before the other context uses it
+    glFinish();
+    
+    SDL_GL_SetAttribute(SDL_GL_SHARE_WITH_CURRENT_CONTEXT, 1);
+    m_renderContext = SDL_GL_CreateContext(sdlWindow);
+    SDL_GL_SetAttribute(SDL_GL_SHARE_WITH_CURRENT_CONTEXT, 0);
+    
+    if (!m_renderContext) {
+        spdlog::warn("Failed to create shared render thread context ({}) - rendering on the main thread", SDL_GetError());
+        SDL_GL_MakeCurrent(sdlWindow, (SDL_GLContext)m_context);
+        return false;
+    }
+    
+    // Creating the context made it current here - the main thread keeps its own for resource uploads
+    SDL_GL_MakeCurrent(sdlWindow, (SDL_GLContext)m_context);
+    
+    m_framesInFlight = std::clamp(framesInFlight, 2, MAX_FRAMES_IN_FLIGHT);
+    m_swapInterval = swapInterval;
+    m_recordFrame = 0;
+    m_submittedFrames.clear();
+    m_stopRenderThread = false;
+    for (RenderFrame& frame : m_frames) {
+        frame = RenderFrame{};
+        frame.vertices.reserve(MAX_BATCH_SPRITES * VERTICES_PER_SPRITE);
+        frame.primitiveVertices.reserve(MAX_PRIMITIVE_VERTICES);
+    }
+    m_batchVertices.clear();
+    m_batchStart = 0;
+    m_primitiveVertices.clear();
+    m_primitiveStart = 0;
+    
+    m_renderThreadEnabled = true;
+    m_renderThread = std::thread(&Renderer::RenderThreadLoop, this);
+    
+    spdlog::info("Render thread started ({} frames in flight)", m_framesInFlight);
+    return true;
+}
+
+void Renderer::StopRenderThread() {
+    if (!m_renderThread.joinable()) {
+        return;
+    }
+    
+    // The thread drains already submitted frames before exiting
+    {
+        std::lock_guard<std::mutex> lock(m_frameMutex);
+        m_stopRenderThread = true;
+    }
+    m_frameSubmitted.notify_all();
+    m_renderThread.join();
+    
+    if (m_window && m_context) {
+        SDL_GL_MakeCurrent(m_window->GetSDLWindow(), (SDL_GLContext)m_context);
+    }
+    if (m_renderContext) {
+        SDL_GL_DeleteContext((SDL_GLContext)m_renderContext);
+        m_renderContext = nullptr;
+    }
+    
+    for (RenderFrame& frame : m_frames) {
+        frame = RenderFrame{};
+    }
+    m_submittedFrames.clear();
+    m_batchVertices.clear();
+    m_batchStart = 0;
+    m_primitiveVertices.clear();
+    m_primitiveStart = 0;
+    m_renderThreadEnabled = false;
+    
+    spdlog::info("Render thread stopped");
+}
+
+void Renderer::SubmitFrame() {
+    FlushBatches();
+    m_batchTexture.reset();
+    
+    // Push this thread's uploads to the GPU so the render context sees them (GL 2.1 has no fences)
+    glFlush();
+    
+    RenderFrame& frame = m_frames[m_recordFrame];
+    frame.vertices.swap(m_batchVertices);
+    frame.primitiveVertices.swap(m_primitiveVertices);
+    {
+        std::lock_guard<std::mutex> lock(m_frameMutex);
+        frame.inFlight = true;
+        m_submittedFrames.push_back(m_recordFrame);
+    }
+    m_frameSubmitted.notify_one();
+    
+    // Wait for the next slot to come back (only blocks when every buffered frame is still queued)
+    m_recordFrame = (m_recordFrame + 1) % m_framesInFlight;
+    RenderFrame& next = m_frames[m_recordFrame];
+    {
+        std::unique_lock<std::mutex> lock(m_frameMutex);
+        m_frameFreed.wait(lock, [&next] { return !next.inFlight; });
+    }
+    
+    // Texture references die here, on the main thread, rather than on the render thread
+    next.commands.clear();
+    next.matrices.clear();
+    next.textures.clear();
+    next.meshes.clear();
+    m_batchVertices.clear();
+    m_batchStart = 0;
+    m_primitiveVertices.clear();
+    m_primitiveStart = 0;
+}
+
+void Renderer::WaitForQueuedFrames() {
+    if (!m_renderThreadEnabled) {
+        return;
+    }
+    
+    std::unique_lock<std::mutex> lock(m_frameMutex);
+    m_frameFreed.wait(lock, [this] {
+        return std::none_of(m_frames.begin(), m_frames.end(), [](const RenderFrame& frame) { return frame.inFlight; });
+    });
+}
+
+void Renderer::RenderThreadLoop() {
+    SDL_Window* sdlWindow = m_window->GetSDLWindow();
+    SDL_GL_MakeCurrent(sdlWindow, (SDL_GLContext)m_renderContext);
+    int appliedSwapInterval = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_frameMutex);
+        appliedSwapInterval = m_swapInterval;
+    }
+    SDL_GL_SetSwapInterval(appliedSwapInterval);
+    
+    // Fixed-function state is per context
+    glViewport(0, 0, m_window->GetWidth(), m_window->GetHeight());
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    ShaderProgram::InvalidateBindingCache();
+    
+    while (true) {
+        int frameIndex = 0;
+        {
+            std::unique_lock<std::mutex> lock(m_frameMutex);
+            m_frameSubmitted.wait(lock, [this] {
+                return m_stopRenderThread || m_swapIntervalPending || !m_submittedFrames.empty();
+            });
+            
+            // SetSwapInterval is waiting for the result (a refused interval keeps the old one)
+            if (m_swapIntervalPending) {
+                m_swapIntervalResult = SDL_GL_SetSwapInterval(m_swapInterval) == 0;
+                if (m_swapIntervalResult) {
+                    appliedSwapInterval = m_swapInterval;
+                } else {
+                    SDL_GL_SetSwapInterval(appliedSwapInterval);
+                }
+                m_swapIntervalPending = false;
+                lock.unlock();
+                m_frameFreed.notify_one();
+                continue;
+            }
+            
+            if (m_submittedFrames.empty()) {
+                break;
+            }
+            frameIndex = m_submittedFrames.front();
+            m_submittedFrames.pop_front();
+        }
         
-        1.0f, 1.0f,    1.0f, 1.0f,   // top right
-        1.0f, 0.0f,    1.0f, 0.0f,   // bottom right
-        0.0f, 0.0f,    0.0f, 0.0f    // bottom left
-    };
+        ExecuteFrame(m_frames[frameIndex]);
+        SDL_GL_SwapWindow(sdlWindow);
+        
+        {
+            std::lock_guard<std::mutex> lock(m_frameMutex);
+            m_frames[frameIndex].inFlight = false;
+        }
+        m_frameFreed.notify_one();
+    }
     
-    glGenBuffers(1, &m_quadVBO);
+    SDL_GL_MakeCurrent(sdlWindow, nullptr);
+}
+
+void Renderer::ExecuteFrame(const RenderFrame& frame) {
+    // The main context may have deleted and reused texture names since the last frame
+    Texture::InvalidateBindingCache();
+    
+    for (const RenderCommand& command : frame.commands) {
+        switch (command.type) {
+            case RenderCommand::Type::Clear:
+                glClearColor(command.clearColor.r, command.clearColor.g, command.clearColor.b, command.clearColor.a);
+                glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+                break;
+            case RenderCommand::Type::DrawBatch:
+                DrawBatch(frame.vertices.data() + command.firstVertex, command.vertexCount,
+                          *command.texture, frame.matrices[command.matrixIndex]);
+                break;
+            case RenderCommand::Type::DrawMesh:
+                DrawQuadBuffer(command.mesh->GetBuffer(), command.vertexCount / VERTICES_PER_SPRITE,
+                               *command.texture, frame.matrices[command.matrixIndex]);
+                break;
+            case RenderCommand::Type::DrawPrimitives:
+                DrawPrimitives(frame.primitiveVertices.data() + command.firstVertex, command.vertexCount,
+                               frame.matrices[command.matrixIndex]);
+                break;
+        }
+    }
+}
+
+void Renderer::SetupSpriteShader() {
+    if (!m_spriteShader.Compile(spriteVertexShader, spriteFragmentShader)) {
+        return;
+    }
+    
+    // Resolve uniform and attribute handles once - the batch flush never does string lookups
+    m_uMVP = m_spriteShader.GetUniform("u_MVP");
+    m_uTexture = m_spriteShader.GetUniform("u_texture");
+    m_aPos = m_spriteShader.GetAttribLocation("aPos");
+    m_aTexCoord = m_spriteShader.GetAttribLocation("aTexCoord");
+    m_aColor = m_spriteShader.GetAttribLocation("aColor");
     
+    spdlog::info("Sprite shader compiled and linked successfully");
+}
+
+void Renderer::SetupQuadMesh() {
+    // Index pattern shared by every sprite in the batch: two triangles per quad
+    // (vertices are emitted as top-left, top-right, bottom-right, bottom-left)
+    std::vector<uint16_t> indices(MAX_BATCH_SPRITES * INDICES_PER_SPRITE);
+    for (size_t i = 0; i < MAX_BATCH_SPRITES; ++i) {
+        uint16_t base = static_cast<uint16_t>(i * VERTICES_PER_SPRITE);
+        indices[i * INDICES_PER_SPRITE + 0] = base + 0;
+        indices[i * INDICES_PER_SPRITE + 1] = base + 1;
+        indices[i * INDICES_PER_SPRITE + 2] = base + 2;
+        indices[i * INDICES_PER_SPRITE + 3] = base + 2;
+        indices[i * INDICES_PER_SPRITE + 4] = base + 3;
+        indices[i * INDICES_PER_SPRITE + 5] = base + 0;
+    }
+    
+    glGenBuffers(1, &m_quadIBO);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_quadIBO);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(uint16_t), indices.data(), GL_STATIC_DRAW);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    
+    // Dynamic vertex buffer, refilled on every batch flush
+    glGenBuffers(1, &m_quadVBO);
     glBindBuffer(GL_ARRAY_BUFFER, m_quadVBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(quadVertices), quadVertices, GL_STATIC_DRAW);
+    glBufferData(GL_ARRAY_BUFFER, MAX_BATCH_SPRITES * VERTICES_PER_SPRITE * sizeof(SpriteVertex), nullptr, GL_STREAM_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    
+    m_batchVertices.reserve(MAX_BATCH_SPRITES * VERTICES_PER_SPRITE);
+    
+    spdlog::info("Sprite batch created ({} sprites per batch)", MAX_BATCH_SPRITES);
+}
+
+void Renderer::SetupPrimitiveBatch() {
+    if (!m_primitiveShader.Compile(primitiveVertexShader, primitiveFragmentShader)) {
+        spdlog::warn("Primitive shader failed to compile - shapes will not be drawn");
+        return;
+    }
+    
+    m_uPrimitiveMVP = m_primitiveShader.GetUniform("u_MVP");
+    m_aPrimitivePos = m_primitiveShader.GetAttribLocation("aPos");
+    m_aPrimitiveColor = m_primitiveShader.GetAttribLocation("aColor");
+    
+    glGenBuffers(1, &m_primitiveVBO);
+    glBindBuffer(GL_ARRAY_BUFFER, m_primitiveVBO);
+    glBufferData(GL_ARRAY_BUFFER, MAX_PRIMITIVE_VERTICES * sizeof(PrimitiveVertex), nullptr, GL_STREAM_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    
+    m_primitiveVertices.reserve(MAX_PRIMITIVE_VERTICES);
     
-    spdlog::info("Sprite quad mesh created");
+    spdlog::info("Primitive batch created ({} vertices per batch)", MAX_PRIMITIVE_VERTICES);
 }
 
 } // namespace rendering
\ No newline at end of file
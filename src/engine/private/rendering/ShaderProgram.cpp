@@ -0,0 +1,252 @@
+#include "engine/public/rendering/ShaderProgram.h"
+#include <glad/glad.h>
+#include <glm/gtc/type_ptr.hpp>
+#include <spdlog/spdlog.h>
+#include <cstring>
+
+namespace rendering {
+
+thread_local unsigned int ShaderProgram::s_boundProgram = 0;
+
+namespace {
+
+unsigned int CompileStage(GLenum type, const char* source) {
+    unsigned int shader = glCreateShader(type);
+    glShaderSource(shader, 1, &source, nullptr);
+    glCompileShader(shader);
+
+    int success;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+    if (!success) {
+        char infoLog[512];
+        glGetShaderInfoLog(shader, 512, nullptr, infoLog);
+        spdlog::error("{} shader compilation failed: {}", type == GL_VERTEX_SHADER ? "Vertex" : "Fragment", infoLog);
+        glDeleteShader(shader);
+        return 0;
+    }
+
+    return shader;
+}
+
+// Active uniform arrays are reported as "name[0]" - strip the suffix so lookups use the plain name
+std::string StripArraySuffix(const char* name) {
+    std::string result(name);
+    size_t bracket = result.find('[');
+    if (bracket != std::string::npos) {
+        result.erase(bracket);
+    }
+    return result;
+}
+
+} // namespace
+
+ShaderProgram::ShaderProgram() = default;
+
+ShaderProgram::~ShaderProgram() {
+    Destroy();
+}
+
+ShaderProgram::ShaderProgram(ShaderProgram&& other) noexcept
+    : m_programID(other.m_programID)
+    , m_uniforms(std::move(other.m_uniforms))
+    , m_uniformIndices(std::move(other.m_uniformIndices))
+    , m_attribLocations(std::move(other.m_attribLocations)) {
+
+    other.m_programID = 0;
+}
+
+ShaderProgram& ShaderProgram::operator=(ShaderProgram&& other) noexcept {
+    if (this != &other) {
+        Destroy();
+
+        m_programID = other.m_programID;
+        m_uniforms = std::move(other.m_uniforms);
+        m_uniformIndices = std::move(other.m_uniformIndices);
+        m_attribLocations = std::move(other.m_attribLocations);
+
+        other.m_programID = 0;
+    }
+    return *this;
+}
+
+bool ShaderProgram::Compile(const char* vertexSource, const char* fragmentSource) {
+    Destroy();
+
+    unsigned int vertexShader = CompileStage(GL_VERTEX_SHADER, vertexSource);
+    if (!vertexShader) {
+        return false;
+    }
+
+    unsigned int fragmentShader = CompileStage(GL_FRAGMENT_SHADER, fragmentSource);
+    if (!fragmentShader) {
+        glDeleteShader(vertexShader);
+        return false;
+    }
+
+    // Create shader program
+    m_programID = glCreateProgram();
+    glAttachShader(m_programID, vertexShader);
+    glAttachShader(m_programID, fragmentShader);
+    glLinkProgram(m_programID);
+
+    // Cleanup shaders (they're linked into the program now)
+    glDeleteShader(vertexShader);
+    glDeleteShader(fragmentShader);
+
+    // Check program linking
+    int success;
+    glGetProgramiv(m_programID, GL_LINK_STATUS, &success);
+    if (!success) {
+        char infoLog[512];
+        glGetProgramInfoLog(m_programID, 512, nullptr, infoLog);
+        spdlog::error("Shader program linking failed: {}", infoLog);
+        glDeleteProgram(m_programID);
+        m_programID = 0;
+        return false;
+    }
+
+    ResolveLocations();
+    return true;
+}
+
+void ShaderProgram::Destroy() {
+    if (m_programID != 0) {
+        if (s_boundProgram == m_programID) {
+            glUseProgram(0);
+            s_boundProgram = 0;
+        }
+        glDeleteProgram(m_programID);
+        m_programID = 0;
+    }
+
+    m_uniforms.clear();
+    m_uniformIndices.clear();
+    m_attribLocations.clear();
+}
+
+void ShaderProgram::Bind() const {
+    if (s_boundProgram != m_programID) {
+        glUseProgram(m_programID);
+        s_boundProgram = m_programID;
+    }
+}
+
+void ShaderProgram::Unbind() {
+    if (s_boundProgram != 0) {
+        glUseProgram(0);
+        s_boundProgram = 0;
+    }
+}
+
+void ShaderProgram::InvalidateBindingCache() {
+    // No real program has this ID, so the next Bind() always calls glUseProgram
+    s_boundProgram = ~0u;
+}
+
+int ShaderProgram::GetUniform(const std::string& name) const {
+    auto it = m_uniformIndices.find(name);
+    if (it != m_uniformIndices.end()) {
+        return it->second;
+    }
+    return -1;
+}
+
+int ShaderProgram::GetAttribLocation(const std::string& name) const {
+    auto it = m_attribLocations.find(name);
+    if (it != m_attribLocations.end()) {
+        return it->second;
+    }
+    return -1;
+}
+
+void ShaderProgram::SetUniform(int uniform, int value) {
+    float bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    if (UpdateCache(uniform, &bits, 1)) {
+        glUniform1i(m_uniforms[uniform].location, value);
+    }
+}
+
+void ShaderProgram::SetUniform(int uniform, float value) {
+    if (UpdateCache(uniform, &value, 1)) {
+        glUniform1f(m_uniforms[uniform].location, value);
+    }
+}
+
+void ShaderProgram::SetUniform(int uniform, const glm::vec2& value) {
+    if (UpdateCache(uniform, glm::value_ptr(value), 2)) {
+        glUniform2fv(m_uniforms[uniform].location, 1, glm::value_ptr(value));
+    }
+}
+
+void ShaderProgram::SetUniform(int uniform, const glm::vec4& value) {
+    if (UpdateCache(uniform, glm::value_ptr(value), 4)) {
+        glUniform4fv(m_uniforms[uniform].location, 1, glm::value_ptr(value));
+    }
+}
+
+void ShaderProgram::SetUniform(int uniform, const glm::mat4& value) {
+    if (UpdateCache(uniform, glm::value_ptr(value), 16)) {
+        glUniformMatrix4fv(m_uniforms[uniform].location, 1, GL_FALSE, glm::value_ptr(value));
+    }
+}
+
+bool ShaderProgram::UpdateCache(int uniform, const float* values, int count) {
+    if (uniform < 0 || uniform >= static_cast<int>(m_uniforms.size())) {
+        return false;
+    }
+
+    UniformSlot& slot = m_uniforms[uniform];
+    if (slot.componentCount == count && std::memcmp(slot.cachedValue, values, count * sizeof(float)) == 0) {
+        return false; // Unchanged - skip the upload
+    }
+
+    std::memcpy(slot.cachedValue, values, count * sizeof(float));
+    slot.componentCount = count;
+    return true;
+}
+
+void ShaderProgram::ResolveLocations() {
+    m_uniforms.clear();
+    m_uniformIndices.clear();
+    m_attribLocations.clear();
+
+    char name[256];
+
+    // Uniforms
+    int uniformCount = 0;
+    glGetProgramiv(m_programID, GL_ACTIVE_UNIFORMS, &uniformCount);
+    for (int i = 0; i < uniformCount; ++i) {
+        GLsizei length = 0;
+        GLint size = 0;
+        GLenum type = 0;
+        glGetActiveUniform(m_programID, i, sizeof(name), &length, &size, &type, name);
+
+        UniformSlot slot;
+        slot.location = glGetUniformLocation(m_programID, name);
+        if (slot.location < 0) continue;
+
+        m_uniformIndices[StripArraySuffix(name)] = static_cast<int>(m_uniforms.size());
+        m_uniforms.push_back(slot);
+    }
+
+    // Attributes
+    int attribCount = 0;
+    glGetProgramiv(m_programID, GL_ACTIVE_ATTRIBUTES, &attribCount);
+    for (int i = 0; i < attribCount; ++i) {
+        GLsizei length = 0;
+        GLint size = 0;
+        GLenum type = 0;
+        glGetActiveAttrib(m_programID, i, sizeof(name), &length, &size, &type, name);
+
+        int location = glGetAttribLocation(m_programID, name);
+        if (location >= 0) {
+            m_attribLocations[name] = location;
+        }
+    }
+
+    spdlog::debug("Shader program {}: {} uniforms, {} attributes resolved",
+                 m_programID, m_uniforms.size(), m_attribLocations.size());
+}
+
+} // namespace rendering
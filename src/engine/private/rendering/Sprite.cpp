@@ -1,7 +1,9 @@
 #include "engine/public/rendering/Sprite.h"
 #include "engine/public/core/Engine.h"
+#include "engine/public/core/Transform.h"
 #include "engine/public/utils/ResourceManager.h"
 #include <spdlog/spdlog.h>
+#include <cmath>
 
 namespace rendering {
 
@@ -21,7 +23,7 @@ Sprite::Sprite(std::shared_ptr<Texture> texture) : m_texture(texture) {
 }
 
 Sprite::Sprite(std::shared_ptr<Texture> texture, const glm::ivec4& sourceRect) 
-    : m_texture(texture), m_sourceRect(sourceRect) {
+    : m_texture(texture), m_sourceRect(sourceRect), m_useFullTexture(false) {
 }
 
 void Sprite::SetTexture(std::shared_ptr<Texture> texture) {
@@ -33,10 +35,23 @@ void Sprite::SetTexture(std::shared_ptr<Texture> texture) {
 
 void Sprite::SetSourceRect(const glm::ivec4& rect) {
     m_sourceRect = rect;
+    m_useFullTexture = false;
 }
 
 void Sprite::SetSourceRect(int x, int y, int width, int height) {
     m_sourceRect = {x, y, width, height};
+    m_useFullTexture = false;
+}
+
+glm::ivec4 Sprite::GetSourceRect() const {
+    if (m_useFullTexture) {
+        // Resolved on demand so a texture that finishes loading later is picked up automatically
+        if (m_texture && m_texture->IsValid()) {
+            return {0, 0, m_texture->GetWidth(), m_texture->GetHeight()};
+        }
+        return {0, 0, 0, 0};
+    }
+    return m_sourceRect;
 }
 
 void Sprite::UseFullTexture() {
@@ -70,23 +85,45 @@ void Sprite::SetAlpha(float alpha) {
 }
 
 glm::ivec2 Sprite::GetSize() const {
-    return {m_sourceRect.z, m_sourceRect.w}; // width, height
+    glm::ivec4 sourceRect = GetSourceRect();
+    return {sourceRect.z, sourceRect.w}; // width, height
 }
 
 int Sprite::GetWidth() const {
-    return m_sourceRect.z;
+    return GetSourceRect().z;
 }
 
 int Sprite::GetHeight() const {
-    return m_sourceRect.w;
+    return GetSourceRect().w;
 }
 
 void Sprite::UpdateSourceRect() {
-    if (m_texture && m_texture->IsValid()) {
-        m_sourceRect = {0, 0, m_texture->GetWidth(), m_texture->GetHeight()};
-    } else {
-        m_sourceRect = {0, 0, 0, 0};
-    }
-}
-
-} // namespace rendering
\ No newline at end of file
+    m_useFullTexture = true;
+    m_sourceRect = {0, 0, 0, 0};
+}
+
+core::Bounds Sprite::GetWorldBounds(const core::Transform& transform) const {
+    const glm::ivec4 sourceRect = GetSourceRect();
+    const glm::vec2 size = glm::vec2(sourceRect.z, sourceRect.w);
+    const glm::vec2 originOffset = m_origin * size;
+    
+    // Same corner math as Renderer::DrawSprite
+    const float radians = glm::radians(transform.rotation);
+    const float cosR = std::cos(radians);
+    const float sinR = std::sin(radians);
+    auto toWorld = [&](float localX, float localY) {
+        float x = (localX - originOffset.x) * transform.scale.x;
+        float y = (localY - originOffset.y) * transform.scale.y;
+        return glm::vec2(transform.position.x + x * cosR - y * sinR, transform.position.y + x * sinR + y * cosR);
+    };
+    
+    const glm::vec2 corners[4] = {
+        toWorld(0.0f, 0.0f),
+        toWorld(size.x, 0.0f),
+        toWorld(size.x, size.y),
+        toWorld(0.0f, size.y)
+    };
+    return core::Bounds::FromPoints(corners, 4);
+}
+
+} // namespace rendering
@@ -1,9 +1,25 @@
 #include "engine/public/rendering/Texture.h"
+#include "engine/public/rendering/TextureContainer.h"
+#include "engine/public/utils/Assets.h"
 #include <SDL_image.h>
 #include <spdlog/spdlog.h>
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
 
 namespace rendering {
 
+thread_local unsigned int Texture::s_boundTextures[Texture::MAX_TRACKED_SLOTS] = {};
+thread_local unsigned int Texture::s_activeSlot = 0;
+
+namespace {
+
+// Set once from config before loading starts, read by decode jobs
+std::atomic<TextureFilter> s_defaultFilter{TextureFilter::Linear};
+std::atomic<bool> s_generateMipmaps{false};
+
+} // anonymous namespace
+
 Texture::Texture() = default;
 
 Texture::~Texture() {
@@ -15,12 +31,19 @@ Texture::Texture(Texture&& other) noexcept
     , m_width(other.m_width)
     , m_height(other.m_height)
     , m_channels(other.m_channels)
+    , m_mipLevels(other.m_mipLevels)
+    , m_compressedFormat(other.m_compressedFormat)
+    , m_memoryBytes(other.m_memoryBytes)
+    , m_pending(other.m_pending)
     , m_filepath(std::move(other.m_filepath)) {
     
     other.m_textureID = 0;
     other.m_width = 0;
     other.m_height = 0;
     other.m_channels = 0;
+    other.m_mipLevels = 0;
+    other.m_compressedFormat = 0;
+    other.m_memoryBytes = 0;
 }
 
 Texture& Texture::operator=(Texture&& other) noexcept {
@@ -31,27 +54,96 @@ Texture& Texture::operator=(Texture&& other) noexcept {
         m_width = other.m_width;
         m_height = other.m_height;
         m_channels = other.m_channels;
+        m_mipLevels = other.m_mipLevels;
+        m_compressedFormat = other.m_compressedFormat;
+        m_memoryBytes = other.m_memoryBytes;
+        m_pending = other.m_pending;
         m_filepath = std::move(other.m_filepath);
         
         other.m_textureID = 0;
         other.m_width = 0;
         other.m_height = 0;
         other.m_channels = 0;
+        other.m_mipLevels = 0;
+        other.m_compressedFormat = 0;
+        other.m_memoryBytes = 0;
     }
     return *this;
 }
 
 bool Texture::LoadFromFile(const std::string& filepath) {
-    m_filepath = filepath;
+    // Same path as async loads: decode (or read the container), then upload
+    ImageData image;
+    if (!DecodeFile(filepath, image)) {
+        return false;
+    }
+    return LoadFromImage(image, filepath);
+}
+
+bool Texture::LoadFromMemory(const unsigned char* data, int width, int height, int channels) {
+    if (!CreateGLTexture(data, width, height, channels)) {
+        return false;
+    }
+    
+    spdlog::info("Created texture from memory ({}x{}, {} channels)", width, height, channels);
+    return true;
+}
+
+bool Texture::LoadFromImage(const ImageData& image, const std::string& sourcePath) {
+    m_pending = false;
+    if (image.pixels.empty() || !CreateGLTexture(image)) {
+        return false;
+    }
     
-    // Load image using SDL_image
-    SDL_Surface* surface = IMG_Load(filepath.c_str());
+    m_filepath = sourcePath;
+    if (m_compressedFormat != 0) {
+        spdlog::info("Loaded texture '{}' ({}x{}, {}, {} mips)", sourcePath, m_width, m_height,
+                     GetCompressedFormatName(m_compressedFormat), m_mipLevels);
+    } else {
+        spdlog::info("Loaded texture '{}' ({}x{}, {} mips)", sourcePath, m_width, m_height, m_mipLevels);
+    }
+    return true;
+}
+
+bool Texture::Reload() {
+    if (m_filepath.empty() || m_pending) {
+        return false;
+    }
+    
+    // Same GL texture, new contents. The size must stay: animation frames, tile meshes and
+    // particle settings keep UVs computed from it
+    ImageData image;
+    if (!DecodeFile(m_filepath, image)) {
+        return false;
+    }
+    if (image.width != m_width || image.height != m_height) {
+        spdlog::warn("Not reloading texture '{}': size changed from {}x{} to {}x{} (restart to pick it up)",
+                     m_filepath, m_width, m_height, image.width, image.height);
+        return false;
+    }
+    const std::string filepath = m_filepath;
+    return LoadFromImage(image, filepath);
+}
+
+bool Texture::DecodeFile(const std::string& filepath, ImageData& image) {
+    if (IsTextureContainer(filepath)) {
+        if (!LoadTextureContainer(filepath, image)) {
+            return false;
+        }
+        if (image.compressedFormat == 0 && image.levels.size() == 1 && s_generateMipmaps.load(std::memory_order_relaxed)) {
+            GenerateMipmaps(image);
+        }
+        return true;
+    }
+    
+    // Typed by extension, as IMG_Load does (some formats have no signature)
+    const std::string extension = std::filesystem::path(filepath).extension().string();
+    SDL_Surface* surface = IMG_LoadTyped_RW(utils::OpenAsset(filepath), 1, extension.empty() ? nullptr : extension.c_str() + 1);
     if (!surface) {
         spdlog::error("Failed to load texture '{}': {}", filepath, IMG_GetError());
         return false;
     }
     
-    // Convert to RGBA format for consistency
     SDL_Surface* rgbaSurface = SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_RGBA32, 0);
     SDL_FreeSurface(surface);
     
@@ -60,32 +152,117 @@ bool Texture::LoadFromFile(const std::string& filepath) {
         return false;
     }
     
-    m_width = rgbaSurface->w;
-    m_height = rgbaSurface->h;
-    m_channels = 4; // RGBA
-    
-    // Create OpenGL texture
-    glGenTextures(1, &m_textureID);
-    glBindTexture(GL_TEXTURE_2D, m_textureID);
+    // Copy out tightly packed rows (surface pitch may include padding)
+    image.width = rgbaSurface->w;
+    image.height = rgbaSurface->h;
+    image.channels = 4;
+    image.pixels.resize(static_cast<size_t>(image.width) * image.height * 4);
     
-    // Upload texture data
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, m_width, m_height, 0, GL_RGBA, GL_UNSIGNED_BYTE, rgbaSurface->pixels);
-    
-    // Set default texture parameters
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    
-    glBindTexture(GL_TEXTURE_2D, 0);
+    const size_t rowBytes = static_cast<size_t>(image.width) * 4;
+    const auto* source = static_cast<const unsigned char*>(rgbaSurface->pixels);
+    for (int row = 0; row < image.height; ++row) {
+        std::copy_n(source + row * rgbaSurface->pitch, rowBytes, image.pixels.data() + row * rowBytes);
+    }
     
     SDL_FreeSurface(rgbaSurface);
     
-    spdlog::info("Loaded texture '{}' ({}x{})", filepath, m_width, m_height);
+    if (s_generateMipmaps.load(std::memory_order_relaxed)) {
+        GenerateMipmaps(image);
+    }
     return true;
 }
 
-bool Texture::LoadFromMemory(const unsigned char* data, int width, int height, int channels) {
+void Texture::GenerateMipmaps(ImageData& image) {
+    const int channels = image.channels;
+    if (image.compressedFormat != 0 || channels <= 0 || image.width <= 0 || image.height <= 0) {
+        return;
+    }
+    if (image.levels.empty()) {
+        image.levels.push_back({0, image.pixels.size(), image.width, image.height});
+    }
+    if (image.levels.size() > 1) {
+        return; // Already has a chain
+    }
+    
+    // Reserve the whole chain up front (at most a third more) so the buffer is allocated once
+    size_t total = image.pixels.size();
+    for (int width = image.width, height = image.height; width > 1 || height > 1;) {
+        width = std::max(width / 2, 1);
+        height = std::max(height / 2, 1);
+        total += static_cast<size_t>(width) * height * channels;
+    }
+    image.pixels.reserve(total);
+    
+    while (image.levels.back().width > 1 || image.levels.back().height > 1) {
+        const ImageLevel source = image.levels.back();
+        ImageLevel level;
+        level.width = std::max(source.width / 2, 1);
+        level.height = std::max(source.height / 2, 1);
+        level.offset = image.pixels.size();
+        level.size = static_cast<size_t>(level.width) * level.height * channels;
+        image.pixels.resize(level.offset + level.size);
+        
+        const unsigned char* in = image.pixels.data() + source.offset;
+        unsigned char* out = image.pixels.data() + level.offset;
+        for (int y = 0; y < level.height; ++y) {
+            const int y0 = std::min(y * 2, source.height - 1);
+            const int y1 = std::min(y * 2 + 1, source.height - 1);
+            for (int x = 0; x < level.width; ++x) {
+                const int x0 = std::min(x * 2, source.width - 1);
+                const int x1 = std::min(x * 2 + 1, source.width - 1);
+                const unsigned char* texels[4] = {
+                    in + (static_cast<size_t>(y0) * source.width + x0) * channels,
+                    in + (static_cast<size_t>(y0) * source.width + x1) * channels,
+                    in + (static_cast<size_t>(y1) * source.width + x0) * channels,
+                    in + (static_cast<size_t>(y1) * source.width + x1) * channels
+                };
+                unsigned char* texel = out + (static_cast<size_t>(y) * level.width + x) * channels;
+                
+                // RGBA: weight colour by alpha so transparent texels don't darken sprite edges
+                const int alphaSum = channels == 4 ? texels[0][3] + texels[1][3] + texels[2][3] + texels[3][3] : 0;
+                for (int c = 0; c < channels; ++c) {
+                    if (channels == 4 && c < 3 && alphaSum > 0) {
+                        int weighted = 0;
+                        for (const unsigned char* t : texels) {
+                            weighted += t[c] * t[3];
+                        }
+                        texel[c] = static_cast<unsigned char>((weighted + alphaSum / 2) / alphaSum);
+                    } else {
+                        texel[c] = static_cast<unsigned char>((texels[0][c] + texels[1][c] + texels[2][c] + texels[3][c] + 2) / 4);
+                    }
+                }
+            }
+        }
+        image.levels.push_back(level);
+    }
+}
+
+void Texture::SetDefaultFilter(TextureFilter filter) {
+    s_defaultFilter.store(filter, std::memory_order_relaxed);
+}
+
+TextureFilter Texture::GetDefaultFilter() {
+    return s_defaultFilter.load(std::memory_order_relaxed);
+}
+
+TextureFilter Texture::ParseFilter(const std::string& name) {
+    if (name == "nearest" || name == "point") return TextureFilter::Nearest;
+    if (name == "trilinear") return TextureFilter::Trilinear;
+    if (name != "linear" && name != "bilinear") {
+        spdlog::warn("Unknown texture filtering '{}', using linear", name);
+    }
+    return TextureFilter::Linear;
+}
+
+void Texture::SetGenerateMipmaps(bool generate) {
+    s_generateMipmaps.store(generate, std::memory_order_relaxed);
+}
+
+bool Texture::GetGenerateMipmaps() {
+    return s_generateMipmaps.load(std::memory_order_relaxed);
+}
+
+bool Texture::CreateGLTexture(const unsigned char* data, int width, int height, int channels) {
     if (!data || width <= 0 || height <= 0) {
         spdlog::error("Invalid texture data parameters");
         return false;
@@ -94,6 +271,9 @@ bool Texture::LoadFromMemory(const unsigned char* data, int width, int height, i
     m_width = width;
     m_height = height;
     m_channels = channels;
+    m_mipLevels = 1;
+    m_compressedFormat = 0;
+    m_memoryBytes = static_cast<size_t>(width) * height * channels;
     
     // Determine OpenGL format
     GLenum format = GL_RGBA;
@@ -101,53 +281,194 @@ bool Texture::LoadFromMemory(const unsigned char* data, int width, int height, i
     else if (channels == 3) format = GL_RGB;
     else if (channels == 4) format = GL_RGBA;
     
-    // Create OpenGL texture
-    glGenTextures(1, &m_textureID);
-    glBindTexture(GL_TEXTURE_2D, m_textureID);
+    // Create OpenGL texture (a reload keeps the existing ID, so holders of this texture see the new pixels)
+    if (m_textureID == 0) {
+        glGenTextures(1, &m_textureID);
+    }
+    BindTextureID(s_activeSlot, m_textureID);
     
     // Upload texture data
     glTexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, format, GL_UNSIGNED_BYTE, data);
     
     // Set default texture parameters
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, 0);
+    SetFilter(GetDefaultFilter());
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
     
-    glBindTexture(GL_TEXTURE_2D, 0);
+    BindTextureID(s_activeSlot, 0);
+    return true;
+}
+
+bool Texture::CreateGLTexture(const ImageData& image) {
+    if (image.pixels.empty() || image.width <= 0 || image.height <= 0) {
+        spdlog::error("Invalid texture data parameters");
+        return false;
+    }
+    if (image.compressedFormat != 0 && !IsCompressedFormatSupported(image.compressedFormat)) {
+        spdlog::error("Compressed format {} is not supported by this GPU/driver",
+                      GetCompressedFormatName(image.compressedFormat));
+        return false;
+    }
+    if (image.compressedFormat == 0 && image.levels.size() <= 1) {
+        return CreateGLTexture(image.pixels.data(), image.width, image.height, image.channels);
+    }
+    
+    GLenum format = GL_RGBA;
+    if (image.channels == 1) format = GL_RED;
+    else if (image.channels == 3) format = GL_RGB;
+    
+    if (m_textureID == 0) {
+        glGenTextures(1, &m_textureID);
+    }
+    BindTextureID(s_activeSlot, m_textureID);
+    
+    // Mip levels of 1 and 3 channel data get small enough to lose 4-byte row alignment
+    const bool unaligned = image.compressedFormat == 0 && image.channels != 4;
+    if (unaligned) glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    
+    size_t bytes = 0;
+    for (size_t i = 0; i < image.levels.size(); ++i) {
+        const ImageLevel& level = image.levels[i];
+        const unsigned char* data = image.pixels.data() + level.offset;
+        if (image.compressedFormat != 0) {
+            glCompressedTexImage2D(GL_TEXTURE_2D, static_cast<GLint>(i), image.compressedFormat, level.width, level.height, 0,
+                                   static_cast<GLsizei>(level.size), data);
+        } else {
+            glTexImage2D(GL_TEXTURE_2D, static_cast<GLint>(i), format, level.width, level.height, 0, format, GL_UNSIGNED_BYTE, data);
+        }
+        bytes += level.size;
+    }
+    
+    if (unaligned) glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    
+    m_width = image.width;
+    m_height = image.height;
+    m_channels = image.channels;
+    m_mipLevels = static_cast<int>(image.levels.size());
+    m_compressedFormat = image.compressedFormat;
+    m_memoryBytes = bytes;
+    
+    // Partial chains (e.g. DDS files stopping at 4x4) stay complete for sampling
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, m_mipLevels - 1);
+    SetFilter(GetDefaultFilter());
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    
+    BindTextureID(s_activeSlot, 0);
+    return true;
+}
+
+bool Texture::UpdateRegion(int x, int y, int width, int height, const unsigned char* data) {
+    if (!m_textureID || !data || width <= 0 || height <= 0) {
+        return false;
+    }
+    
+    if (m_compressedFormat != 0) {
+        spdlog::error("Cannot update a region of compressed texture '{}'", m_filepath);
+        return false;
+    }
+    
+    if (x < 0 || y < 0 || x + width > m_width || y + height > m_height) {
+        spdlog::error("Texture region ({}, {}, {}x{}) is outside the {}x{} texture", x, y, width, height, m_width, m_height);
+        return false;
+    }
+    
+    GLenum format = GL_RGBA;
+    if (m_channels == 1) format = GL_RED;
+    else if (m_channels == 3) format = GL_RGB;
+    
+    BindTextureID(s_activeSlot, m_textureID);
+    
+    // Rows of 1 and 3 channel data aren't necessarily 4-byte aligned
+    if (m_channels != 4) glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, width, height, format, GL_UNSIGNED_BYTE, data);
+    if (m_channels != 4) glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
     
-    spdlog::info("Created texture from memory ({}x{}, {} channels)", width, height, channels);
     return true;
 }
 
 void Texture::Bind(unsigned int slot) const {
-    glActiveTexture(GL_TEXTURE0 + slot);
-    glBindTexture(GL_TEXTURE_2D, m_textureID);
+    BindTextureID(slot, m_textureID);
 }
 
 void Texture::Unbind() const {
-    glBindTexture(GL_TEXTURE_2D, 0);
+    BindTextureID(s_activeSlot, 0);
+}
+
+void Texture::InvalidateBindingCache() {
+    // No real texture has this ID, so the next bind on every slot reaches GL
+    for (auto& bound : s_boundTextures) {
+        bound = ~0u;
+    }
+    glActiveTexture(GL_TEXTURE0);
+    s_activeSlot = 0;
+}
+
+void Texture::SetFilter(TextureFilter filter) {
+    const bool mipmapped = m_mipLevels > 1;
+    switch (filter) {
+        case TextureFilter::Nearest:
+            SetFilterMode(mipmapped ? GL_NEAREST_MIPMAP_NEAREST : GL_NEAREST, GL_NEAREST);
+            break;
+        case TextureFilter::Linear:
+            SetFilterMode(mipmapped ? GL_LINEAR_MIPMAP_NEAREST : GL_LINEAR, GL_LINEAR);
+            break;
+        case TextureFilter::Trilinear:
+            SetFilterMode(mipmapped ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR, GL_LINEAR);
+            break;
+    }
 }
 
 void Texture::SetFilterMode(GLenum minFilter, GLenum magFilter) {
-    glBindTexture(GL_TEXTURE_2D, m_textureID);
+    BindTextureID(s_activeSlot, m_textureID);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, minFilter);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, magFilter);
-    glBindTexture(GL_TEXTURE_2D, 0);
 }
 
 void Texture::SetWrapMode(GLenum wrapS, GLenum wrapT) {
-    glBindTexture(GL_TEXTURE_2D, m_textureID);
+    BindTextureID(s_activeSlot, m_textureID);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, wrapS);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, wrapT);
-    glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+void Texture::BindTextureID(unsigned int slot, unsigned int textureID) {
+    if (slot >= MAX_TRACKED_SLOTS) {
+        // Untracked unit - always hit GL, then restore unit 0 so the active slot stays known
+        glActiveTexture(GL_TEXTURE0 + slot);
+        glBindTexture(GL_TEXTURE_2D, textureID);
+        glActiveTexture(GL_TEXTURE0);
+        s_activeSlot = 0;
+        return;
+    }
+    
+    if (s_boundTextures[slot] == textureID) {
+        return;
+    }
+    
+    if (s_activeSlot != slot) {
+        glActiveTexture(GL_TEXTURE0 + slot);
+        s_activeSlot = slot;
+    }
+    glBindTexture(GL_TEXTURE_2D, textureID);
+    s_boundTextures[slot] = textureID;
 }
 
 void Texture::Cleanup() {
     if (m_textureID != 0) {
+        // GL unbinds deleted textures; forget them so a recycled ID isn't mistaken for bound
+        for (auto& bound : s_boundTextures) {
+            if (bound == m_textureID) {
+                bound = 0;
+            }
+        }
+        
         glDeleteTextures(1, &m_textureID);
         m_textureID = 0;
     }
+    m_mipLevels = 0;
+    m_compressedFormat = 0;
+    m_memoryBytes = 0;
 }
 
 } // namespace rendering
\ No newline at end of file
@@ -0,0 +1,413 @@
+#include "engine/public/rendering/TextureAtlas.h"
+#include "engine/public/rendering/RectPacker.h"
+#include "engine/public/rendering/Texture.h"
+#include "engine/public/utils/Assets.h"
+#include <SDL_image.h>
+#include <nlohmann/json.hpp>
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+namespace rendering {
+
+namespace {
+
+constexpr int ATLAS_CACHE_VERSION = 1;
+
+bool IsSupportedImage(const std::filesystem::path& path) {
+    std::string extension = path.extension().string();
+    std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+    return extension == ".png" || extension == ".jpg" || extension == ".jpeg" ||
+           extension == ".bmp" || extension == ".tga";
+}
+
+} // namespace
+
+TextureAtlas::TextureAtlas() = default;
+
+TextureAtlas::~TextureAtlas() = default;
+
+bool TextureAtlas::BuildFromDirectory(const std::string& directory, const AtlasOptions& options) {
+    if (!std::filesystem::is_directory(directory)) {
+        spdlog::error("Atlas directory not found: {}", directory);
+        return false;
+    }
+
+    std::vector<std::string> imagePaths;
+    try {
+        for (const auto& entry : std::filesystem::recursive_directory_iterator(directory)) {
+            if (entry.is_regular_file() && IsSupportedImage(entry.path())) {
+                imagePaths.push_back(entry.path().generic_string());
+            }
+        }
+    } catch (const std::exception& e) {
+        spdlog::error("Failed to scan atlas directory '{}': {}", directory, e.what());
+        return false;
+    }
+
+    // Sort for a deterministic layout across platforms
+    std::sort(imagePaths.begin(), imagePaths.end());
+
+    return BuildFromFiles(imagePaths, options, directory);
+}
+
+bool TextureAtlas::BuildFromFiles(const std::vector<std::string>& imagePaths, const AtlasOptions& options,
+                                  const std::string& baseDirectory) {
+    if (imagePaths.empty()) {
+        spdlog::error("No images provided for texture atlas");
+        return false;
+    }
+
+    if (options.pageSize <= 0 || options.padding < 0) {
+        spdlog::error("Invalid atlas options (page size {}, padding {})", options.pageSize, options.padding);
+        return false;
+    }
+
+    m_pages.clear();
+    m_regions.clear();
+
+    // Gather source descriptions (also used to validate the cache)
+    std::vector<SourceImage> sources;
+    sources.reserve(imagePaths.size());
+
+    for (const auto& path : imagePaths) {
+        SourceImage source;
+        source.path = path;
+
+        std::filesystem::path filePath(path);
+        std::filesystem::path relative = filePath;
+        if (!baseDirectory.empty()) {
+            relative = std::filesystem::relative(filePath, baseDirectory);
+        }
+        source.regionName = relative.replace_extension().generic_string();
+
+        std::error_code ec;
+        source.fileSize = std::filesystem::file_size(filePath, ec);
+        if (ec) {
+            spdlog::error("Atlas source image not found: {}", path);
+            return false;
+        }
+        source.modifiedTime = static_cast<long long>(
+            std::filesystem::last_write_time(filePath, ec).time_since_epoch().count());
+
+        sources.push_back(std::move(source));
+    }
+
+    // Try the cached layout first
+    if (!options.cachePath.empty() && LoadCache(sources, options)) {
+        spdlog::info("Loaded texture atlas from cache '{}' ({} regions, {} pages)",
+                    options.cachePath, m_regions.size(), m_pages.size());
+        return true;
+    }
+
+    return Pack(sources, options);
+}
+
+bool TextureAtlas::HasRegion(const std::string& name) const {
+    return m_regions.find(name) != m_regions.end();
+}
+
+const TextureAtlas::Region* TextureAtlas::GetRegion(const std::string& name) const {
+    auto it = m_regions.find(name);
+    if (it != m_regions.end()) {
+        return &it->second;
+    }
+    return nullptr;
+}
+
+Sprite TextureAtlas::CreateSprite(const std::string& regionName) const {
+    const Region* region = GetRegion(regionName);
+    if (!region) {
+        spdlog::warn("Atlas region '{}' not found", regionName);
+        return Sprite();
+    }
+
+    return Sprite(m_pages[region->page], region->rect);
+}
+
+std::vector<std::string> TextureAtlas::GetRegionNames() const {
+    std::vector<std::string> names;
+    names.reserve(m_regions.size());
+    for (const auto& [name, region] : m_regions) {
+        names.push_back(name);
+    }
+    std::sort(names.begin(), names.end());
+    return names;
+}
+
+std::shared_ptr<Texture> TextureAtlas::GetPageTexture(int page) const {
+    if (page < 0 || page >= static_cast<int>(m_pages.size())) {
+        return nullptr;
+    }
+    return m_pages[page];
+}
+
+bool TextureAtlas::Pack(const std::vector<SourceImage>& sources, const AtlasOptions& options) {
+    struct LoadedImage {
+        const SourceImage* source = nullptr;
+        SDL_Surface* surface = nullptr;
+    };
+
+    // Load and convert all source images
+    std::vector<LoadedImage> images;
+    images.reserve(sources.size());
+
+    auto freeImages = [&images]() {
+        for (auto& image : images) {
+            SDL_FreeSurface(image.surface);
+        }
+        images.clear();
+    };
+
+    for (const auto& source : sources) {
+        const std::string extension = std::filesystem::path(source.path).extension().string();
+        SDL_Surface* surface = IMG_LoadTyped_RW(utils::OpenAsset(source.path), 1, extension.empty() ? nullptr : extension.c_str() + 1);
+        if (!surface) {
+            spdlog::error("Failed to load atlas image '{}': {}", source.path, IMG_GetError());
+            continue;
+        }
+
+        SDL_Surface* rgbaSurface = SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_RGBA32, 0);
+        SDL_FreeSurface(surface);
+        if (!rgbaSurface) {
+            spdlog::error("Failed to convert atlas image '{}' to RGBA format: {}", source.path, SDL_GetError());
+            continue;
+        }
+
+        if (rgbaSurface->w + options.padding > options.pageSize || rgbaSurface->h + options.padding > options.pageSize) {
+            spdlog::error("Atlas image '{}' ({}x{}) does not fit in a {}x{} page",
+                         source.path, rgbaSurface->w, rgbaSurface->h, options.pageSize, options.pageSize);
+            SDL_FreeSurface(rgbaSurface);
+            continue;
+        }
+
+        images.push_back({&source, rgbaSurface});
+    }
+
+    if (images.empty()) {
+        spdlog::error("No valid images to pack into atlas");
+        return false;
+    }
+
+    // Largest first gives MaxRects the best results for offline packing
+    std::sort(images.begin(), images.end(), [](const LoadedImage& a, const LoadedImage& b) {
+        int sideA = std::max(a.surface->w, a.surface->h);
+        int sideB = std::max(b.surface->w, b.surface->h);
+        if (sideA != sideB) return sideA > sideB;
+        return a.source->regionName < b.source->regionName;
+    });
+
+    std::vector<RectPacker> packers;
+    std::vector<std::vector<unsigned char>> pagePixels;
+    const size_t pageBytes = static_cast<size_t>(options.pageSize) * options.pageSize * 4;
+
+    for (const auto& image : images) {
+        const int paddedWidth = image.surface->w + options.padding;
+        const int paddedHeight = image.surface->h + options.padding;
+
+        glm::ivec2 position;
+        int page = -1;
+        for (size_t i = 0; i < packers.size(); ++i) {
+            if (packers[i].Insert(paddedWidth, paddedHeight, position)) {
+                page = static_cast<int>(i);
+                break;
+            }
+        }
+
+        // Start a new page if no existing page has room
+        if (page < 0) {
+            packers.emplace_back(options.pageSize, options.pageSize);
+            pagePixels.emplace_back(pageBytes, 0);
+            page = static_cast<int>(packers.size() - 1);
+            packers.back().Insert(paddedWidth, paddedHeight, position);
+        }
+
+        // Copy pixels row by row into the page
+        auto& pixels = pagePixels[page];
+        const auto* src = static_cast<const unsigned char*>(image.surface->pixels);
+        const size_t rowBytes = static_cast<size_t>(image.surface->w) * 4;
+        for (int row = 0; row < image.surface->h; ++row) {
+            size_t dstOffset = (static_cast<size_t>(position.y + row) * options.pageSize + position.x) * 4;
+            std::memcpy(&pixels[dstOffset], src + static_cast<size_t>(row) * image.surface->pitch, rowBytes);
+        }
+
+        Region region;
+        region.page = page;
+        region.rect = {position.x, position.y, image.surface->w, image.surface->h};
+        m_regions[image.source->regionName] = region;
+    }
+
+    freeImages();
+
+    // Upload pages
+    for (size_t i = 0; i < pagePixels.size(); ++i) {
+        auto texture = std::make_shared<Texture>();
+        if (!texture->LoadFromMemory(pagePixels[i].data(), options.pageSize, options.pageSize, 4)) {
+            spdlog::error("Failed to create atlas page {}", i);
+            m_pages.clear();
+            m_regions.clear();
+            return false;
+        }
+        m_pages.push_back(texture);
+
+        spdlog::debug("Atlas page {}: {:.1f}% occupied", i, packers[i].GetOccupancy() * 100.0f);
+    }
+
+    spdlog::info("Packed texture atlas: {} regions into {} page(s) of {}x{}",
+                m_regions.size(), m_pages.size(), options.pageSize, options.pageSize);
+
+    if (!options.cachePath.empty()) {
+        WriteCache(sources, options, pagePixels);
+    }
+
+    return true;
+}
+
+bool TextureAtlas::LoadCache(const std::vector<SourceImage>& sources, const AtlasOptions& options) {
+    const std::string layoutPath = options.cachePath + ".json";
+
+    std::ifstream file(layoutPath);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    try {
+        nlohmann::json layout;
+        file >> layout;
+
+        if (layout.value("version", 0) != ATLAS_CACHE_VERSION ||
+            layout.value("page_size", 0) != options.pageSize ||
+            layout.value("padding", -1) != options.padding) {
+            spdlog::info("Atlas cache '{}' is out of date (options changed), repacking", layoutPath);
+            return false;
+        }
+
+        // Source list must match exactly (same files, sizes and modification times)
+        const auto& cachedSources = layout["sources"];
+        if (!cachedSources.is_array() || cachedSources.size() != sources.size()) {
+            spdlog::info("Atlas cache '{}' is out of date (sources changed), repacking", layoutPath);
+            return false;
+        }
+
+        for (size_t i = 0; i < sources.size(); ++i) {
+            const auto& cached = cachedSources[i];
+            if (cached.value("path", "") != sources[i].path ||
+                cached.value("size", uintmax_t(0)) != sources[i].fileSize ||
+                cached.value("mtime", 0LL) != sources[i].modifiedTime) {
+                spdlog::info("Atlas cache '{}' is out of date ('{}' changed), repacking", layoutPath, sources[i].path);
+                return false;
+            }
+        }
+
+        // Load the pre-packed page images
+        std::vector<std::shared_ptr<Texture>> pages;
+        size_t pageCount = layout.value("pages", size_t(0));
+        for (size_t i = 0; i < pageCount; ++i) {
+            auto texture = std::make_shared<Texture>();
+            if (!texture->LoadFromFile(GetPageCachePath(options.cachePath, i))) {
+                spdlog::warn("Atlas cache page {} missing, repacking", i);
+                return false;
+            }
+            pages.push_back(texture);
+        }
+
+        std::unordered_map<std::string, Region> regions;
+        for (const auto& [name, value] : layout["regions"].items()) {
+            Region region;
+            region.page = value.value("page", 0);
+            auto rect = value["rect"];
+            region.rect = {rect[0].get<int>(), rect[1].get<int>(), rect[2].get<int>(), rect[3].get<int>()};
+
+            if (region.page < 0 || region.page >= static_cast<int>(pages.size())) {
+                spdlog::warn("Atlas cache region '{}' references invalid page, repacking", name);
+                return false;
+            }
+            regions[name] = region;
+        }
+
+        m_pages = std::move(pages);
+        m_regions = std::move(regions);
+        return true;
+
+    } catch (const std::exception& e) {
+        spdlog::warn("Failed to read atlas cache '{}': {}", layoutPath, e.what());
+        return false;
+    }
+}
+
+bool TextureAtlas::WriteCache(const std::vector<SourceImage>& sources, const AtlasOptions& options,
+                              const std::vector<std::vector<unsigned char>>& pagePixels) const {
+    try {
+        std::filesystem::path cacheDir = std::filesystem::path(options.cachePath).parent_path();
+        if (!cacheDir.empty()) {
+            std::filesystem::create_directories(cacheDir);
+        }
+
+        // Write page images
+        for (size_t i = 0; i < pagePixels.size(); ++i) {
+            SDL_Surface* surface = SDL_CreateRGBSurfaceWithFormatFrom(
+                const_cast<unsigned char*>(pagePixels[i].data()), options.pageSize, options.pageSize, 32,
+                options.pageSize * 4, SDL_PIXELFORMAT_RGBA32);
+            if (!surface) {
+                spdlog::warn("Failed to create surface for atlas cache page {}: {}", i, SDL_GetError());
+                return false;
+            }
+
+            std::string pagePath = GetPageCachePath(options.cachePath, i);
+            int result = IMG_SavePNG(surface, pagePath.c_str());
+            SDL_FreeSurface(surface);
+
+            if (result != 0) {
+                spdlog::warn("Failed to write atlas cache page '{}': {}", pagePath, IMG_GetError());
+                return false;
+            }
+        }
+
+        // Write layout
+        nlohmann::json layout;
+        layout["version"] = ATLAS_CACHE_VERSION;
+        layout["page_size"] = options.pageSize;
+        layout["padding"] = options.padding;
+        layout["pages"] = pagePixels.size();
+
+        layout["sources"] = nlohmann::json::array();
+        for (const auto& source : sources) {
+            layout["sources"].push_back({
+                {"path", source.path},
+                {"size", source.fileSize},
+                {"mtime", source.modifiedTime}
+            });
+        }
+
+        layout["regions"] = nlohmann::json::object();
+        for (const auto& [name, region] : m_regions) {
+            layout["regions"][name] = {
+                {"page", region.page},
+                {"rect", {region.rect.x, region.rect.y, region.rect.z, region.rect.w}}
+            };
+        }
+
+        std::string layoutPath = options.cachePath + ".json";
+        std::ofstream file(layoutPath);
+        if (!file.is_open()) {
+            spdlog::warn("Failed to open atlas cache for writing: {}", layoutPath);
+            return false;
+        }
+        file << layout.dump(4);
+
+        spdlog::info("Wrote texture atlas cache: {}", layoutPath);
+        return true;
+
+    } catch (const std::exception& e) {
+        spdlog::warn("Failed to write atlas cache '{}': {}", options.cachePath, e.what());
+        return false;
+    }
+}
+
+std::string TextureAtlas::GetPageCachePath(const std::string& cachePath, size_t page) {
+    return cachePath + "_" + std::to_string(page) + ".png";
+}
+
+} // namespace rendering
@@ -0,0 +1,343 @@
+#include "engine/public/rendering/TextureContainer.h"
+#include "engine/public/rendering/Texture.h"
+#include "engine/public/utils/Assets.h"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace rendering {
+
+namespace {
+
+struct CompressedFormat {
+    GLenum format;
+    uint32_t blockBytes; // Per 4x4 block
+    const char* name;
+};
+
+const CompressedFormat COMPRESSED_FORMATS[] = {
+    {GL_COMPRESSED_RGB_S3TC_DXT1_EXT, 8, "BC1 RGB"},
+    {GL_COMPRESSED_RGBA_S3TC_DXT1_EXT, 8, "BC1"},
+    {GL_COMPRESSED_RGBA_S3TC_DXT3_EXT, 16, "BC2"},
+    {GL_COMPRESSED_RGBA_S3TC_DXT5_EXT, 16, "BC3"},
+    {GL_COMPRESSED_RED_RGTC1, 8, "BC4"},
+    {GL_COMPRESSED_RG_RGTC2, 16, "BC5"},
+    {GL_COMPRESSED_RGBA_BPTC_UNORM, 16, "BC7"},
+    {GL_COMPRESSED_RGB8_ETC2, 8, "ETC2 RGB"},
+    {GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2, 8, "ETC2 RGB A1"},
+    {GL_COMPRESSED_RGBA8_ETC2_EAC, 16, "ETC2 RGBA"},
+    {GL_COMPRESSED_R11_EAC, 8, "EAC R11"},
+    {GL_COMPRESSED_RG11_EAC, 16, "EAC RG11"},
+};
+
+const CompressedFormat* FindCompressedFormat(GLenum format) {
+    for (const CompressedFormat& entry : COMPRESSED_FORMATS) {
+        if (entry.format == format) {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+// Pixel layout of a container: a compressed GL format, or raw RGBA8 (format 0)
+struct ContainerFormat {
+    GLenum compressedFormat = 0;
+    bool supported = false;
+};
+
+ContainerFormat FromDxgiFormat(uint32_t dxgi) {
+    switch (dxgi) {
+        case 28: case 29: return {0, true};                                      // R8G8B8A8_UNORM(_SRGB)
+        case 71: case 72: return {GL_COMPRESSED_RGBA_S3TC_DXT1_EXT, true};       // BC1
+        case 74: case 75: return {GL_COMPRESSED_RGBA_S3TC_DXT3_EXT, true};       // BC2
+        case 77: case 78: return {GL_COMPRESSED_RGBA_S3TC_DXT5_EXT, true};       // BC3
+        case 80:          return {GL_COMPRESSED_RED_RGTC1, true};                // BC4_UNORM
+        case 83:          return {GL_COMPRESSED_RG_RGTC2, true};                 // BC5_UNORM
+        case 98: case 99: return {GL_COMPRESSED_RGBA_BPTC_UNORM, true};          // BC7
+        default:          return {};
+    }
+}
+
+ContainerFormat FromVkFormat(uint32_t vkFormat) {
+    switch (vkFormat) {
+        case 37: case 43:   return {0, true};                                             // R8G8B8A8_UNORM/SRGB
+        case 131: case 132: return {GL_COMPRESSED_RGB_S3TC_DXT1_EXT, true};               // BC1_RGB
+        case 133: case 134: return {GL_COMPRESSED_RGBA_S3TC_DXT1_EXT, true};              // BC1_RGBA
+        case 135: case 136: return {GL_COMPRESSED_RGBA_S3TC_DXT3_EXT, true};              // BC2
+        case 137: case 138: return {GL_COMPRESSED_RGBA_S3TC_DXT5_EXT, true};              // BC3
+        case 139:           return {GL_COMPRESSED_RED_RGTC1, true};                       // BC4_UNORM
+        case 141:           return {GL_COMPRESSED_RG_RGTC2, true};                        // BC5_UNORM
+        case 145: case 146: return {GL_COMPRESSED_RGBA_BPTC_UNORM, true};                 // BC7
+        case 147: case 148: return {GL_COMPRESSED_RGB8_ETC2, true};                       // ETC2_R8G8B8
+        case 149: case 150: return {GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2, true};   // ETC2_R8G8B8A1
+        case 151: case 152: return {GL_COMPRESSED_RGBA8_ETC2_EAC, true};                  // ETC2_R8G8B8A8
+        case 153:           return {GL_COMPRESSED_R11_EAC, true};                         // EAC_R11_UNORM
+        case 155:           return {GL_COMPRESSED_RG11_EAC, true};                        // EAC_R11G11_UNORM
+        default:            return {};
+    }
+}
+
+// Largest side a container may declare. Parsing runs on loader threads, so this is a fixed bound rather
+// than GL_MAX_TEXTURE_SIZE; it keeps the int level sizes and the size_t level byte counts from overflowing.
+constexpr uint32_t MAX_TEXTURE_DIMENSION = 16384;
+
+bool IsValidDimension(uint32_t size) {
+    return size > 0 && size <= MAX_TEXTURE_DIMENSION;
+}
+
+template<typename T>
+T ReadValue(const std::vector<unsigned char>& data, size_t offset) {
+    T value{};
+    if (offset + sizeof(T) <= data.size()) {
+        std::memcpy(&value, data.data() + offset, sizeof(T)); // Containers are little-endian, like our targets
+    }
+    return value;
+}
+
+size_t GetLevelSize(GLenum compressedFormat, int width, int height) {
+    if (compressedFormat == 0) {
+        return static_cast<size_t>(width) * static_cast<size_t>(height) * 4;
+    }
+    const CompressedFormat* format = FindCompressedFormat(compressedFormat);
+    const size_t blocksX = static_cast<size_t>((width + 3) / 4);
+    const size_t blocksY = static_cast<size_t>((height + 3) / 4);
+    return blocksX * blocksY * (format ? format->blockBytes : 16);
+}
+
+bool ReadFileBytes(const std::string& path, std::vector<unsigned char>& data) {
+    return utils::ReadAsset(path, data) && !data.empty();
+}
+
+// Copy one mip level out of the file into the image (levels end up back to back)
+bool AppendLevel(ImageData& image, const std::vector<unsigned char>& data, size_t offset, size_t size, int width, int height) {
+    if (offset > data.size() || size > data.size() - offset) {
+        return false;
+    }
+    ImageLevel level;
+    level.offset = image.pixels.size();
+    level.size = size;
+    level.width = width;
+    level.height = height;
+    image.pixels.insert(image.pixels.end(), data.begin() + offset, data.begin() + offset + size);
+    image.levels.push_back(level);
+    return true;
+}
+
+bool ParseDDS(const std::string& path, const std::vector<unsigned char>& data, ImageData& image) {
+    constexpr uint32_t DDSD_MIPMAPCOUNT = 0x20000;
+    constexpr uint32_t DDPF_FOURCC = 0x4;
+    constexpr uint32_t DDSCAPS2_CUBEMAP = 0x200;
+    constexpr uint32_t DDSCAPS2_VOLUME = 0x200000;
+    auto fourCC = [](const char* code) {
+        return static_cast<uint32_t>(code[0]) | (static_cast<uint32_t>(code[1]) << 8) |
+               (static_cast<uint32_t>(code[2]) << 16) | (static_cast<uint32_t>(code[3]) << 24);
+    };
+
+    if (data.size() < 128 || ReadValue<uint32_t>(data, 0) != fourCC("DDS ") || ReadValue<uint32_t>(data, 4) != 124) {
+        spdlog::error("Not a DDS file: {}", path);
+        return false;
+    }
+
+    const uint32_t flags = ReadValue<uint32_t>(data, 8);
+    const uint32_t rawHeight = ReadValue<uint32_t>(data, 12);
+    const uint32_t rawWidth = ReadValue<uint32_t>(data, 16);
+    const uint32_t mipCount = (flags & DDSD_MIPMAPCOUNT) ? std::max(ReadValue<uint32_t>(data, 28), 1u) : 1u;
+    const uint32_t pixelFlags = ReadValue<uint32_t>(data, 80);
+    const uint32_t code = ReadValue<uint32_t>(data, 84);
+    const uint32_t caps2 = ReadValue<uint32_t>(data, 112);
+
+    if (!IsValidDimension(rawWidth) || !IsValidDimension(rawHeight)) {
+        spdlog::error("DDS size {}x{} is empty or larger than {}: {}", rawWidth, rawHeight, MAX_TEXTURE_DIMENSION, path);
+        return false;
+    }
+    const int width = static_cast<int>(rawWidth);
+    const int height = static_cast<int>(rawHeight);
+
+    if (caps2 & (DDSCAPS2_CUBEMAP | DDSCAPS2_VOLUME)) {
+        spdlog::error("DDS cube maps and volume textures are not supported: {}", path);
+        return false;
+    }
+    if (!(pixelFlags & DDPF_FOURCC)) {
+        spdlog::error("Uncompressed legacy DDS is not supported (use PNG or a DX10 header): {}", path);
+        return false;
+    }
+
+    ContainerFormat format;
+    size_t dataOffset = 128;
+    if (code == fourCC("DXT1")) {
+        format = {GL_COMPRESSED_RGBA_S3TC_DXT1_EXT, true};
+    } else if (code == fourCC("DXT3")) {
+        format = {GL_COMPRESSED_RGBA_S3TC_DXT3_EXT, true};
+    } else if (code == fourCC("DXT5")) {
+        format = {GL_COMPRESSED_RGBA_S3TC_DXT5_EXT, true};
+    } else if (code == fourCC("ATI1") || code == fourCC("BC4U")) {
+        format = {GL_COMPRESSED_RED_RGTC1, true};
+    } else if (code == fourCC("ATI2") || code == fourCC("BC5U")) {
+        format = {GL_COMPRESSED_RG_RGTC2, true};
+    } else if (code == fourCC("DX10")) {
+        if (data.size() < 148) {
+            spdlog::error("Truncated DDS file: {}", path);
+            return false;
+        }
+        if (ReadValue<uint32_t>(data, 132) != 3 || ReadValue<uint32_t>(data, 140) > 1) { // TEXTURE2D, single slice
+            spdlog::error("Only single 2D DDS textures are supported: {}", path);
+            return false;
+        }
+        format = FromDxgiFormat(ReadValue<uint32_t>(data, 128));
+        dataOffset = 148;
+    }
+
+    if (!format.supported) {
+        spdlog::error("Unsupported DDS pixel format in {}", path);
+        return false;
+    }
+
+    image.width = width;
+    image.height = height;
+    image.channels = 4;
+    image.compressedFormat = format.compressedFormat;
+
+    size_t offset = dataOffset;
+    int levelWidth = width;
+    int levelHeight = height;
+    for (uint32_t level = 0; level < mipCount; ++level) {
+        const size_t size = GetLevelSize(format.compressedFormat, levelWidth, levelHeight);
+        if (!AppendLevel(image, data, offset, size, levelWidth, levelHeight)) {
+            if (level == 0) {
+                spdlog::error("Truncated DDS file: {}", path);
+                return false;
+            }
+            spdlog::warn("DDS file {} has fewer mip levels than declared, using {}", path, level);
+            break;
+        }
+        offset += size;
+        levelWidth = std::max(levelWidth / 2, 1);
+        levelHeight = std::max(levelHeight / 2, 1);
+    }
+    return true;
+}
+
+bool ParseKTX2(const std::string& path, const std::vector<unsigned char>& data, ImageData& image) {
+    static const unsigned char IDENTIFIER[12] = {0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n'};
+    if (data.size() < 80 || std::memcmp(data.data(), IDENTIFIER, sizeof(IDENTIFIER)) != 0) {
+        spdlog::error("Not a KTX2 file: {}", path);
+        return false;
+    }
+
+    const uint32_t vkFormat = ReadValue<uint32_t>(data, 12);
+    const uint32_t rawWidth = ReadValue<uint32_t>(data, 20);
+    const uint32_t rawHeight = ReadValue<uint32_t>(data, 24);
+    const uint32_t depth = ReadValue<uint32_t>(data, 28);
+    const uint32_t layers = ReadValue<uint32_t>(data, 32);
+    const uint32_t faces = ReadValue<uint32_t>(data, 36);
+    const uint32_t levelCount = std::max(ReadValue<uint32_t>(data, 40), 1u);
+    const uint32_t supercompression = ReadValue<uint32_t>(data, 44);
+
+    if (depth > 1 || layers > 1 || faces != 1 || rawHeight == 0) {
+        spdlog::error("Only single 2D KTX2 textures are supported: {}", path);
+        return false;
+    }
+    if (!IsValidDimension(rawWidth) || !IsValidDimension(rawHeight)) {
+        spdlog::error("KTX2 size {}x{} is empty or larger than {}: {}", rawWidth, rawHeight, MAX_TEXTURE_DIMENSION, path);
+        return false;
+    }
+    const int width = static_cast<int>(rawWidth);
+    const int height = static_cast<int>(rawHeight);
+    if (supercompression != 0) {
+        spdlog::error("Supercompressed KTX2 (Basis Universal / Zstandard) is not supported: {}", path);
+        return false;
+    }
+
+    const ContainerFormat format = FromVkFormat(vkFormat);
+    if (!format.supported) {
+        spdlog::error("Unsupported KTX2 format (VkFormat {}) in {}", vkFormat, path);
+        return false;
+    }
+
+    image.width = width;
+    image.height = height;
+    image.channels = 4;
+    image.compressedFormat = format.compressedFormat;
+
+    // Level index follows the 80 byte header, largest level first
+    int levelWidth = width;
+    int levelHeight = height;
+    for (uint32_t level = 0; level < levelCount; ++level) {
+        const size_t entry = 80 + static_cast<size_t>(level) * 24;
+        const auto offset = static_cast<size_t>(ReadValue<uint64_t>(data, entry));
+        const auto size = static_cast<size_t>(ReadValue<uint64_t>(data, entry + 8));
+        if (size < GetLevelSize(format.compressedFormat, levelWidth, levelHeight) ||
+            !AppendLevel(image, data, offset, size, levelWidth, levelHeight)) {
+            if (level == 0) {
+                spdlog::error("Truncated KTX2 file: {}", path);
+                return false;
+            }
+            spdlog::warn("KTX2 file {} has a broken mip level {}, using the first {}", path, level, level);
+            break;
+        }
+        levelWidth = std::max(levelWidth / 2, 1);
+        levelHeight = std::max(levelHeight / 2, 1);
+    }
+    return true;
+}
+
+// Case-insensitive suffix test (suffix given in lower case)
+bool HasExtension(const std::string& path, const char* suffix) {
+    const size_t length = std::strlen(suffix);
+    if (path.size() < length) {
+        return false;
+    }
+    return std::equal(path.end() - length, path.end(), suffix, [](char a, char b) {
+        return std::tolower(static_cast<unsigned char>(a)) == b;
+    });
+}
+
+} // anonymous namespace
+
+bool IsTextureContainer(const std::string& path) {
+    return HasExtension(path, ".dds") || HasExtension(path, ".ktx2");
+}
+
+bool LoadTextureContainer(const std::string& path, ImageData& image) {
+    std::vector<unsigned char> data;
+    if (!ReadFileBytes(path, data)) {
+        spdlog::error("Failed to read texture file: {}", path);
+        return false;
+    }
+
+    image = ImageData{};
+    return HasExtension(path, ".ktx2") ? ParseKTX2(path, data, image) : ParseDDS(path, data, image);
+}
+
+bool IsCompressedFormatSupported(unsigned int glFormat) {
+    switch (glFormat) {
+        case GL_COMPRESSED_RGB_S3TC_DXT1_EXT:
+        case GL_COMPRESSED_RGBA_S3TC_DXT1_EXT:
+        case GL_COMPRESSED_RGBA_S3TC_DXT3_EXT:
+        case GL_COMPRESSED_RGBA_S3TC_DXT5_EXT:
+            return GLAD_GL_EXT_texture_compression_s3tc;
+        case GL_COMPRESSED_RED_RGTC1:
+        case GL_COMPRESSED_RG_RGTC2:
+            return GLAD_GL_VERSION_3_0 || GLAD_GL_ARB_texture_compression_rgtc || GLAD_GL_EXT_texture_compression_rgtc;
+        case GL_COMPRESSED_RGBA_BPTC_UNORM:
+            return GLAD_GL_VERSION_4_2 || GLAD_GL_ARB_texture_compression_bptc;
+        case GL_COMPRESSED_RGB8_ETC2:
+        case GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2:
+        case GL_COMPRESSED_RGBA8_ETC2_EAC:
+        case GL_COMPRESSED_R11_EAC:
+        case GL_COMPRESSED_RG11_EAC:
+            return GLAD_GL_VERSION_4_3 || GLAD_GL_ARB_ES3_compatibility;
+        default:
+            return false;
+    }
+}
+
+const char* GetCompressedFormatName(unsigned int glFormat) {
+    const CompressedFormat* format = FindCompressedFormat(glFormat);
+    return format ? format->name : "unknown";
+}
+
+} // namespace rendering
@@ -10,8 +10,8 @@ Window::~Window() {
     Shutdown();
 }
 
-bool Window::Initialize(const std::string& title, int width, int height) {
-    spdlog::info("Initializing window: {}x{}", width, height);
+bool Window::Initialize(const std::string& title, int width, int height, bool hidden) {
+    spdlog::info("Initializing window: {}x{}{}", width, height, hidden ? " (hidden)" : "");
     
     m_width = width;
     m_height = height;
@@ -22,7 +22,7 @@ bool Window::Initialize(const std::string& title, int width, int height) {
         SDL_WINDOWPOS_CENTERED,
         SDL_WINDOWPOS_CENTERED,
         width, height,
-        SDL_WINDOW_OPENGL | SDL_WINDOW_SHOWN
+        SDL_WINDOW_OPENGL | (hidden ? SDL_WINDOW_HIDDEN : SDL_WINDOW_SHOWN)
     );
     
     if (!m_window) {
@@ -1,10 +1,18 @@
 #include "engine/public/save/SaveManager.h"
+#include "engine/public/core/Engine.h"
+#include "engine/public/core/JobSystem.h"
+#include <lz4.h>
 #include <filesystem>
 #include <fstream>
 #include <iomanip>
 #include <sstream>
 #include <chrono>
 #include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <limits>
 
 #ifdef _WIN32
 #include <windows.h>
@@ -19,6 +27,252 @@
 
 namespace save {
 
+namespace {
+
+// .sav header: magic, encoding, compression, 2 reserved bytes, uncompressed payload size (little endian)
+constexpr char SAVE_MAGIC[4] = {'S', 'A', 'V', '1'};
+constexpr size_t SAVE_HEADER_SIZE = 16;
+constexpr uint8_t COMPRESSION_NONE = 0;
+constexpr uint8_t COMPRESSION_LZ4 = 1;
+
+// Per directory save index
+constexpr const char* INDEX_FILENAME = "saves.index";
+constexpr int INDEX_VERSION = 1;
+
+// Incremental chains
+constexpr const char* INCREMENTAL_DIRECTORY = "incremental";
+constexpr uint64_t FNV_OFFSET = 14695981039346656037ull;
+constexpr uint64_t FNV_PRIME = 1099511628211ull;
+
+void WriteU64(unsigned char* out, uint64_t value) {
+    for (int i = 0; i < 8; ++i) {
+        out[i] = static_cast<unsigned char>(value >> (i * 8));
+    }
+}
+
+uint64_t ReadU64(const unsigned char* in) {
+    uint64_t value = 0;
+    for (int i = 0; i < 8; ++i) {
+        value |= static_cast<uint64_t>(in[i]) << (i * 8);
+    }
+    return value;
+}
+
+std::vector<uint8_t> Encode(const nlohmann::json& data, SaveFormat format, bool compact) {
+    switch (format) {
+        case SaveFormat::MessagePack:
+            return nlohmann::json::to_msgpack(data);
+        case SaveFormat::Cbor:
+            return nlohmann::json::to_cbor(data);
+        case SaveFormat::Json:
+        default: {
+            std::string text = compact ? data.dump() : data.dump(4);
+            return std::vector<uint8_t>(text.begin(), text.end());
+        }
+    }
+}
+
+nlohmann::json Decode(const uint8_t* data, size_t size, SaveFormat format) {
+    switch (format) {
+        case SaveFormat::MessagePack:
+            return nlohmann::json::from_msgpack(data, data + size);
+        case SaveFormat::Cbor:
+            return nlohmann::json::from_cbor(data, data + size);
+        case SaveFormat::Json:
+        default:
+            return nlohmann::json::parse(data, data + size);
+    }
+}
+
+uint64_t HashBytes(const void* data, size_t size, uint64_t hash) {
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < size; ++i) {
+        hash = (hash ^ bytes[i]) * FNV_PRIME;
+    }
+    return hash;
+}
+
+// Hash of a json value without serializing it (FNV-1a over the tree; objects are key ordered)
+uint64_t HashJson(const nlohmann::json& value, uint64_t hash = FNV_OFFSET) {
+    const auto type = static_cast<uint8_t>(value.type());
+    hash = HashBytes(&type, sizeof(type), hash);
+    
+    switch (value.type()) {
+        case nlohmann::json::value_t::object:
+            for (auto it = value.begin(); it != value.end(); ++it) {
+                const std::string& key = it.key();
+                hash = HashBytes(key.data(), key.size() + 1, hash); // Include the terminator so keys can't run into values
+                hash = HashJson(it.value(), hash);
+            }
+            break;
+        case nlohmann::json::value_t::array: {
+            const uint64_t count = value.size();
+            hash = HashBytes(&count, sizeof(count), hash);
+            for (const auto& element : value) {
+                hash = HashJson(element, hash);
+            }
+            break;
+        }
+        case nlohmann::json::value_t::string: {
+            const auto& text = value.get_ref<const std::string&>();
+            hash = HashBytes(text.data(), text.size() + 1, hash);
+            break;
+        }
+        case nlohmann::json::value_t::boolean: {
+            const bool flag = value.get<bool>();
+            hash = HashBytes(&flag, sizeof(flag), hash);
+            break;
+        }
+        case nlohmann::json::value_t::number_integer: {
+            const int64_t number = value.get<int64_t>();
+            hash = HashBytes(&number, sizeof(number), hash);
+            break;
+        }
+        case nlohmann::json::value_t::number_unsigned: {
+            const uint64_t number = value.get<uint64_t>();
+            hash = HashBytes(&number, sizeof(number), hash);
+            break;
+        }
+        case nlohmann::json::value_t::number_float: {
+            const double number = value.get<double>();
+            hash = HashBytes(&number, sizeof(number), hash);
+            break;
+        }
+        case nlohmann::json::value_t::binary: {
+            const auto& binary = value.get_binary();
+            hash = HashBytes(binary.data(), binary.size(), hash);
+            break;
+        }
+        default:
+            break;
+    }
+    return hash;
+}
+
+// Chain file names: {game}_{slot}_{sequence}_{base|delta}{ext}, zero padded so they sort by sequence
+bool IsChainBase(const std::string& filename) {
+    return std::filesystem::path(filename).stem().string().ends_with("_base");
+}
+
+bool IsChainDelta(const std::string& filename) {
+    return std::filesystem::path(filename).stem().string().ends_with("_delta");
+}
+
+uint64_t ParseChainSequence(const std::string& filename) {
+    const std::string stem = std::filesystem::path(filename).stem().string();
+    const size_t kindStart = stem.rfind('_');
+    const size_t sequenceStart = kindStart == std::string::npos ? std::string::npos : stem.rfind('_', kindStart - 1);
+    if (sequenceStart == std::string::npos) {
+        return 0;
+    }
+    
+    uint64_t sequence = 0;
+    for (size_t i = sequenceStart + 1; i < kindStart; ++i) {
+        if (stem[i] < '0' || stem[i] > '9') {
+            return 0;
+        }
+        sequence = sequence * 10 + static_cast<uint64_t>(stem[i] - '0');
+    }
+    return sequence;
+}
+
+bool WriteFileAtomic(const std::string& filePath, const std::vector<uint8_t>& bytes) {
+    // Write next to the target and rename over it, so readers only ever see a complete file. The temp
+    // name is unique per write: two saves in the same second target the same file concurrently
+    static std::atomic<uint64_t> s_writeSequence{0};
+    const std::string tempPath = filePath + "." + std::to_string(++s_writeSequence) + ".tmp";
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            spdlog::error("Failed to open file for writing: {}", tempPath);
+            return false;
+        }
+        
+        file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+        file.flush();
+        if (!file) {
+            spdlog::error("Failed to write file: {}", tempPath);
+            file.close();
+            std::error_code ec;
+            std::filesystem::remove(tempPath, ec);
+            return false;
+        }
+    }
+    
+    std::error_code ec;
+    std::filesystem::rename(tempPath, filePath, ec);
+    if (ec) {
+        spdlog::error("Failed to replace file '{}': {}", filePath, ec.message());
+        std::filesystem::remove(tempPath, ec);
+        return false;
+    }
+    return true;
+}
+
+bool ReadIndexFile(const std::string& indexPath, std::vector<SaveInfo>& saves) {
+    std::ifstream file(indexPath);
+    if (!file.is_open()) {
+        return false;
+    }
+    
+    nlohmann::json index = nlohmann::json::parse(file, nullptr, false);
+    if (index.is_discarded() || !index.is_object() || index.value("version", 0) != INDEX_VERSION ||
+        !index.contains("saves") || !index["saves"].is_array()) {
+        spdlog::warn("Ignoring invalid save index: {}", indexPath);
+        return false;
+    }
+    
+    saves.clear();
+    for (const auto& entry : index["saves"]) {
+        SaveInfo info;
+        info.filename = entry.value("file", "");
+        info.type = entry.value("type", "");
+        info.timestamp = entry.value("timestamp", "");
+        info.version = entry.value("version", "");
+        info.sizeBytes = entry.value("size", uint64_t{0});
+        if (!info.filename.empty()) {
+            saves.push_back(std::move(info));
+        }
+    }
+    
+    std::sort(saves.begin(), saves.end(), [](const SaveInfo& a, const SaveInfo& b) { return a.filename < b.filename; });
+    return true;
+}
+
+bool WriteIndexFile(const std::string& indexPath, const std::vector<SaveInfo>& saves) {
+    nlohmann::json entries = nlohmann::json::array();
+    for (const auto& info : saves) {
+        entries.push_back({
+            {"file", info.filename},
+            {"type", info.type},
+            {"timestamp", info.timestamp},
+            {"version", info.version},
+            {"size", info.sizeBytes}
+        });
+    }
+    
+    nlohmann::json index;
+    index["version"] = INDEX_VERSION;
+    index["saves"] = std::move(entries);
+    
+    const std::string text = index.dump();
+    return WriteFileAtomic(indexPath, std::vector<uint8_t>(text.begin(), text.end()));
+}
+
+SaveInfo MakeSaveInfo(const std::string& filename, const nlohmann::json& saveData, uint64_t sizeBytes) {
+    SaveInfo info;
+    info.filename = filename;
+    info.sizeBytes = sizeBytes;
+    if (saveData.is_object()) {
+        info.type = saveData.value("type", "");
+        info.timestamp = saveData.value("timestamp", "");
+        info.version = saveData.value("version", "");
+    }
+    return info;
+}
+
+} // anonymous namespace
+
 SaveManager::SaveManager() = default;
 
 SaveManager::~SaveManager() {
@@ -60,6 +314,11 @@ void SaveManager::Shutdown() {
     if (m_initialized) {
         spdlog::info("Shutting down save manager...");
         
+        // Don't lose an autosave that is still being written
+        WaitForPendingSaves();
+        Update();
+        m_pendingSaves.reset();
+        
         m_registeredTypes.clear();
         m_initialized = false;
         
@@ -77,7 +336,12 @@ void SaveManager::SetGameName(const std::string& gameName) {
     
     // Update save directory if using default
     if (m_saveDirectory.find("UnknownGame") != std::string::npos) {
-        m_saveDirectory = GetDefaultSaveDirectory();
+        {
+            // RecordSave() reads it on workers under the index lock
+            std::lock_guard<std::mutex> lock(m_indexMutex);
+            m_saveDirectory = GetDefaultSaveDirectory();
+        }
+        ClearCaches();
         spdlog::info("Updated save directory for game '{}': {}", m_gameName, m_saveDirectory);
     }
 }
@@ -88,109 +352,198 @@ void SaveManager::SetSaveDirectory(const std::string& directory) {
         return;
     }
     
-    m_saveDirectory = directory;
+    {
+        std::lock_guard<std::mutex> lock(m_indexMutex);
+        m_saveDirectory = directory;
+    }
+    ClearCaches();
     spdlog::info("Save directory set to: {}", m_saveDirectory);
 }
 
 void SaveManager::SetCompressionEnabled(bool enabled) {
     m_compressionEnabled = enabled;
-    spdlog::info("Save compression {}", enabled ? "enabled" : "disabled");
+    spdlog::info("Save compression {}", enabled ? "enabled (LZ4)" : "disabled");
 }
 
-std::vector<std::string> SaveManager::GetSavesInSlot(const std::string& slotName) const {
-    std::vector<std::string> saves;
-    
-    if (!m_initialized) {
-        spdlog::error("SaveManager not initialized");
-        return saves;
+void SaveManager::SetFormat(SaveFormat format) {
+    m_format = format;
+    spdlog::info("Save format: {}", format == SaveFormat::MessagePack ? "MessagePack" : format == SaveFormat::Cbor ? "CBOR" : "JSON");
+}
+
+SaveFormat SaveManager::ParseFormat(const std::string& name) {
+    if (name == "msgpack" || name == "messagepack") return SaveFormat::MessagePack;
+    if (name == "cbor") return SaveFormat::Cbor;
+    if (name != "json") {
+        spdlog::warn("Unknown save format '{}', using json", name);
+    }
+    return SaveFormat::Json;
+}
+
+void SaveManager::Update() {
+    std::vector<CompletedSave> completed;
+    {
+        std::lock_guard<std::mutex> lock(m_completedMutex);
+        completed.swap(m_completedSaves);
     }
     
-    std::string slotPath = GetSlotPath(slotName);
-    
-    if (!std::filesystem::exists(slotPath)) {
-        return saves; // Empty vector for non-existent slot
+    for (auto& save : completed) {
+        if (save.callback) {
+            save.callback(save.success, save.filePath);
+        }
+    }
+}
+
+bool SaveManager::HasPendingSaves() const {
+    return m_pendingSaves && !m_pendingSaves->IsDone();
+}
+
+void SaveManager::WaitForPendingSaves() {
+    if (HasPendingSaves()) {
+        core::Engine::Jobs().Wait(*m_pendingSaves);
     }
+}
+
+bool SaveManager::QueueSave(std::string filePath, nlohmann::json saveData, bool replaceOlder, SaveCallback callback) {
+    const SaveFormat format = m_format;
+    const bool compress = m_compressionEnabled;
     
-    try {
-        for (const auto& entry : std::filesystem::directory_iterator(slotPath)) {
-            if (entry.is_regular_file()) {
-                std::string filename = entry.path().filename().string();
-                if (filename.ends_with(".json")) {
-                    saves.push_back(filename);
-                }
-            }
+    auto work = [this, filePath = std::move(filePath), saveData = std::move(saveData), replaceOlder,
+                 format, compress](std::string& writtenPath) {
+        writtenPath = filePath;
+        uint64_t bytesWritten = 0;
+        if (!WriteSaveFile(filePath, saveData, format, compress, &bytesWritten)) {
+            return false;
         }
         
-        // Sort saves by filename (which includes timestamp)
-        std::sort(saves.begin(), saves.end());
+        std::filesystem::path path(filePath);
+        RecordSave(filePath, saveData, bytesWritten);
+        if (replaceOlder) {
+            RemoveOlderSaves(path.parent_path().string(), path.filename().string());
+        }
+        spdlog::info("Saved (async): {}", path.filename().string());
+        return true;
+    };
+    
+    return SubmitSaveJob(std::move(work), std::move(callback));
+}
+
+bool SaveManager::SubmitSaveJob(std::function<bool(std::string& filePath)> work, SaveCallback callback) {
+    auto job = [this, work = std::move(work), callback = std::move(callback)]() mutable {
+        std::string filePath;
+        const bool success = work(filePath);
         
-    } catch (const std::exception& e) {
-        spdlog::error("Failed to list saves in slot '{}': {}", slotName, e.what());
+        std::lock_guard<std::mutex> lock(m_completedMutex);
+        m_completedSaves.push_back({std::move(callback), success, std::move(filePath)});
+    };
+    
+    auto& jobs = core::Engine::Jobs();
+    if (!jobs.IsInitialized()) {
+        // No workers to hand off to - write now, still report through Update()
+        job();
+        return true;
     }
     
-    return saves;
+    if (!m_pendingSaves) {
+        m_pendingSaves = std::make_unique<core::JobCounter>();
+    }
+    jobs.Submit(std::move(job), m_pendingSaves.get());
+    return true;
 }
 
-std::vector<std::string> SaveManager::GetAllSlots() const {
-    std::vector<std::string> slots;
+std::vector<std::string> SaveManager::GetSavesInSlot(const std::string& slotName) const {
+    std::vector<std::string> saves;
     
     if (!m_initialized) {
         spdlog::error("SaveManager not initialized");
-        return slots;
+        return saves;
     }
     
-    if (!std::filesystem::exists(m_saveDirectory)) {
-        return slots; // Empty vector if save directory doesn't exist
+    // Sorted by filename (which includes timestamp) in the index
+    for (const auto& info : GetSaveInfos(slotName)) {
+        saves.push_back(info.filename);
     }
     
-    try {
-        for (const auto& entry : std::filesystem::directory_iterator(m_saveDirectory)) {
-            if (entry.is_directory()) {
-                std::string slotName = entry.path().filename().string();
-                if (slotName != "quicksave") { // Don't include quicksave in regular slots
-                    slots.push_back(slotName);
-                }
-            }
-        }
-        
-        std::sort(slots.begin(), slots.end());
-        
-    } catch (const std::exception& e) {
-        spdlog::error("Failed to list save slots: {}", e.what());
+    return saves;
+}
+
+std::vector<std::string> SaveManager::GetAllSlots() const {
+    if (!m_initialized) {
+        spdlog::error("SaveManager not initialized");
+        return {};
     }
     
-    return slots;
+    std::lock_guard<std::mutex> lock(m_indexMutex);
+    ScanDirectories();
+    return std::vector<std::string>(m_slotNames.begin(), m_slotNames.end());
 }
 
 std::vector<std::string> SaveManager::GetQuicksaveTypes() const {
-    std::vector<std::string> types;
+    if (!m_initialized) {
+        spdlog::error("SaveManager not initialized");
+        return {};
+    }
     
+    std::lock_guard<std::mutex> lock(m_indexMutex);
+    ScanDirectories();
+    return std::vector<std::string>(m_quicksaveTypes.begin(), m_quicksaveTypes.end());
+}
+
+std::vector<SaveInfo> SaveManager::GetSaveInfos(const std::string& slotName) const {
     if (!m_initialized) {
         spdlog::error("SaveManager not initialized");
-        return types;
+        return {};
     }
     
-    std::string quicksavePath = GetQuicksavePath();
+    std::lock_guard<std::mutex> lock(m_indexMutex);
+    return GetIndex(GetSlotPath(slotName)).saves;
+}
+
+std::optional<SaveInfo> SaveManager::GetSaveInfo(const std::string& slotName, const std::string& filename) const {
+    if (!m_initialized) {
+        spdlog::error("SaveManager not initialized");
+        return std::nullopt;
+    }
     
-    if (!std::filesystem::exists(quicksavePath)) {
-        return types; // Empty vector if quicksave directory doesn't exist
+    std::lock_guard<std::mutex> lock(m_indexMutex);
+    const auto& saves = GetIndex(GetSlotPath(slotName)).saves;
+    auto it = std::lower_bound(saves.begin(), saves.end(), filename,
+                               [](const SaveInfo& info, const std::string& name) { return info.filename < name; });
+    if (it == saves.end() || it->filename != filename) {
+        return std::nullopt;
+    }
+    return *it;
+}
+
+std::optional<SaveInfo> SaveManager::GetQuicksaveInfo(const std::string& typeName) const {
+    std::lock_guard<std::mutex> lock(m_indexMutex);
+    const auto& saves = GetIndex(GetQuicksavePath() + "/" + typeName).saves;
+    if (saves.empty()) {
+        return std::nullopt;
     }
+    return saves.back();
+}
+
+void SaveManager::RebuildIndexes() {
+    std::lock_guard<std::mutex> lock(m_indexMutex);
+    m_indexes.clear();
+    m_slotNames.clear();
+    m_quicksaveTypes.clear();
+    m_directoriesScanned = false;
+    ScanDirectories();
     
-    try {
-        for (const auto& entry : std::filesystem::directory_iterator(quicksavePath)) {
-            if (entry.is_directory()) {
-                std::string typeName = entry.path().filename().string();
-                types.push_back(typeName);
-            }
-        }
-        
-        std::sort(types.begin(), types.end());
-        
-    } catch (const std::exception& e) {
-        spdlog::error("Failed to list quicksave types: {}", e.what());
+    std::vector<std::string> directories;
+    for (const auto& slotName : m_slotNames) {
+        directories.push_back(GetSlotPath(slotName));
+    }
+    for (const auto& typeName : m_quicksaveTypes) {
+        directories.push_back(GetQuicksavePath() + "/" + typeName);
     }
     
-    return types;
+    std::error_code ec;
+    for (const auto& directory : directories) {
+        std::filesystem::remove(directory + "/" + INDEX_FILENAME, ec);
+        GetIndex(directory);
+    }
 }
 
 bool SaveManager::DeleteSave(const std::string& slotName, const std::string& filename) {
@@ -208,6 +561,7 @@ bool SaveManager::DeleteSave(const std::string& slotName, const std::string& fil
         }
         
         std::filesystem::remove(fullPath);
+        RecordDelete(GetSlotPath(slotName), filename);
         spdlog::info("Deleted save from slot '{}': {}", slotName, filename);
         return true;
         
@@ -237,6 +591,16 @@ bool SaveManager::DeleteSlot(const std::string& slotName) {
         }
         
         std::filesystem::remove_all(slotPath);
+        ForgetDirectory(slotPath);
+        ForgetDirectory(GetIncrementalPath(slotName));
+        {
+            std::lock_guard<std::mutex> lock(m_indexMutex);
+            m_slotNames.erase(slotName);
+        }
+        {
+            std::lock_guard<std::mutex> lock(m_chainMutex);
+            m_chains.erase(slotName);
+        }
         spdlog::info("Deleted slot: {}", slotName);
         return true;
         
@@ -260,12 +624,13 @@ bool SaveManager::DeleteQuicksave(const std::string& typeName) {
             return true;
         }
         
-        // Delete all files in the quicksave type directory
+        // Delete all files in the quicksave type directory (index included)
         for (const auto& entry : std::filesystem::directory_iterator(quicksaveTypePath)) {
             if (entry.is_regular_file()) {
                 std::filesystem::remove(entry.path());
             }
         }
+        ForgetDirectory(quicksaveTypePath);
         
         spdlog::info("Deleted quicksave for type: {}", typeName);
         return true;
@@ -292,6 +657,13 @@ bool SaveManager::DeleteAllQuicksaves() {
         
         // Delete all quicksave type directories
         std::filesystem::remove_all(quicksavePath);
+        {
+            std::lock_guard<std::mutex> lock(m_indexMutex);
+            for (const auto& typeName : m_quicksaveTypes) {
+                m_indexes.erase(quicksavePath + "/" + typeName);
+            }
+            m_quicksaveTypes.clear();
+        }
         
         spdlog::info("Deleted all quicksaves");
         return true;
@@ -317,6 +689,11 @@ size_t SaveManager::GetSlotSaveCount(const std::string& slotName) const {
     return saves.size();
 }
 
+bool SaveManager::IsSaveFile(const std::filesystem::path& path) {
+    const auto extension = path.extension();
+    return extension == ".json" || extension == ".sav";
+}
+
 std::string SaveManager::GetSaveDirectory() const {
     return m_saveDirectory;
 }
@@ -376,7 +753,12 @@ std::string SaveManager::GenerateTimestamp() const {
 }
 
 std::string SaveManager::GenerateSaveFilename(const std::string& slotName) const {
-    return m_gameName + "_" + slotName + "_" + GenerateTimestamp() + ".json";
+    return m_gameName + "_" + slotName + "_" + GenerateTimestamp() + GetFileExtension();
+}
+
+std::string SaveManager::GetFileExtension() const {
+    // Plain JSON stays human readable and editable, everything else gets the binary container
+    return (m_format == SaveFormat::Json && !m_compressionEnabled) ? ".json" : ".sav";
 }
 
 bool SaveManager::EnsureDirectoryExists(const std::string& path) const {
@@ -393,29 +775,473 @@ bool SaveManager::EnsureDirectoryExists(const std::string& path) const {
 }
 
 bool SaveManager::SaveJson(const std::string& filePath, const nlohmann::json& data) {
+    uint64_t bytesWritten = 0;
+    if (!WriteSaveFile(filePath, data, m_format, m_compressionEnabled, &bytesWritten)) {
+        return false;
+    }
+    RecordSave(filePath, data, bytesWritten);
+    return true;
+}
+
+bool SaveManager::WriteSaveFile(const std::string& filePath, const nlohmann::json& data, SaveFormat format, bool compress,
+                                uint64_t* bytesWritten) {
     try {
-        std::ofstream file(filePath);
-        if (!file.is_open()) {
-            spdlog::error("Failed to open file for writing: {}", filePath);
-            return false;
-        }
+        const bool container = format != SaveFormat::Json || compress;
+        std::vector<uint8_t> payload = Encode(data, format, compress);
         
-        if (m_compressionEnabled) {
-            // For now, just compact JSON (no compression library)
-            // In future could add actual compression with zlib
-            file << data.dump();
+        std::vector<uint8_t> bytes;
+        if (!container) {
+            bytes = std::move(payload);
         } else {
-            // Pretty print for development
-            file << data.dump(4);
+            bytes.resize(SAVE_HEADER_SIZE);
+            std::memcpy(bytes.data(), SAVE_MAGIC, sizeof(SAVE_MAGIC));
+            bytes[4] = static_cast<uint8_t>(format);
+            bytes[5] = compress ? COMPRESSION_LZ4 : COMPRESSION_NONE;
+            WriteU64(bytes.data() + 8, payload.size());
+            
+            if (compress) {
+                if (payload.size() > static_cast<size_t>(LZ4_MAX_INPUT_SIZE)) {
+                    spdlog::error("Save data too large to compress ({} bytes): {}", payload.size(), filePath);
+                    return false;
+                }
+                const int bound = LZ4_compressBound(static_cast<int>(payload.size()));
+                bytes.resize(SAVE_HEADER_SIZE + bound);
+                const int compressedSize = LZ4_compress_default(reinterpret_cast<const char*>(payload.data()),
+                                                                reinterpret_cast<char*>(bytes.data() + SAVE_HEADER_SIZE),
+                                                                static_cast<int>(payload.size()), bound);
+                if (compressedSize <= 0) {
+                    spdlog::error("Failed to compress save data: {}", filePath);
+                    return false;
+                }
+                bytes.resize(SAVE_HEADER_SIZE + compressedSize);
+            } else {
+                bytes.insert(bytes.end(), payload.begin(), payload.end());
+            }
         }
         
-        file.close();
+        if (!WriteFileAtomic(filePath, bytes)) {
+            return false;
+        }
+        
+        if (bytesWritten) {
+            *bytesWritten = bytes.size();
+        }
         return true;
         
     } catch (const std::exception& e) {
-        spdlog::error("Failed to save JSON to '{}': {}", filePath, e.what());
+        spdlog::error("Failed to save to '{}': {}", filePath, e.what());
+        return false;
+    }
+}
+
+void SaveManager::RemoveOlderSaves(const std::string& directory, const std::string& keepFilename) {
+    std::lock_guard<std::mutex> lock(m_indexMutex);
+    SaveIndex& index = GetIndex(directory);
+    
+    // Timestamped names sort chronologically - never delete a newer save written meanwhile
+    auto keep = std::lower_bound(index.saves.begin(), index.saves.end(), keepFilename,
+                                 [](const SaveInfo& info, const std::string& name) { return info.filename < name; });
+    if (keep == index.saves.begin()) {
+        return;
+    }
+    
+    std::error_code ec;
+    for (auto it = index.saves.begin(); it != keep; ++it) {
+        std::filesystem::remove(directory + "/" + it->filename, ec);
+    }
+    index.saves.erase(index.saves.begin(), keep);
+    WriteIndexFile(directory + "/" + INDEX_FILENAME, index.saves);
+}
+
+SaveManager::SaveIndex& SaveManager::GetIndex(const std::string& directory) const {
+    auto it = m_indexes.find(directory);
+    if (it != m_indexes.end()) {
+        return it->second;
+    }
+    
+    SaveIndex& index = m_indexes[directory];
+    std::error_code ec;
+    if (!std::filesystem::is_directory(directory, ec)) {
+        return index; // Nothing saved here yet
+    }
+    
+    const std::string indexPath = directory + "/" + INDEX_FILENAME;
+    if (ReadIndexFile(indexPath, index.saves)) {
+        return index;
+    }
+    
+    // No (valid) index yet - read every save header once and write one
+    for (const auto& entry : std::filesystem::directory_iterator(directory, ec)) {
+        if (!entry.is_regular_file() || !IsSaveFile(entry.path())) {
+            continue;
+        }
+        
+        std::error_code sizeError;
+        const uint64_t size = entry.file_size(sizeError);
+        auto saveData = LoadJson(entry.path().string());
+        index.saves.push_back(MakeSaveInfo(entry.path().filename().string(), saveData.value_or(nlohmann::json()), size));
+    }
+    
+    std::sort(index.saves.begin(), index.saves.end(), [](const SaveInfo& a, const SaveInfo& b) { return a.filename < b.filename; });
+    WriteIndexFile(indexPath, index.saves);
+    spdlog::info("Rebuilt save index for '{}' ({} saves)", directory, index.saves.size());
+    return index;
+}
+
+void SaveManager::ScanDirectories() const {
+    if (m_directoriesScanned) {
+        return;
+    }
+    m_directoriesScanned = true;
+    
+    // One scan per session - saves and deletes keep the sets current afterwards
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator(m_saveDirectory, ec)) {
+        if (entry.is_directory()) {
+            std::string slotName = entry.path().filename().string();
+            if (slotName != "quicksave") { // Don't include quicksave in regular slots
+                m_slotNames.insert(slotName);
+            }
+        }
+    }
+    
+    for (const auto& entry : std::filesystem::directory_iterator(GetQuicksavePath(), ec)) {
+        if (entry.is_directory()) {
+            m_quicksaveTypes.insert(entry.path().filename().string());
+        }
+    }
+}
+
+void SaveManager::RecordSave(const std::string& filePath, const nlohmann::json& saveData, uint64_t sizeBytes) {
+    const std::filesystem::path path(filePath);
+    const std::string directory = path.parent_path().string();
+    SaveInfo info = MakeSaveInfo(path.filename().string(), saveData, sizeBytes);
+    
+    std::lock_guard<std::mutex> lock(m_indexMutex);
+    SaveIndex& index = GetIndex(directory);
+    auto it = std::lower_bound(index.saves.begin(), index.saves.end(), info.filename,
+                               [](const SaveInfo& entry, const std::string& name) { return entry.filename < name; });
+    if (it != index.saves.end() && it->filename == info.filename) {
+        *it = std::move(info);
+    } else {
+        index.saves.insert(it, std::move(info));
+    }
+    WriteIndexFile(directory + "/" + INDEX_FILENAME, index.saves);
+    
+    // Keep slot / quicksave type listings current without rescanning
+    if (m_directoriesScanned) {
+        const std::filesystem::path parent = path.parent_path().parent_path();
+        const std::string name = path.parent_path().filename().string();
+        if (parent == std::filesystem::path(GetQuicksavePath())) {
+            m_quicksaveTypes.insert(name);
+        } else if (parent == std::filesystem::path(m_saveDirectory)) {
+            m_slotNames.insert(name);
+        }
+    }
+}
+
+void SaveManager::RecordDelete(const std::string& directory, const std::string& filename) {
+    std::lock_guard<std::mutex> lock(m_indexMutex);
+    SaveIndex& index = GetIndex(directory);
+    auto it = std::find_if(index.saves.begin(), index.saves.end(), [&](const SaveInfo& info) { return info.filename == filename; });
+    if (it != index.saves.end()) {
+        index.saves.erase(it);
+        WriteIndexFile(directory + "/" + INDEX_FILENAME, index.saves);
+    }
+}
+
+void SaveManager::ForgetDirectory(const std::string& directory) {
+    std::lock_guard<std::mutex> lock(m_indexMutex);
+    m_indexes.erase(directory);
+}
+
+void SaveManager::ClearCaches() {
+    {
+        std::lock_guard<std::mutex> lock(m_chainMutex);
+        m_chains.clear();
+    }
+    
+    std::lock_guard<std::mutex> lock(m_indexMutex);
+    m_indexes.clear();
+    m_slotNames.clear();
+    m_quicksaveTypes.clear();
+    m_directoriesScanned = false;
+}
+
+std::string SaveManager::GetIncrementalPath(const std::string& slotName) const {
+    return GetSlotPath(slotName) + "/" + INCREMENTAL_DIRECTORY;
+}
+
+SaveManager::ChainSettings SaveManager::GetChainSettings(const std::string& slotName) const {
+    ChainSettings settings;
+    settings.directory = GetIncrementalPath(slotName);
+    settings.gameName = m_gameName;
+    settings.extension = GetFileExtension();
+    settings.format = m_format;
+    settings.compress = m_compressionEnabled;
+    settings.maxDeltas = m_maxDeltas;
+    return settings;
+}
+
+bool SaveManager::HasIncrementalSave(const std::string& slotName) {
+    if (!m_initialized) {
+        spdlog::error("SaveManager not initialized");
+        return false;
+    }
+    
+    std::lock_guard<std::mutex> lock(m_chainMutex);
+    return !GetChain(slotName, GetIncrementalPath(slotName)).baseFilename.empty();
+}
+
+bool SaveManager::CompactIncremental(const std::string& slotName) {
+    if (!m_initialized) {
+        spdlog::error("SaveManager not initialized");
+        return false;
+    }
+    
+    try {
+        // One lock for read + write so an async save can't slip a delta in between
+        std::lock_guard<std::mutex> lock(m_chainMutex);
+        auto saveData = ReadChain(slotName);
+        if (!saveData.has_value()) {
+            return false;
+        }
+        const ChainSettings settings = GetChainSettings(slotName);
+        if (GetChain(slotName, settings.directory).deltas.empty()) {
+            return true; // Already just a base
+        }
+        
+        // Snapshot 0: same state as on disk, so it must not supersede queued async saves
+        return WriteChain(slotName, settings, std::move(*saveData), 0, true, nullptr);
+        
+    } catch (const std::exception& e) {
+        spdlog::error("Failed to compact incremental save in slot '{}': {}", slotName, e.what());
+        return false;
+    }
+}
+
+bool SaveManager::WriteIncremental(const std::string& slotName, const ChainSettings& settings, nlohmann::json saveData,
+                                   uint64_t snapshot, std::string* writtenPath) {
+    try {
+        std::lock_guard<std::mutex> lock(m_chainMutex);
+        return WriteChain(slotName, settings, std::move(saveData), snapshot, false, writtenPath);
+    } catch (const std::exception& e) {
+        spdlog::error("Failed to save incrementally to slot '{}': {}", slotName, e.what());
+        return false;
+    }
+}
+
+std::optional<nlohmann::json> SaveManager::LoadIncrementalData(const std::string& slotName) {
+    std::lock_guard<std::mutex> lock(m_chainMutex);
+    return ReadChain(slotName);
+}
+
+SaveManager::IncrementalChain& SaveManager::GetChain(const std::string& slotName, const std::string& directory) {
+    IncrementalChain& chain = m_chains[slotName];
+    if (chain.loaded) {
+        return chain;
+    }
+    chain.loaded = true;
+    
+    std::vector<SaveInfo> files;
+    {
+        std::lock_guard<std::mutex> lock(m_indexMutex);
+        files = GetIndex(directory).saves;
+    }
+    if (files.empty()) {
+        return chain;
+    }
+    
+    chain.nextSequence = ParseChainSequence(files.back().filename) + 1;
+    
+    // The newest base and the deltas written after it (anything older is left over from an interrupted compaction)
+    size_t baseIndex = files.size();
+    for (size_t i = 0; i < files.size(); ++i) {
+        if (IsChainBase(files[i].filename)) {
+            baseIndex = i;
+        }
+    }
+    if (baseIndex == files.size()) {
+        return chain;
+    }
+    
+    chain.baseFilename = files[baseIndex].filename;
+    chain.baseBytes = files[baseIndex].sizeBytes;
+    for (size_t i = baseIndex + 1; i < files.size(); ++i) {
+        if (IsChainDelta(files[i].filename)) {
+            chain.deltas.push_back(files[i].filename);
+            chain.deltaBytes += files[i].sizeBytes;
+        }
+    }
+    
+    // Hashes of the newest state are stored in the newest file
+    const std::string& newest = chain.deltas.empty() ? chain.baseFilename : chain.deltas.back();
+    auto saveData = LoadJson(directory + "/" + newest);
+    if (saveData.has_value() && saveData->contains("incremental") && (*saveData)["incremental"].contains("hashes")) {
+        chain.hashes = (*saveData)["incremental"]["hashes"].get<std::unordered_map<std::string, uint64_t>>();
+    } else {
+        spdlog::warn("Incremental save chain in slot '{}' is unreadable, the next save writes a new base", slotName);
+        chain.baseFilename.clear();
+        chain.deltas.clear();
+    }
+    
+    return chain;
+}
+
+bool SaveManager::WriteChain(const std::string& slotName, const ChainSettings& settings, nlohmann::json saveData, uint64_t snapshot,
+                             bool forceBase, std::string* writtenPath) {
+    const std::string& directory = settings.directory;
+    IncrementalChain& chain = GetChain(slotName, directory);
+    
+    // Async saves can finish out of order - never write an older snapshot over a newer one
+    if (snapshot != 0 && snapshot < chain.lastSnapshot) {
+        spdlog::debug("Skipping incremental save to slot '{}': a newer snapshot is already written", slotName);
+        return true;
+    }
+    
+    if (!EnsureDirectoryExists(directory)) {
+        spdlog::error("Failed to create incremental save directory: {}", directory);
         return false;
     }
+    {
+        // The chain lives below the slot, so RecordSave() won't see the slot itself
+        std::lock_guard<std::mutex> lock(m_indexMutex);
+        if (m_directoriesScanned) {
+            m_slotNames.insert(slotName);
+        }
+    }
+    
+    const nlohmann::json& data = saveData["data"];
+    std::unordered_map<std::string, uint64_t> hashes;
+    if (data.is_object()) {
+        for (auto it = data.begin(); it != data.end(); ++it) {
+            hashes[it.key()] = HashJson(it.value());
+        }
+    }
+    
+    const bool writeBase = forceBase || chain.baseFilename.empty() || !data.is_object() ||
+                           chain.deltas.size() >= settings.maxDeltas || chain.deltaBytes > chain.baseBytes;
+    const uint64_t sequence = chain.nextSequence;
+    
+    std::ostringstream name;
+    name << settings.gameName << "_" << slotName << "_" << std::setw(8) << std::setfill('0') << sequence
+         << (writeBase ? "_base" : "_delta") << settings.extension;
+    const std::string filename = name.str();
+    const std::string filePath = directory + "/" + filename;
+    
+    nlohmann::json chainInfo;
+    chainInfo["kind"] = writeBase ? "base" : "delta";
+    chainInfo["sequence"] = sequence;
+    chainInfo["hashes"] = hashes;
+    
+    uint64_t bytesWritten = 0;
+    if (writeBase) {
+        saveData["incremental"] = std::move(chainInfo);
+        if (!WriteSaveFile(filePath, saveData, settings.format, settings.compress, &bytesWritten)) {
+            return false;
+        }
+        RecordSave(filePath, saveData, bytesWritten);
+        
+        // The new base replaces the whole previous chain
+        RemoveOlderSaves(directory, filename);
+        chain.baseFilename = filename;
+        chain.baseBytes = bytesWritten;
+        chain.deltas.clear();
+        chain.deltaBytes = 0;
+        spdlog::info("Incremental base written to slot '{}': {} ({} bytes)", slotName, filename, bytesWritten);
+    } else {
+        nlohmann::json changed = nlohmann::json::object();
+        for (const auto& [key, hash] : hashes) {
+            auto previous = chain.hashes.find(key);
+            if (previous == chain.hashes.end() || previous->second != hash) {
+                changed[key] = data[key];
+            }
+        }
+        nlohmann::json removed = nlohmann::json::array();
+        for (const auto& [key, hash] : chain.hashes) {
+            if (hashes.find(key) == hashes.end()) {
+                removed.push_back(key);
+            }
+        }
+        
+        if (changed.empty() && removed.empty()) {
+            spdlog::debug("Incremental save to slot '{}' skipped: nothing changed", slotName);
+            chain.lastSnapshot = std::max(chain.lastSnapshot, snapshot);
+            if (writtenPath) {
+                *writtenPath = directory + "/" + (chain.deltas.empty() ? chain.baseFilename : chain.deltas.back());
+            }
+            return true;
+        }
+        
+        chainInfo["removed"] = std::move(removed);
+        
+        nlohmann::json delta;
+        delta["version"] = saveData["version"];
+        delta["timestamp"] = saveData["timestamp"];
+        delta["type"] = saveData["type"];
+        delta["incremental"] = std::move(chainInfo);
+        const size_t changedCount = changed.size();
+        delta["data"] = std::move(changed);
+        
+        if (!WriteSaveFile(filePath, delta, settings.format, settings.compress, &bytesWritten)) {
+            return false;
+        }
+        RecordSave(filePath, delta, bytesWritten);
+        
+        chain.deltas.push_back(filename);
+        chain.deltaBytes += bytesWritten;
+        spdlog::info("Incremental delta written to slot '{}': {} ({} of {} keys, {} bytes)",
+                     slotName, filename, changedCount, hashes.size(), bytesWritten);
+    }
+    
+    chain.hashes = std::move(hashes);
+    chain.nextSequence = sequence + 1;
+    chain.lastSnapshot = std::max(chain.lastSnapshot, snapshot);
+    if (writtenPath) {
+        *writtenPath = filePath;
+    }
+    return true;
+}
+
+std::optional<nlohmann::json> SaveManager::ReadChain(const std::string& slotName) {
+    const std::string directory = GetIncrementalPath(slotName);
+    IncrementalChain& chain = GetChain(slotName, directory);
+    if (chain.baseFilename.empty()) {
+        spdlog::info("No incremental save in slot '{}'", slotName);
+        return std::nullopt;
+    }
+
+    auto saveData = LoadJson(directory + "/" + chain.baseFilename);
+    if (!saveData.has_value() || !saveData->contains("version") || !saveData->contains("data")) {
+        spdlog::error("Invalid incremental base in slot '{}': {}", slotName, chain.baseFilename);
+        return std::nullopt;
+    }
+    
+    std::string version = (*saveData)["version"];
+    if (version != "1.0.0") {
+        spdlog::error("Incompatible save file version '{}': {}", version, chain.baseFilename);
+        return std::nullopt;
+    }
+    
+    nlohmann::json& data = (*saveData)["data"];
+    for (const auto& deltaFilename : chain.deltas) {
+        auto delta = LoadJson(directory + "/" + deltaFilename);
+        if (!delta.has_value() || !delta->contains("data") || !delta->contains("incremental")) {
+            spdlog::error("Invalid incremental delta in slot '{}': {}", slotName, deltaFilename);
+            return std::nullopt;
+        }
+        
+        for (auto& [key, value] : (*delta)["data"].items()) {
+            data[key] = std::move(value);
+        }
+        for (const auto& key : (*delta)["incremental"].value("removed", nlohmann::json::array())) {
+            data.erase(key.get<std::string>());
+        }
+        (*saveData)["timestamp"] = (*delta)["timestamp"];
+    }
+    
+    saveData->erase("incremental");
+    return saveData;
 }
 
 std::optional<nlohmann::json> SaveManager::LoadJson(const std::string& filePath) {
@@ -425,17 +1251,54 @@ std::optional<nlohmann::json> SaveManager::LoadJson(const std::string& filePath)
             return std::nullopt;
         }
         
-        std::ifstream file(filePath);
+        std::ifstream file(filePath, std::ios::binary);
         if (!file.is_open()) {
             spdlog::error("Failed to open file for reading: {}", filePath);
             return std::nullopt;
         }
         
-        nlohmann::json data;
-        file >> data;
+        std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
         file.close();
         
-        return data;
+        // Plain JSON saves (and every save written before the container existed)
+        if (bytes.size() < SAVE_HEADER_SIZE || std::memcmp(bytes.data(), SAVE_MAGIC, sizeof(SAVE_MAGIC)) != 0) {
+            return nlohmann::json::parse(bytes.begin(), bytes.end());
+        }
+        
+        const uint8_t encoding = bytes[4];
+        const uint8_t compression = bytes[5];
+        const uint64_t payloadSize = ReadU64(bytes.data() + 8);
+        if (encoding > static_cast<uint8_t>(SaveFormat::Cbor) || compression > COMPRESSION_LZ4) {
+            spdlog::error("Unsupported save encoding {}/{}: {}", encoding, compression, filePath);
+            return std::nullopt;
+        }
+        
+        const uint8_t* stored = bytes.data() + SAVE_HEADER_SIZE;
+        const size_t storedSize = bytes.size() - SAVE_HEADER_SIZE;
+        const SaveFormat format = static_cast<SaveFormat>(encoding);
+        
+        if (compression == COMPRESSION_NONE) {
+            if (storedSize != payloadSize) {
+                spdlog::error("Truncated save file: {}", filePath);
+                return std::nullopt;
+            }
+            return Decode(stored, storedSize, format);
+        }
+        
+        if (payloadSize > static_cast<uint64_t>(LZ4_MAX_INPUT_SIZE) || storedSize > static_cast<size_t>(std::numeric_limits<int>::max())) {
+            spdlog::error("Corrupt save file header: {}", filePath);
+            return std::nullopt;
+        }
+        
+        std::vector<uint8_t> payload(static_cast<size_t>(payloadSize));
+        const int decompressed = LZ4_decompress_safe(reinterpret_cast<const char*>(stored), reinterpret_cast<char*>(payload.data()),
+                                                     static_cast<int>(storedSize), static_cast<int>(payload.size()));
+        if (decompressed < 0 || static_cast<uint64_t>(decompressed) != payloadSize) {
+            spdlog::error("Failed to decompress save file: {}", filePath);
+            return std::nullopt;
+        }
+        
+        return Decode(payload.data(), payload.size(), format);
         
     } catch (const std::exception& e) {
         spdlog::error("Failed to load JSON from '{}': {}", filePath, e.what());
@@ -1,9 +1,30 @@
 #include "engine/public/text/FontManager.h"
+#include "engine/public/text/GlyphAtlas.h"
+#include "engine/public/text/TextLayout.h"
+#include "engine/public/utils/Assets.h"
 #include <spdlog/spdlog.h>
+#include <cstring>
 #include <filesystem>
 
 namespace text {
 
+namespace {
+
+// Cheap signature check instead of a full parse - sizes are opened later
+bool IsFontData(const uint8_t* data, size_t size) {
+    static const uint8_t signatures[][4] = {
+        {0x00, 0x01, 0x00, 0x00}, {'t', 'r', 'u', 'e'}, {'O', 'T', 'T', 'O'}, {'t', 't', 'c', 'f'}
+    };
+    for (const auto& signature : signatures) {
+        if (size >= 4 && std::memcmp(data, signature, 4) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // anonymous namespace
+
 FontManager::FontManager() = default;
 
 FontManager::~FontManager() {
@@ -41,6 +62,10 @@ void FontManager::Shutdown() {
 }
 
 bool FontManager::LoadFont(const std::string& filepath, const std::string& name, int size) {
+    return LoadFont(std::vector<std::string>{filepath}, name, size);
+}
+
+bool FontManager::LoadFont(const std::vector<std::string>& candidates, const std::string& name, int size) {
     if (!m_initialized) {
         spdlog::warn("Font manager not initialized, cannot load font: {}", name);
         return false;
@@ -58,115 +83,64 @@ bool FontManager::LoadFont(const std::string& filepath, const std::string& name,
         return false;
     }
     
-    // Try to load font from multiple locations
-    TTF_Font* font = nullptr;
-    std::string actualPath;
-    
-    // First try: assets/fonts/ directory
-    std::string assetsPath = "assets/fonts/" + filepath;
-    if (std::filesystem::exists(assetsPath)) {
-        font = TTF_OpenFont(assetsPath.c_str(), size);
-        actualPath = assetsPath;
-    }
-    
-    // Second try: system font directories (macOS/Linux/Windows)
-    if (!font) {
-        std::vector<std::string> systemPaths;
-        
-        #ifdef __APPLE__
-        systemPaths = {
-            "/System/Library/Fonts/" + filepath,
-            "/Library/Fonts/" + filepath,
-            "~/Library/Fonts/" + filepath
-        };
-        #elif defined(__linux__)
-        systemPaths = {
-            "/usr/share/fonts/truetype/dejavu/" + filepath,
-            "/usr/share/fonts/TTF/" + filepath,
-            "/usr/share/fonts/" + filepath,
-            "~/.fonts/" + filepath
-        };
-        #elif defined(_WIN32)
-        systemPaths = {
-            "C:/Windows/Fonts/" + filepath
-        };
-        #endif
-        
-        for (const auto& path : systemPaths) {
-            if (std::filesystem::exists(path)) {
-                font = TTF_OpenFont(path.c_str(), size);
-                if (font) {
-                    actualPath = path;
-                    break;
-                }
-            }
+    std::shared_ptr<FontFile> file;
+    for (const auto& candidate : candidates) {
+        const std::string path = ResolveFontPath(candidate);
+        if (!path.empty() && (file = LoadFontFile(path))) {
+            break;
         }
     }
     
-    // Third try: common system font names as fallbacks
-    if (!font) {
-        std::vector<std::string> fallbackFonts;
-        
-        #ifdef __APPLE__
-        fallbackFonts = {
-            "/System/Library/Fonts/Arial.ttf",
-            "/System/Library/Fonts/Helvetica.ttc",
-            "/System/Library/Fonts/Times.ttc"
-        };
-        #elif defined(__linux__)
-        fallbackFonts = {
-            "/usr/share/fonts/truetype/dejavu/DejaVuSans.ttf",
-            "/usr/share/fonts/truetype/liberation/LiberationSans-Regular.ttf",
-            "/usr/share/fonts/TTF/arial.ttf"
-        };
-        #elif defined(_WIN32)
-        fallbackFonts = {
-            "C:/Windows/Fonts/arial.ttf",
-            "C:/Windows/Fonts/calibri.ttf",
-            "C:/Windows/Fonts/tahoma.ttf"
-        };
-        #endif
-        
-        for (const auto& fallback : fallbackFonts) {
-            if (std::filesystem::exists(fallback)) {
-                font = TTF_OpenFont(fallback.c_str(), size);
-                if (font) {
-                    actualPath = fallback;
-                    spdlog::debug("Using fallback font for '{}'", name);
+    // Fall back to a common system font (looked up once per session)
+    if (!file) {
+        if (!m_fallbackResolved) {
+            m_fallbackResolved = true;
+            
+            std::vector<std::string> fallbackFonts;
+            #ifdef __APPLE__
+            fallbackFonts = {
+                "/System/Library/Fonts/Arial.ttf",
+                "/System/Library/Fonts/Helvetica.ttc",
+                "/System/Library/Fonts/Times.ttc"
+            };
+            #elif defined(__linux__)
+            fallbackFonts = {
+                "/usr/share/fonts/truetype/dejavu/DejaVuSans.ttf",
+                "/usr/share/fonts/truetype/liberation/LiberationSans-Regular.ttf",
+                "/usr/share/fonts/TTF/arial.ttf"
+            };
+            #elif defined(_WIN32)
+            fallbackFonts = {
+                "C:/Windows/Fonts/arial.ttf",
+                "C:/Windows/Fonts/calibri.ttf",
+                "C:/Windows/Fonts/tahoma.ttf"
+            };
+            #endif
+            
+            for (const auto& fallback : fallbackFonts) {
+                if (std::filesystem::exists(fallback)) {
+                    m_fallbackPath = fallback;
                     break;
                 }
             }
         }
-    }
-    
-    // Final fallback: Let SDL_ttf try to find any system font
-    if (!font) {
-        // Try some generic names that SDL_ttf might resolve
-        std::vector<std::string> genericNames = {"Arial", "Helvetica", "Times", "sans-serif"};
-        for (const auto& genericName : genericNames) {
-            font = TTF_OpenFont(genericName.c_str(), size);
-            if (font) {
-                actualPath = genericName + " (system resolved)";
-                spdlog::debug("Using system-resolved font for '{}'", name);
-                break;
-            }
+        
+        if (!m_fallbackPath.empty() && (file = LoadFontFile(m_fallbackPath))) {
+            spdlog::debug("Using fallback font '{}' for '{}'", m_fallbackPath, name);
         }
     }
     
-    if (!font) {
-        spdlog::error("Failed to load font '{}' from '{}' or any fallback: {}", name, filepath, TTF_GetError());
+    if (!file) {
+        spdlog::error("Failed to load font '{}' from '{}' or any fallback", name, candidates.empty() ? "" : candidates.front());
         return false;
     }
     
-    // Store font data
+    // Store font data (the size itself is opened on first use)
     FontData fontData;
-    fontData.font = font;
-    fontData.filepath = actualPath;
-    fontData.size = size;
-    
-    m_fonts[name] = fontData;
+    fontData.face = GetFace(file, size);
+    m_fonts[name] = std::move(fontData);
     
-    spdlog::info("Loaded font '{}' at size {}", name, size);
+    spdlog::info("Loaded font '{}' at size {} from '{}'", name, size, file->path);
     
     // Set as default if no default is set
     if (m_defaultFont.empty()) {
@@ -176,54 +150,216 @@ bool FontManager::LoadFont(const std::string& filepath, const std::string& name,
     return true;
 }
 
-void FontManager::UnloadFont(const std::string& name) {
-    auto it = m_fonts.find(name);
-    if (it != m_fonts.end()) {
-        if (it->second.font) {
-            TTF_CloseFont(it->second.font);
+std::string FontManager::ResolveFontPath(const std::string& filepath) {
+    auto cached = m_resolvedPaths.find(filepath);
+    if (cached != m_resolvedPaths.end()) {
+        return cached->second;
+    }
+    
+    // First try: assets/fonts/ directory (packed or loose)
+    std::vector<std::string> paths = {"assets/fonts/" + filepath};
+    
+    // Second try: system font directories (macOS/Linux/Windows)
+    #ifdef __APPLE__
+    paths.insert(paths.end(), {
+        "/System/Library/Fonts/" + filepath,
+        "/Library/Fonts/" + filepath,
+        "~/Library/Fonts/" + filepath
+    });
+    #elif defined(__linux__)
+    paths.insert(paths.end(), {
+        "/usr/share/fonts/truetype/dejavu/" + filepath,
+        "/usr/share/fonts/TTF/" + filepath,
+        "/usr/share/fonts/" + filepath,
+        "~/.fonts/" + filepath
+    });
+    #elif defined(_WIN32)
+    paths.insert(paths.end(), {
+        "C:/Windows/Fonts/" + filepath
+    });
+    #endif
+    
+    // Last: the name as given (absolute or relative to the working directory)
+    paths.push_back(filepath);
+    
+    std::string resolved;
+    for (const auto& path : paths) {
+        if (utils::AssetExists(path)) {
+            resolved = path;
+            break;
         }
-        
-        // Clear default font if this was it
-        if (m_defaultFont == name) {
-            m_defaultFont.clear();
+    }
+    
+    m_resolvedPaths[filepath] = resolved;
+    return resolved;
+}
+
+std::shared_ptr<FontManager::FontFile> FontManager::LoadFontFile(const std::string& path) {
+    auto it = m_files.find(path);
+    if (it != m_files.end()) {
+        if (auto file = it->second.lock()) {
+            return file;
         }
-        
-        m_fonts.erase(it);
-        spdlog::info("Unloaded font '{}'", name);
     }
+    
+    auto file = std::make_shared<FontFile>();
+    file->path = path;
+    if (utils::AssetView view = utils::FindPackedAsset(path)) {
+        file->data = view.data;
+        file->size = view.size;
+    } else {
+        if (!utils::ReadAsset(path, file->bytes)) {
+            spdlog::error("Failed to read font file '{}'", path);
+            return nullptr;
+        }
+        file->data = file->bytes.data();
+        file->size = file->bytes.size();
+    }
+    
+    if (!IsFontData(file->data, file->size)) {
+        spdlog::error("Not a TrueType/OpenType font: {}", path);
+        return nullptr;
+    }
+    
+    m_files[path] = file;
+    return file;
 }
 
-void FontManager::UnloadAll() {
-    for (auto& [name, fontData] : m_fonts) {
-        if (fontData.font) {
-            TTF_CloseFont(fontData.font);
+std::vector<std::string> FontManager::ReloadFontFile(const std::string& path) {
+    const std::string normalized = std::filesystem::path(path).lexically_normal().generic_string();
+    std::shared_ptr<FontFile> file;
+    for (const auto& [filePath, weakFile] : m_files) {
+        if (std::filesystem::path(filePath).lexically_normal().generic_string() == normalized) {
+            file = weakFile.lock();
+            break;
         }
     }
+    if (!file || file->bytes.empty()) {
+        return {}; // Not in use, or mapped from the (read-only) asset archive
+    }
     
-    m_fonts.clear();
-    m_defaultFont.clear();
+    // Keep the old contents if the new file isn't readable yet
+    std::vector<uint8_t> bytes;
+    if (!utils::ReadAsset(file->path, bytes) || !IsFontData(bytes.data(), bytes.size())) {
+        spdlog::warn("Keeping the previous version of font file '{}' (new one is not a readable font)", file->path);
+        return {};
+    }
+    
+    // Close every size of the file; each reopens from the new data on next use
+    for (const auto& [key, weakFace] : m_faces) {
+        auto face = weakFace.lock();
+        if (!face || face->file != file) {
+            continue;
+        }
+        face->glyphAtlas.reset();
+        face->glyphMetrics.reset();
+        if (face->font) {
+            TTF_CloseFont(face->font);
+            face->font = nullptr;
+        }
+        face->failed = false;
+    }
+    
+    file->bytes = std::move(bytes);
+    file->data = file->bytes.data();
+    file->size = file->bytes.size();
     
-    if (!m_fonts.empty()) {
-        spdlog::info("Unloaded {} fonts", m_fonts.size());
+    std::vector<std::string> names;
+    for (const auto& [name, fontData] : m_fonts) {
+        if (fontData.face->file == file) {
+            names.push_back(name);
+        }
     }
+    spdlog::info("Reloaded font file '{}' ({} fonts)", file->path, names.size());
+    return names;
 }
 
-TTF_Font* FontManager::GetFont(const std::string& name) const {
+std::shared_ptr<FontManager::FontFace> FontManager::GetFace(const std::shared_ptr<FontFile>& file, int size) {
+    const std::string key = file->path + "#" + std::to_string(size);
+    auto it = m_faces.find(key);
+    if (it != m_faces.end()) {
+        if (auto face = it->second.lock()) {
+            return face;
+        }
+    }
+    
+    auto face = std::make_shared<FontFace>();
+    face->file = file;
+    face->size = size;
+    m_faces[key] = face;
+    return face;
+}
+
+FontManager::FontFace::~FontFace() {
+    glyphAtlas.reset();
+    glyphMetrics.reset();
+    if (font) {
+        TTF_CloseFont(font);
+    }
+}
+
+TTF_Font* FontManager::FontFace::Open() {
+    if (!font && !failed) {
+        // Reads straight from the shared file data, which outlives the font
+        font = TTF_OpenFontRW(SDL_RWFromConstMem(file->data, static_cast<int>(file->size)), 1, size);
+        if (!font) {
+            failed = true;
+            spdlog::error("Failed to open font '{}' at size {}: {}", file->path, size, TTF_GetError());
+        }
+    }
+    return font;
+}
+
+FontManager::FontFace* FontManager::FindFace(const std::string& name) const {
     auto it = m_fonts.find(name);
     if (it != m_fonts.end()) {
-        return it->second.font;
+        return it->second.face.get();
     }
     
     // If font not found, try to return default font
     if (!m_defaultFont.empty() && name != m_defaultFont) {
         spdlog::warn("Font '{}' not found, using default font '{}'", name, m_defaultFont);
-        return GetFont(m_defaultFont);
+        return FindFace(m_defaultFont);
     }
     
     spdlog::warn("Font '{}' not found and no default font available", name);
     return nullptr;
 }
 
+void FontManager::UnloadFont(const std::string& name) {
+    auto it = m_fonts.find(name);
+    if (it != m_fonts.end()) {
+        // Clear default font if this was it
+        if (m_defaultFont == name) {
+            m_defaultFont.clear();
+        }
+        
+        // The face (and file data) go with their last user
+        m_fonts.erase(it);
+        std::erase_if(m_faces, [](const auto& entry) { return entry.second.expired(); });
+        std::erase_if(m_files, [](const auto& entry) { return entry.second.expired(); });
+        spdlog::info("Unloaded font '{}'", name);
+    }
+}
+
+void FontManager::UnloadAll() {
+    const size_t count = m_fonts.size();
+    
+    m_fonts.clear();
+    m_faces.clear();
+    m_files.clear();
+    m_defaultFont.clear();
+    
+    if (count > 0) {
+        spdlog::info("Unloaded {} fonts", count);
+    }
+}
+
+TTF_Font* FontManager::GetFont(const std::string& name) const {
+    FontFace* face = FindFace(name);
+    return face ? face->Open() : nullptr;
+}
+
 bool FontManager::HasFont(const std::string& name) const {
     return m_fonts.find(name) != m_fonts.end();
 }
@@ -231,7 +367,7 @@ bool FontManager::HasFont(const std::string& name) const {
 int FontManager::GetFontSize(const std::string& name) const {
     auto it = m_fonts.find(name);
     if (it != m_fonts.end()) {
-        return it->second.size;
+        return it->second.face->size;
     }
     return 0;
 }
@@ -239,7 +375,7 @@ int FontManager::GetFontSize(const std::string& name) const {
 std::string FontManager::GetFontFilepath(const std::string& name) const {
     auto it = m_fonts.find(name);
     if (it != m_fonts.end()) {
-        return it->second.filepath;
+        return it->second.face->file->path;
     }
     return "";
 }
@@ -303,4 +439,45 @@ TTF_Font* FontManager::GetDefaultFontHandle() const {
     return GetFont(m_defaultFont);
 }
 
+GlyphAtlas* FontManager::GetGlyphAtlas(const std::string& fontName) {
+    // Same fallback as GetFont - use the default font's atlas
+    FontFace* face = FindFace(fontName);
+    if (!face || !face->Open()) {
+        return nullptr;
+    }
+    
+    if (!face->glyphAtlas) {
+        face->glyphAtlas = std::make_unique<GlyphAtlas>(face->font, m_glyphAtlasPageSize);
+        spdlog::debug("Created glyph atlas for font '{}' at size {}", face->file->path, face->size);
+    }
+    
+    return face->glyphAtlas.get();
+}
+
+GlyphMetrics* FontManager::GetGlyphMetrics(const std::string& fontName) {
+    FontFace* face = FindFace(fontName);
+    if (!face || !face->Open()) {
+        return nullptr;
+    }
+    
+    if (!face->glyphMetrics) {
+        face->glyphMetrics = std::make_unique<GlyphMetrics>(face->font);
+    }
+    
+    return face->glyphMetrics.get();
+}
+
+void FontManager::SetGlyphAtlasPageSize(int pageSize) {
+    if (pageSize != m_glyphAtlasPageSize) {
+        m_glyphAtlasPageSize = pageSize;
+        ClearGlyphAtlases(); // Existing atlases use the old page size
+    }
+}
+
+void FontManager::ClearGlyphAtlases() {
+    for (auto& [name, fontData] : m_fonts) {
+        fontData.face->glyphAtlas.reset();
+    }
+}
+
 } // namespace text
\ No newline at end of file
@@ -0,0 +1,174 @@
+#include "engine/public/text/GlyphAtlas.h"
+#include "engine/public/rendering/Texture.h"
+#include <spdlog/spdlog.h>
+#include <SDL.h>
+#include <algorithm>
+
+namespace text {
+
+namespace {
+
+constexpr uint32_t REPLACEMENT_CHARACTER = 0xFFFD;
+
+} // namespace
+
+GlyphAtlas::GlyphAtlas(TTF_Font* font, int pageSize)
+    : m_font(font)
+    , m_pageSize(std::max(64, pageSize)) {
+}
+
+GlyphAtlas::~GlyphAtlas() = default;
+
+const Glyph* GlyphAtlas::GetGlyph(uint32_t codepoint) {
+    auto it = m_glyphs.find(codepoint);
+    if (it != m_glyphs.end()) {
+        return &it->second;
+    }
+
+    Glyph glyph;
+    if (!RasterizeGlyph(codepoint, glyph)) {
+        // Fall back to the replacement character (or give up if even that fails)
+        if (codepoint == REPLACEMENT_CHARACTER) {
+            return nullptr;
+        }
+        const Glyph* replacement = GetGlyph(REPLACEMENT_CHARACTER);
+        if (!replacement) {
+            return nullptr;
+        }
+        glyph = *replacement;
+    }
+
+    return &m_glyphs.emplace(codepoint, glyph).first->second;
+}
+
+int GlyphAtlas::GetKerning(uint32_t previous, uint32_t codepoint) const {
+    if (!m_font || previous == 0) {
+        return 0;
+    }
+    return TTF_GetFontKerningSizeGlyphs32(m_font, previous, codepoint);
+}
+
+std::shared_ptr<rendering::Texture> GlyphAtlas::GetPageTexture(int page) const {
+    if (page < 0 || page >= static_cast<int>(m_pages.size())) {
+        return nullptr;
+    }
+    return m_pages[page];
+}
+
+void GlyphAtlas::Clear() {
+    m_glyphs.clear();
+    m_pages.clear();
+    m_packer.Reset(0, 0);
+}
+
+uint32_t GlyphAtlas::NextCodepoint(const std::string& text, size_t& index) {
+    const auto lead = static_cast<unsigned char>(text[index++]);
+    if (lead < 0x80) {
+        return lead;
+    }
+
+    int extraBytes = 0;
+    uint32_t codepoint = 0;
+    if ((lead & 0xE0) == 0xC0) { extraBytes = 1; codepoint = lead & 0x1F; }
+    else if ((lead & 0xF0) == 0xE0) { extraBytes = 2; codepoint = lead & 0x0F; }
+    else if ((lead & 0xF8) == 0xF0) { extraBytes = 3; codepoint = lead & 0x07; }
+    else return REPLACEMENT_CHARACTER;
+
+    for (int i = 0; i < extraBytes; ++i) {
+        if (index >= text.size() || (static_cast<unsigned char>(text[index]) & 0xC0) != 0x80) {
+            return REPLACEMENT_CHARACTER;
+        }
+        codepoint = (codepoint << 6) | (static_cast<unsigned char>(text[index++]) & 0x3F);
+    }
+
+    return codepoint;
+}
+
+bool GlyphAtlas::RasterizeGlyph(uint32_t codepoint, Glyph& glyph) {
+    if (!m_font) {
+        return false;
+    }
+
+    int minX, maxX, minY, maxY, advance;
+    if (TTF_GlyphMetrics32(m_font, codepoint, &minX, &maxX, &minY, &maxY, &advance) != 0) {
+        return false;
+    }
+    glyph.advance = advance;
+
+    // Whitespace has metrics but nothing to draw
+    if (maxX <= minX || maxY <= minY) {
+        glyph.page = -1;
+        return true;
+    }
+
+    // Render white so the glyph can be tinted to any color at draw time
+    SDL_Color white = {255, 255, 255, 255};
+    SDL_Surface* glyphSurface = TTF_RenderGlyph32_Blended(m_font, codepoint, white);
+    if (!glyphSurface) {
+        spdlog::warn("Failed to rasterize glyph U+{:04X}: {}", codepoint, TTF_GetError());
+        return false;
+    }
+
+    SDL_Surface* rgbaSurface = SDL_ConvertSurfaceFormat(glyphSurface, SDL_PIXELFORMAT_RGBA32, 0);
+    SDL_FreeSurface(glyphSurface);
+    if (!rgbaSurface) {
+        spdlog::error("Failed to convert glyph surface to RGBA format");
+        return false;
+    }
+
+    const int width = rgbaSurface->w;
+    const int height = rgbaSurface->h;
+    if (width + GLYPH_PADDING > m_pageSize || height + GLYPH_PADDING > m_pageSize) {
+        spdlog::warn("Glyph U+{:04X} ({}x{}) does not fit a {}px atlas page", codepoint, width, height, m_pageSize);
+        SDL_FreeSurface(rgbaSurface);
+        return false;
+    }
+
+    // Find a spot on the current page, starting a new page when it's full
+    glm::ivec2 position;
+    if (m_pages.empty() || !m_packer.Insert(width + GLYPH_PADDING, height + GLYPH_PADDING, position)) {
+        if (!AddPage() || !m_packer.Insert(width + GLYPH_PADDING, height + GLYPH_PADDING, position)) {
+            SDL_FreeSurface(rgbaSurface);
+            return false;
+        }
+    }
+
+    // Upload row by row if the surface pitch has padding
+    const auto* pixels = static_cast<const unsigned char*>(rgbaSurface->pixels);
+    auto& page = m_pages.back();
+    if (rgbaSurface->pitch == width * 4) {
+        page->UpdateRegion(position.x, position.y, width, height, pixels);
+    } else {
+        for (int row = 0; row < height; ++row) {
+            page->UpdateRegion(position.x, position.y + row, width, 1, pixels + row * rgbaSurface->pitch);
+        }
+    }
+    SDL_FreeSurface(rgbaSurface);
+    m_uploadCount++;
+
+    const float invSize = 1.0f / m_pageSize;
+    glyph.page = static_cast<int>(m_pages.size()) - 1;
+    glyph.size = {width, height};
+    glyph.uvRect = {position.x * invSize, position.y * invSize,
+                    (position.x + width) * invSize, (position.y + height) * invSize};
+    return true;
+}
+
+bool GlyphAtlas::AddPage() {
+    // Start fully transparent so padding between glyphs never samples garbage
+    std::vector<unsigned char> clearPixels(static_cast<size_t>(m_pageSize) * m_pageSize * 4, 0);
+
+    auto page = std::make_shared<rendering::Texture>();
+    if (!page->LoadFromMemory(clearPixels.data(), m_pageSize, m_pageSize, 4)) {
+        spdlog::error("Failed to create {}x{} glyph atlas page", m_pageSize, m_pageSize);
+        return false;
+    }
+
+    m_pages.push_back(std::move(page));
+    m_packer.Reset(m_pageSize, m_pageSize);
+
+    spdlog::debug("Glyph atlas page {} created ({}x{})", m_pages.size() - 1, m_pageSize, m_pageSize);
+    return true;
+}
+
+} // namespace text
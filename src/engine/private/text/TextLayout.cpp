@@ -0,0 +1,173 @@
+#include "engine/public/text/TextLayout.h"
+#include "engine/public/text/GlyphAtlas.h"
+#include <algorithm>
+#include <cmath>
+
+namespace text {
+
+namespace {
+
+constexpr uint32_t REPLACEMENT_CHARACTER = 0xFFFD;
+
+bool IsBreakingSpace(uint32_t codepoint) {
+    return codepoint == ' ' || codepoint == '\t';
+}
+
+} // namespace
+
+GlyphMetrics::GlyphMetrics(TTF_Font* font)
+    : m_font(font) {
+    std::fill(std::begin(m_asciiAdvances), std::end(m_asciiAdvances), -1);
+}
+
+int GlyphMetrics::GetAdvance(uint32_t codepoint) {
+    if (codepoint < ASCII_COUNT) {
+        int& advance = m_asciiAdvances[codepoint];
+        if (advance < 0) {
+            advance = MeasureAdvance(codepoint);
+        }
+        return advance;
+    }
+
+    auto it = m_advances.find(codepoint);
+    if (it != m_advances.end()) {
+        return it->second;
+    }
+    const int advance = MeasureAdvance(codepoint);
+    m_advances.emplace(codepoint, advance);
+    return advance;
+}
+
+int GlyphMetrics::GetKerning(uint32_t previous, uint32_t codepoint) {
+    if (!m_font || previous == 0) {
+        return 0;
+    }
+
+    const uint64_t key = (static_cast<uint64_t>(previous) << 32) | codepoint;
+    auto it = m_kerning.find(key);
+    if (it != m_kerning.end()) {
+        return it->second;
+    }
+    const int kerning = TTF_GetFontKerningSizeGlyphs32(m_font, previous, codepoint);
+    m_kerning.emplace(key, kerning);
+    return kerning;
+}
+
+int GlyphMetrics::GetLineSkip() const {
+    return m_font ? TTF_FontLineSkip(m_font) : 0;
+}
+
+int GlyphMetrics::MeasureAdvance(uint32_t codepoint) {
+    if (!m_font) {
+        return 0;
+    }
+
+    int minX, maxX, minY, maxY, advance;
+    if (TTF_GlyphMetrics32(m_font, codepoint, &minX, &maxX, &minY, &maxY, &advance) == 0) {
+        return advance;
+    }
+
+    // Same fallback as the glyph atlas
+    return codepoint == REPLACEMENT_CHARACTER ? 0 : GetAdvance(REPLACEMENT_CHARACTER);
+}
+
+void TextLayout::Build(const std::string& content, GlyphMetrics& metrics, const TextLayoutOptions& options) {
+    Clear();
+    m_lineSkip = metrics.GetLineSkip();
+    m_sourceLength = content.size();
+    if (content.empty()) {
+        return;
+    }
+
+    const bool softBreaks = options.wordWrap && options.maxWidth > 0.0f;
+    const float firstKerning = options.kerning ? options.kerningAdjustment : 0.0f;
+
+    size_t lineStart = 0;
+    float pen = 0.0f;             // Width of [lineStart, i)
+    size_t contentEnd = 0;        // End of the last non-space glyph on the line
+    float contentWidth = 0.0f;
+    bool afterSpace = false;
+    uint32_t previous = 0;
+
+    // Last place the line can be broken: it ends at breakEnd and the next one starts at resumeAt
+    bool haveBreak = false;
+    size_t breakEnd = 0;
+    float breakWidth = 0.0f;
+    size_t resumeAt = 0;
+    float resumeShift = 0.0f;     // Pen width that moves off the line with the break
+
+    for (size_t i = 0; i < content.size();) {
+        const size_t start = i;
+        const uint32_t codepoint = GlyphAtlas::NextCodepoint(content, i);
+
+        if (codepoint == '\n' && options.wordWrap) {
+            AddLine(lineStart, contentEnd, contentWidth);
+            lineStart = contentEnd = i;
+            pen = contentWidth = 0.0f;
+            afterSpace = haveBreak = false;
+            previous = 0;
+            continue;
+        }
+
+        const int glyphAdvance = metrics.GetAdvance(codepoint);
+        float advance = static_cast<float>(glyphAdvance);
+        if (options.kerning) {
+            advance += metrics.GetKerning(previous, codepoint) + options.kerningAdjustment;
+        }
+        previous = codepoint;
+
+        // Trailing spaces never push a line over the limit
+        if (IsBreakingSpace(codepoint)) {
+            pen += advance;
+            afterSpace = true;
+            continue;
+        }
+
+        if (softBreaks) {
+            if (afterSpace && contentEnd > lineStart) {
+                haveBreak = true;
+                breakEnd = contentEnd;
+                breakWidth = contentWidth;
+                resumeAt = start;
+                // The word's first glyph loses its kerning against the space once it starts a line
+                resumeShift = pen + advance - (glyphAdvance + firstKerning);
+            }
+
+            if (haveBreak && pen + advance > options.maxWidth) {
+                AddLine(lineStart, breakEnd, breakWidth);
+                lineStart = resumeAt;
+                pen -= resumeShift;
+                haveBreak = false;
+            }
+        }
+
+        afterSpace = false;
+        pen += advance;
+        contentEnd = i;
+        contentWidth = pen;
+    }
+
+    if (options.wordWrap) {
+        AddLine(lineStart, contentEnd, contentWidth);
+    } else {
+        AddLine(0, content.size(), pen);
+    }
+}
+
+void TextLayout::Clear() {
+    m_lines.clear();
+    m_width = 0;
+    m_lineSkip = 0;
+    m_sourceLength = 0;
+}
+
+void TextLayout::AddLine(size_t offset, size_t end, float width) {
+    TextLine line;
+    line.offset = offset;
+    line.length = end > offset ? end - offset : 0;
+    line.width = static_cast<int>(std::ceil(std::max(width, 0.0f)));
+    m_width = std::max(m_width, line.width);
+    m_lines.push_back(line);
+}
+
+} // namespace text
@@ -1,4 +1,7 @@
 #include "engine/public/text/TextRenderer.h"
+#include "engine/public/text/GlyphAtlas.h"
+#include "engine/public/core/Engine.h"
+#include "engine/public/core/FrameArena.h"
 #include "engine/public/rendering/Texture.h"
 #include "engine/public/rendering/Renderer.h"
 #include "engine/public/rendering/Sprite.h"
@@ -7,11 +10,42 @@
 #include <spdlog/spdlog.h>
 #include <SDL.h>
 #include <algorithm>
-#include <sstream>
-#include <iomanip>
+#include <cmath>
+#include <memory_resource>
 
 namespace text {
 
+namespace {
+
+// Frames a layout can go unused before it's dropped
+constexpr size_t LAYOUT_CACHE_FRAMES = 600;
+
+// FNV-1a over every property that goes into a key (floats hashed by bit pattern)
+struct KeyHasher {
+    uint64_t hash = 14695981039346656037ull;
+    
+    void Bytes(const void* data, size_t size) {
+        const auto* bytes = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < size; ++i) {
+            hash ^= bytes[i];
+            hash *= 1099511628211ull;
+        }
+    }
+    
+    void String(const std::string& value) {
+        Bytes(value.data(), value.size());
+        uint64_t length = value.size(); // Separates adjacent strings ("ab"+"c" vs "a"+"bc")
+        Bytes(&length, sizeof(length));
+    }
+    
+    template <typename T>
+    void Value(const T& value) {
+        Bytes(&value, sizeof(value));
+    }
+};
+
+} // namespace
+
 TextRenderer::TextRenderer() = default;
 
 TextRenderer::~TextRenderer() {
@@ -71,6 +105,7 @@ void TextRenderer::Update() {
     // Periodically clean up old cache entries (every 60 frames)
     if (m_currentFrame % 60 == 0) {
         EvictOldCacheEntries();
+        EvictOldLayouts();
     }
 }
 
@@ -88,7 +123,9 @@ void TextRenderer::DrawText(const Text& text, const glm::vec2& position, float r
     }
     
     // Choose rendering method based on text render mode and caching settings
-    if (text.GetRenderMode() == TextRenderMode::Cached && m_enableCache) {
+    if (text.GetRenderMode() == TextRenderMode::GlyphAtlas) {
+        RenderGlyphAtlas(text, position, rotation, scale);
+    } else if (text.GetRenderMode() == TextRenderMode::Cached && m_enableCache) {
         RenderCached(text, position, rotation, scale);
     } else {
         RenderImmediate(text, position, rotation, scale);
@@ -115,6 +152,9 @@ glm::ivec2 TextRenderer::MeasureText(const std::string& content, const std::stri
 
 void TextRenderer::ClearCache() {
     m_textCache.clear();
+    m_layoutCache.clear();
+    m_lruHead = nullptr;
+    m_lruTail = nullptr;
     m_currentCacheSize = 0;
     spdlog::debug("Text cache cleared");
 }
@@ -122,15 +162,21 @@ void TextRenderer::ClearCache() {
 void TextRenderer::ClearCacheForFont(const std::string& fontName) {
     auto it = m_textCache.begin();
     while (it != m_textCache.end()) {
-        // Check if this cache entry uses the specified font
-        // This is a simplified check - in a more robust system you'd store font info
-        if (it->first.find(fontName) != std::string::npos) {
+        if (it->second.fontName == fontName) {
+            UnlinkLRU(&it->second);
             m_currentCacheSize -= it->second.memorySize;
             it = m_textCache.erase(it);
         } else {
             ++it;
         }
     }
+    for (auto layout = m_layoutCache.begin(); layout != m_layoutCache.end();) {
+        if (layout->second.fontName == fontName) {
+            layout = m_layoutCache.erase(layout);
+        } else {
+            ++layout;
+        }
+    }
     spdlog::debug("Cleared cache entries for font '{}'", fontName);
 }
 
@@ -143,6 +189,17 @@ size_t TextRenderer::GetCacheMemoryUsage() const {
     return m_currentCacheSize;
 }
 
+TextCacheStats TextRenderer::GetCacheStats() const {
+    TextCacheStats stats = m_cacheStats;
+    stats.entries = m_textCache.size();
+    stats.layouts = m_layoutCache.size();
+    return stats;
+}
+
+void TextRenderer::ResetCacheStats() {
+    m_cacheStats = TextCacheStats{};
+}
+
 void TextRenderer::LoadConfigFromSettings() {
     auto config = utils::Config::Instance();
     
@@ -157,6 +214,11 @@ void TextRenderer::LoadConfigFromSettings() {
     else if (hinting == "mono") m_hinting = TTF_HINTING_MONO;
     else m_hinting = TTF_HINTING_NORMAL;
     
+    m_glyphAtlasPageSize = config->GetInt("text.glyph_atlas.page_size", 512);
+    if (m_fontManager) {
+        m_fontManager->SetGlyphAtlasPageSize(m_glyphAtlasPageSize);
+    }
+    
     spdlog::debug("Text renderer config loaded - Cache: {}MB, Kerning: {}, Hinting: {}", 
                  m_maxCacheSize / (1024 * 1024), m_enableKerning, hinting);
 }
@@ -220,17 +282,21 @@ std::shared_ptr<rendering::Texture> TextRenderer::RenderToTexture(const Text& te
 
 void TextRenderer::RenderCached(const Text& text, const glm::vec2& position, float rotation, const glm::vec2& scale) {
     // Generate cache key
-    std::string cacheKey = GenerateTextHash(text);
+    uint64_t cacheKey = GenerateCacheKey(text);
     
     std::shared_ptr<rendering::Texture> texture;
     
     // Check if we have this text cached
     auto it = m_textCache.find(cacheKey);
     if (it != m_textCache.end()) {
-        // Update last used frame for LRU
-        it->second.lastUsedFrame = m_currentFrame;
+        // Move to the front of the LRU list
+        UnlinkLRU(&it->second);
+        LinkLRUFront(&it->second);
         texture = it->second.texture;
+        m_cacheStats.hits++;
     } else {
+        m_cacheStats.misses++;
+        
         // Not cached - render to texture and cache it
         texture = RenderToTexture(text);
         if (!texture) return;
@@ -239,20 +305,21 @@ void TextRenderer::RenderCached(const Text& text, const glm::vec2& position, flo
         glm::ivec2 size = {texture->GetWidth(), texture->GetHeight()};
         size_t memorySize = size.x * size.y * 4; // 4 bytes per pixel (RGBA)
         
-        // Check if we have room in cache
-        while (m_currentCacheSize + memorySize > m_maxCacheSize && !m_textCache.empty()) {
-            EvictOldCacheEntries();
+        // Make room by evicting least recently used entries
+        while (m_currentCacheSize + memorySize > m_maxCacheSize && m_lruTail) {
+            RemoveCacheEntry(m_lruTail->key);
+            m_cacheStats.evictions++;
         }
         
         // Add to cache
-        CachedTextData cacheData;
+        CachedTextData& cacheData = m_textCache[cacheKey];
         cacheData.texture = texture;
         cacheData.size = size;
         cacheData.memorySize = memorySize;
-        cacheData.lastUsedFrame = m_currentFrame;
-        cacheData.textHash = cacheKey;
+        cacheData.fontName = text.GetFont();
+        cacheData.key = cacheKey;
+        LinkLRUFront(&cacheData);
         
-        m_textCache[cacheKey] = cacheData;
         m_currentCacheSize += memorySize;
     }
     
@@ -270,80 +337,144 @@ void TextRenderer::RenderCached(const Text& text, const glm::vec2& position, flo
     m_renderer->DrawSprite(&textSprite, transform);
 }
 
-std::vector<std::string> TextRenderer::WrapText(const std::string& content, const std::string& fontName, float maxWidth) {
-    std::vector<std::string> lines;
-    
-    if (maxWidth <= 0) {
-        lines.push_back(content);
-        return lines;
-    }
-    
-    std::istringstream words(content);
-    std::string word;
-    std::string currentLine;
+void TextRenderer::RenderGlyphAtlas(const Text& text, const glm::vec2& position, float rotation, const glm::vec2& scale) {
+    GlyphAtlas* atlas = m_fontManager->GetGlyphAtlas(text.GetFont());
+    const TextLayout* layout = GetLayout(text);
+    if (!atlas || !layout || !m_renderer) return;
+    
+    // The layout measured with the same advances and kerning the atlas draws with
+    const std::vector<TextLine>& lines = layout->GetLines();
+    const float lineHeight = layout->GetLineSkip() * text.GetLineSpacing();
+    const int blockWidth = layout->GetWidth();
+    
+    glm::ivec2 blockSize = {blockWidth, static_cast<int>(lineHeight * lines.size())};
+    glm::vec2 origin = position + CalculateAlignmentOffset(text, blockSize);
+    
+    // Same transform as a top-left origin sprite at the block origin
+    const float radians = glm::radians(rotation);
+    const float cosR = std::cos(radians);
+    const float sinR = std::sin(radians);
+    auto toWorld = [&](float localX, float localY) {
+        float x = localX * scale.x;
+        float y = localY * scale.y;
+        return glm::vec2(origin.x + x * cosR - y * sinR, origin.y + x * sinR + y * cosR);
+    };
     
-    while (words >> word) {
-        std::string testLine = currentLine.empty() ? word : currentLine + " " + word;
-        
-        int width, height;
-        m_fontManager->GetTextSize(testLine, fontName, width, height);
-        
-        if (width <= maxWidth) {
-            currentLine = testLine;
-        } else {
-            if (!currentLine.empty()) {
-                lines.push_back(currentLine);
-                currentLine = word;
-            } else {
-                // Single word is too long - add it anyway
-                lines.push_back(word);
+    const std::string& content = text.GetContent();
+    auto emitGlyphs = [&](const glm::vec2& offset, const glm::vec4& color) {
+        for (size_t lineIndex = 0; lineIndex < lines.size(); ++lineIndex) {
+            const TextLine& line = lines[lineIndex];
+            
+            // Per-line alignment inside the block (matches CreateTextSurface)
+            float penX = offset.x;
+            if (text.GetAlignment() == TextAlignment::Center) {
+                penX += (blockWidth - line.width) * 0.5f;
+            } else if (text.GetAlignment() == TextAlignment::Right) {
+                penX += static_cast<float>(blockWidth - line.width);
+            }
+            const float penY = offset.y + lineIndex * lineHeight;
+            
+            uint32_t previous = 0;
+            const size_t lineEnd = line.offset + line.length;
+            for (size_t i = line.offset; i < lineEnd;) {
+                uint32_t codepoint = GlyphAtlas::NextCodepoint(content, i);
+                const Glyph* glyph = atlas->GetGlyph(codepoint);
+                if (!glyph) continue;
+                
+                if (m_enableKerning) {
+                    penX += atlas->GetKerning(previous, codepoint) + m_kerningAdjustment;
+                }
+                previous = codepoint;
+                
+                if (glyph->page >= 0) {
+                    const glm::vec2 corners[4] = {
+                        toWorld(penX, penY),
+                        toWorld(penX + glyph->size.x, penY),
+                        toWorld(penX + glyph->size.x, penY + glyph->size.y),
+                        toWorld(penX, penY + glyph->size.y)
+                    };
+                    m_renderer->DrawQuad(atlas->GetPageTexture(glyph->page), corners, glyph->uvRect, color);
+                }
+                
+                penX += glyph->advance;
             }
         }
+    };
+    
+    // Effects are extra passes over the same glyphs (outline needs a separate atlas and isn't supported here)
+    if (text.IsShadowEnabled()) {
+        emitGlyphs(text.GetShadowOffset(), text.GetShadowColor());
+    }
+    emitGlyphs(glm::vec2(0.0f), text.GetColor());
+}
+
+const TextLayout* TextRenderer::GetLayout(const Text& text) {
+    const uint64_t key = GenerateLayoutKey(text);
+    
+    // Lines index into the content, so a (very unlikely) key collision must not hand out foreign offsets
+    auto it = m_layoutCache.find(key);
+    if (it != m_layoutCache.end() && it->second.layout.GetSourceLength() == text.GetContent().size()) {
+        it->second.lastUsedFrame = m_currentFrame;
+        return &it->second.layout;
     }
     
-    if (!currentLine.empty()) {
-        lines.push_back(currentLine);
+    GlyphMetrics* metrics = m_fontManager->GetGlyphMetrics(text.GetFont());
+    if (!metrics) {
+        return nullptr;
     }
     
-    return lines;
+    TextLayoutOptions options;
+    options.wordWrap = text.IsWordWrapEnabled();
+    options.maxWidth = text.GetMaxWidth();
+    options.kerning = m_enableKerning;
+    options.kerningAdjustment = m_kerningAdjustment;
+    
+    CachedLayout& cached = m_layoutCache[key];
+    cached.layout.Build(text.GetContent(), *metrics, options);
+    cached.fontName = text.GetFont();
+    cached.lastUsedFrame = m_currentFrame;
+    return &cached.layout;
 }
 
-std::string TextRenderer::GenerateTextHash(const Text& text) {
-    // Create a hash from all text properties that affect rendering
-    std::ostringstream hash;
-    hash << text.GetContent() << "|"
-         << text.GetFont() << "|"
-         << std::fixed << std::setprecision(3)
-         << text.GetColor().r << "," << text.GetColor().g << "," 
-         << text.GetColor().b << "," << text.GetColor().a << "|"
-         << static_cast<int>(text.GetAlignment()) << "|"
-         << text.IsWordWrapEnabled() << "|" << text.GetMaxWidth() << "|"
-         << text.GetLineSpacing() << "|"
-         << text.IsOutlineEnabled() << "|" << text.GetOutlineThickness() << "|"
-         << text.GetOutlineColor().r << "," << text.GetOutlineColor().g << ","
-         << text.GetOutlineColor().b << "," << text.GetOutlineColor().a << "|"
-         << text.IsShadowEnabled() << "|" 
-         << text.GetShadowOffset().x << "," << text.GetShadowOffset().y << "|"
-         << text.GetShadowColor().r << "," << text.GetShadowColor().g << ","
-         << text.GetShadowColor().b << "," << text.GetShadowColor().a;
-    
-    return hash.str();
+uint64_t TextRenderer::GenerateLayoutKey(const Text& text) const {
+    // Only what changes where lines break and how wide they are
+    KeyHasher hasher;
+    hasher.String(text.GetContent());
+    hasher.String(text.GetFont());
+    hasher.Value(text.IsWordWrapEnabled());
+    hasher.Value(text.IsWordWrapEnabled() ? text.GetMaxWidth() : 0.0f);
+    hasher.Value(m_enableKerning);
+    hasher.Value(m_kerningAdjustment);
+    return hasher.hash;
+}
+
+uint64_t TextRenderer::GenerateCacheKey(const Text& text) {
+    // Every property that affects the rendered texture
+    KeyHasher hasher;
+    hasher.String(text.GetContent());
+    hasher.String(text.GetFont());
+    hasher.Value(text.GetColor());
+    hasher.Value(text.GetAlignment());
+    hasher.Value(text.IsWordWrapEnabled());
+    hasher.Value(text.GetMaxWidth());
+    hasher.Value(text.GetLineSpacing());
+    hasher.Value(text.IsOutlineEnabled());
+    hasher.Value(text.GetOutlineThickness());
+    hasher.Value(text.GetOutlineColor());
+    hasher.Value(text.IsShadowEnabled());
+    hasher.Value(text.GetShadowOffset());
+    hasher.Value(text.GetShadowColor());
+    return hasher.hash;
 }
 
 glm::ivec2 TextRenderer::CalculateTextSize(const Text& text) {
     if (text.IsWordWrapEnabled()) {
-        auto lines = WrapText(text.GetContent(), text.GetFont(), text.GetMaxWidth());
-        int maxWidth = 0;
-        int totalHeight = 0;
-        
-        for (const auto& line : lines) {
-            int width, height;
-            m_fontManager->GetTextSize(line, text.GetFont(), width, height);
-            maxWidth = std::max(maxWidth, width);
-            totalHeight += static_cast<int>(height * text.GetLineSpacing());
-        }
+        const TextLayout* layout = GetLayout(text);
+        if (!layout) return {0, 0};
         
-        return {maxWidth, totalHeight};
+        // Same line advance as CreateTextSurface
+        const int lineAdvance = static_cast<int>(layout->GetLineSkip() * text.GetLineSpacing());
+        return {layout->GetWidth(), lineAdvance * static_cast<int>(layout->GetLines().size())};
     } else {
         int width, height;
         m_fontManager->GetTextSize(text.GetContent(), text.GetFont(), width, height);
@@ -352,29 +483,61 @@ glm::ivec2 TextRenderer::CalculateTextSize(const Text& text) {
 }
 
 void TextRenderer::EvictOldCacheEntries() {
-    if (m_textCache.empty()) return;
-    
-    // If we're over the cache limit, remove oldest entries
-    while (m_currentCacheSize > m_maxCacheSize && !m_textCache.empty()) {
-        // Find the oldest entry (lowest lastUsedFrame)
-        auto oldestIt = std::min_element(m_textCache.begin(), m_textCache.end(),
-            [](const auto& a, const auto& b) {
-                return a.second.lastUsedFrame < b.second.lastUsedFrame;
-            });
-        
-        m_currentCacheSize -= oldestIt->second.memorySize;
-        m_textCache.erase(oldestIt);
+    // Drop least recently used entries until we're back under the limit
+    while (m_currentCacheSize > m_maxCacheSize && m_lruTail) {
+        RemoveCacheEntry(m_lruTail->key);
+        m_cacheStats.evictions++;
+    }
+}
+
+void TextRenderer::EvictOldLayouts() {
+    for (auto it = m_layoutCache.begin(); it != m_layoutCache.end();) {
+        if (m_currentFrame - it->second.lastUsedFrame > LAYOUT_CACHE_FRAMES) {
+            it = m_layoutCache.erase(it);
+        } else {
+            ++it;
+        }
     }
 }
 
-void TextRenderer::RemoveCacheEntry(const std::string& key) {
+void TextRenderer::RemoveCacheEntry(uint64_t key) {
     auto it = m_textCache.find(key);
     if (it != m_textCache.end()) {
+        UnlinkLRU(&it->second);
         m_currentCacheSize -= it->second.memorySize;
         m_textCache.erase(it);
     }
 }
 
+void TextRenderer::LinkLRUFront(CachedTextData* entry) {
+    entry->lruPrev = nullptr;
+    entry->lruNext = m_lruHead;
+    if (m_lruHead) {
+        m_lruHead->lruPrev = entry;
+    }
+    m_lruHead = entry;
+    if (!m_lruTail) {
+        m_lruTail = entry;
+    }
+}
+
+void TextRenderer::UnlinkLRU(CachedTextData* entry) {
+    if (entry->lruPrev) {
+        entry->lruPrev->lruNext = entry->lruNext;
+    } else if (m_lruHead == entry) {
+        m_lruHead = entry->lruNext;
+    }
+    
+    if (entry->lruNext) {
+        entry->lruNext->lruPrev = entry->lruPrev;
+    } else if (m_lruTail == entry) {
+        m_lruTail = entry->lruPrev;
+    }
+    
+    entry->lruPrev = nullptr;
+    entry->lruNext = nullptr;
+}
+
 SDL_Surface* TextRenderer::CreateTextSurface(const Text& text) {
     TTF_Font* font = m_fontManager->GetFont(text.GetFont());
     if (!font) {
@@ -393,28 +556,31 @@ SDL_Surface* TextRenderer::CreateTextSurface(const Text& text) {
     SDL_Surface* surface = nullptr;
     
     if (text.IsWordWrapEnabled()) {
-        // Handle word wrapping
-        auto lines = WrapText(text.GetContent(), text.GetFont(), text.GetMaxWidth());
-        
-        // Calculate total size
-        int maxWidth = 0;
-        int totalHeight = 0;
-        int lineHeight = m_fontManager->GetFontLineSkip(text.GetFont());
+        const TextLayout* layout = GetLayout(text);
+        if (!layout) return nullptr;
         
-        std::vector<SDL_Surface*> lineSurfaces;
+        const std::vector<TextLine>& lines = layout->GetLines();
+        const std::string& content = text.GetContent();
+        const int lineAdvance = static_cast<int>(layout->GetLineSkip() * text.GetLineSpacing());
         
-        for (const auto& line : lines) {
-            SDL_Surface* lineSurface = TTF_RenderUTF8_Blended(font, line.c_str(), color);
-            if (lineSurface) {
-                lineSurfaces.push_back(lineSurface);
-                maxWidth = std::max(maxWidth, lineSurface->w);
-                totalHeight += static_cast<int>(lineHeight * text.GetLineSpacing());
+        // Render each line (empty lines just leave their gap); scratch comes from the frame arena
+        std::pmr::memory_resource* scratch = &core::Engine::FrameMemory();
+        std::pmr::vector<SDL_Surface*> lineSurfaces(lines.size(), nullptr, scratch);
+        std::pmr::string lineText(scratch); // Reused - SDL_ttf wants a terminated string
+        int maxWidth = 0;
+        for (size_t i = 0; i < lines.size(); ++i) {
+            if (lines[i].length == 0) continue;
+            
+            lineText.assign(content, lines[i].offset, lines[i].length);
+            lineSurfaces[i] = TTF_RenderUTF8_Blended(font, lineText.c_str(), color);
+            if (lineSurfaces[i]) {
+                maxWidth = std::max(maxWidth, lineSurfaces[i]->w);
             }
         }
         
-        if (!lineSurfaces.empty()) {
+        if (maxWidth > 0 && lineAdvance > 0) {
             // Create combined surface
-            surface = SDL_CreateRGBSurface(0, maxWidth, totalHeight, 32,
+            surface = SDL_CreateRGBSurface(0, maxWidth, lineAdvance * static_cast<int>(lines.size()), 32,
                 0x00FF0000, 0x0000FF00, 0x000000FF, 0xFF000000);
             
             if (surface) {
@@ -422,9 +588,11 @@ SDL_Surface* TextRenderer::CreateTextSurface(const Text& text) {
                 SDL_FillRect(surface, nullptr, SDL_MapRGBA(surface->format, 0, 0, 0, 0));
                 
                 // Blit lines
-                int yOffset = 0;
-                for (SDL_Surface* lineSurface : lineSurfaces) {
-                    SDL_Rect destRect = {0, yOffset, lineSurface->w, lineSurface->h};
+                for (size_t i = 0; i < lineSurfaces.size(); ++i) {
+                    SDL_Surface* lineSurface = lineSurfaces[i];
+                    if (!lineSurface) continue;
+                    
+                    SDL_Rect destRect = {0, static_cast<int>(i) * lineAdvance, lineSurface->w, lineSurface->h};
                     
                     // Apply alignment
                     if (text.GetAlignment() == TextAlignment::Center) {
@@ -434,14 +602,15 @@ SDL_Surface* TextRenderer::CreateTextSurface(const Text& text) {
                     }
                     
                     SDL_BlitSurface(lineSurface, nullptr, surface, &destRect);
-                    yOffset += static_cast<int>(lineHeight * text.GetLineSpacing());
                 }
             }
         }
         
         // Clean up line surfaces
         for (SDL_Surface* lineSurface : lineSurfaces) {
-            SDL_FreeSurface(lineSurface);
+            if (lineSurface) {
+                SDL_FreeSurface(lineSurface);
+            }
         }
     } else {
         // Simple single-line rendering
@@ -0,0 +1,511 @@
+#include "engine/public/tilemap/Tilemap.h"
+#include "engine/public/core/Engine.h"
+#include "engine/public/rendering/QuadMesh.h"
+#include "engine/public/rendering/Renderer.h"
+#include "engine/public/rendering/Texture.h"
+#include "engine/public/utils/Assets.h"
+#include "engine/public/utils/ResourceManager.h"
+#include <tmxlite/Map.hpp>
+#include <tmxlite/ObjectGroup.hpp>
+#include <tmxlite/TileLayer.hpp>
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <map>
+#include <utility>
+
+namespace tilemap {
+
+namespace {
+
+uint32_t PackColor(const glm::vec4& color) {
+    auto toByte = [](float value) {
+        return static_cast<uint8_t>(std::clamp(value, 0.0f, 1.0f) * 255.0f + 0.5f);
+    };
+    const uint8_t bytes[4] = {toByte(color.r), toByte(color.g), toByte(color.b), toByte(color.a)};
+    uint32_t packed;
+    std::memcpy(&packed, bytes, sizeof(packed));
+    return packed;
+}
+
+// Per-corner UVs (top-left, top-right, bottom-right, bottom-left) with Tiled's flip flags applied
+void GetTileTexCoords(const glm::vec4& uvRect, uint8_t flipFlags, glm::vec2 texCoords[4]) {
+    texCoords[0] = {uvRect.x, uvRect.y};
+    texCoords[1] = {uvRect.z, uvRect.y};
+    texCoords[2] = {uvRect.z, uvRect.w};
+    texCoords[3] = {uvRect.x, uvRect.w};
+
+    // Diagonal flip (transpose) is applied before the horizontal and vertical flips
+    if (flipFlags & tmx::TileLayer::FlipFlag::Diagonal) {
+        std::swap(texCoords[1], texCoords[3]);
+    }
+    if (flipFlags & tmx::TileLayer::FlipFlag::Horizontal) {
+        std::swap(texCoords[0], texCoords[1]);
+        std::swap(texCoords[3], texCoords[2]);
+    }
+    if (flipFlags & tmx::TileLayer::FlipFlag::Vertical) {
+        std::swap(texCoords[0], texCoords[3]);
+        std::swap(texCoords[1], texCoords[2]);
+    }
+}
+
+bool IsCollisionLayer(const std::string& name) {
+    std::string lower = name;
+    std::transform(lower.begin(), lower.end(), lower.begin(), [](unsigned char c) { return std::tolower(c); });
+    return lower == "collision";
+}
+
+// Rectangle objects become collider bounds; other shapes and rotated rectangles are skipped
+void AddColliders(const tmx::ObjectGroup& group, const glm::vec2& origin, std::vector<core::Bounds>& colliders) {
+    const glm::vec2 offset = origin + glm::vec2(static_cast<float>(group.getOffset().x), static_cast<float>(group.getOffset().y));
+    size_t skipped = 0;
+    for (const tmx::Object& object : group.getObjects()) {
+        if (object.getShape() != tmx::Object::Shape::Rectangle || object.getRotation() != 0.0f) {
+            skipped++;
+            continue;
+        }
+        const tmx::FloatRect& rect = object.getAABB();
+        if (rect.width <= 0.0f || rect.height <= 0.0f) {
+            skipped++;
+            continue;
+        }
+        const glm::vec2 min = offset + glm::vec2(rect.left, rect.top);
+        colliders.emplace_back(min, min + glm::vec2(rect.width, rect.height));
+    }
+    if (skipped > 0) {
+        spdlog::warn("Collision layer '{}': skipped {} objects that are not axis-aligned rectangles", group.getName(), skipped);
+    }
+}
+
+struct ChunkBuilder {
+    core::Bounds bounds;
+    bool empty = true;
+    std::map<size_t, std::vector<rendering::MeshVertex>> vertices; // Per tileset
+};
+
+} // anonymous namespace
+
+Tilemap::Tilemap(int chunkSize)
+    : m_chunkSize(std::clamp(chunkSize, 1, 64)) {
+}
+
+Tilemap::~Tilemap() {
+    Unload();
+}
+
+bool Tilemap::Load(const std::string& path, const glm::vec2& origin) {
+    return Parse(path, origin) && Upload();
+}
+
+bool Tilemap::Parse(const std::string& path, const glm::vec2& origin) {
+    Unload();
+    m_origin = origin;
+
+    // Packed maps parse from memory; relative paths (tileset images) still resolve next to the map
+    tmx::Map map;
+    bool loaded = false;
+    if (utils::FindPackedAsset(path)) {
+        std::string text;
+        loaded = utils::ReadAssetText(path, text) &&
+                 map.loadFromString(text, std::filesystem::path(path).parent_path().generic_string());
+    } else {
+        loaded = map.load(path);
+    }
+    if (!loaded) {
+        spdlog::error("Failed to load tilemap: {}", path);
+        return false;
+    }
+    if (map.getOrientation() != tmx::Orientation::Orthogonal) {
+        spdlog::error("Tilemap {} is not orthogonal (only orthogonal maps are supported)", path);
+        return false;
+    }
+
+    m_sizeInTiles = {static_cast<int>(map.getTileCount().x), static_cast<int>(map.getTileCount().y)};
+    m_tileSize = {static_cast<int>(map.getTileSize().x), static_cast<int>(map.getTileSize().y)};
+
+    // Tilesets
+    for (const tmx::Tileset& source : map.getTilesets()) {
+        Tileset tileset;
+        tileset.firstGid = source.getFirstGID();
+        tileset.lastGid = source.getLastGID();
+        tileset.tileSize = {static_cast<int>(source.getTileSize().x), static_cast<int>(source.getTileSize().y)};
+        tileset.columns = static_cast<int>(source.getColumnCount());
+        tileset.spacing = static_cast<int>(source.getSpacing());
+        tileset.margin = static_cast<int>(source.getMargin());
+
+        // UVs are computed from the image size in the tileset, so no texture is needed until Upload()
+        tileset.imageSize = glm::vec2(static_cast<float>(source.getImageSize().x), static_cast<float>(source.getImageSize().y));
+        if (source.getImagePath().empty()) {
+            spdlog::warn("Tileset '{}' in {} is an image collection (not supported), its tiles will be skipped",
+                         source.getName(), path);
+        } else if (tileset.imageSize.x <= 0.0f || tileset.imageSize.y <= 0.0f) {
+            spdlog::warn("Tileset '{}' in {} has no image size, its tiles will be skipped", source.getName(), path);
+        } else {
+            tileset.imagePath = source.getImagePath();
+            if (tileset.columns <= 0 && tileset.tileSize.x > 0) {
+                tileset.columns = (static_cast<int>(tileset.imageSize.x) - 2 * tileset.margin + tileset.spacing) /
+                                  (tileset.tileSize.x + tileset.spacing);
+            }
+        }
+        m_tilesets.push_back(std::move(tileset));
+
+        // Tile animations (frame tile IDs are global)
+        const size_t tilesetIndex = m_tilesets.size() - 1;
+        const Tileset& added = m_tilesets.back();
+        if (added.imagePath.empty()) {
+            continue;
+        }
+        for (const tmx::Tileset::Tile& tile : source.getTiles()) {
+            if (tile.animation.frames.empty()) {
+                continue;
+            }
+
+            Animation animation;
+            animation.tileset = tilesetIndex;
+            for (const auto& frame : tile.animation.frames) {
+                if (frame.tileID < added.firstGid || frame.tileID > added.lastGid) {
+                    continue;
+                }
+                animation.durationMs += static_cast<float>(frame.duration);
+                animation.frameUVs.push_back(GetTileUVRect(added, frame.tileID));
+                animation.frameEndsMs.push_back(animation.durationMs);
+            }
+            if (animation.frameUVs.empty()) {
+                continue;
+            }
+
+            m_animationGids.push_back(added.firstGid + tile.ID);
+            m_animations.push_back(std::move(animation));
+        }
+    }
+
+    // Tile layers
+    size_t meshCount = 0;
+    size_t animatedCount = 0;
+
+    for (const auto& layerPtr : map.getLayers()) {
+        if (layerPtr->getType() == tmx::Layer::Type::Object) {
+            if (IsCollisionLayer(layerPtr->getName())) {
+                AddColliders(layerPtr->getLayerAs<tmx::ObjectGroup>(), origin, m_colliders);
+            }
+            continue;
+        }
+        if (layerPtr->getType() != tmx::Layer::Type::Tile) {
+            continue;
+        }
+
+        const auto& source = layerPtr->getLayerAs<tmx::TileLayer>();
+        Layer layer;
+        layer.name = source.getName();
+        layer.visible = source.getVisible();
+        layer.opacity = source.getOpacity();
+
+        const glm::vec2 offset = origin + glm::vec2(static_cast<float>(source.getOffset().x), static_cast<float>(source.getOffset().y));
+        const uint32_t color = PackColor(glm::vec4(1.0f, 1.0f, 1.0f, layer.opacity));
+
+        // Key (row, column) so chunks come out in row-major order, roughly matching Tiled's draw order
+        std::map<std::pair<int, int>, ChunkBuilder> builders;
+        std::map<std::pair<int, int>, std::vector<AnimatedTile>> animated;
+
+        auto addTile = [&](int x, int y, const tmx::TileLayer::Tile& tile) {
+            if (tile.ID == 0) {
+                return;
+            }
+            const int tilesetIndex = FindTileset(tile.ID);
+            if (tilesetIndex < 0 || m_tilesets[tilesetIndex].imagePath.empty()) {
+                return;
+            }
+            const Tileset& tileset = m_tilesets[tilesetIndex];
+
+            // Oversized tiles are anchored to the bottom-left of their cell, as in Tiled
+            const glm::vec2 topLeft = offset + glm::vec2(static_cast<float>(x * m_tileSize.x),
+                                                         static_cast<float>((y + 1) * m_tileSize.y - tileset.tileSize.y));
+            const glm::vec2 size(tileset.tileSize);
+            const glm::vec2 corners[4] = {
+                topLeft,
+                topLeft + glm::vec2(size.x, 0.0f),
+                topLeft + size,
+                topLeft + glm::vec2(0.0f, size.y)
+            };
+
+            const auto key = std::make_pair(static_cast<int>(std::floor(static_cast<float>(y) / m_chunkSize)),
+                                            static_cast<int>(std::floor(static_cast<float>(x) / m_chunkSize)));
+            ChunkBuilder& builder = builders[key];
+            const core::Bounds tileBounds(topLeft, topLeft + size);
+            if (builder.empty) {
+                builder.bounds = tileBounds;
+                builder.empty = false;
+            } else {
+                builder.bounds.min = glm::min(builder.bounds.min, tileBounds.min);
+                builder.bounds.max = glm::max(builder.bounds.max, tileBounds.max);
+            }
+
+            const int animation = FindAnimation(tile.ID);
+            if (animation >= 0) {
+                AnimatedTile animatedTile;
+                std::copy(std::begin(corners), std::end(corners), animatedTile.corners);
+                animatedTile.animation = static_cast<uint32_t>(animation);
+                animatedTile.flipFlags = tile.flipFlags;
+                animated[key].push_back(animatedTile);
+                return;
+            }
+
+            glm::vec2 texCoords[4];
+            GetTileTexCoords(GetTileUVRect(tileset, tile.ID), tile.flipFlags, texCoords);
+            std::vector<rendering::MeshVertex>& vertices = builder.vertices[static_cast<size_t>(tilesetIndex)];
+            for (int i = 0; i < 4; ++i) {
+                vertices.push_back({corners[i], texCoords[i], color});
+            }
+        };
+
+        if (map.isInfinite()) {
+            for (const tmx::TileLayer::Chunk& chunk : source.getChunks()) {
+                for (int y = 0; y < chunk.size.y; ++y) {
+                    for (int x = 0; x < chunk.size.x; ++x) {
+                        const size_t index = static_cast<size_t>(y) * chunk.size.x + x;
+                        if (index < chunk.tiles.size()) {
+                            addTile(chunk.position.x + x, chunk.position.y + y, chunk.tiles[index]);
+                        }
+                    }
+                }
+            }
+        } else {
+            const auto& tiles = source.getTiles();
+            for (int y = 0; y < m_sizeInTiles.y; ++y) {
+                for (int x = 0; x < m_sizeInTiles.x; ++x) {
+                    const size_t index = static_cast<size_t>(y) * m_sizeInTiles.x + x;
+                    if (index < tiles.size()) {
+                        addTile(x, y, tiles[index]);
+                    }
+                }
+            }
+        }
+
+        layer.chunks.reserve(builders.size());
+        for (auto& [key, builder] : builders) {
+            Chunk chunk;
+            chunk.bounds = builder.bounds;
+
+            for (auto& [tilesetIndex, vertices] : builder.vertices) {
+                ChunkMesh chunkMesh;
+                chunkMesh.tileset = tilesetIndex;
+                chunkMesh.quadCount = vertices.size() / 4;
+                chunkMesh.vertices = std::move(vertices);
+                chunk.meshes.push_back(std::move(chunkMesh));
+                meshCount++;
+            }
+
+            auto animatedIt = animated.find(key);
+            if (animatedIt != animated.end()) {
+                chunk.animatedTiles = std::move(animatedIt->second);
+                animatedCount += chunk.animatedTiles.size();
+            }
+            layer.chunks.push_back(std::move(chunk));
+        }
+
+        m_layers.push_back(std::move(layer));
+    }
+
+    m_parsed = true;
+    spdlog::debug("Parsed tilemap {} ({}x{} tiles, {} layers, {} chunk meshes, {} animated tiles, {} colliders)",
+                  path, m_sizeInTiles.x, m_sizeInTiles.y, m_layers.size(), meshCount, animatedCount, m_colliders.size());
+    return true;
+}
+
+bool Tilemap::Upload(bool asyncTextures) {
+    if (!m_parsed) {
+        return false;
+    }
+    if (m_loaded) {
+        return true;
+    }
+
+    utils::ResourceManager& resources = core::Engine::Resources();
+    for (Tileset& tileset : m_tilesets) {
+        if (tileset.imagePath.empty()) {
+            continue;
+        }
+        tileset.texture = asyncTextures ? resources.LoadTextureAsync(tileset.imagePath)
+                                        : resources.LoadTexture(tileset.imagePath);
+        if (!tileset.texture) {
+            spdlog::warn("Failed to load tileset image: {}", tileset.imagePath);
+        }
+    }
+
+    for (Layer& layer : m_layers) {
+        for (Chunk& chunk : layer.chunks) {
+            for (ChunkMesh& chunkMesh : chunk.meshes) {
+                auto mesh = std::make_shared<rendering::QuadMesh>();
+                if (mesh->Build(chunkMesh.vertices.data(), chunkMesh.vertices.size())) {
+                    chunkMesh.mesh = std::move(mesh);
+                }
+                // The GPU copy is all that's needed from here on
+                chunkMesh.vertices.clear();
+                chunkMesh.vertices.shrink_to_fit();
+            }
+        }
+    }
+
+    m_loaded = true;
+    return true;
+}
+
+size_t Tilemap::GetMeshMemoryUsage() const {
+    size_t quads = 0;
+    for (const Layer& layer : m_layers) {
+        for (const Chunk& chunk : layer.chunks) {
+            for (const ChunkMesh& chunkMesh : chunk.meshes) {
+                quads += chunkMesh.quadCount;
+            }
+        }
+    }
+    return quads * 4 * sizeof(rendering::MeshVertex);
+}
+
+const std::string& Tilemap::GetTilesetImagePath(size_t tilesetIndex) const {
+    static const std::string empty;
+    return tilesetIndex < m_tilesets.size() ? m_tilesets[tilesetIndex].imagePath : empty;
+}
+
+glm::ivec2 Tilemap::GetTilesetImageSize(size_t tilesetIndex) const {
+    return tilesetIndex < m_tilesets.size() ? glm::ivec2(m_tilesets[tilesetIndex].imageSize) : glm::ivec2(0);
+}
+
+int Tilemap::FindAnimation(uint32_t gid) const {
+    auto it = std::find(m_animationGids.begin(), m_animationGids.end(), gid);
+    if (it != m_animationGids.end()) {
+        return static_cast<int>(it - m_animationGids.begin());
+    }
+    return -1;
+}
+
+void Tilemap::Unload() {
+    m_layers.clear();
+    m_colliders.clear();
+    m_tilesets.clear();
+    m_animations.clear();
+    m_animationGids.clear();
+    m_animationTimeMs = 0.0f;
+    m_sizeInTiles = {0, 0};
+    m_tileSize = {0, 0};
+    m_origin = {0.0f, 0.0f};
+    m_parsed = false;
+    m_loaded = false;
+}
+
+void Tilemap::Update(float deltaTime) {
+    if (m_animations.empty()) {
+        return;
+    }
+
+    m_animationTimeMs += deltaTime * 1000.0f;
+    for (Animation& animation : m_animations) {
+        if (animation.durationMs <= 0.0f) {
+            continue;
+        }
+        const float time = std::fmod(m_animationTimeMs, animation.durationMs);
+        auto it = std::upper_bound(animation.frameEndsMs.begin(), animation.frameEndsMs.end(), time);
+        animation.currentFrame = std::min(static_cast<size_t>(it - animation.frameEndsMs.begin()),
+                                          animation.frameUVs.size() - 1);
+    }
+}
+
+void Tilemap::Draw(rendering::Renderer& renderer) const {
+    for (size_t i = 0; i < m_layers.size(); ++i) {
+        DrawLayer(renderer, i);
+    }
+}
+
+void Tilemap::DrawLayer(rendering::Renderer& renderer, size_t layerIndex) const {
+    if (layerIndex >= m_layers.size()) {
+        return;
+    }
+    const Layer& layer = m_layers[layerIndex];
+    if (!layer.visible || layer.opacity <= 0.0f) {
+        return;
+    }
+
+    // Static chunks first: one draw call per visible chunk and tileset
+    bool hasAnimatedTiles = false;
+    for (const Chunk& chunk : layer.chunks) {
+        if (!renderer.IsVisible(chunk.bounds)) {
+            continue;
+        }
+        for (const ChunkMesh& chunkMesh : chunk.meshes) {
+            renderer.DrawMesh(chunkMesh.mesh, m_tilesets[chunkMesh.tileset].texture);
+        }
+        hasAnimatedTiles = hasAnimatedTiles || !chunk.animatedTiles.empty();
+    }
+
+    if (!hasAnimatedTiles) {
+        return;
+    }
+
+    // Animated tiles of the visible chunks share one sprite batch per tileset
+    const glm::vec4 color(1.0f, 1.0f, 1.0f, layer.opacity);
+    for (const Chunk& chunk : layer.chunks) {
+        if (chunk.animatedTiles.empty() || !renderer.IsVisible(chunk.bounds)) {
+            continue;
+        }
+        for (const AnimatedTile& tile : chunk.animatedTiles) {
+            const Animation& animation = m_animations[tile.animation];
+            glm::vec2 texCoords[4];
+            GetTileTexCoords(animation.frameUVs[animation.currentFrame], tile.flipFlags, texCoords);
+            renderer.DrawQuad(m_tilesets[animation.tileset].texture, tile.corners, texCoords, color);
+        }
+    }
+}
+
+const std::string& Tilemap::GetLayerName(size_t layerIndex) const {
+    static const std::string empty;
+    return layerIndex < m_layers.size() ? m_layers[layerIndex].name : empty;
+}
+
+int Tilemap::FindLayer(const std::string& name) const {
+    for (size_t i = 0; i < m_layers.size(); ++i) {
+        if (m_layers[i].name == name) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+void Tilemap::SetLayerVisible(size_t layerIndex, bool visible) {
+    if (layerIndex < m_layers.size()) {
+        m_layers[layerIndex].visible = visible;
+    }
+}
+
+bool Tilemap::IsLayerVisible(size_t layerIndex) const {
+    return layerIndex < m_layers.size() && m_layers[layerIndex].visible;
+}
+
+int Tilemap::FindTileset(uint32_t gid) const {
+    // Tilesets are sorted by first GID; the owner is the last one starting at or before gid
+    for (int i = static_cast<int>(m_tilesets.size()) - 1; i >= 0; --i) {
+        if (gid >= m_tilesets[i].firstGid) {
+            return gid <= m_tilesets[i].lastGid ? i : -1;
+        }
+    }
+    return -1;
+}
+
+glm::vec4 Tilemap::GetTileUVRect(const Tileset& tileset, uint32_t gid) const {
+    if (tileset.columns <= 0 || tileset.imageSize.x <= 0.0f || tileset.imageSize.y <= 0.0f) {
+        return glm::vec4(0.0f, 0.0f, 1.0f, 1.0f);
+    }
+
+    const int localId = static_cast<int>(gid - tileset.firstGid);
+    const int column = localId % tileset.columns;
+    const int row = localId / tileset.columns;
+    const glm::vec2 pixel(static_cast<float>(tileset.margin + column * (tileset.tileSize.x + tileset.spacing)),
+                          static_cast<float>(tileset.margin + row * (tileset.tileSize.y + tileset.spacing)));
+    const glm::vec2 uv0 = pixel / tileset.imageSize;
+    const glm::vec2 uv1 = (pixel + glm::vec2(tileset.tileSize)) / tileset.imageSize;
+    return glm::vec4(uv0.x, uv0.y, uv1.x, uv1.y);
+}
+
+} // namespace tilemap
@@ -0,0 +1,284 @@
+#include "engine/public/utils/AssetArchive.h"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+namespace utils {
+
+namespace {
+
+constexpr char ARCHIVE_MAGIC[4] = {'P', 'A', 'K', '1'};
+constexpr uint32_t ARCHIVE_VERSION = 1;
+constexpr uint64_t DATA_ALIGNMENT = 16;
+constexpr size_t COPY_BUFFER_SIZE = 1 << 20;
+
+struct ArchiveHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t fileCount;
+    uint32_t pathsSize;
+    uint64_t fileSize;
+    uint64_t reserved;
+};
+static_assert(sizeof(ArchiveHeader) == 32, "Archive header layout");
+
+struct ArchiveEntry {
+    uint64_t hash;
+    uint64_t offset;
+    uint64_t size;
+    uint32_t pathOffset;  // Into the paths block
+    uint32_t pathLength;
+};
+static_assert(sizeof(ArchiveEntry) == 32, "Archive entry layout");
+
+uint64_t AlignUp(uint64_t value) {
+    return (value + DATA_ALIGNMENT - 1) & ~(DATA_ALIGNMENT - 1);
+}
+
+} // anonymous namespace
+
+std::string AssetArchive::NormalizePath(std::string_view path) {
+    std::string normalized(path);
+    std::replace(normalized.begin(), normalized.end(), '\\', '/');
+    while (normalized.rfind("./", 0) == 0) {
+        normalized.erase(0, 2);
+    }
+    return normalized;
+}
+
+uint64_t AssetArchive::HashPath(std::string_view normalizedPath) {
+    uint64_t hash = 14695981039346656037ull;
+    for (const char c : normalizedPath) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+bool AssetArchive::Open(const std::string& path) {
+    Close();
+
+    if (!m_file.Open(path)) {
+        return false;
+    }
+
+    const uint8_t* data = m_file.GetData();
+    const size_t size = m_file.GetSize();
+
+    ArchiveHeader header;
+    if (size < sizeof(header)) {
+        spdlog::error("Asset archive too small: {}", path);
+        Close();
+        return false;
+    }
+    std::memcpy(&header, data, sizeof(header));
+
+    if (std::memcmp(header.magic, ARCHIVE_MAGIC, sizeof(ARCHIVE_MAGIC)) != 0 || header.version != ARCHIVE_VERSION) {
+        spdlog::error("Not an asset archive (or an unsupported version): {}", path);
+        Close();
+        return false;
+    }
+
+    const uint64_t pathsOffset = sizeof(ArchiveHeader) + static_cast<uint64_t>(header.fileCount) * sizeof(ArchiveEntry);
+    if (header.fileSize != size || pathsOffset + header.pathsSize > size) {
+        spdlog::error("Asset archive is truncated or corrupt: {}", path);
+        Close();
+        return false;
+    }
+
+    const char* paths = reinterpret_cast<const char*>(data + pathsOffset);
+    m_entries.reserve(header.fileCount);
+    for (uint32_t i = 0; i < header.fileCount; ++i) {
+        ArchiveEntry entry;
+        std::memcpy(&entry, data + sizeof(ArchiveHeader) + static_cast<size_t>(i) * sizeof(ArchiveEntry), sizeof(entry));
+
+        if (static_cast<uint64_t>(entry.pathOffset) + entry.pathLength > header.pathsSize ||
+            entry.offset > size || entry.size > size - entry.offset) {
+            spdlog::error("Asset archive entry {} is out of range: {}", i, path);
+            Close();
+            return false;
+        }
+
+        m_entries.push_back({entry.hash, entry.offset, entry.size, std::string_view(paths + entry.pathOffset, entry.pathLength)});
+    }
+
+    if (!std::is_sorted(m_entries.begin(), m_entries.end(), [](const Entry& a, const Entry& b) { return a.hash < b.hash; })) {
+        spdlog::error("Asset archive table is not sorted: {}", path);
+        Close();
+        return false;
+    }
+
+    return true;
+}
+
+void AssetArchive::Close() {
+    m_entries.clear();
+    m_file.Close();
+}
+
+AssetView AssetArchive::Find(std::string_view path) const {
+    if (m_entries.empty()) return {};
+
+    const std::string normalized = NormalizePath(path);
+    const uint64_t hash = HashPath(normalized);
+
+    auto it = std::lower_bound(m_entries.begin(), m_entries.end(), hash,
+                               [](const Entry& entry, uint64_t value) { return entry.hash < value; });
+    for (; it != m_entries.end() && it->hash == hash; ++it) {
+        if (it->path == normalized) {
+            return {m_file.GetData() + it->offset, static_cast<size_t>(it->size)};
+        }
+    }
+    return {};
+}
+
+bool AssetArchive::Build(const std::string& directory, const std::string& outputPath,
+                         const std::vector<GeneratedFile>& generated) {
+    namespace fs = std::filesystem;
+
+    std::error_code ec;
+    const fs::path root = fs::path(directory).lexically_normal();
+    if (!fs::is_directory(root, ec)) {
+        spdlog::error("Asset directory not found: {}", directory);
+        return false;
+    }
+
+    // Stored paths start at the directory itself ("assets/...")
+    const fs::path top = (root.has_filename() ? root : root.parent_path()).filename();
+
+    struct Source {
+        fs::path file;
+        std::string path;
+        ArchiveEntry entry{};
+    };
+    std::vector<Source> sources;
+
+    for (fs::recursive_directory_iterator it(root, ec), end; it != end; it.increment(ec)) {
+        if (ec) break;
+        const std::string name = it->path().filename().string();
+        if (!name.empty() && name[0] == '.') {
+            if (it->is_directory(ec)) it.disable_recursion_pending();
+            continue;
+        }
+        if (!it->is_regular_file(ec)) continue;
+
+        Source source;
+        source.file = it->path();
+        source.path = NormalizePath((top / it->path().lexically_relative(root)).generic_string());
+        source.entry.hash = HashPath(source.path);
+        source.entry.size = it->file_size(ec);
+        sources.push_back(std::move(source));
+    }
+    if (ec) {
+        spdlog::error("Failed to scan asset directory '{}': {}", directory, ec.message());
+        return false;
+    }
+
+    for (const auto& file : generated) {
+        Source source;
+        source.file = file.file;
+        source.path = NormalizePath(file.path);
+        source.entry.hash = HashPath(source.path);
+        source.entry.size = fs::file_size(source.file, ec);
+        if (ec) {
+            spdlog::error("Generated asset '{}' not found: {}", file.file, ec.message());
+            return false;
+        }
+
+        sources.erase(std::remove_if(sources.begin(), sources.end(), [&source](const Source& existing) {
+            return existing.path == source.path;
+        }), sources.end());
+        sources.push_back(std::move(source));
+    }
+
+    std::sort(sources.begin(), sources.end(), [](const Source& a, const Source& b) {
+        return a.entry.hash != b.entry.hash ? a.entry.hash < b.entry.hash : a.path < b.path;
+    });
+
+    std::string paths;
+    for (auto& source : sources) {
+        source.entry.pathOffset = static_cast<uint32_t>(paths.size());
+        source.entry.pathLength = static_cast<uint32_t>(source.path.size());
+        paths += source.path;
+    }
+
+    uint64_t offset = AlignUp(sizeof(ArchiveHeader) + sources.size() * sizeof(ArchiveEntry) + paths.size());
+    for (auto& source : sources) {
+        source.entry.offset = offset;
+        offset = AlignUp(offset + source.entry.size);
+    }
+
+    ArchiveHeader header{};
+    std::memcpy(header.magic, ARCHIVE_MAGIC, sizeof(ARCHIVE_MAGIC));
+    header.version = ARCHIVE_VERSION;
+    header.fileCount = static_cast<uint32_t>(sources.size());
+    header.pathsSize = static_cast<uint32_t>(paths.size());
+    header.fileSize = offset;
+
+    const std::string tempPath = outputPath + ".tmp";
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            spdlog::error("Failed to open file for writing: {}", tempPath);
+            return false;
+        }
+
+        static const char padding[DATA_ALIGNMENT] = {};
+        auto padTo = [&file](uint64_t position) {
+            const uint64_t current = static_cast<uint64_t>(file.tellp());
+            if (position > current) {
+                file.write(padding, static_cast<std::streamsize>(position - current));
+            }
+        };
+
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        for (const auto& source : sources) {
+            file.write(reinterpret_cast<const char*>(&source.entry), sizeof(source.entry));
+        }
+        file.write(paths.data(), static_cast<std::streamsize>(paths.size()));
+
+        std::vector<char> buffer(COPY_BUFFER_SIZE);
+        bool copied = true;
+        for (const auto& source : sources) {
+            padTo(source.entry.offset);
+
+            std::ifstream input(source.file, std::ios::binary);
+            uint64_t remaining = source.entry.size;
+            while (input && remaining > 0) {
+                const auto chunk = static_cast<std::streamsize>(std::min<uint64_t>(remaining, buffer.size()));
+                input.read(buffer.data(), chunk);
+                file.write(buffer.data(), input.gcount());
+                remaining -= static_cast<uint64_t>(input.gcount());
+            }
+            if (remaining > 0) {
+                spdlog::error("Failed to read asset: {}", source.file.string());
+                copied = false;
+                break;
+            }
+        }
+        padTo(header.fileSize);
+
+        file.flush();
+        if (!copied || !file) {
+            spdlog::error("Failed to write asset archive: {}", tempPath);
+            file.close();
+            fs::remove(tempPath, ec);
+            return false;
+        }
+    }
+
+    fs::rename(tempPath, outputPath, ec);
+    if (ec) {
+        spdlog::error("Failed to replace asset archive '{}': {}", outputPath, ec.message());
+        fs::remove(tempPath, ec);
+        return false;
+    }
+
+    spdlog::info("Packed {} files ({:.1f} MB) into {}", sources.size(),
+                 static_cast<double>(header.fileSize) / (1024.0 * 1024.0), outputPath);
+    return true;
+}
+
+} // namespace utils
@@ -0,0 +1,91 @@
+#include "engine/public/utils/Assets.h"
+#include <SDL.h>
+#include <spdlog/spdlog.h>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <memory>
+
+namespace utils {
+
+namespace {
+
+std::unique_ptr<AssetArchive> s_archive;
+
+template<typename Container>
+bool ReadAssetInto(const std::string& path, Container& out) {
+    if (AssetView view = FindPackedAsset(path)) {
+        out.assign(reinterpret_cast<const typename Container::value_type*>(view.data),
+                   reinterpret_cast<const typename Container::value_type*>(view.data + view.size));
+        return true;
+    }
+
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        return false;
+    }
+    const std::streamsize size = file.tellg();
+    if (size < 0) {
+        return false;
+    }
+    out.resize(static_cast<size_t>(size));
+    file.seekg(0);
+    return static_cast<bool>(file.read(reinterpret_cast<char*>(out.data()), size));
+}
+
+} // anonymous namespace
+
+bool MountAssetArchive(const std::string& path) {
+    auto archive = std::make_unique<AssetArchive>();
+    if (!archive->Open(path)) {
+        return false;
+    }
+
+    spdlog::info("Mounted asset archive '{}' ({} files)", path, archive->GetFileCount());
+    s_archive = std::move(archive);
+    return true;
+}
+
+void UnmountAssetArchive() {
+    if (s_archive) {
+        spdlog::info("Unmounted asset archive '{}'", s_archive->GetPath());
+        s_archive.reset();
+    }
+}
+
+bool IsAssetArchiveMounted() {
+    return s_archive != nullptr;
+}
+
+bool AssetExists(const std::string& path) {
+    if (s_archive && s_archive->Contains(path)) {
+        return true;
+    }
+    std::error_code ec;
+    return std::filesystem::is_regular_file(path, ec);
+}
+
+SDL_RWops* OpenAsset(const std::string& path) {
+    if (AssetView view = FindPackedAsset(path)) {
+        if (view.size > static_cast<size_t>(std::numeric_limits<int>::max())) {
+            SDL_SetError("Packed asset too large for SDL_RWFromConstMem: %s", path.c_str());
+            return nullptr;
+        }
+        return SDL_RWFromConstMem(view.data, static_cast<int>(view.size));
+    }
+    return SDL_RWFromFile(path.c_str(), "rb");
+}
+
+AssetView FindPackedAsset(const std::string& path) {
+    return s_archive ? s_archive->Find(path) : AssetView{};
+}
+
+bool ReadAsset(const std::string& path, std::vector<uint8_t>& bytes) {
+    return ReadAssetInto(path, bytes);
+}
+
+bool ReadAssetText(const std::string& path, std::string& text) {
+    return ReadAssetInto(path, text);
+}
+
+} // namespace utils
@@ -1,11 +1,40 @@
 #include "engine/public/utils/Config.h"
+#include <algorithm>
 #include <fstream>
 #include <spdlog/spdlog.h>
+#include <string_view>
 
 namespace utils {
 
+namespace {
+
+// Next non-empty segment of a dotted path, empty once there are none left
+std::string_view NextPathPart(std::string_view path, size_t& position) {
+    while (position < path.size()) {
+        size_t end = path.find('.', position);
+        if (end == std::string_view::npos) {
+            end = path.size();
+        }
+        const std::string_view part = path.substr(position, end - position);
+        position = end + 1;
+        if (!part.empty()) {
+            return part;
+        }
+    }
+    return {};
+}
+
+// Lookups need the key as a std::string - reuse one per thread instead of building a vector of parts
+std::string& PathKeyBuffer() {
+    thread_local std::string key;
+    return key;
+}
+
+} // namespace
+
 // Static member definition
 std::shared_ptr<Config> Config::s_instance = nullptr;
+std::atomic<uint64_t> Config::s_generation{1};
 
 std::shared_ptr<Config> Config::Instance() {
     if (!s_instance) {
@@ -40,6 +69,7 @@ bool Config::Load(const std::string& filename) {
         
         spdlog::info("Config loaded successfully from: {}", filename);
         m_hasUnsavedChanges = false;
+        NotifyChanged("");
         return true;
         
     } catch (const std::exception& e) {
@@ -50,6 +80,61 @@ bool Config::Load(const std::string& filename) {
     }
 }
 
+size_t Config::Reload() {
+    if (m_configPath.empty()) {
+        return 0;
+    }
+    
+    nlohmann::json updated;
+    try {
+        std::ifstream file(m_configPath);
+        if (!file.is_open()) {
+            return 0;
+        }
+        file >> updated;
+    } catch (const std::exception& e) {
+        // Usually caught mid-save by an editor - the next write reloads it
+        spdlog::warn("Config file '{}' not reloaded: {}", m_configPath, e.what());
+        return 0;
+    }
+    
+    // Changed keys as dot paths; a change inside an array reports the array
+    std::vector<std::string> changed;
+    for (const auto& operation : nlohmann::json::diff(m_config, updated)) {
+        const std::string pointer = operation["path"].get<std::string>();
+        std::string path;
+        const nlohmann::json* node = &updated;
+        for (size_t begin = 1; begin <= pointer.size();) {
+            size_t end = pointer.find('/', begin);
+            if (end == std::string::npos) end = pointer.size();
+            std::string token = pointer.substr(begin, end - begin);
+            for (size_t i = 0; (i = token.find('~', i)) != std::string::npos; ++i) {
+                token.replace(i, 2, token.compare(i, 2, "~1") == 0 ? "/" : "~");
+            }
+            
+            if (node && node->is_array()) break;
+            path += (path.empty() ? "" : ".") + token;
+            node = node && node->is_object() && node->contains(token) ? &(*node)[token] : nullptr;
+            begin = end + 1;
+        }
+        if (std::find(changed.begin(), changed.end(), path) == changed.end()) {
+            changed.push_back(path);
+        }
+    }
+    if (changed.empty()) {
+        return 0;
+    }
+    
+    m_config = std::move(updated);
+    m_hasUnsavedChanges = false;
+    spdlog::info("Config reloaded from '{}' ({} changed keys)", m_configPath, changed.size());
+    for (const auto& path : changed) {
+        spdlog::debug("Config key changed: {}", path.empty() ? "<root>" : path);
+        NotifyChanged(path);
+    }
+    return changed.size();
+}
+
 bool Config::Save(const std::string& filename) {
     std::string saveFile = filename.empty() ? m_configPath : filename;
     
@@ -83,6 +168,7 @@ void Config::LoadDefaults() {
     CreateDefaultConfig();
     m_hasUnsavedChanges = true;
     spdlog::info("Default configuration loaded");
+    NotifyChanged("");
 }
 
 int Config::GetInt(const std::string& path, int defaultValue) const {
@@ -122,6 +208,7 @@ void Config::SetInt(const std::string& path, int value) {
     if (configValue) {
         *configValue = value;
         m_hasUnsavedChanges = true;
+        NotifyChanged(path);
     }
 }
 
@@ -130,6 +217,7 @@ void Config::SetFloat(const std::string& path, float value) {
     if (configValue) {
         *configValue = value;
         m_hasUnsavedChanges = true;
+        NotifyChanged(path);
     }
 }
 
@@ -138,6 +226,7 @@ void Config::SetBool(const std::string& path, bool value) {
     if (configValue) {
         *configValue = value;
         m_hasUnsavedChanges = true;
+        NotifyChanged(path);
     }
 }
 
@@ -146,6 +235,7 @@ void Config::SetString(const std::string& path, const std::string& value) {
     if (configValue) {
         *configValue = value;
         m_hasUnsavedChanges = true;
+        NotifyChanged(path);
     }
 }
 
@@ -162,6 +252,7 @@ void Config::SetSection(const std::string& path, const nlohmann::json& section)
     if (configValue) {
         *configValue = section;
         m_hasUnsavedChanges = true;
+        NotifyChanged(path);
     }
 }
 
@@ -174,86 +265,118 @@ void Config::Reset() {
     LoadDefaults();
 }
 
+ConfigSubscription Config::Subscribe(const std::string& path, ConfigCallback callback) {
+    const ConfigSubscription id = m_nextSubscription++;
+    m_subscribers.push_back({id, path, std::move(callback)});
+    return id;
+}
+
+void Config::Unsubscribe(ConfigSubscription subscription) {
+    m_subscribers.erase(std::remove_if(m_subscribers.begin(), m_subscribers.end(),
+                                       [subscription](const Subscriber& subscriber) { return subscriber.id == subscription; }),
+                        m_subscribers.end());
+}
+
+void Config::NotifyChanged(const std::string& path) {
+    s_generation.fetch_add(1, std::memory_order_relaxed);
+    
+    if (m_subscribers.empty()) {
+        return;
+    }
+    
+    // Same branch: one path is the other, or a parent of it at a '.' boundary
+    auto onBranch = [](const std::string& a, const std::string& b) {
+        if (a.empty() || b.empty()) return true;
+        const std::string& shorter = a.size() <= b.size() ? a : b;
+        const std::string& longer = a.size() <= b.size() ? b : a;
+        return longer.compare(0, shorter.size(), shorter) == 0 &&
+               (longer.size() == shorter.size() || longer[shorter.size()] == '.');
+    };
+    
+    // Copy first - callbacks may subscribe, unsubscribe or set other values
+    std::vector<ConfigCallback> callbacks;
+    for (const auto& subscriber : m_subscribers) {
+        if (onBranch(subscriber.path, path)) {
+            callbacks.push_back(subscriber.callback);
+        }
+    }
+    for (const auto& callback : callbacks) {
+        callback(path);
+    }
+}
+
 void Config::Shutdown() {
     if (!m_configPath.empty()) {
         Save(m_configPath);
     }
-    // Reset the singleton instance
+    m_subscribers.clear();
+    
+    // Reset the singleton instance (keys must not keep values from this one)
     s_instance.reset();
+    s_generation.fetch_add(1, std::memory_order_relaxed);
 }
 
 nlohmann::json* Config::GetValuePointer(const std::string& path, bool createPath) {
-    auto pathParts = SplitPath(path);
+    std::string& key = PathKeyBuffer();
     nlohmann::json* current = &m_config;
     
-    for (size_t i = 0; i < pathParts.size(); ++i) {
-        const auto& part = pathParts[i];
+    size_t position = 0;
+    std::string_view part = NextPathPart(path, position);
+    while (!part.empty()) {
+        const std::string_view next = NextPathPart(path, position);
+        key.assign(part);
         
-        if (i == pathParts.size() - 1) {
+        if (next.empty()) {
             // Last part - this is our target
-            if (createPath || current->contains(part)) {
-                return &(*current)[part];
+            if (createPath || current->contains(key)) {
+                return &(*current)[key];
             }
             return nullptr;
-        } else {
-            // Intermediate part - navigate or create
-            if (!current->contains(part)) {
-                if (createPath) {
-                    (*current)[part] = nlohmann::json::object();
-                } else {
-                    return nullptr;
-                }
+        }
+        
+        // Intermediate part - navigate or create
+        if (!current->contains(key)) {
+            if (createPath) {
+                (*current)[key] = nlohmann::json::object();
+            } else {
+                return nullptr;
             }
-            
-            if (!(*current)[part].is_object()) {
-                if (createPath) {
-                    (*current)[part] = nlohmann::json::object();
-                } else {
-                    return nullptr;
-                }
+        }
+        
+        if (!(*current)[key].is_object()) {
+            if (createPath) {
+                (*current)[key] = nlohmann::json::object();
+            } else {
+                return nullptr;
             }
-            
-            current = &(*current)[part];
         }
+        
+        current = &(*current)[key];
+        part = next;
     }
     
     return current;
 }
 
 const nlohmann::json* Config::GetValuePointer(const std::string& path) const {
-    auto pathParts = SplitPath(path);
+    std::string& key = PathKeyBuffer();
     const nlohmann::json* current = &m_config;
     
-    for (const auto& part : pathParts) {
-        if (!current->contains(part)) {
+    size_t position = 0;
+    for (std::string_view part = NextPathPart(path, position); !part.empty(); part = NextPathPart(path, position)) {
+        // One lookup per level (contains + operator[] searched twice)
+        if (!current->is_object()) {
             return nullptr;
         }
-        current = &(*current)[part];
-    }
-    
-    return current;
-}
-
-std::vector<std::string> Config::SplitPath(const std::string& path) const {
-    std::vector<std::string> parts;
-    std::string current;
-    
-    for (char c : path) {
-        if (c == '.') {
-            if (!current.empty()) {
-                parts.push_back(current);
-                current.clear();
-            }
-        } else {
-            current += c;
+        key.assign(part);
+        auto it = current->find(key);
+        if (it == current->end()) {
+            return nullptr;
         }
+        current = &*it;
     }
     
-    if (!current.empty()) {
-        parts.push_back(current);
-    }
-    
-    return parts;
+    return current;
 }
 
 void Config::CreateDefaultConfig() {
@@ -262,6 +385,7 @@ void Config::CreateDefaultConfig() {
             {"width", 1280},
             {"height", 720},
             {"fullscreen", false},
+            {"background_color", nlohmann::json::array({0.15f, 0.15f, 0.15f, 1.0f})},
             {"vsync", true},
             {"title", "SDL2 Game"}
         }},
@@ -269,13 +393,68 @@ void Config::CreateDefaultConfig() {
             {"renderer", "opengl"},
             {"antialiasing", true},
             {"texture_filtering", "linear"},
-            {"shadow_quality", "medium"}
+            {"generate_mipmaps", false},
+            {"shadow_quality", "medium"},
+            {"render_thread", false},
+            {"frames_in_flight", 2},
+            {"culling", true},
+            {"static_grid_cell_size", 256.0f}
         }},
         {"audio", {
             {"master_volume", 1.0f},
             {"music_volume", 0.8f},
             {"sfx_volume", 1.0f},
-            {"muted", false}
+            {"ambient_volume", 0.8f},
+            {"muted", false},
+            {"voices", 32},
+            {"voice_limits", {
+                {"sfx", 24},
+                {"music", 4},
+                {"ambient", 8}
+            }},
+            {"min_distance", 100.0f},
+            {"max_distance", 1000.0f},
+            {"cull_volume", 0.01f},
+            {"sample_rate", 44100},
+            {"buffer_size", 1024},
+            {"mixer", {
+                {"enabled", true},
+                {"limiter_ceiling", 0.98f},
+                {"ducking", {
+                    {"enabled", false},
+                    {"amount", 0.5f},
+                    {"threshold", 0.1f},
+                    {"attack_ms", 10.0f},
+                    {"release_ms", 300.0f}
+                }}
+            }}
+        }},
+        {"text", {
+            {"default_font", "arial.ttf"},
+            {"default_size", 16},
+            {"render_quality", "high"},
+            {"cache_size_mb", 64},
+            {"antialiasing", true},
+            {"default_color", nlohmann::json::array({1.0f, 1.0f, 1.0f, 1.0f})},
+            {"kerning", {
+                {"enabled", true},
+                {"adjustment", 0.0f}
+            }},
+            {"outline", {
+                {"enabled", false},
+                {"thickness", 1},
+                {"color", nlohmann::json::array({0.0f, 0.0f, 0.0f, 1.0f})}
+            }},
+            {"shadow", {
+                {"enabled", false},
+                {"offset", nlohmann::json::array({2, 2})},
+                {"color", nlohmann::json::array({0.0f, 0.0f, 0.0f, 0.5f})}
+            }},
+            {"glyph_atlas", {
+                {"page_size", 512}
+            }},
+            {"hinting", "normal"},
+            {"subpixel_rendering", false}
         }},
         {"input", {
             {"mouse_sensitivity", 1.0f},
@@ -294,7 +473,56 @@ void Config::CreateDefaultConfig() {
             {"difficulty", "normal"},
             {"auto_save", true},
             {"show_fps", false},
-            {"language", "en"}
+            {"language", "en"},
+            {"loop_mode", "auto"},
+            {"target_fps", 60.0f},
+            {"spin_threshold_ms", 2.0f},
+            {"max_delta_time", 0.05f}
+        }},
+        {"physics", {
+            {"fixed_timestep", 1.0f / 60.0f},
+            {"max_fixed_steps", 5},
+            {"worker_count", 0},
+            {"substep_count", 4},
+            {"debug_draw", false},
+            {"interpolation", true}
+        }},
+        {"jobs", {
+            {"worker_threads", 0},
+            {"parallel_init", true}
+        }},
+        {"memory", {
+            {"frame_arena_kb", 1024}
+        }},
+        {"particles", {
+            {"job_batch_size", 4096}
+        }},
+        {"resources", {
+            {"max_pending_uploads", 32},
+            {"upload_budget_ms", 2.0},
+            {"texture_budget_mb", 512},
+            {"archive", "assets.pak"}
+        }},
+        {"hot_reload", {
+            {"enabled", true},
+            {"debounce_ms", 100}
+        }},
+        {"save", {
+            {"format", "json"},
+            {"compression", false},
+            {"max_deltas", 16}
+        }},
+        {"streaming", {
+            {"load_radius", 512.0},
+            {"unload_radius", 1024.0},
+            {"max_concurrent_loads", 2},
+            {"max_activations_per_frame", 1},
+            {"texture_budget_mb", 256},
+            {"mesh_budget_mb", 64},
+            {"collider_budget", 20000}
+        }},
+        {"debug", {
+            {"profiler_overlay", false}
         }}
     };
 }
@@ -0,0 +1,345 @@
+#include "engine/public/utils/FileWatcher.h"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <filesystem>
+#include <utility>
+
+#if defined(_WIN32)
+#include <windows.h>
+#elif defined(__APPLE__)
+#include <CoreServices/CoreServices.h>
+#include <dispatch/dispatch.h>
+#include <climits>
+#include <cstdlib>
+#elif defined(__linux__)
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#endif
+
+namespace utils {
+
+FileWatcher::~FileWatcher() {
+    Stop();
+}
+
+std::vector<std::string> FileWatcher::TakeChanges() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return std::exchange(m_changes, {});
+}
+
+void FileWatcher::PushChange(const std::string& path) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (std::find(m_changes.begin(), m_changes.end(), path) == m_changes.end()) {
+        m_changes.push_back(path);
+    }
+}
+
+#if defined(_WIN32)
+
+bool FileWatcher::Start(const std::string& directory) {
+    Stop();
+
+    HANDLE handle = CreateFileA(directory.c_str(), FILE_LIST_DIRECTORY, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                                nullptr, OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, nullptr);
+    if (handle == INVALID_HANDLE_VALUE) {
+        spdlog::error("Failed to watch directory: {} (error {})", directory, GetLastError());
+        return false;
+    }
+
+    m_directory = std::filesystem::path(directory).lexically_normal().generic_string();
+    m_directoryHandle = handle;
+    m_stopEvent = CreateEventA(nullptr, TRUE, FALSE, nullptr);
+    m_running = true;
+    m_thread = std::thread(&FileWatcher::Run, this);
+    return true;
+}
+
+void FileWatcher::Stop() {
+    if (!m_running) {
+        return;
+    }
+
+    SetEvent(static_cast<HANDLE>(m_stopEvent));
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+    CloseHandle(static_cast<HANDLE>(m_stopEvent));
+    CloseHandle(static_cast<HANDLE>(m_directoryHandle));
+    m_stopEvent = nullptr;
+    m_directoryHandle = nullptr;
+    m_running = false;
+}
+
+void FileWatcher::Run() {
+    HANDLE directory = static_cast<HANDLE>(m_directoryHandle);
+    OVERLAPPED overlapped = {};
+    overlapped.hEvent = CreateEventA(nullptr, FALSE, FALSE, nullptr);
+    alignas(DWORD) char buffer[64 * 1024];
+
+    while (true) {
+        if (!ReadDirectoryChangesW(directory, buffer, sizeof(buffer), TRUE,
+                                   FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_SIZE,
+                                   nullptr, &overlapped, nullptr)) {
+            spdlog::error("Watching {} failed (error {})", m_directory, GetLastError());
+            break;
+        }
+
+        HANDLE handles[2] = {overlapped.hEvent, static_cast<HANDLE>(m_stopEvent)};
+        if (WaitForMultipleObjects(2, handles, FALSE, INFINITE) != WAIT_OBJECT_0) {
+            CancelIo(directory);
+            GetOverlappedResult(directory, &overlapped, nullptr, TRUE);
+            break;
+        }
+
+        DWORD bytes = 0;
+        if (!GetOverlappedResult(directory, &overlapped, &bytes, FALSE) || bytes == 0) {
+            spdlog::warn("File watcher buffer overflowed - some changes under {} were missed", m_directory);
+            continue;
+        }
+
+        for (const char* entry = buffer;;) {
+            const auto* info = reinterpret_cast<const FILE_NOTIFY_INFORMATION*>(entry);
+            if (info->Action == FILE_ACTION_ADDED || info->Action == FILE_ACTION_MODIFIED ||
+                info->Action == FILE_ACTION_RENAMED_NEW_NAME) {
+                const std::wstring name(info->FileName, info->FileNameLength / sizeof(WCHAR));
+                const std::filesystem::path path = std::filesystem::path(m_directory) / name;
+                std::error_code error;
+                if (!std::filesystem::is_directory(path, error)) {
+                    PushChange(path.lexically_normal().generic_string());
+                }
+            }
+            if (info->NextEntryOffset == 0) {
+                break;
+            }
+            entry += info->NextEntryOffset;
+        }
+    }
+
+    CloseHandle(overlapped.hEvent);
+}
+
+#elif defined(__APPLE__)
+
+bool FileWatcher::Start(const std::string& directory) {
+    Stop();
+
+    char resolved[PATH_MAX];
+    if (!realpath(directory.c_str(), resolved)) {
+        spdlog::error("Failed to watch directory: {} (not found)", directory);
+        return false;
+    }
+    m_directory = std::filesystem::path(directory).lexically_normal().generic_string();
+    m_resolvedRoot = resolved;
+
+    CFStringRef path = CFStringCreateWithCString(nullptr, resolved, kCFStringEncodingUTF8);
+    CFArrayRef paths = CFArrayCreate(nullptr, reinterpret_cast<const void**>(&path), 1, &kCFTypeArrayCallBacks);
+    FSEventStreamContext context = {0, this, nullptr, nullptr, nullptr};
+    FSEventStreamRef stream = FSEventStreamCreate(nullptr, &FileWatcher::OnEvents, &context, paths, kFSEventStreamEventIdSinceNow,
+                                                  0.05, kFSEventStreamCreateFlagFileEvents | kFSEventStreamCreateFlagNoDefer);
+    CFRelease(paths);
+    CFRelease(path);
+    if (!stream) {
+        spdlog::error("Failed to create an FSEvents stream for {}", directory);
+        return false;
+    }
+
+    dispatch_queue_t queue = dispatch_queue_create("engine.file_watcher", DISPATCH_QUEUE_SERIAL);
+    FSEventStreamSetDispatchQueue(stream, queue);
+    if (!FSEventStreamStart(stream)) {
+        spdlog::error("Failed to start the FSEvents stream for {}", directory);
+        FSEventStreamInvalidate(stream);
+        FSEventStreamRelease(stream);
+        dispatch_release(queue);
+        return false;
+    }
+
+    m_stream = stream;
+    m_queue = queue;
+    m_running = true;
+    return true;
+}
+
+void FileWatcher::Stop() {
+    if (!m_running) {
+        return;
+    }
+
+    // Stop + invalidate wait for a callback in progress, so none runs after this
+    FSEventStreamRef stream = static_cast<FSEventStreamRef>(m_stream);
+    FSEventStreamStop(stream);
+    FSEventStreamInvalidate(stream);
+    FSEventStreamRelease(stream);
+    dispatch_release(static_cast<dispatch_queue_t>(m_queue));
+    m_stream = nullptr;
+    m_queue = nullptr;
+    m_running = false;
+}
+
+void FileWatcher::Run() {
+    // Events arrive on the dispatch queue instead
+}
+
+void FileWatcher::OnEvents(const struct __FSEventStream*, void* context, size_t count, void* paths,
+                           const uint32_t* flags, const uint64_t*) {
+    auto* watcher = static_cast<FileWatcher*>(context);
+    char** eventPaths = static_cast<char**>(paths);
+
+    for (size_t i = 0; i < count; ++i) {
+        const bool file = (flags[i] & kFSEventStreamEventFlagItemIsFile) != 0;
+        const bool written = (flags[i] & (kFSEventStreamEventFlagItemModified | kFSEventStreamEventFlagItemCreated |
+                                          kFSEventStreamEventFlagItemRenamed)) != 0;
+        if (!file || !written) {
+            continue;
+        }
+
+        // Back to the watched directory's own name (the stream reports real paths)
+        const std::filesystem::path relative = std::filesystem::path(eventPaths[i]).lexically_relative(watcher->m_resolvedRoot);
+        if (!relative.empty() && *relative.begin() != "..") {
+            watcher->PushChange((std::filesystem::path(watcher->m_directory) / relative).lexically_normal().generic_string());
+        }
+    }
+}
+
+#elif defined(__linux__)
+
+bool FileWatcher::Start(const std::string& directory) {
+    Stop();
+
+    std::error_code error;
+    if (!std::filesystem::is_directory(directory, error)) {
+        spdlog::error("Failed to watch directory: {} (not found)", directory);
+        return false;
+    }
+
+    m_inotify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    m_wakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (m_inotify < 0 || m_wakeFd < 0) {
+        spdlog::error("Failed to initialize inotify: {}", std::strerror(errno));
+        if (m_inotify >= 0) close(m_inotify);
+        if (m_wakeFd >= 0) close(m_wakeFd);
+        m_inotify = m_wakeFd = -1;
+        return false;
+    }
+
+    m_directory = std::filesystem::path(directory).lexically_normal().generic_string();
+    AddWatches(m_directory);
+    m_running = true;
+    m_thread = std::thread(&FileWatcher::Run, this);
+    return true;
+}
+
+void FileWatcher::Stop() {
+    if (!m_running) {
+        return;
+    }
+
+    const uint64_t wake = 1;
+    if (write(m_wakeFd, &wake, sizeof(wake)) < 0) {
+        spdlog::warn("Failed to wake the file watcher thread: {}", std::strerror(errno));
+    }
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+
+    close(m_inotify);
+    close(m_wakeFd);
+    m_inotify = m_wakeFd = -1;
+    m_watches.clear();
+    m_running = false;
+}
+
+void FileWatcher::AddWatches(const std::string& directory) {
+    constexpr uint32_t MASK = IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE | IN_ONLYDIR;
+
+    auto addWatch = [this](const std::string& path) {
+        const int watch = inotify_add_watch(m_inotify, path.c_str(), MASK);
+        if (watch < 0) {
+            spdlog::warn("Cannot watch {}: {}", path, std::strerror(errno));
+            return;
+        }
+        m_watches[watch] = path;
+    };
+
+    addWatch(directory);
+    std::error_code error;
+    for (auto it = std::filesystem::recursive_directory_iterator(directory, error);
+         !error && it != std::filesystem::recursive_directory_iterator(); it.increment(error)) {
+        if (it->is_directory(error)) {
+            addWatch(it->path().lexically_normal().generic_string());
+        }
+    }
+}
+
+void FileWatcher::Run() {
+    alignas(inotify_event) char buffer[16 * 1024];
+    pollfd fds[2] = {{m_inotify, POLLIN, 0}, {m_wakeFd, POLLIN, 0}};
+
+    while (true) {
+        if (poll(fds, 2, -1) < 0) {
+            if (errno == EINTR) continue;
+            spdlog::error("File watcher poll failed: {}", std::strerror(errno));
+            break;
+        }
+        if (fds[1].revents & POLLIN) {
+            break;
+        }
+
+        const ssize_t length = read(m_inotify, buffer, sizeof(buffer));
+        if (length <= 0) {
+            continue;
+        }
+
+        for (ssize_t offset = 0; offset < length;) {
+            const auto* event = reinterpret_cast<const inotify_event*>(buffer + offset);
+            offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+
+            if (event->mask & IN_Q_OVERFLOW) {
+                spdlog::warn("File watcher queue overflowed - some changes under {} were missed", m_directory);
+                continue;
+            }
+
+            auto watch = m_watches.find(event->wd);
+            if (watch == m_watches.end() || event->len == 0) {
+                continue;
+            }
+            const std::string path = watch->second + "/" + event->name;
+
+            if (event->mask & IN_ISDIR) {
+                // New (or moved in) directory: watch it too, and report what was already written into it
+                if (event->mask & (IN_CREATE | IN_MOVED_TO)) {
+                    AddWatches(path);
+                    std::error_code error;
+                    for (auto it = std::filesystem::recursive_directory_iterator(path, error);
+                         !error && it != std::filesystem::recursive_directory_iterator(); it.increment(error)) {
+                        if (it->is_regular_file(error)) {
+                            PushChange(it->path().lexically_normal().generic_string());
+                        }
+                    }
+                }
+            } else if (event->mask & (IN_CLOSE_WRITE | IN_MOVED_TO)) {
+                PushChange(path);
+            }
+        }
+    }
+}
+
+#else
+
+bool FileWatcher::Start(const std::string& directory) {
+    spdlog::warn("File watching is not supported on this platform ({} is not watched)", directory);
+    return false;
+}
+
+void FileWatcher::Stop() {
+}
+
+void FileWatcher::Run() {
+}
+
+#endif
+
+} // namespace utils
@@ -0,0 +1,146 @@
+#include "engine/public/utils/HotReloader.h"
+#include "engine/public/audio/AudioManager.h"
+#include "engine/public/core/Engine.h"
+#include "engine/public/text/FontManager.h"
+#include "engine/public/text/TextRenderer.h"
+#include "engine/public/utils/Assets.h"
+#include "engine/public/utils/Config.h"
+#include "engine/public/utils/ResourceManager.h"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <cctype>
+#include <filesystem>
+
+namespace utils {
+
+namespace {
+
+bool HasExtension(const std::string& path, std::initializer_list<const char*> extensions) {
+    std::string extension = std::filesystem::path(path).extension().string();
+    std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char c) { return std::tolower(c); });
+    return std::any_of(extensions.begin(), extensions.end(), [&extension](const char* candidate) { return extension == candidate; });
+}
+
+} // anonymous namespace
+
+HotReloader::~HotReloader() {
+    Shutdown();
+}
+
+bool HotReloader::Initialize(bool watch) {
+    if (m_initialized) {
+        return true;
+    }
+
+    auto& config = core::Engine::Config();
+    m_debounce = std::chrono::milliseconds(std::max(config.GetInt("hot_reload.debounce_ms", 100), 0));
+    m_initialized = true;
+
+#ifndef ENGINE_HOT_RELOAD_ENABLED
+    // Release builds ship without it, whatever settings.json says
+    watch = false;
+#endif
+    if (!watch || !config.GetBool("hot_reload.enabled", true)) {
+        spdlog::info("Hot reload disabled");
+        return true;
+    }
+    if (IsAssetArchiveMounted()) {
+        spdlog::info("Hot reload off - assets come from the mounted archive");
+        return true;
+    }
+
+    if (m_watcher.Start("assets")) {
+        spdlog::info("Hot reload watching '{}' ({} ms settle time)", m_watcher.GetDirectory(), m_debounce.count());
+    } else {
+        spdlog::warn("Hot reload unavailable - asset changes need a restart");
+    }
+    return true;
+}
+
+void HotReloader::Shutdown() {
+    if (!m_initialized) {
+        return;
+    }
+
+    m_watcher.Stop();
+    m_pending.clear();
+    m_subscribers.clear();
+    m_initialized = false;
+}
+
+void HotReloader::Update() {
+    if (!m_watcher.IsRunning()) {
+        return;
+    }
+
+    const Clock::time_point now = Clock::now();
+    for (std::string& path : m_watcher.TakeChanges()) {
+        m_pending[std::move(path)] = now;
+    }
+    if (m_pending.empty()) {
+        return;
+    }
+
+    // Handle files that have been quiet long enough, in a stable order
+    std::vector<std::string> ready;
+    for (auto it = m_pending.begin(); it != m_pending.end();) {
+        if (now - it->second >= m_debounce) {
+            ready.push_back(it->first);
+            it = m_pending.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    std::sort(ready.begin(), ready.end());
+
+    for (const std::string& path : ready) {
+        Reload(path);
+    }
+}
+
+void HotReloader::Reload(const std::string& path) {
+    auto& config = core::Engine::Config();
+    const std::string configPath = std::filesystem::path(config.GetConfigPath()).lexically_normal().generic_string();
+
+    if (!configPath.empty() && path == configPath) {
+        config.Reload();
+    } else if (HasExtension(path, {".png", ".jpg", ".jpeg", ".bmp", ".tga", ".gif", ".dds", ".ktx2"})) {
+        core::Engine::Resources().ReloadTexture(path);
+    } else if (HasExtension(path, {".ttf", ".otf", ".ttc"})) {
+        auto& textRenderer = core::Engine::TextRenderer();
+        for (const std::string& fontName : core::Engine::Fonts().ReloadFontFile(path)) {
+            textRenderer.ClearCacheForFont(fontName);
+        }
+    } else if (HasExtension(path, {".wav", ".ogg", ".mp3", ".flac"})) {
+        core::Engine::Audio().ReloadSoundFile(path);
+    }
+
+    // Copy first - callbacks may subscribe or unsubscribe
+    std::vector<HotReloadCallback> callbacks;
+    for (const auto& subscriber : m_subscribers) {
+        if (path.compare(0, subscriber.prefix.size(), subscriber.prefix) == 0) {
+            callbacks.push_back(subscriber.callback);
+        }
+    }
+    for (const auto& callback : callbacks) {
+        callback(path);
+    }
+}
+
+HotReloadSubscription HotReloader::Subscribe(const std::string& prefix, HotReloadCallback callback) {
+    if (!callback) {
+        return 0;
+    }
+
+    const HotReloadSubscription id = m_nextSubscription++;
+    m_subscribers.push_back({id, prefix, std::move(callback)});
+    return id;
+}
+
+void HotReloader::Unsubscribe(HotReloadSubscription subscription) {
+    m_subscribers.erase(std::remove_if(m_subscribers.begin(), m_subscribers.end(), [subscription](const Subscriber& subscriber) {
+        return subscriber.id == subscription;
+    }), m_subscribers.end());
+}
+
+} // namespace utils
@@ -0,0 +1,133 @@
+#include "engine/public/utils/MappedFile.h"
+#include <spdlog/spdlog.h>
+#include <utility>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#endif
+
+namespace utils {
+
+MappedFile::~MappedFile() {
+    Close();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept {
+    MoveFrom(other);
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        Close();
+        MoveFrom(other);
+    }
+    return *this;
+}
+
+void MappedFile::MoveFrom(MappedFile& other) {
+    m_data = std::exchange(other.m_data, nullptr);
+    m_size = std::exchange(other.m_size, 0);
+    m_path = std::move(other.m_path);
+    m_open = std::exchange(other.m_open, false);
+#ifdef _WIN32
+    m_file = std::exchange(other.m_file, nullptr);
+    m_mapping = std::exchange(other.m_mapping, nullptr);
+#else
+    m_fd = std::exchange(other.m_fd, -1);
+#endif
+}
+
+bool MappedFile::Open(const std::string& path) {
+    Close();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        spdlog::error("Failed to open file for mapping: {} (error {})", path, GetLastError());
+        return false;
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize)) {
+        spdlog::error("Failed to get file size: {} (error {})", path, GetLastError());
+        CloseHandle(file);
+        return false;
+    }
+
+    // Mapping an empty file fails on Windows - an empty mapping is still open
+    if (fileSize.QuadPart > 0) {
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        void* view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+        if (!view) {
+            spdlog::error("Failed to map file: {} (error {})", path, GetLastError());
+            if (mapping) CloseHandle(mapping);
+            CloseHandle(file);
+            return false;
+        }
+        m_mapping = mapping;
+        m_data = static_cast<const uint8_t*>(view);
+        m_size = static_cast<size_t>(fileSize.QuadPart);
+    }
+    m_file = file;
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        spdlog::error("Failed to open file for mapping: {} ({})", path, std::strerror(errno));
+        return false;
+    }
+
+    struct stat info;
+    if (::fstat(fd, &info) != 0) {
+        spdlog::error("Failed to get file size: {} ({})", path, std::strerror(errno));
+        ::close(fd);
+        return false;
+    }
+
+    if (info.st_size > 0) {
+        void* view = ::mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        if (view == MAP_FAILED) {
+            spdlog::error("Failed to map file: {} ({})", path, std::strerror(errno));
+            ::close(fd);
+            return false;
+        }
+        m_data = static_cast<const uint8_t*>(view);
+        m_size = static_cast<size_t>(info.st_size);
+    }
+    m_fd = fd;
+#endif
+
+    m_path = path;
+    m_open = true;
+    return true;
+}
+
+void MappedFile::Close() {
+    if (!m_open) return;
+
+#ifdef _WIN32
+    if (m_data) UnmapViewOfFile(m_data);
+    if (m_mapping) CloseHandle(m_mapping);
+    if (m_file) CloseHandle(m_file);
+    m_mapping = nullptr;
+    m_file = nullptr;
+#else
+    if (m_data) ::munmap(const_cast<uint8_t*>(m_data), m_size);
+    if (m_fd >= 0) ::close(m_fd);
+    m_fd = -1;
+#endif
+
+    m_data = nullptr;
+    m_size = 0;
+    m_path.clear();
+    m_open = false;
+}
+
+} // namespace utils
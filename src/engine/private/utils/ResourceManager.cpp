@@ -1,10 +1,27 @@
 #include "engine/public/utils/ResourceManager.h"
+#include "engine/public/animation/AnimationClip.h"
+#include "engine/public/core/Engine.h"
+#include "engine/public/core/JobSystem.h"
+#include "engine/public/rendering/Renderer.h"
 #include "engine/public/rendering/Texture.h"
+#include "engine/public/rendering/TextureAtlas.h"
+#include "engine/public/utils/Config.h"
 #include "engine/public/utils/Logger.h"
 #include <spdlog/spdlog.h>
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
 
 namespace utils {
 
+struct ResourceManager::AsyncTextureLoad {
+    std::string path;
+    std::shared_ptr<rendering::Texture> texture; // Strong ref keeps the cache entry alive until uploaded
+    std::vector<TextureLoadCallback> callbacks;
+    rendering::ImageData image;                  // Written by the decoding job only
+    bool decoded = false;
+};
+
 ResourceManager::ResourceManager() = default;
 
 ResourceManager::~ResourceManager() {
@@ -17,6 +34,13 @@ bool ResourceManager::Initialize() {
     }
     
     spdlog::info("Initializing ResourceManager...");
+    
+    auto config = Config::Instance();
+    m_maxPendingUploads = static_cast<size_t>(std::max(1, config->GetInt("resources.max_pending_uploads", 32)));
+    m_uploadBudgetMs = config->GetFloat("resources.upload_budget_ms", 2.0f);
+    m_textureBudget = static_cast<size_t>(std::max(0, config->GetInt("resources.texture_budget_mb", 512))) * 1024 * 1024;
+    m_decodeCounter = std::make_unique<core::JobCounter>();
+    
     m_initialized = true;
     return true;
 }
@@ -27,6 +51,24 @@ void ResourceManager::Shutdown() {
     }
     
     spdlog::info("Shutting down ResourceManager...");
+    
+    // Let in-flight decodes finish (they reference this manager), then drop everything unuploaded
+    if (m_decodeCounter && !m_decodeCounter->IsDone()) {
+        core::Engine::Jobs().Wait(*m_decodeCounter);
+    }
+    for (auto& [path, load] : m_asyncLoads) {
+        load->texture->SetPending(false);
+    }
+    m_asyncLoads.clear();
+    m_queuedLoads.clear();
+    {
+        std::lock_guard<std::mutex> lock(m_decodedMutex);
+        m_decodedLoads.clear();
+    }
+    m_activeDecodes = 0;
+    
+    m_animationSets.clear();
+    m_atlases.clear();
     UnloadAllTextures();
     m_initialized = false;
 }
@@ -37,22 +79,19 @@ std::shared_ptr<rendering::Texture> ResourceManager::LoadTexture(const std::stri
         return nullptr;
     }
     
-    // Check if texture is already loaded
+    // Check if texture is already loaded (possibly only retained by the cache)
     auto it = m_textures.find(path);
     if (it != m_textures.end()) {
-        if (auto texture = it->second.lock()) {
-            return texture;
-        } else {
-            // Weak pointer expired, remove from cache
-            m_textures.erase(it);
-        }
+        it->second.lastUsedFrame = m_frame;
+        return it->second.texture;
     }
     
     // Load new texture
     auto texture = std::make_shared<rendering::Texture>();
     if (texture->LoadFromFile(path)) {
-        m_textures[path] = texture;
+        m_textures[path] = {texture, m_frame};
         spdlog::debug("Loaded texture: {}", path);
+        EnforceTextureBudget();
         return texture;
     } else {
         spdlog::error("Failed to load texture: {}", path);
@@ -60,6 +99,138 @@ std::shared_ptr<rendering::Texture> ResourceManager::LoadTexture(const std::stri
     }
 }
 
+std::shared_ptr<rendering::Texture> ResourceManager::LoadTextureAsync(const std::string& path, TextureLoadCallback callback) {
+    if (!m_initialized) {
+        spdlog::error("ResourceManager not initialized");
+        return nullptr;
+    }
+    
+    // Already requested - piggyback on the outstanding load
+    auto pending = m_asyncLoads.find(path);
+    if (pending != m_asyncLoads.end()) {
+        if (callback) {
+            pending->second->callbacks.push_back(std::move(callback));
+        }
+        return pending->second->texture;
+    }
+    
+    // Already loaded
+    auto it = m_textures.find(path);
+    if (it != m_textures.end()) {
+        it->second.lastUsedFrame = m_frame;
+        const std::shared_ptr<rendering::Texture>& texture = it->second.texture;
+        if (callback) {
+            callback(texture, texture->IsValid());
+        }
+        return texture;
+    }
+    
+    auto load = std::make_shared<AsyncTextureLoad>();
+    load->path = path;
+    load->texture = std::make_shared<rendering::Texture>();
+    load->texture->SetPending(true);
+    if (callback) {
+        load->callbacks.push_back(std::move(callback));
+    }
+    
+    m_textures[path] = {load->texture, m_frame};
+    m_asyncLoads[path] = load;
+    
+    if (m_activeDecodes < m_maxPendingUploads) {
+        StartDecode(load);
+    } else {
+        m_queuedLoads.push_back(load);
+    }
+    
+    return load->texture;
+}
+
+void ResourceManager::ProcessUploads() {
+    ProcessUploads(m_uploadBudgetMs);
+}
+
+void ResourceManager::ProcessUploads(float budgetMs) {
+    if (!m_initialized) {
+        return;
+    }
+    
+    const auto start = std::chrono::steady_clock::now();
+    
+    while (true) {
+        std::shared_ptr<AsyncTextureLoad> load;
+        {
+            std::lock_guard<std::mutex> lock(m_decodedMutex);
+            if (m_decodedLoads.empty()) {
+                break;
+            }
+            load = std::move(m_decodedLoads.front());
+            m_decodedLoads.pop_front();
+        }
+        
+        FinishLoad(*load);
+        
+        // Always make progress, then stop once the frame's upload budget is spent
+        const std::chrono::duration<float, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        if (elapsed.count() >= budgetMs) {
+            break;
+        }
+    }
+    
+    StartQueuedLoads();
+    
+    // Once per frame: note which textures are still in use, then evict retained ones if over budget
+    m_frame++;
+    UpdateTextureUsage();
+    EnforceTextureBudget();
+}
+
+void ResourceManager::StartQueuedLoads() {
+    while (!m_queuedLoads.empty() && m_activeDecodes < m_maxPendingUploads) {
+        std::shared_ptr<AsyncTextureLoad> load = std::move(m_queuedLoads.front());
+        m_queuedLoads.pop_front();
+        StartDecode(load);
+    }
+}
+
+void ResourceManager::StartDecode(const std::shared_ptr<AsyncTextureLoad>& load) {
+    m_activeDecodes++;
+    core::Engine::Jobs().Submit([this, load] {
+        load->decoded = rendering::Texture::DecodeFile(load->path, load->image);
+        
+        std::lock_guard<std::mutex> lock(m_decodedMutex);
+        m_decodedLoads.push_back(load);
+    }, m_decodeCounter.get());
+}
+
+void ResourceManager::FinishLoad(AsyncTextureLoad& load) {
+    m_activeDecodes--;
+    
+    const bool success = load.decoded && load.texture->LoadFromImage(load.image, load.path);
+    load.texture->SetPending(false);
+    load.image = rendering::ImageData{}; // Release the CPU copy
+    
+    if (success) {
+        spdlog::debug("Loaded texture (async): {}", load.path);
+    } else {
+        spdlog::error("Failed to load texture: {}", load.path);
+        
+        // Don't cache failures so a later request retries
+        auto it = m_textures.find(load.path);
+        if (it != m_textures.end() && it->second.texture == load.texture) {
+            m_textures.erase(it);
+        }
+    }
+    
+    auto pending = m_asyncLoads.find(load.path);
+    if (pending != m_asyncLoads.end() && pending->second.get() == &load) {
+        m_asyncLoads.erase(pending);
+    }
+    
+    for (auto& callback : load.callbacks) {
+        callback(load.texture, success);
+    }
+}
+
 void ResourceManager::UnloadTexture(const std::string& path) {
     auto it = m_textures.find(path);
     if (it != m_textures.end()) {
@@ -68,6 +239,32 @@ void ResourceManager::UnloadTexture(const std::string& path) {
     }
 }
 
+bool ResourceManager::ReloadTexture(const std::string& path) {
+    // Loader paths may be spelled differently ("assets//a.png", "./assets/a.png")
+    const std::string normalized = std::filesystem::path(path).lexically_normal().generic_string();
+    bool reloaded = false;
+    bool drained = false;
+    for (auto& [cachedPath, cached] : m_textures) {
+        if (cachedPath != path && std::filesystem::path(cachedPath).lexically_normal().generic_string() != normalized) {
+            continue;
+        }
+        if (cached.texture->IsPending()) {
+            continue; // The outstanding load reads the file after this anyway
+        }
+        
+        // Frames queued on the render thread may still sample the old contents
+        if (!drained) {
+            core::Engine::Renderer().WaitForQueuedFrames();
+            drained = true;
+        }
+        if (cached.texture->Reload()) {
+            reloaded = true;
+            spdlog::info("Reloaded texture: {}", cachedPath);
+        }
+    }
+    return reloaded;
+}
+
 void ResourceManager::UnloadAllTextures() {
     size_t count = m_textures.size();
     m_textures.clear();
@@ -76,13 +273,250 @@ void ResourceManager::UnloadAllTextures() {
     }
 }
 
+std::shared_ptr<rendering::TextureAtlas> ResourceManager::LoadAtlas(const std::string& name, const std::string& directory) {
+    // Cache the packed layout next to the other generated assets by default
+    rendering::AtlasOptions options;
+    options.cachePath = "assets/cache/atlases/" + name;
+    return LoadAtlas(name, directory, options);
+}
+
+std::shared_ptr<rendering::TextureAtlas> ResourceManager::LoadAtlas(const std::string& name, const std::string& directory,
+                                                                    const rendering::AtlasOptions& options) {
+    if (!m_initialized) {
+        spdlog::error("ResourceManager not initialized");
+        return nullptr;
+    }
+    
+    if (auto existing = GetAtlas(name)) {
+        return existing;
+    }
+    
+    auto atlas = std::make_shared<rendering::TextureAtlas>();
+    if (!atlas->BuildFromDirectory(directory, options)) {
+        spdlog::error("Failed to build atlas '{}' from directory: {}", name, directory);
+        return nullptr;
+    }
+    
+    m_atlases[name] = atlas;
+    return atlas;
+}
+
+std::shared_ptr<rendering::TextureAtlas> ResourceManager::LoadAtlas(const std::string& name, const std::vector<std::string>& imagePaths,
+                                                                    const rendering::AtlasOptions& options) {
+    if (!m_initialized) {
+        spdlog::error("ResourceManager not initialized");
+        return nullptr;
+    }
+    
+    if (auto existing = GetAtlas(name)) {
+        return existing;
+    }
+    
+    auto atlas = std::make_shared<rendering::TextureAtlas>();
+    if (!atlas->BuildFromFiles(imagePaths, options)) {
+        spdlog::error("Failed to build atlas '{}' from {} images", name, imagePaths.size());
+        return nullptr;
+    }
+    
+    m_atlases[name] = atlas;
+    return atlas;
+}
+
+std::shared_ptr<rendering::TextureAtlas> ResourceManager::GetAtlas(const std::string& name) const {
+    auto it = m_atlases.find(name);
+    if (it != m_atlases.end()) {
+        return it->second;
+    }
+    return nullptr;
+}
+
+rendering::Sprite ResourceManager::CreateAtlasSprite(const std::string& atlasName, const std::string& regionName) const {
+    auto atlas = GetAtlas(atlasName);
+    if (!atlas) {
+        spdlog::warn("Atlas '{}' not loaded", atlasName);
+        return rendering::Sprite();
+    }
+    return atlas->CreateSprite(regionName);
+}
+
+void ResourceManager::UnloadAtlas(const std::string& name) {
+    auto it = m_atlases.find(name);
+    if (it != m_atlases.end()) {
+        m_atlases.erase(it);
+        spdlog::debug("Unloaded atlas: {}", name);
+    }
+}
+
+std::shared_ptr<animation::AnimationSet> ResourceManager::LoadAnimations(const std::string& path) {
+    if (!m_initialized) {
+        spdlog::error("ResourceManager not initialized");
+        return nullptr;
+    }
+    
+    auto it = m_animationSets.find(path);
+    if (it != m_animationSets.end()) {
+        return it->second;
+    }
+    
+    auto set = animation::AnimationSet::Load(path);
+    if (set) {
+        m_animationSets[path] = set;
+    }
+    return set;
+}
+
+void ResourceManager::UnloadAnimations(const std::string& path) {
+    if (m_animationSets.erase(path) > 0) {
+        spdlog::debug("Unloaded animation set: {}", path);
+    }
+}
+
 size_t ResourceManager::GetTextureCount() const {
     return m_textures.size();
 }
 
+size_t ResourceManager::GetAtlasCount() const {
+    return m_atlases.size();
+}
+
 size_t ResourceManager::GetMemoryUsage() const {
-    // Simple estimation - would need texture size info for accurate count
-    return m_textures.size() * sizeof(rendering::Texture);
+    size_t bytes = 0;
+    for (const auto& [path, cached] : m_textures) {
+        bytes += cached.texture->GetMemoryUsage();
+    }
+    for (const auto& [name, atlas] : m_atlases) {
+        for (size_t page = 0; page < atlas->GetPageCount(); ++page) {
+            if (auto texture = atlas->GetPageTexture(static_cast<int>(page))) {
+                bytes += texture->GetMemoryUsage();
+            }
+        }
+    }
+    return bytes;
+}
+
+size_t ResourceManager::GetRetainedMemoryUsage() const {
+    size_t bytes = 0;
+    for (const auto& [path, cached] : m_textures) {
+        if (cached.texture.use_count() == 1) {
+            bytes += cached.texture->GetMemoryUsage();
+        }
+    }
+    return bytes;
+}
+
+void ResourceManager::SetTextureBudget(size_t bytes) {
+    m_textureBudget = bytes;
+    m_budgetWarned = false;
+    EnforceTextureBudget();
+}
+
+void ResourceManager::UpdateTextureUsage() {
+    for (auto& [path, cached] : m_textures) {
+        if (cached.texture.use_count() > 1) {
+            cached.lastUsedFrame = m_frame;
+        }
+    }
+}
+
+void ResourceManager::EnforceTextureBudget() {
+    if (m_textureBudget == 0) {
+        return;
+    }
+    
+    if (GetMemoryUsage() > m_textureBudget) {
+        TrimTextures(m_textureBudget);
+    }
+    
+    const size_t usage = GetMemoryUsage();
+    if (usage > m_textureBudget) {
+        if (!m_budgetWarned) {
+            spdlog::warn("Textures in use need {:.1f} MB, over the {:.1f} MB texture budget",
+                         usage / (1024.0 * 1024.0), m_textureBudget / (1024.0 * 1024.0));
+            m_budgetWarned = true;
+        }
+    } else {
+        m_budgetWarned = false;
+    }
+}
+
+void ResourceManager::TrimTextures(size_t targetBytes) {
+    // Retained textures (cache holds the only reference), least recently used first
+    std::vector<std::unordered_map<std::string, CachedTexture>::iterator> retained;
+    for (auto it = m_textures.begin(); it != m_textures.end(); ++it) {
+        if (it->second.texture.use_count() == 1) {
+            retained.push_back(it);
+        }
+    }
+    std::sort(retained.begin(), retained.end(), [](const auto& a, const auto& b) {
+        return a->second.lastUsedFrame < b->second.lastUsedFrame;
+    });
+    
+    size_t usage = GetMemoryUsage();
+    size_t evicted = 0;
+    size_t freed = 0;
+    for (auto it : retained) {
+        if (usage <= targetBytes) {
+            break;
+        }
+        const size_t bytes = it->second.texture->GetMemoryUsage();
+        usage -= std::min(usage, bytes);
+        freed += bytes;
+        evicted++;
+        m_textures.erase(it);
+    }
+    
+    if (evicted > 0) {
+        spdlog::debug("Evicted {} retained textures ({} KB)", evicted, freed / 1024);
+    }
+}
+
+std::vector<TextureStats> ResourceManager::GetTextureStats() const {
+    std::vector<TextureStats> stats;
+    stats.reserve(m_textures.size());
+    
+    auto describe = [&](const std::string& name, const rendering::Texture& texture, long references) {
+        TextureStats entry;
+        entry.name = name;
+        entry.width = texture.GetWidth();
+        entry.height = texture.GetHeight();
+        entry.mipLevels = texture.GetMipLevels();
+        entry.bytes = texture.GetMemoryUsage();
+        entry.references = references;
+        entry.pending = texture.IsPending();
+        return entry;
+    };
+    
+    for (const auto& [path, cached] : m_textures) {
+        TextureStats entry = describe(path, *cached.texture, cached.texture.use_count() - 1);
+        entry.retained = entry.references == 0;
+        entry.framesSinceUse = m_frame - std::min(cached.lastUsedFrame, m_frame);
+        stats.push_back(std::move(entry));
+    }
+    for (const auto& [name, atlas] : m_atlases) {
+        for (size_t page = 0; page < atlas->GetPageCount(); ++page) {
+            if (auto texture = atlas->GetPageTexture(static_cast<int>(page))) {
+                // Minus the atlas' own page reference and our local copy
+                stats.push_back(describe("atlas:" + name + "#" + std::to_string(page), *texture, texture.use_count() - 2));
+            }
+        }
+    }
+    
+    std::sort(stats.begin(), stats.end(), [](const TextureStats& a, const TextureStats& b) {
+        return a.bytes > b.bytes;
+    });
+    return stats;
+}
+
+void ResourceManager::DumpTextureStats() const {
+    const std::vector<TextureStats> stats = GetTextureStats();
+    spdlog::info("Textures: {} entries, {:.2f} MB ({:.2f} MB retained), budget {:.2f} MB",
+                 stats.size(), GetMemoryUsage() / (1024.0 * 1024.0), GetRetainedMemoryUsage() / (1024.0 * 1024.0),
+                 m_textureBudget / (1024.0 * 1024.0));
+    for (const TextureStats& entry : stats) {
+        spdlog::info("  {:>8.1f} KB  {}x{} mips {}  refs {}{}{}  {}", entry.bytes / 1024.0, entry.width, entry.height,
+                     entry.mipLevels, entry.references, entry.retained ? " (retained)" : "",
+                     entry.pending ? " (pending)" : "", entry.name);
+    }
 }
 
 } // namespace utils
\ No newline at end of file
@@ -0,0 +1,368 @@
+#include "engine/public/world/WorldStreamer.h"
+#include "engine/public/core/Engine.h"
+#include "engine/public/core/FrameArena.h"
+#include "engine/public/core/JobSystem.h"
+#include "engine/public/core/Transform.h"
+#include "engine/public/physics/RigidBody.h"
+#include "engine/public/tilemap/Tilemap.h"
+#include "engine/public/utils/Assets.h"
+#include "engine/public/utils/Config.h"
+#include "engine/public/utils/ResourceManager.h"
+#include <nlohmann/json.hpp>
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <filesystem>
+#include <limits>
+#include <memory_resource>
+
+namespace world {
+
+namespace {
+
+core::Bounds Expand(const core::Bounds& bounds, float amount) {
+    return core::Bounds(bounds.min - glm::vec2(amount), bounds.max + glm::vec2(amount));
+}
+
+// Gap between two rectangles (0 when they overlap)
+float Distance(const core::Bounds& a, const core::Bounds& b) {
+    const glm::vec2 gap = glm::max(glm::vec2(0.0f), glm::max(a.min - b.max, b.min - a.max));
+    return glm::length(gap);
+}
+
+size_t ImageBytes(const glm::ivec2& size) {
+    return static_cast<size_t>(std::max(size.x, 0)) * static_cast<size_t>(std::max(size.y, 0)) * 4;
+}
+
+} // anonymous namespace
+
+WorldStreamer::WorldStreamer() = default;
+
+WorldStreamer::~WorldStreamer() {
+    Shutdown();
+}
+
+bool WorldStreamer::Initialize() {
+    auto& config = *utils::Config::Instance();
+    m_loadRadius = config.GetFloat("streaming.load_radius", 512.0f);
+    m_unloadRadius = std::max(config.GetFloat("streaming.unload_radius", 1024.0f), m_loadRadius);
+    m_maxConcurrentLoads = std::max(config.GetInt("streaming.max_concurrent_loads", 2), 1);
+    m_maxActivationsPerFrame = std::max(config.GetInt("streaming.max_activations_per_frame", 1), 1);
+
+    constexpr size_t MB = 1024 * 1024;
+    m_budgets.textureBytes = static_cast<size_t>(std::max(config.GetInt("streaming.texture_budget_mb", 256), 0)) * MB;
+    m_budgets.meshBytes = static_cast<size_t>(std::max(config.GetInt("streaming.mesh_budget_mb", 64), 0)) * MB;
+    m_budgets.colliderCount = static_cast<size_t>(std::max(config.GetInt("streaming.collider_budget", 20000), 0));
+
+    m_initialized = true;
+    spdlog::info("World streamer initialized (load radius {}, unload radius {})", m_loadRadius, m_unloadRadius);
+    return true;
+}
+
+void WorldStreamer::Shutdown() {
+    if (!m_initialized) {
+        return;
+    }
+    Clear();
+    m_initialized = false;
+}
+
+bool WorldStreamer::LoadWorld(const std::string& path) {
+    Clear();
+
+    std::string text;
+    if (!utils::ReadAssetText(path, text)) {
+        spdlog::error("Failed to open world file: {}", path);
+        return false;
+    }
+
+    nlohmann::json world;
+    try {
+        world = nlohmann::json::parse(text);
+    } catch (const nlohmann::json::exception& e) {
+        spdlog::error("Failed to parse world file {}: {}", path, e.what());
+        return false;
+    }
+
+    if (world.contains("patterns")) {
+        spdlog::warn("World file {} uses map patterns (not supported), only listed maps are streamed", path);
+    }
+
+    const std::filesystem::path directory = std::filesystem::path(path).parent_path();
+    for (const auto& entry : world.value("maps", nlohmann::json::array())) {
+        const std::string fileName = entry.value("fileName", "");
+        const glm::vec2 position(entry.value("x", 0.0f), entry.value("y", 0.0f));
+        const glm::vec2 size(entry.value("width", 0.0f), entry.value("height", 0.0f));
+        if (fileName.empty() || size.x <= 0.0f || size.y <= 0.0f) {
+            spdlog::warn("Skipping world entry without file name or size in {}", path);
+            continue;
+        }
+        AddRegion((directory / fileName).generic_string(), position, size);
+    }
+
+    spdlog::info("Loaded world {} ({} regions)", path, m_regions.size());
+    return !m_regions.empty();
+}
+
+size_t WorldStreamer::AddRegion(const std::string& mapPath, const glm::vec2& position, const glm::vec2& size) {
+    Region region;
+    region.mapPath = mapPath;
+    region.bounds = core::Bounds(position, position + size);
+    m_regions.push_back(std::move(region));
+    m_stats.regions = m_regions.size();
+    return m_regions.size() - 1;
+}
+
+void WorldStreamer::Clear() {
+    WaitForLoads();
+    for (Region& region : m_regions) {
+        Evict(region);
+    }
+    m_regions.clear();
+    m_textureRefs.clear();
+    m_stats = StreamingStats();
+}
+
+bool WorldStreamer::IsRegionResident(size_t regionIndex) const {
+    return regionIndex < m_regions.size() && m_regions[regionIndex].state == RegionState::Resident;
+}
+
+const tilemap::Tilemap* WorldStreamer::GetRegionMap(size_t regionIndex) const {
+    return IsRegionResident(regionIndex) ? m_regions[regionIndex].map.get() : nullptr;
+}
+
+void WorldStreamer::Update(const core::Bounds& focus, float deltaTime) {
+    if (m_regions.empty()) {
+        return;
+    }
+
+    m_focus = focus;
+    const core::Bounds loadArea = Expand(focus, m_loadRadius);
+    const core::Bounds keepArea = Expand(focus, m_unloadRadius);
+
+    // Collect finished parse jobs
+    for (Region& region : m_regions) {
+        if (region.state == RegionState::Loading && region.parseJob->IsDone()) {
+            region.parseJob.reset();
+            if (region.map->IsParsed()) {
+                region.state = RegionState::Parsed;
+            } else {
+                spdlog::error("World region {} failed to load and will not be retried", region.mapPath);
+                region.map.reset();
+                region.state = RegionState::Failed;
+            }
+        }
+    }
+
+    // Evict everything that drifted out of range (loading regions are evicted once their job is done)
+    for (Region& region : m_regions) {
+        if ((region.state == RegionState::Parsed || region.state == RegionState::Resident) &&
+            !keepArea.Overlaps(region.bounds)) {
+            Evict(region);
+        }
+    }
+
+    // Nearest regions first, both for activation and for new loads (frame scratch, gone next frame)
+    std::pmr::vector<Region*> candidates(&core::Engine::FrameMemory());
+    for (Region& region : m_regions) {
+        if ((region.state == RegionState::Parsed || region.state == RegionState::Unloaded) &&
+            loadArea.Overlaps(region.bounds)) {
+            candidates.push_back(&region);
+        }
+    }
+    std::sort(candidates.begin(), candidates.end(), [&](const Region* a, const Region* b) {
+        return Distance(focus, a->bounds) < Distance(focus, b->bounds);
+    });
+
+    int activations = 0;
+    for (Region* region : candidates) {
+        if (region->state == RegionState::Parsed && activations < m_maxActivationsPerFrame) {
+            if (Activate(*region, loadArea)) {
+                activations++;
+            }
+        }
+    }
+
+    size_t loading = 0;
+    for (const Region& region : m_regions) {
+        loading += region.state == RegionState::Loading ? 1 : 0;
+    }
+    for (Region* region : candidates) {
+        if (loading >= static_cast<size_t>(m_maxConcurrentLoads)) {
+            break;
+        }
+        if (region->state == RegionState::Unloaded) {
+            StartLoad(*region);
+            loading++;
+        }
+    }
+    m_stats.loading = loading;
+
+    // Tile animations
+    for (Region& region : m_regions) {
+        if (region.state == RegionState::Resident) {
+            region.map->Update(deltaTime);
+        }
+    }
+}
+
+void WorldStreamer::Draw(rendering::Renderer& renderer) const {
+    for (const Region& region : m_regions) {
+        if (region.state == RegionState::Resident) {
+            region.map->Draw(renderer);
+        }
+    }
+}
+
+void WorldStreamer::StartLoad(Region& region) {
+    region.map = std::make_shared<tilemap::Tilemap>();
+    region.parseJob = std::make_unique<core::JobCounter>();
+    region.state = RegionState::Loading;
+
+    // The job only touches the map it shares with us; GL and physics work waits for Activate()
+    std::shared_ptr<tilemap::Tilemap> map = region.map;
+    const std::string path = region.mapPath;
+    const glm::vec2 origin = region.bounds.min;
+    core::Engine::Jobs().Submit([map, path, origin] {
+        map->Parse(path, origin);
+    }, region.parseJob.get());
+}
+
+bool WorldStreamer::Activate(Region& region, const core::Bounds& loadArea) {
+    RegionCost cost = GetCost(region);
+
+    // Make room by evicting the farthest resident regions that are no longer needed
+    while (!Fits(cost)) {
+        Region* farthest = nullptr;
+        float farthestDistance = -1.0f;
+        for (Region& other : m_regions) {
+            if (other.state != RegionState::Resident || loadArea.Overlaps(other.bounds)) {
+                continue;
+            }
+            const float distance = Distance(m_focus, other.bounds);
+            if (distance > farthestDistance) {
+                farthest = &other;
+                farthestDistance = distance;
+            }
+        }
+        if (!farthest) {
+            if (!region.budgetWarned) {
+                spdlog::warn("World region {} does not fit the streaming budgets (textures {}/{} KB, meshes {}/{} KB, "
+                             "colliders {}/{}) - not activated",
+                             region.mapPath,
+                             (m_stats.textureBytes + cost.textureBytes) / 1024, m_budgets.textureBytes / 1024,
+                             (m_stats.meshBytes + cost.meshBytes) / 1024, m_budgets.meshBytes / 1024,
+                             m_stats.colliders + cost.colliders, m_budgets.colliderCount);
+                region.budgetWarned = true;
+            }
+            return false;
+        }
+        Evict(*farthest);
+        cost = GetCost(region); // Evicting may have released images this region shares
+    }
+
+    region.map->Upload(true);
+
+    const std::vector<core::Bounds>& colliders = region.map->GetColliders();
+    if (!colliders.empty()) {
+        region.body = std::make_unique<physics::RigidBody>(core::Transform(region.bounds.min), physics::RigidBody::Type::Static);
+        for (const core::Bounds& collider : colliders) {
+            const glm::vec2 size = collider.GetSize();
+            region.body->AddBoxCollider(size.x, size.y, collider.GetCenter() - region.bounds.min);
+        }
+    }
+
+    for (size_t i = 0; i < region.map->GetTilesetCount(); ++i) {
+        const std::string& image = region.map->GetTilesetImagePath(i);
+        if (!image.empty()) {
+            m_textureRefs[image]++;
+        }
+    }
+
+    m_stats.textureBytes += cost.textureBytes;
+    m_stats.meshBytes += cost.meshBytes;
+    m_stats.colliders += cost.colliders;
+    m_stats.resident++;
+    m_stats.loads++;
+
+    region.state = RegionState::Resident;
+    region.budgetWarned = false;
+    spdlog::debug("World region {} resident ({} KB meshes, {} colliders)", region.mapPath,
+                  cost.meshBytes / 1024, cost.colliders);
+    return true;
+}
+
+void WorldStreamer::Evict(Region& region) {
+    if (region.state == RegionState::Resident) {
+        for (size_t i = 0; i < region.map->GetTilesetCount(); ++i) {
+            const std::string& image = region.map->GetTilesetImagePath(i);
+            auto it = image.empty() ? m_textureRefs.end() : m_textureRefs.find(image);
+            if (it != m_textureRefs.end() && --it->second == 0) {
+                m_stats.textureBytes -= std::min(m_stats.textureBytes, ImageBytes(region.map->GetTilesetImageSize(i)));
+                m_textureRefs.erase(it);
+                
+                // The cache keeps textures alive by itself - drop its reference so the memory the
+                // budget just released is actually freed (once the map below lets go of it too)
+                core::Engine::Resources().UnloadTexture(image);
+            }
+        }
+        m_stats.meshBytes -= std::min(m_stats.meshBytes, region.map->GetMeshMemoryUsage());
+        m_stats.colliders -= std::min(m_stats.colliders, region.map->GetColliders().size());
+        m_stats.resident--;
+        m_stats.evictions++;
+        spdlog::debug("World region {} evicted", region.mapPath);
+    }
+
+    if (region.state == RegionState::Loading) {
+        // The job still writes to the map - let it finish, the next Update() evicts it if still out of range
+        return;
+    }
+
+    region.body.reset();
+    region.map.reset();
+    if (region.state != RegionState::Failed) {
+        region.state = RegionState::Unloaded;
+    }
+}
+
+void WorldStreamer::WaitForLoads() {
+    for (Region& region : m_regions) {
+        if (region.state == RegionState::Loading) {
+            core::Engine::Jobs().Wait(*region.parseJob);
+            region.parseJob.reset();
+            region.state = RegionState::Parsed;
+        }
+    }
+}
+
+WorldStreamer::RegionCost WorldStreamer::GetCost(const Region& region) const {
+    RegionCost cost;
+    cost.meshBytes = region.map->GetMeshMemoryUsage();
+    cost.colliders = region.map->GetColliders().size();
+
+    for (size_t i = 0; i < region.map->GetTilesetCount(); ++i) {
+        const std::string& image = region.map->GetTilesetImagePath(i);
+        if (image.empty() || m_textureRefs.count(image)) {
+            continue;
+        }
+        // Count images shared between this region's own tilesets once
+        bool seen = false;
+        for (size_t j = 0; j < i; ++j) {
+            seen = seen || region.map->GetTilesetImagePath(j) == image;
+        }
+        if (!seen) {
+            cost.textureBytes += ImageBytes(region.map->GetTilesetImageSize(i));
+        }
+    }
+    return cost;
+}
+
+bool WorldStreamer::Fits(const RegionCost& cost) const {
+    auto fits = [](size_t used, size_t extra, size_t budget) {
+        return budget == 0 || used + extra <= budget;
+    };
+    return fits(m_stats.textureBytes, cost.textureBytes, m_budgets.textureBytes) &&
+           fits(m_stats.meshBytes, cost.meshBytes, m_budgets.meshBytes) &&
+           fits(m_stats.colliders, cost.colliders, m_budgets.colliderCount);
+}
+
+} // namespace world
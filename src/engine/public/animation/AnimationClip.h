@@ -0,0 +1,107 @@
+#pragma once
+
+#include "engine/public/rendering/Sprite.h"
+#include <glm/glm.hpp>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace rendering {
+    class Texture;
+}
+
+namespace animation {
+
+    enum class LoopMode {
+        Loop,     // "loop" - start over after the last frame (default)
+        Once,     // "once" - stop on the last frame
+        PingPong  // "pingpong" - play forwards, then backwards
+    };
+
+    /**
+     * Animation Clip
+     *
+     * A frame table on one sprite sheet texture: every frame's UV rect and
+     * size is computed once, so drawing an animated sprite is a lookup -
+     * the sprite's source rect is never touched. Frames may have their own
+     * durations; clips with uniform frames map time to a frame with one
+     * multiply instead of a search.
+     *
+     * Clips are immutable once built and shared by every Animator playing
+     * them. Load them from a set file with AnimationSet.
+     */
+    class AnimationClip {
+    public:
+        AnimationClip(std::string name, std::shared_ptr<rendering::Texture> texture,
+                      std::vector<glm::ivec4> rects, std::vector<float> durations, LoopMode loopMode);
+
+        // Frame shown at a time (seconds since the clip started; looping is applied here)
+        size_t GetFrameIndex(float time) const;
+        const rendering::SpriteFrame& GetFrame(size_t index) const; // UVs are built once the texture has loaded
+
+        const std::string& GetName() const { return m_name; }
+        const std::shared_ptr<rendering::Texture>& GetTexture() const { return m_texture; }
+        size_t GetFrameCount() const { return m_rects.size(); }
+        const glm::ivec4& GetFrameRect(size_t index) const { return m_rects[index]; }
+        float GetDuration() const { return m_duration; } // One pass through the frames
+        float GetPeriod() const;                         // Until it repeats (Once: until it stops)
+        LoopMode GetLoopMode() const { return m_loopMode; }
+        float GetBoundingRadius() const { return m_boundingRadius; } // Around the origin, for any frame and pivot
+
+        static LoopMode ParseLoopMode(const std::string& name); // Unknown names fall back to Loop
+
+    private:
+        void BuildFrames() const;
+
+        std::string m_name;
+        std::shared_ptr<rendering::Texture> m_texture;
+        LoopMode m_loopMode;
+
+        std::vector<glm::ivec4> m_rects;   // x, y, width, height in texture pixels
+        std::vector<float> m_frameEnds;    // Cumulative end time of each frame
+        float m_duration = 0.0f;
+        float m_uniformDuration = 0.0f;    // Non-zero when every frame lasts this long
+        float m_boundingRadius = 0.0f;
+
+        mutable std::vector<rendering::SpriteFrame> m_frames; // Empty until the texture size is known
+    };
+
+    /**
+     * Animation Set
+     *
+     * The clips of one sprite sheet, loaded from a JSON file next to it:
+     *
+     *   {
+     *     "texture": "player.png",
+     *     "clips": {
+     *       "run":  { "frames": [[0, 0, 32, 32], [32, 0, 32, 32]], "fps": 12 },
+     *       "idle": { "grid": { "x": 0, "y": 32, "width": 32, "height": 32, "count": 4 }, "fps": 6 },
+     *       "hit":  { "frames": [{ "rect": [0, 64, 32, 32], "duration_ms": 50 }], "loop": "once" }
+     *     }
+     *   }
+     *
+     * Instead of "texture", "atlas" names a directory packed into a
+     * rendering::TextureAtlas; frames are then region names
+     * ("frames": ["run_0", "run_1"]) and must share one atlas page.
+     * Paths are relative to the set file. "grid" frames run left to right
+     * and wrap after "columns" (default: all in one row).
+     *
+     * Usage:
+     *   auto set = core::Engine::Resources().LoadAnimations("assets/textures/player.anim.json");
+     *   registry.Add<animation::Animator>(player, set->GetClip("run"));
+     */
+    class AnimationSet {
+    public:
+        static std::shared_ptr<AnimationSet> Load(const std::string& path);
+
+        std::shared_ptr<const AnimationClip> GetClip(const std::string& name) const; // nullptr if missing
+        bool HasClip(const std::string& name) const { return m_clips.count(name) > 0; }
+        std::vector<std::string> GetClipNames() const;
+        size_t GetClipCount() const { return m_clips.size(); }
+
+    private:
+        std::unordered_map<std::string, std::shared_ptr<const AnimationClip>> m_clips;
+    };
+
+} // namespace animation
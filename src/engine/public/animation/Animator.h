@@ -0,0 +1,67 @@
+#pragma once
+
+#include "AnimationClip.h"
+#include <cmath>
+#include <memory>
+
+namespace animation {
+
+    /**
+     * Animator
+     *
+     * Per-entity playback state of an AnimationClip: a clock, a speed and
+     * nothing else. ecs::UpdateAnimations advances every animator in one
+     * pass over the packed pool (a few floats each, no clip access), and
+     * the frame is only looked up when the entity is drawn - animations
+     * off screen cost the clock update and nothing more.
+     *
+     * An entity with a Transform, a Sprite and an Animator is drawn with the
+     * clip's texture and current frame; the sprite supplies origin and tint.
+     *
+     * Usage:
+     *   auto& animator = registry.Add<animation::Animator>(player, set->GetClip("idle"));
+     *   animator.Play(set->GetClip("run"));         // Switches clip, keeps playing
+     *   if (animator.IsFinished()) { ... }          // LoopMode::Once clips
+     */
+    class Animator {
+    public:
+        Animator() = default;
+        explicit Animator(std::shared_ptr<const AnimationClip> clip, float speed = 1.0f);
+
+        // Playback (playing the current clip again only restarts it when asked to)
+        void Play(std::shared_ptr<const AnimationClip> clip, bool restart = false);
+        void Pause() { m_playing = false; }
+        void Resume() { m_playing = m_clip != nullptr; }
+        void Stop();
+        void SetSpeed(float speed) { m_speed = speed; }
+        void SetTime(float time);
+
+        // Called by ecs::UpdateAnimations
+        void Advance(float deltaTime) {
+            if (!m_playing) return;
+            m_time += deltaTime * m_speed;
+            if (m_time >= m_period || m_time < 0.0f) {
+                Wrap();
+            }
+        }
+
+        // State
+        const std::shared_ptr<const AnimationClip>& GetClip() const { return m_clip; }
+        size_t GetFrameIndex() const { return m_clip ? m_clip->GetFrameIndex(m_time) : 0; }
+        float GetTime() const { return m_time; }
+        float GetSpeed() const { return m_speed; }
+        bool IsPlaying() const { return m_playing; }
+        bool IsFinished() const { return m_clip && !m_loops && m_time >= m_period; }
+
+    private:
+        void Wrap();
+
+        std::shared_ptr<const AnimationClip> m_clip;
+        float m_time = 0.0f;
+        float m_speed = 1.0f;
+        float m_period = 0.0f; // Cached from the clip so Advance never touches it
+        bool m_loops = true;
+        bool m_playing = false;
+    };
+
+} // namespace animation
@@ -1,12 +1,25 @@
 #pragma once
 
+#include "engine/public/audio/AudioMixer.h"
 #include <SDL_mixer.h>
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <deque>
+#include <future>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <memory>
+#include <vector>
+
+namespace core {
+    class JobCounter;
+}
 
 namespace audio {
 
+    class SoundBank;
+
     enum class AudioCategory {
         SFX,
         Music,
@@ -16,6 +29,24 @@ namespace audio {
     using AudioHandle = int;
     static constexpr AudioHandle INVALID_AUDIO_HANDLE = -1;
 
+    // Per play options (PlaySound overload)
+    struct SoundParams {
+        float volume = 1.0f;
+        int priority = -1;            // Higher wins when voices run out (-1 = the sound's priority)
+        bool positional = false;      // Attenuate and pan by distance to the listener
+        glm::vec2 position{0.0f};
+        float minDistance = -1.0f;    // Full volume inside (-1 = "audio.min_distance")
+        float maxDistance = -1.0f;    // Silent (and culled) beyond (-1 = "audio.max_distance")
+    };
+
+    struct VoiceStats {
+        int voices = 0;               // Pool size (mixing channels)
+        int active = 0;
+        uint32_t culled = 0;          // Inaudible plays rejected before taking a voice
+        uint32_t stolen = 0;          // Voices cut for a more important sound
+        uint32_t dropped = 0;         // Plays rejected because every candidate voice was more important
+    };
+
     /**
      * Audio Manager
      * 
@@ -23,6 +54,41 @@ namespace audio {
      * Supports both one-shot sounds (SFX) and streaming audio (Music/Ambient).
      * 
      * Volume calculation: final_volume = sound_volume * category_volume * master_volume
+     *                                    (* distance attenuation for positional sounds)
+     * 
+     * Sounds play on a fixed pool of voices, one per SDL_mixer channel
+     * ("audio.voices"), plus one slot for the music stream. Handles encode
+     * the voice index and a generation, so a stale handle never controls
+     * a newer sound. When a sound is played:
+     * - Positional sounds quieter than "audio.cull_volume" at the listener
+     *   are culled without taking a voice.
+     * - At its category's limit ("audio.voice_limits"), or with every voice
+     *   busy, the lowest priority voice is stolen (quietest first among
+     *   equals) - but only if it is not more important than the new sound,
+     *   otherwise the new sound is dropped.
+     * Update() re-attenuates and pans positional voices relative to the
+     * listener (SetListenerPosition) and frees finished voices.
+     * 
+     * With "audio.mixer.enabled" the output is opened as float and all
+     * gain staging happens in the AudioMixer bus stage on the audio thread:
+     * voice gain and panning per channel, category volumes, low-pass and
+     * ducking per bus, master volume and a limiter on the final mix. The
+     * device format comes from "audio.sample_rate" / "audio.buffer_size".
+     * Without it (or on an unsupported device) volumes fall back to
+     * Mix_Volume / Mix_SetPanning.
+     * 
+     * LoadSoundBank() memory-maps a whole bank of pre-decoded PCM and
+     * registers every sound in it without decoding or copying. A bank is
+     * built from its manifest by BuildSoundBank(): offline by the asset
+     * packer for packed builds (the bank is then read in place from the
+     * archive and never rebuilt), and for loose assets by LoadSoundBank()
+     * itself when the bank is missing, older than its manifest or was
+     * built for a different device format.
+     * 
+     * LoadSoundAsync() decodes on the job system and registers the sound in
+     * Update() on the main thread. Poll the returned future (wait_for(0))
+     * rather than blocking on it from the main thread - it is only fulfilled
+     * by Update().
      */
     class AudioManager {
     public:
@@ -38,14 +104,33 @@ namespace audio {
 
         // Loading/Unloading
         bool LoadSound(const std::string& filepath, const std::string& name, AudioCategory category);
+        std::shared_future<bool> LoadSoundAsync(const std::string& filepath, const std::string& name, AudioCategory category);
         bool LoadStream(const std::string& filepath, const std::string& name, AudioCategory category);
         void UnloadSound(const std::string& name);
         void UnloadStream(const std::string& name);
+        size_t ReloadSoundFile(const std::string& path); // Re-decode the sounds loaded from a file (not bank sounds); returns how many
+
+        // Sound banks (paths relative to assets/audio, manifest at "<bank>.json")
+        bool LoadSoundBank(const std::string& bankPath, const std::string& bankName);
+        void UnloadSoundBank(const std::string& bankName);
+        bool IsSoundBankLoaded(const std::string& bankName) const { return m_banks.count(bankName) > 0; }
+        // Decode everything in the manifest at the device format; written next to the manifest unless outputPath is given
+        bool BuildSoundBank(const std::string& bankPath, const std::string& outputPath = "");
 
         // Playback
         AudioHandle PlaySound(const std::string& name, float volume = 1.0f);
+        AudioHandle PlaySound(const std::string& name, const SoundParams& params);
+        AudioHandle PlaySoundAt(const std::string& name, const glm::vec2& position, float volume = 1.0f);
         AudioHandle PlayStream(const std::string& name, float volume = 1.0f, bool loop = true);
 
+        // Voice management
+        void SetSoundPriority(const std::string& name, int priority);   // Default for every play of the sound (0)
+        void SetCategoryVoiceLimit(AudioCategory category, int voices);
+        void SetListenerPosition(const glm::vec2& position) { m_listenerPosition = position; }
+        const glm::vec2& GetListenerPosition() const { return m_listenerPosition; }
+        void SetAudioPosition(AudioHandle handle, const glm::vec2& position);
+        const VoiceStats& GetVoiceStats() const { return m_voiceStats; }
+
         // Individual audio control
         void PauseAudio(AudioHandle handle);
         void ResumeAudio(AudioHandle handle);
@@ -66,11 +151,24 @@ namespace audio {
         void ResumeAll();
         void StopAll();
 
+        // Bus effects (need the mixer stage, ignored otherwise)
+        void SetCategoryLowPass(AudioCategory category, float cutoffHz); // 0 = off
+        void SetDucking(const DuckingSettings& settings);
+        void SetLimiterCeiling(float ceiling);                           // 0 = off
+        const AudioMixer* GetMixer() const { return m_mixer.get(); }     // nullptr without the mixer stage
+
     private:
         struct SoundData {
             Mix_Chunk* chunk = nullptr;
             AudioCategory category = AudioCategory::SFX;
             std::string filepath;
+            int priority = 0;
+            std::string bank;      // Owning sound bank - the chunk points into its mapping
+        };
+
+        struct LoadedBank {
+            std::unique_ptr<SoundBank> bank;
+            std::vector<std::string> sounds;
         };
 
         struct StreamData {
@@ -79,18 +177,50 @@ namespace audio {
             std::string filepath;
         };
 
-        struct PlayingAudio {
+        // Sound being decoded on a worker (chunk/error written by the job only)
+        struct PendingSound {
+            std::string name;
+            std::string fullPath;
             AudioCategory category = AudioCategory::SFX;
-            float volume = 1.0f;
-            int channel = -1;  // For Mix_Chunk sounds (-1 for Mix_Music)
+            Mix_Chunk* chunk = nullptr;
+            std::string error;
+            std::promise<bool> promise;
+        };
+
+        // Voice index = SDL_mixer channel; the last voice is the music stream
+        struct Voice {
+            uint32_t generation = 1;
+            bool active = false;
             bool isStream = false;
             bool isPaused = false;
+            bool panned = false;          // Panning effect registered on the channel
+            AudioCategory category = AudioCategory::SFX;
+            const Mix_Chunk* chunk = nullptr;
+            const Mix_Music* music = nullptr;
+            float volume = 1.0f;          // Requested sound volume
+            float attenuation = 1.0f;     // Distance gain (1 for non-positional)
+            int priority = 0;
+            bool positional = false;
+            glm::vec2 position{0.0f};
+            float minDistance = 0.0f;
+            float maxDistance = 0.0f;
         };
 
         // Internal helpers
+        static std::string GetSoundPath(const std::string& filepath, AudioCategory category);
+        void ProcessLoadedSounds();
+        bool RegisterSoundBank(std::unique_ptr<SoundBank> bank, const std::string& bankName, const std::string& fullPath);
         float CalculateFinalVolume(AudioCategory category, float soundVolume) const;
-        void UpdateChannelVolume(int channel, AudioCategory category, float soundVolume);
-        AudioHandle GetNextHandle();
+        void ApplyVoiceVolume(int index);
+        void ApplyVoicePanning(int index);
+        float GetVoicePan(const Voice& voice) const;   // -1 = left, 1 = right
+        float CalculateAttenuation(const glm::vec2& position, float minDistance, float maxDistance) const;
+        Voice* FindVoice(AudioHandle handle);
+        const Voice* FindVoice(AudioHandle handle) const;
+        AudioHandle MakeHandle(int index) const;
+        int AcquireVoice(AudioCategory category, int priority, float audibility);
+        void ReleaseVoice(int index);
+        int GetMusicVoice() const { return static_cast<int>(m_voices.size()) - 1; }
         void CleanupFinishedSounds();
 
         bool m_initialized = false;
@@ -105,13 +235,25 @@ namespace audio {
         // Audio data storage
         std::unordered_map<std::string, SoundData> m_sounds;
         std::unordered_map<std::string, StreamData> m_streams;
+        std::unordered_map<std::string, LoadedBank> m_banks;
+        
+        // Async loads (m_loadedSounds is filled by workers, drained in Update())
+        std::unordered_map<std::string, std::shared_future<bool>> m_pendingSounds;
+        std::deque<std::shared_ptr<PendingSound>> m_loadedSounds;
+        std::mutex m_loadedMutex;
+        std::unique_ptr<core::JobCounter> m_loadCounter;
         
-        // Playing audio tracking
-        std::unordered_map<AudioHandle, PlayingAudio> m_playingAudio;
-        AudioHandle m_nextHandle = 1;
+        // Voice pool (fixed size once initialized)
+        std::vector<Voice> m_voices;
+        int m_categoryVoices[3] = {0, 0, 0};       // Active voices per AudioCategory
+        int m_categoryVoiceLimits[3] = {0, 0, 0};  // 0 = no limit
+        glm::vec2 m_listenerPosition{0.0f};
+        float m_minDistance = 100.0f;
+        float m_maxDistance = 1000.0f;
+        float m_cullVolume = 0.01f;
+        VoiceStats m_voiceStats;
         
-        // Currently playing music/stream (SDL_mixer only supports one music at a time)
-        AudioHandle m_currentMusicHandle = INVALID_AUDIO_HANDLE;
+        std::unique_ptr<AudioMixer> m_mixer;
     };
 
 } // namespace audio
\ No newline at end of file
@@ -0,0 +1,122 @@
+#pragma once
+
+#include "engine/public/audio/DSP.h"
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace audio {
+
+    // Sidechain ducking: the SFX bus pushes the Music and Ambient buses down
+    struct DuckingSettings {
+        bool enabled = false;
+        float amount = 0.5f;      // Gain of the ducked buses while SFX are loud
+        float threshold = 0.1f;   // SFX bus peak that triggers ducking
+        float attackMs = 10.0f;   // Time to duck
+        float releaseMs = 300.0f; // Time to recover
+    };
+
+    /**
+     * Audio Mixer
+     *
+     * Bus stage on top of SDL_mixer, running entirely on the audio thread.
+     * Every mixing channel gets an effect that applies the voice's gain and
+     * panning, adds the result to its bus and hands SDL_mixer silence; the
+     * postmix callback then adds whatever SDL_mixer produced (the music
+     * stream) to the bus of the stream's category and builds the final mix:
+     *
+     *   voices -> bus (low-pass) -> bus volume x ducking -> sum -> master -> limiter
+     *
+     * The game thread only stores target values (atomics); the audio thread
+     * ramps towards them over one buffer, so volume changes never click.
+     * Buses are indexed like AudioCategory. Needs 16-bit or float stereo output.
+     */
+    class AudioMixer {
+    public:
+        static constexpr int BUS_COUNT = 3;
+
+        AudioMixer();
+        ~AudioMixer();
+
+        AudioMixer(const AudioMixer&) = delete;
+        AudioMixer& operator=(const AudioMixer&) = delete;
+
+        // After Mix_OpenAudio / Mix_AllocateChannels; false if the output format is unsupported
+        bool Initialize(int channels, int bufferFrames);
+        void Shutdown();
+        bool IsInitialized() const { return m_initialized; }
+
+        // Voices (main thread). Call StartVoice before Mix_PlayChannel: SDL_mixer
+        // drops a channel's effects whenever it finishes or is halted.
+        void StartVoice(int channel, int bus, dsp::StereoGain gain);
+        void SetVoiceGain(int channel, dsp::StereoGain gain);
+        void SetMusicBus(int bus); // Bus the music stream is mixed into (its category)
+
+        // Buses
+        void SetBusVolume(int bus, float volume);
+        void SetBusLowPass(int bus, float cutoffHz); // 0 = off
+        void SetMasterVolume(float volume);
+        void SetDucking(const DuckingSettings& settings);
+        void SetLimiterCeiling(float ceiling);       // 0 = off
+
+        // Meters (updated once per buffer)
+        float GetBusPeak(int bus) const;
+        float GetDuckGain() const { return m_duckGainMeter.load(std::memory_order_relaxed); }
+        int GetSampleRate() const { return m_sampleRate; }
+
+    private:
+        struct Channel {
+            std::atomic<int> bus{0};
+            std::atomic<float> gainLeft{1.0f};
+            std::atomic<float> gainRight{1.0f};
+            dsp::StereoGain applied;   // Audio thread
+            size_t offset = 0;         // Frames added this buffer (audio thread)
+        };
+
+        struct Bus {
+            std::atomic<float> volume{1.0f};
+            std::atomic<float> lowPassCutoff{0.0f};
+            std::atomic<float> peak{0.0f};
+            std::vector<float> buffer; // Interleaved stereo
+            float lowPassState[2] = {0.0f, 0.0f};
+            float appliedGain = 1.0f;
+        };
+
+        static void ChannelEffect(int channel, void* stream, int len, void* udata);
+        static void PostMix(void* udata, unsigned char* stream, int len);
+
+        void ProcessChannel(int channel, void* stream, int bytes);
+        void ProcessMix(unsigned char* stream, int bytes);
+        const float* ToFloat(const void* stream, size_t samples);
+
+        std::unique_ptr<Channel[]> m_channels;
+        int m_channelCount = 0;
+        Bus m_buses[BUS_COUNT];
+        std::vector<float> m_mix;
+        std::vector<float> m_scratch;
+        size_t m_capacityFrames = 0;
+
+        int m_sampleRate = 0;
+        bool m_floatOutput = false;
+        size_t m_bytesPerSample = 0;
+
+        std::atomic<int> m_musicBus{1}; // Music
+        std::atomic<float> m_masterVolume{1.0f};
+        std::atomic<float> m_limiterCeiling{0.98f};
+        std::atomic<bool> m_duckingEnabled{false};
+        std::atomic<float> m_duckAmount{0.5f};
+        std::atomic<float> m_duckThreshold{0.1f};
+        std::atomic<float> m_duckAttackMs{10.0f};
+        std::atomic<float> m_duckReleaseMs{300.0f};
+        std::atomic<float> m_duckGainMeter{1.0f};
+
+        // Audio thread state
+        float m_appliedMaster = 1.0f;
+        float m_duckGain = 1.0f;
+        float m_limiterGain = 1.0f;
+
+        bool m_initialized = false;
+    };
+
+} // namespace audio
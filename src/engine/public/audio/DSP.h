@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace audio {
+namespace dsp {
+
+    /**
+     * Audio DSP kernels
+     *
+     * Work on interleaved stereo float buffers in [-1, 1]. The kernels use
+     * SSE2 on x86/x64 and NEON on ARM, with a scalar fallback elsewhere;
+     * buffers need no particular alignment and any frame count is allowed.
+     *
+     * Gains are ramped linearly from one value to another over the buffer
+     * so that changing a volume between mixer callbacks does not click.
+     * All functions are allocation free and safe to call on the audio thread.
+     */
+
+    struct StereoGain {
+        float left = 1.0f;
+        float right = 1.0f;
+    };
+
+    // Name of the instruction set the kernels were built for ("SSE2", "NEON", "scalar")
+    const char* GetInstructionSet();
+
+    // dst += src * gain, ramping from -> to (frames of interleaved stereo)
+    void MixStereo(float* dst, const float* src, size_t frames, StereoGain from, StereoGain to);
+
+    // buffer *= gain, ramping from -> to (count samples, any channel layout)
+    void ApplyGain(float* buffer, size_t count, float from, float to);
+
+    // Largest absolute sample value
+    float Peak(const float* buffer, size_t count);
+
+    // Hard clip to [-limit, limit]
+    void Clamp(float* buffer, size_t count, float limit);
+
+    // One-pole low-pass, coefficient from LowPassCoefficient(); state holds the last L/R outputs
+    void LowPass(float* buffer, size_t frames, float coefficient, float state[2]);
+    float LowPassCoefficient(float cutoffHz, int sampleRate);
+
+    // Sample format conversion (float side in [-1, 1], int16 output saturates)
+    void S16ToFloat(const int16_t* src, float* dst, size_t count);
+    void FloatToS16(const float* src, int16_t* dst, size_t count);
+
+} // namespace dsp
+} // namespace audio
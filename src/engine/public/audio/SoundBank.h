@@ -0,0 +1,69 @@
+#pragma once
+
+#include "engine/public/utils/AssetArchive.h"
+#include "engine/public/utils/MappedFile.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace audio {
+
+    // Device format the PCM in a bank was decoded to (as reported by Mix_QuerySpec)
+    struct SoundBankFormat {
+        int frequency = 0;
+        uint16_t format = 0;
+        int channels = 0;
+
+        bool operator==(const SoundBankFormat& other) const {
+            return frequency == other.frequency && format == other.format && channels == other.channels;
+        }
+        bool operator!=(const SoundBankFormat& other) const { return !(*this == other); }
+    };
+
+    struct SoundBankSound {
+        std::string name;
+        int category = 0;              // AudioCategory index
+        int priority = 0;
+        const uint8_t* data = nullptr; // PCM in the bank's format (points into the mapping once opened)
+        uint32_t size = 0;
+    };
+
+    /**
+     * Sound Bank
+     *
+     * One file of pre-decoded PCM plus a table of contents:
+     *
+     *   header | table of contents | names | PCM (each sound 16 byte aligned)
+     *
+     * The PCM is already at the output device's rate, format and channel
+     * count, so a channel can play it directly (Mix_QuickLoad_RAW) from the
+     * memory mapping: no decoding, resampling or copying at load time.
+     * Banks are built for one device format, in native byte order; a bank
+     * whose format no longer matches must be rebuilt. Packed builds carry
+     * banks the asset packer built offline, read in place from the archive.
+     */
+    class SoundBank {
+    public:
+        bool Open(const std::string& path);   // Maps and validates the file
+        bool Open(const utils::AssetView& packed, const std::string& path); // In place from the archive (must stay mounted)
+        void Close();
+        bool IsOpen() const { return m_data != nullptr; }
+
+        const SoundBankFormat& GetFormat() const { return m_format; }
+        const std::vector<SoundBankSound>& GetSounds() const { return m_sounds; }
+        size_t GetSize() const { return m_size; }
+
+        // Write a bank (temp file + rename, so a loaded bank is never half overwritten)
+        static bool Write(const std::string& path, const SoundBankFormat& format, const std::vector<SoundBankSound>& sounds);
+
+    private:
+        bool Parse(const std::string& path);
+
+        utils::MappedFile m_file;      // Loose banks only
+        const uint8_t* m_data = nullptr;
+        size_t m_size = 0;
+        SoundBankFormat m_format;
+        std::vector<SoundBankSound> m_sounds;
+    };
+
+} // namespace audio
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <cstddef>
+
+namespace core {
+
+    /**
+     * Axis-aligned bounding box in world space (min = top-left, max = bottom-right in y-down coordinates)
+     */
+    struct Bounds {
+        glm::vec2 min = {0.0f, 0.0f};
+        glm::vec2 max = {0.0f, 0.0f};
+
+        Bounds() = default;
+        Bounds(const glm::vec2& minimum, const glm::vec2& maximum) : min(minimum), max(maximum) {}
+
+        static Bounds FromPoints(const glm::vec2* points, size_t count) {
+            if (count == 0) {
+                return {};
+            }
+            Bounds bounds(points[0], points[0]);
+            for (size_t i = 1; i < count; ++i) {
+                bounds.min.x = std::min(bounds.min.x, points[i].x);
+                bounds.min.y = std::min(bounds.min.y, points[i].y);
+                bounds.max.x = std::max(bounds.max.x, points[i].x);
+                bounds.max.y = std::max(bounds.max.y, points[i].y);
+            }
+            return bounds;
+        }
+
+        // Touching edges count as overlapping
+        bool Overlaps(const Bounds& other) const {
+            return min.x <= other.max.x && max.x >= other.min.x &&
+                   min.y <= other.max.y && max.y >= other.min.y;
+        }
+
+        bool Contains(const glm::vec2& point) const {
+            return point.x >= min.x && point.x <= max.x && point.y >= min.y && point.y <= max.y;
+        }
+
+        glm::vec2 GetSize() const { return max - min; }
+        glm::vec2 GetCenter() const { return (min + max) * 0.5f; }
+    };
+
+} // namespace core
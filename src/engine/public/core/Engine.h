@@ -1,30 +1,58 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
 
 namespace audio { class AudioManager; }
+namespace debug { class ProfilerOverlay; }
+namespace ecs { class Registry; class StaticSpriteIndex; }
 namespace input { class Input; }
+namespace particles { class ParticleSystem; }
 namespace physics { class Physics; }
 namespace rendering { class Renderer; class Window; }
 namespace save { class SaveManager; }
 namespace text { class FontManager; class TextRenderer; }
-namespace utils { class Config; class ResourceManager; class Logger; }
+namespace utils { class Config; class HotReloader; class ResourceManager; class Logger; }
+namespace world { class WorldStreamer; }
 
 namespace core {
+    class FrameArena;
+    class FramePacer;
     class IGameApplication;
+    class JobSystem;
+    
+    // Startup options for hosts other than the game itself (e.g. the EngineBench benchmark)
+    struct EngineOptions {
+        bool hiddenWindow = false;     // Never show the window (rendering still goes to its GL context)
+        bool saveConfigOnExit = true;  // Write the config back to assets/settings.json in Shutdown()
+        bool hotReload = true;         // Watch assets/ for changes (also needs "hot_reload.enabled")
+    };
     
     class Engine {
     public:
         // Lifecycle
-        static bool Initialize();
+        static bool Initialize(const EngineOptions& options = {});
         static void Run();
+        static void RequestQuit(); // Run() returns after the current frame
         static void Shutdown();
         static bool IsInitialized();
         
+        // Fixed timestep info. Alpha (0..1) is how far the frame is past the last physics step - blend
+        // the previous and current step states with it when rendering (see RigidBody::GetInterpolatedTransform).
+        static float GetInterpolationAlpha();
+        static float GetFixedTimestep();
+        
         // System access - Clean static API
         static audio::AudioManager& Audio();
+        static ecs::Registry& Entities();
+        static FrameArena& FrameMemory(); // Scratch memory, released at the start of every frame
+        static FramePacer& FramePacing(); // Loop mode and frame-time statistics (p50/p99)
+        static utils::HotReloader& HotReload(); // Reloads changed files under assets/ (see HotReloader)
+        static ecs::StaticSpriteIndex& StaticSprites(); // Grid over StaticSprite-tagged entities (culled draw)
         static input::Input& Input();
+        static JobSystem& Jobs();
         static utils::Logger& Logger();
+        static particles::ParticleSystem& Particles();
         static physics::Physics& Physics();
         static rendering::Renderer& Renderer();
         static rendering::Window& Window();
@@ -33,6 +61,7 @@ namespace core {
         static text::TextRenderer& TextRenderer();
         static utils::Config& Config();
         static utils::ResourceManager& Resources();
+        static world::WorldStreamer& World(); // Streams level regions near the camera (see LoadWorld)
         
         // Internal access (for engine code only)
         static Engine& Instance();
@@ -42,6 +71,8 @@ namespace core {
         void Update(float deltaTime);
         void Render();
         void HandleEvents();
+        static void ConfigureFramePacing();
+        static void ApplyAudioConfig();
         Engine() = default;
         ~Engine() = default;
         Engine(const Engine&) = delete;
@@ -51,7 +82,14 @@ namespace core {
         
         // System instances (unique_ptr for proper cleanup)
         std::unique_ptr<audio::AudioManager> m_audioManager;
+        std::unique_ptr<ecs::Registry> m_registry;
+        std::unique_ptr<ecs::StaticSpriteIndex> m_staticSprites;
+        std::unique_ptr<FrameArena> m_frameArena;
+        std::unique_ptr<FramePacer> m_framePacer;
+        std::unique_ptr<utils::HotReloader> m_hotReloader;
         std::unique_ptr<input::Input> m_input;
+        std::unique_ptr<JobSystem> m_jobSystem;
+        std::unique_ptr<particles::ParticleSystem> m_particleSystem;
         std::unique_ptr<physics::Physics> m_physics;
         std::unique_ptr<rendering::Renderer> m_renderer;
         std::unique_ptr<rendering::Window> m_window;
@@ -59,14 +97,23 @@ namespace core {
         std::unique_ptr<text::FontManager> m_fontManager;
         std::unique_ptr<text::TextRenderer> m_textRenderer;
         std::unique_ptr<utils::ResourceManager> m_resourceManager;
+        std::unique_ptr<world::WorldStreamer> m_worldStreamer;
+#ifdef ENGINE_PROFILER_ENABLED
+        std::unique_ptr<debug::ProfilerOverlay> m_profilerOverlay;
+#endif
         
         bool m_initialized = false;
+        EngineOptions m_options;
         
         // Game loop state
         bool m_isRunning = false;
         float m_fixedTimestep = 1.0f / 60.0f;  // Default 60Hz
         float m_physicsAccumulator = 0.0f;
         int m_maxFixedSteps = 5;  // Prevent spiral of death
+        float m_interpolationAlpha = 1.0f;
+        bool m_interpolationEnabled = true;
+        float m_maxDeltaTime = 0.05f;  // Cap on the variable delta ("game.max_delta_time")
+        uint32_t m_audioConfigSubscription = 0; // utils::ConfigSubscription for the "audio" section
         std::unique_ptr<IGameApplication> m_gameApp;
     };
 }
\ No newline at end of file
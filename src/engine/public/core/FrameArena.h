@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace core {
+
+    /**
+     * Frame Arena
+     *
+     * Linear allocator for scratch memory that only lives for one frame.
+     * Allocating is a pointer bump, freeing does nothing, and Reset() at the
+     * top of every frame (Engine::Run does this) hands everything back at
+     * once. If a frame needs more than the arena holds, the rest comes from
+     * overflow chunks and the arena grows on the next Reset, so a steady
+     * workload settles on zero heap allocations.
+     *
+     * It is a std::pmr::memory_resource, so pmr containers can use it
+     * directly. Nothing allocated from it may be kept past the frame, and
+     * destructors are never run. Not thread-safe: use it from the main
+     * thread (or one job at a time).
+     *
+     * Usage:
+     *   core::FrameArena& arena = core::Engine::FrameMemory();
+     *   std::pmr::vector<Region*> visible(&arena);
+     *   float* weights = arena.AllocateArray<float>(count);
+     */
+    class FrameArena : public std::pmr::memory_resource {
+    public:
+        static constexpr size_t DEFAULT_CAPACITY = 1024 * 1024;
+
+        explicit FrameArena(size_t capacity = DEFAULT_CAPACITY);
+        ~FrameArena() override;
+
+        FrameArena(const FrameArena&) = delete;
+        FrameArena& operator=(const FrameArena&) = delete;
+
+        void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+        template <typename T>
+        T* AllocateArray(size_t count) {
+            return static_cast<T*>(Allocate(sizeof(T) * count, alignof(T)));
+        }
+
+        template <typename T, typename... Args>
+        T* New(Args&&... args) {
+            static_assert(std::is_trivially_destructible_v<T>, "FrameArena never runs destructors");
+            return new (Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+        }
+
+        // Release everything allocated since the last Reset (grows the arena after an overflow)
+        void Reset();
+        void Reserve(size_t capacity);
+
+        // Stats
+        size_t GetUsed() const { return m_frameBytes; }         // This frame, including overflow
+        size_t GetCapacity() const { return m_capacity; }
+        size_t GetPeak() const { return m_peakBytes; }          // Largest frame so far
+        size_t GetOverflowCount() const { return m_overflowCount; } // Frames that did not fit
+
+    private:
+        void* do_allocate(size_t bytes, size_t alignment) override;
+        void do_deallocate(void*, size_t, size_t) override {} // Released by Reset
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+        void* AllocateOverflow(size_t size, size_t alignment);
+        void ReleaseOverflow();
+
+        static constexpr size_t BUFFER_ALIGNMENT = 64;
+        static constexpr size_t OVERFLOW_CHUNK_SIZE = 64 * 1024;
+
+        struct Chunk {
+            std::byte* data = nullptr;
+            size_t size = 0;
+        };
+
+        std::byte* m_buffer = nullptr;
+        size_t m_capacity = 0;
+        size_t m_offset = 0;
+
+        std::vector<Chunk> m_overflow; // Only touched when a frame doesn't fit
+        size_t m_overflowOffset = 0;   // Into the last overflow chunk
+        bool m_overflowed = false;
+
+        size_t m_frameBytes = 0;
+        size_t m_peakBytes = 0;
+        size_t m_overflowCount = 0;
+    };
+
+} // namespace core
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace core {
+
+    // How Engine::Run paces frames ("game.loop_mode" in settings.json)
+    enum class LoopMode {
+        Vsync,          // "vsync" - block in the buffer swap
+        AdaptiveVsync,  // "adaptive_vsync" - vsync, but late frames tear instead of waiting a whole interval
+        Uncapped,       // "uncapped" - no waiting at all
+        TargetRate,     // "target" - swap immediately, hold "game.target_fps" with a sleep+spin wait
+        LowLatency      // "low_latency" - like target, but the wait happens before input is sampled
+    };
+
+    // Frame-to-frame interval statistics over the recent history
+    struct FrameTimeStats {
+        float averageMs = 0.0f;
+        float p50Ms = 0.0f;
+        float p99Ms = 0.0f;
+        float maxMs = 0.0f;
+        size_t sampleCount = 0;
+    };
+
+    /**
+     * Frame Pacer
+     *
+     * Owns the game loop's timing. BeginFrame() marks the start of a frame
+     * and returns the (uncapped) delta time since the previous one; EndFrame()
+     * marks the end of the frame's work and, in TargetRate mode, waits until
+     * the next frame is due.
+     *
+     * Waits sleep in 1 ms steps while more than "game.spin_threshold_ms" is
+     * left and then spin on SDL_GetPerformanceCounter, so the deadline is hit
+     * to within microseconds instead of SDL_Delay's 1-2 ms overshoot.
+     *
+     * LowLatency mode moves the wait to the start of BeginFrame(): it sleeps
+     * until the deadline minus the expected work time (median of recent
+     * frames plus a margin), so input is sampled as late as possible.
+     *
+     * Frame intervals are kept in a ring buffer for GetStats() (p50/p99
+     * jitter); this is available in every build, not just profiler builds.
+     */
+    class FramePacer {
+    public:
+        static constexpr size_t HISTORY_SIZE = 256;
+
+        FramePacer();
+
+        void Configure(LoopMode mode, float targetFps, float spinThresholdMs);
+
+        // Frame bracket (main thread)
+        float BeginFrame(); // Returns seconds since the previous BeginFrame (0 on the first frame)
+        void EndFrame();
+
+        FrameTimeStats GetStats() const;
+
+        LoopMode GetMode() const { return m_mode; }
+        float GetTargetFps() const { return m_targetFps; }
+        int GetSwapInterval() const; // Swap interval the mode expects (1, -1 or 0)
+
+        static LoopMode ParseMode(const std::string& name, LoopMode fallback);
+        static const char* GetModeName(LoopMode mode);
+
+    private:
+        void WaitUntil(uint64_t deadline) const;
+        uint64_t EstimateWorkTicks() const;
+
+        LoopMode m_mode = LoopMode::Vsync;
+        float m_targetFps = 60.0f;
+        uint64_t m_frequency = 0;
+        uint64_t m_frameTicks = 0;       // Target interval (TargetRate/LowLatency)
+        uint64_t m_spinTicks = 0;        // Remaining time below which the wait spins
+        uint64_t m_nextDeadline = 0;     // When the next frame should start (TargetRate/LowLatency)
+        uint64_t m_frameStart = 0;
+        uint64_t m_lastFrameStart = 0;
+
+        // Work time (BeginFrame -> EndFrame) history for the low-latency estimate
+        static constexpr size_t WORK_HISTORY_SIZE = 16;
+        std::array<uint64_t, WORK_HISTORY_SIZE> m_workTicks = {};
+        size_t m_workCount = 0;
+
+        std::array<float, HISTORY_SIZE> m_frameTimesMs = {};
+        size_t m_frameTimeCount = 0;
+        size_t m_frameTimeNext = 0;
+    };
+
+} // namespace core
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace core {
+
+    class JobSystem;
+
+    /**
+     * Initialization Graph
+     *
+     * Startup steps with named dependencies. Run() starts every step as
+     * soon as all of its dependencies have finished: ordinary steps go to
+     * the job system, main-thread steps (window, GL context, anything that
+     * writes config or subscribes to it) run on the calling thread in the
+     * meantime. A step returns false for a fatal error - nothing new is
+     * started after that and Run() returns false once the running steps
+     * are done.
+     *
+     * Every step is timed, and LogTimeline() prints when each one ran, on
+     * which thread, and the chain of steps that decided the total time.
+     *
+     * Usage:
+     *   core::InitGraph graph;
+     *   graph.Add("audio", {}, [] { return InitAudio(); });
+     *   graph.AddOnMainThread("window", {}, [] { return CreateWindow(); });
+     *   graph.AddOnMainThread("renderer", {"window"}, [] { return CreateRenderer(); });
+     *   if (!graph.Run(&jobs)) { ... }
+     *   graph.LogTimeline();
+     */
+    class InitGraph {
+    public:
+        using StepFunction = std::function<bool()>;
+
+        struct StepTiming {
+            std::string name;
+            float startMs = 0.0f;         // Since Run() started
+            float endMs = 0.0f;
+            size_t threadIndex = 0;       // JobSystem thread index (0 = main thread)
+            bool ran = false;             // False if skipped after an earlier failure
+            bool succeeded = false;
+        };
+
+        void Add(std::string name, std::vector<std::string> dependencies, StepFunction step);
+        void AddOnMainThread(std::string name, std::vector<std::string> dependencies, StepFunction step);
+
+        // Without a job system (or with no workers) every step runs on this thread, in dependency order
+        bool Run(JobSystem* jobs);
+
+        void LogTimeline() const;
+        std::vector<StepTiming> GetTimeline() const;
+        std::vector<std::string> GetCriticalPath() const; // Steps whose finish held up the last one, in order
+        float GetTotalMs() const { return m_totalMs; }
+
+    private:
+        enum class State { Pending, Running, Done, Failed, Skipped };
+
+        struct Step {
+            std::string name;
+            std::vector<std::string> dependencies;
+            std::vector<size_t> dependencyIndices;
+            StepFunction function;
+            bool mainThread = false;
+            State state = State::Pending;
+            StepTiming timing;
+        };
+
+        void AddStep(std::string name, std::vector<std::string> dependencies, StepFunction step, bool mainThread);
+        bool ResolveDependencies();
+        bool IsReady(const Step& step) const; // m_mutex must be held
+        void Execute(size_t index);           // Runs the step and records the result (locks m_mutex)
+        float ElapsedMs() const;
+
+        // Only touched under m_mutex while Run() is in progress
+        std::vector<Step> m_steps;
+        std::mutex m_mutex;
+        std::condition_variable m_stepFinished;
+        size_t m_running = 0;
+        bool m_failed = false;
+
+        JobSystem* m_jobs = nullptr; // While running in parallel
+        uint64_t m_startTicks = 0;
+        float m_totalMs = 0.0f;
+    };
+
+} // namespace core
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace core {
+
+    using JobFunction = std::function<void()>;
+
+    class JobSystem;
+
+    /**
+     * Job Counter
+     *
+     * Fence for a group of jobs. Every job submitted with a counter
+     * increments it and decrements it when finished. Wait on it with
+     * JobSystem::Wait(), or attach follow-up jobs with JobSystem::SubmitAfter()
+     * which are queued the moment the counter reaches zero.
+     *
+     * A counter must outlive all jobs that reference it.
+     */
+    class JobCounter {
+    public:
+        JobCounter() = default;
+        JobCounter(const JobCounter&) = delete;
+        JobCounter& operator=(const JobCounter&) = delete;
+
+        bool IsDone() const { return m_pending.load(std::memory_order_acquire) == 0; }
+
+    private:
+        friend class JobSystem;
+
+        std::atomic<int> m_pending{0};
+        std::mutex m_continuationMutex;
+        std::vector<std::pair<JobFunction, JobCounter*>> m_continuations;
+    };
+
+    /**
+     * Job System
+     *
+     * Work-stealing thread pool. Each worker (and the main thread) owns a
+     * deque: jobs submitted from a thread go to its own deque, owners pop
+     * from the back (newest, cache-warm) and idle threads steal from the
+     * front of other deques. Threads waiting on a counter run jobs instead
+     * of blocking, so waiting from inside a job never deadlocks.
+     *
+     * Usage:
+     *   auto& jobs = core::Engine::Jobs();
+     *
+     *   core::JobCounter counter;
+     *   jobs.Submit([] { BuildNavMesh(); }, &counter);
+     *   jobs.SubmitAfter(counter, [] { SpawnAgents(); });
+     *   jobs.Wait(counter);
+     *
+     *   jobs.ParallelFor(particles.size(), 256, [&](size_t begin, size_t end) {
+     *       for (size_t i = begin; i < end; ++i) particles[i].Update(deltaTime);
+     *   });
+     */
+    class JobSystem {
+    public:
+        JobSystem();
+        ~JobSystem();
+
+        JobSystem(const JobSystem&) = delete;
+        JobSystem& operator=(const JobSystem&) = delete;
+
+        // System lifecycle (workerCount 0 = one per hardware thread, minus the main thread)
+        bool Initialize(int workerCount = 0);
+        void Shutdown();
+        bool IsInitialized() const { return m_initialized; }
+
+        // Job submission
+        void Submit(JobFunction job, JobCounter* counter = nullptr);
+        void SubmitAfter(JobCounter& dependency, JobFunction job, JobCounter* counter = nullptr);
+
+        // Blocks until the counter reaches zero, running queued jobs meanwhile
+        void Wait(JobCounter& counter);
+
+        // Split [0, count) into batches of batchSize and run them across all threads (blocks)
+        void ParallelFor(size_t count, size_t batchSize, const std::function<void(size_t begin, size_t end)>& body);
+
+        // Info
+        size_t GetWorkerCount() const { return m_workers.size(); }
+        size_t GetThreadCount() const { return m_queues.size(); } // Workers + main thread
+        bool IsWorkerThread() const;
+        size_t GetCurrentThreadIndex() const; // 0 = main thread (and threads not owned by the system), 1..N = workers
+
+    private:
+        struct Job {
+            JobFunction function;
+            JobCounter* counter = nullptr;
+        };
+
+        struct WorkQueue {
+            std::mutex mutex;
+            std::deque<Job> jobs;
+        };
+
+        void WorkerLoop(size_t queueIndex);
+        void Enqueue(Job job);
+        bool TryRunOne();
+        bool PopLocal(size_t queueIndex, Job& job);
+        bool Steal(size_t thiefIndex, Job& job);
+        void Execute(Job& job);
+        void FinishJob(JobCounter* counter);
+        size_t CurrentQueueIndex() const;
+
+        std::vector<std::unique_ptr<WorkQueue>> m_queues; // [0] = main thread
+        std::vector<std::thread> m_workers;
+
+        // Idle workers sleep here until work arrives
+        std::mutex m_sleepMutex;
+        std::condition_variable m_wakeCondition;
+        std::atomic<int> m_queuedJobs{0};
+        std::atomic<bool> m_running{false};
+
+        bool m_initialized = false;
+    };
+
+} // namespace core
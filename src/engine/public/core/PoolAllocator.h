@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <memory_resource>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace core {
+
+    /**
+     * Pool Allocator
+     *
+     * Fixed-size blocks carved from chunks allocated upfront, with freed
+     * blocks kept on an intrusive free list - allocating and freeing are a
+     * couple of pointer moves and memory is only returned on destruction.
+     * Good for many objects of one type that come and go (particles,
+     * events, nodes).
+     *
+     * As a std::pmr::memory_resource it serves every request that fits a
+     * block and passes larger ones to the upstream resource. Not thread-safe.
+     *
+     * Usage:
+     *   core::PoolAllocator pool(sizeof(Bullet), 256);
+     *   Bullet* bullet = pool.New<Bullet>(position, velocity);
+     *   pool.Delete(bullet);
+     */
+    class PoolAllocator : public std::pmr::memory_resource {
+    public:
+        PoolAllocator(size_t blockSize, size_t blocksPerChunk = 64, size_t alignment = alignof(std::max_align_t),
+                      std::pmr::memory_resource* upstream = std::pmr::new_delete_resource());
+        ~PoolAllocator() override;
+
+        PoolAllocator(const PoolAllocator&) = delete;
+        PoolAllocator& operator=(const PoolAllocator&) = delete;
+
+        void* Allocate();
+        void Deallocate(void* block);
+
+        template <typename T, typename... Args>
+        T* New(Args&&... args) {
+            assert(Fits(sizeof(T), alignof(T)) && "Type does not fit the pool's blocks");
+            if (!Fits(sizeof(T), alignof(T))) return nullptr;
+            return new (Allocate()) T(std::forward<Args>(args)...);
+        }
+
+        template <typename T>
+        void Delete(T* object) {
+            if (!object) return;
+            object->~T();
+            Deallocate(object);
+        }
+
+        // Stats
+        size_t GetBlockSize() const { return m_blockSize; }
+        size_t GetUsedBlocks() const { return m_usedBlocks; }
+        size_t GetCapacityBlocks() const { return m_chunks.size() * m_blocksPerChunk; }
+
+    private:
+        void* do_allocate(size_t bytes, size_t alignment) override;
+        void do_deallocate(void* pointer, size_t bytes, size_t alignment) override;
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+        bool Fits(size_t bytes, size_t alignment) const { return bytes <= m_blockSize && alignment <= m_alignment; }
+        void AddChunk();
+
+        struct FreeBlock {
+            FreeBlock* next;
+        };
+
+        size_t m_blockSize;
+        size_t m_blocksPerChunk;
+        size_t m_alignment;
+        std::pmr::memory_resource* m_upstream;
+
+        std::vector<void*> m_chunks;
+        FreeBlock* m_freeList = nullptr;
+        size_t m_usedBlocks = 0;
+    };
+
+} // namespace core
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+namespace core {
+
+    /**
+     * Ring Buffer
+     *
+     * Fixed-capacity lock-free queue for exactly one producer thread and
+     * one consumer thread (which may be the same thread). Nothing is
+     * allocated after construction; Push fails instead of growing when the
+     * buffer is full. Capacity must be a power of two.
+     *
+     * Usage:
+     *   core::RingBuffer<InputEvent, 256> events;
+     *   events.Push(event);              // Producer
+     *   while (events.Pop(event)) { }    // Consumer
+     */
+    template <typename T, size_t Capacity>
+    class RingBuffer {
+        static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "RingBuffer capacity must be a power of two");
+
+    public:
+        RingBuffer() = default;
+        RingBuffer(const RingBuffer&) = delete;
+        RingBuffer& operator=(const RingBuffer&) = delete;
+
+        // Producer side
+        bool Push(const T& item) {
+            const size_t head = m_head.load(std::memory_order_relaxed);
+            if (head - m_tail.load(std::memory_order_acquire) == Capacity) {
+                return false;
+            }
+            m_items[head & MASK] = item;
+            m_head.store(head + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Consumer side
+        bool Pop(T& item) {
+            const size_t tail = m_tail.load(std::memory_order_relaxed);
+            if (tail == m_head.load(std::memory_order_acquire)) {
+                return false;
+            }
+            item = m_items[tail & MASK];
+            m_tail.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Approximate while the other side is running
+        size_t Size() const {
+            return m_head.load(std::memory_order_acquire) - m_tail.load(std::memory_order_acquire);
+        }
+        bool IsEmpty() const { return Size() == 0; }
+        static constexpr size_t GetCapacity() { return Capacity; }
+
+    private:
+        static constexpr size_t MASK = Capacity - 1;
+
+        // Separate cache lines so producer and consumer don't false-share
+        alignas(64) std::atomic<size_t> m_head{0};
+        alignas(64) std::atomic<size_t> m_tail{0};
+        T m_items[Capacity];
+    };
+
+} // namespace core
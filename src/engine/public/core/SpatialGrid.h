@@ -0,0 +1,63 @@
+#pragma once
+
+#include "Bounds.h"
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace core {
+
+    /**
+     * Spatial Grid
+     *
+     * Uniform grid over world space for objects that don't move. Each item
+     * is listed in every cell its bounds touch; cells are allocated only
+     * where items exist, so the world can be unbounded and sparse.
+     *
+     * Query() returns every item overlapping an area exactly once, in
+     * insertion order (stable draw order no matter which cells were hit).
+     * There is no per-item removal: clear and re-insert when the set of
+     * items changes.
+     */
+    class SpatialGrid {
+    public:
+        explicit SpatialGrid(float cellSize = 256.0f);
+
+        void SetCellSize(float cellSize); // Clears the grid
+        float GetCellSize() const { return m_cellSize; }
+
+        void Clear();
+        void Reserve(size_t itemCount);
+        void Insert(uint32_t id, const Bounds& bounds);
+
+        // Appends the ids of items overlapping area to results
+        void Query(const Bounds& area, std::vector<uint32_t>& results) const;
+
+        size_t GetItemCount() const { return m_items.size(); }
+        size_t GetCellCount() const { return m_cells.size(); }
+
+    private:
+        struct Item {
+            uint32_t id;
+            Bounds bounds;
+        };
+
+        struct CellRange {
+            int32_t minX, minY, maxX, maxY;
+        };
+
+        CellRange GetCellRange(const Bounds& bounds) const;
+        static uint64_t MakeKey(int32_t x, int32_t y);
+
+        float m_cellSize;
+        std::vector<Item> m_items;
+        std::unordered_map<uint64_t, std::vector<uint32_t>> m_cells; // Cell key -> item indices
+
+        // Query scratch (dedup of items spanning several cells)
+        mutable std::vector<uint32_t> m_visitStamps; // Per item: last query that reported it
+        mutable std::vector<uint32_t> m_hits;
+        mutable uint32_t m_queryStamp = 0;
+    };
+
+} // namespace core
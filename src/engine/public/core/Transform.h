@@ -1,6 +1,7 @@
 #pragma once
 
 #include <glm/glm.hpp>
+#include <cmath>
 
 namespace core {
 
@@ -43,6 +44,20 @@ namespace core {
         
         // Get rotation in radians for calculations
         float GetRotationRadians() const { return glm::radians(rotation); }
+        
+        // Blend between two states (e.g. the last two fixed steps; rotation takes the shortest arc)
+        static float LerpDegrees(float from, float to, float alpha) {
+            float delta = std::fmod(to - from, 360.0f);
+            if (delta > 180.0f) delta -= 360.0f;
+            if (delta < -180.0f) delta += 360.0f;
+            return from + delta * alpha;
+        }
+        
+        static Transform Interpolate(const Transform& previous, const Transform& current, float alpha) {
+            return Transform(previous.position + (current.position - previous.position) * alpha,
+                             LerpDegrees(previous.rotation, current.rotation, alpha),
+                             previous.scale + (current.scale - previous.scale) * alpha);
+        }
     };
 
 } // namespace core
\ No newline at end of file
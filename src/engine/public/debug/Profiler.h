@@ -0,0 +1,142 @@
+#pragma once
+
+/**
+ * Frame Profiler
+ *
+ * Scoped CPU timers, a GPU timer query around the render pass and a ring
+ * buffer of per-frame samples for the profiler overlay. Profiled builds
+ * also replace the global operator new/delete to count heap allocations
+ * per frame (every thread's, so jobs and the render thread count too).
+ *
+ * Everything here is compiled out unless ENGINE_PROFILER_ENABLED is defined
+ * (CMake option ENGINE_ENABLE_PROFILER, never set for Release builds). The
+ * macros expand to nothing when disabled, so they can stay in shipping code.
+ *
+ * Usage (engine or game code):
+ *   void MyGame::Update(float deltaTime) {
+ *       ENGINE_PROFILE_FUNCTION();
+ *       {
+ *           ENGINE_PROFILE_SCOPE("AI");   // Name must be a string literal
+ *           UpdateAI(deltaTime);
+ *       }
+ *   }
+ */
+
+#ifdef ENGINE_PROFILER_ENABLED
+
+#include <array>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace rendering {
+    struct RenderStats;
+}
+
+namespace debug {
+
+    // One timed scope within a frame
+    struct ProfileScope {
+        const char* name = nullptr; // Static string (literal or __func__)
+        uint16_t depth = 0;         // Nesting level, 0 = top level
+        float startMs = 0.0f;       // Relative to the start of the frame
+        float durationMs = 0.0f;
+    };
+
+    // Everything recorded for a single frame
+    struct ProfileFrame {
+        uint64_t index = 0;
+        float cpuMs = 0.0f;
+        float gpuMs = -1.0f;        // -1 until the GPU query result arrives (or if unsupported)
+        uint32_t drawCalls = 0;
+        uint32_t flushes = 0;
+        uint32_t sprites = 0;
+        uint32_t allocations = 0;   // operator new calls during the frame
+        uint64_t allocatedBytes = 0;
+        size_t frameArenaBytes = 0; // core::FrameArena usage
+        std::vector<ProfileScope> scopes;
+    };
+
+    // Process-wide operator new totals since startup
+    uint64_t GetAllocationCount();
+    uint64_t GetAllocatedBytes();
+
+    class Profiler {
+    public:
+        static constexpr size_t HISTORY_SIZE = 240;
+
+        static Profiler& Instance();
+
+        // Frame bracket (main thread)
+        void BeginFrame();
+        void EndFrame(const rendering::RenderStats& renderStats, size_t frameArenaBytes = 0);
+
+        // Scopes (only recorded on the thread that called BeginFrame)
+        void PushScope(const char* name);
+        void PopScope();
+
+        // GPU timing (requires a current GL context and ARB_timer_query)
+        void InitializeGpuTimers();
+        void ShutdownGpuTimers();
+        void BeginGpuTimer();
+        void EndGpuTimer();
+        bool IsGpuTimingAvailable() const { return m_gpuAvailable; }
+
+        // History (0 = last completed frame)
+        size_t GetFrameCount() const;
+        const ProfileFrame& GetFrame(size_t framesAgo) const;
+
+    private:
+        Profiler() = default;
+
+        static constexpr int GPU_QUERY_COUNT = 4; // Frames of latency before results are read
+
+        void CollectGpuResults();
+        ProfileFrame* FindFrame(uint64_t index);
+
+        std::array<ProfileFrame, HISTORY_SIZE> m_history;
+        uint64_t m_completedFrames = 0;
+
+        ProfileFrame m_current;
+        std::vector<size_t> m_scopeStack; // Indices into m_current.scopes
+        std::vector<uint64_t> m_scopeStartTicks;
+        uint64_t m_frameStartTicks = 0;
+        uint64_t m_frameStartAllocations = 0;
+        uint64_t m_frameStartBytes = 0;
+        std::thread::id m_frameThread;
+        bool m_inFrame = false;
+
+        // GPU timer queries (ring so results are read without stalling)
+        unsigned int m_gpuQueries[GPU_QUERY_COUNT] = {};
+        uint64_t m_gpuQueryFrame[GPU_QUERY_COUNT] = {};
+        bool m_gpuQueryPending[GPU_QUERY_COUNT] = {};
+        int m_gpuQueryIndex = 0;
+        bool m_gpuAvailable = false;
+        bool m_gpuTimerActive = false;
+    };
+
+    /**
+     * RAII helper behind ENGINE_PROFILE_SCOPE
+     */
+    class ScopedTimer {
+    public:
+        explicit ScopedTimer(const char* name) { Profiler::Instance().PushScope(name); }
+        ~ScopedTimer() { Profiler::Instance().PopScope(); }
+
+        ScopedTimer(const ScopedTimer&) = delete;
+        ScopedTimer& operator=(const ScopedTimer&) = delete;
+    };
+
+} // namespace debug
+
+#define ENGINE_PROFILE_CONCAT_INNER(a, b) a##b
+#define ENGINE_PROFILE_CONCAT(a, b) ENGINE_PROFILE_CONCAT_INNER(a, b)
+#define ENGINE_PROFILE_SCOPE(name) ::debug::ScopedTimer ENGINE_PROFILE_CONCAT(profileScope_, __LINE__)(name)
+#define ENGINE_PROFILE_FUNCTION() ENGINE_PROFILE_SCOPE(__func__)
+
+#else
+
+#define ENGINE_PROFILE_SCOPE(name) ((void)0)
+#define ENGINE_PROFILE_FUNCTION() ((void)0)
+
+#endif // ENGINE_PROFILER_ENABLED
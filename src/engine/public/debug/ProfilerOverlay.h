@@ -0,0 +1,49 @@
+#pragma once
+
+#ifdef ENGINE_PROFILER_ENABLED
+
+#include <SDL.h>
+
+namespace debug {
+
+    /**
+     * Profiler Overlay
+     *
+     * ImGui window showing the frame profiler's history: frame-time graph,
+     * per-scope breakdown of the last frame, renderer counters and the
+     * ResourceManager's per-texture memory.
+     * Toggle with F3 (initial state from "debug.profiler_overlay").
+     *
+     * Owns the ImGui context and its SDL2/OpenGL backends. Only present in
+     * builds with ENGINE_PROFILER_ENABLED.
+     */
+    class ProfilerOverlay {
+    public:
+        ProfilerOverlay();
+        ~ProfilerOverlay();
+
+        // System lifecycle (requires the renderer's GL context)
+        bool Initialize(SDL_Window* window, void* glContext);
+        void Shutdown();
+        bool IsInitialized() const { return m_initialized; }
+
+        // Feed SDL events to ImGui; returns true if the event toggled the overlay
+        bool ProcessEvent(const SDL_Event& event);
+
+        // Draw the overlay on top of the finished frame
+        void Render();
+
+        void SetVisible(bool visible) { m_visible = visible; }
+        bool IsVisible() const { return m_visible; }
+
+    private:
+        void DrawWindow();
+        void DrawTextureStats();
+
+        bool m_initialized = false;
+        bool m_visible = false;
+    };
+
+} // namespace debug
+
+#endif // ENGINE_PROFILER_ENABLED
@@ -0,0 +1,182 @@
+#pragma once
+
+#include "Entity.h"
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace ecs {
+
+    /**
+     * Type-erased pool interface (lets the registry drop an entity's components without knowing their types)
+     */
+    class IComponentPool {
+    public:
+        virtual ~IComponentPool() = default;
+        virtual bool Contains(Entity entity) const = 0;
+        virtual void Remove(Entity entity) = 0;
+        virtual void Clear() = 0;
+        virtual size_t Size() const = 0;
+
+        // Bumped by every Add/Remove/Clear, so caches built from a pool can tell when it changed
+        uint32_t GetRevision() const { return m_revision; }
+
+    protected:
+        uint32_t m_revision = 0;
+    };
+
+    /**
+     * Entity Set
+     *
+     * Sparse-set index shared by the pools:
+     * - m_sparse maps entity index -> dense slot (NPOS if absent)
+     * - m_entities[i] owns slot i of the pool's dense arrays
+     *
+     * Lookup, insert and remove are O(1); removal swaps the last element
+     * into the hole, so iteration order is not stable and references are
+     * invalidated by Add/Remove on the same pool.
+     */
+    class EntitySet : public IComponentPool {
+    public:
+        static constexpr uint32_t NPOS = 0xFFFFFFFFu;
+
+        bool Contains(Entity entity) const override {
+            const uint32_t index = EntityTraits::GetIndex(entity);
+            return index < m_sparse.size() && m_sparse[index] != NPOS && m_entities[m_sparse[index]] == entity;
+        }
+
+        // Dense slot of the entity, NPOS if it has no component here
+        uint32_t Find(Entity entity) const {
+            return Contains(entity) ? m_sparse[EntityTraits::GetIndex(entity)] : NPOS;
+        }
+
+        size_t Size() const override { return m_entities.size(); }
+        bool Empty() const { return m_entities.empty(); }
+
+        // Dense entity array (slot i of every component array belongs to entity i)
+        const std::vector<Entity>& GetEntities() const { return m_entities; }
+
+    protected:
+        // Appends the entity; its components go to the returned slot (the back of the dense arrays)
+        uint32_t Insert(Entity entity) {
+            assert(!Contains(entity) && "Entity already has this component");
+
+            const uint32_t index = EntityTraits::GetIndex(entity);
+            if (index >= m_sparse.size()) {
+                m_sparse.resize(index + 1, NPOS);
+            }
+
+            const uint32_t slot = static_cast<uint32_t>(m_entities.size());
+            m_sparse[index] = slot;
+            m_entities.push_back(entity);
+            m_revision++;
+            return slot;
+        }
+
+        // Drops the entity (which must be contained) and returns its old slot: the caller moves
+        // the back of each dense array there (unless it already is the back) and pops it
+        uint32_t Erase(Entity entity) {
+            const uint32_t index = EntityTraits::GetIndex(entity);
+            const uint32_t slot = m_sparse[index];
+            const uint32_t last = static_cast<uint32_t>(m_entities.size() - 1);
+
+            if (slot != last) {
+                m_entities[slot] = m_entities[last];
+                m_sparse[EntityTraits::GetIndex(m_entities[slot])] = slot;
+            }
+
+            m_entities.pop_back();
+            m_sparse[index] = NPOS;
+            m_revision++;
+            return slot;
+        }
+
+        void ClearEntities() {
+            m_sparse.clear();
+            m_entities.clear();
+            m_revision++;
+        }
+
+        void ReserveEntities(size_t capacity) { m_entities.reserve(capacity); }
+
+    private:
+        std::vector<uint32_t> m_sparse;
+        std::vector<Entity> m_entities;
+    };
+
+    /**
+     * Component Pool
+     *
+     * Stores one component type in a packed array next to the EntitySet:
+     * m_components[i] belongs to GetEntities()[i], so iterating the dense
+     * arrays directly is a linear walk over contiguous memory. Types whose
+     * hot fields are read separately specialize it and keep one array per
+     * field instead (core::Transform, see TransformPool.h).
+     */
+    template<typename T>
+    class ComponentPool final : public EntitySet {
+    public:
+        template<typename... Args>
+        T& Add(Entity entity, Args&&... args) {
+            Insert(entity);
+            m_components.emplace_back(std::forward<Args>(args)...);
+            return m_components.back();
+        }
+
+        void Remove(Entity entity) override {
+            if (!Contains(entity)) {
+                return;
+            }
+
+            const uint32_t slot = Erase(entity);
+            if (slot != m_components.size() - 1) {
+                m_components[slot] = std::move(m_components.back());
+            }
+            m_components.pop_back();
+        }
+
+        void Clear() override {
+            ClearEntities();
+            m_components.clear();
+        }
+
+        T& Get(Entity entity) {
+            assert(Contains(entity) && "Entity does not have this component");
+            return m_components[Find(entity)];
+        }
+
+        const T& Get(Entity entity) const {
+            assert(Contains(entity) && "Entity does not have this component");
+            return m_components[Find(entity)];
+        }
+
+        T* TryGet(Entity entity) {
+            const uint32_t slot = Find(entity);
+            return slot != NPOS ? &m_components[slot] : nullptr;
+        }
+
+        const T* TryGet(Entity entity) const {
+            const uint32_t slot = Find(entity);
+            return slot != NPOS ? &m_components[slot] : nullptr;
+        }
+
+        // Component in a dense slot
+        T& GetAt(uint32_t slot) { return m_components[slot]; }
+        const T& GetAt(uint32_t slot) const { return m_components[slot]; }
+
+        void Reserve(size_t capacity) {
+            ReserveEntities(capacity);
+            m_components.reserve(capacity);
+        }
+
+        // Dense component array (index i belongs to GetEntities()[i])
+        std::vector<T>& GetComponents() { return m_components; }
+        const std::vector<T>& GetComponents() const { return m_components; }
+
+    private:
+        std::vector<T> m_components;
+    };
+
+} // namespace ecs
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstdint>
+
+namespace ecs {
+
+    /**
+     * Entity Handle
+     *
+     * 32-bit id: low 20 bits index into the registry's slots, high 12 bits
+     * are a version bumped every time the slot is recycled, so stale
+     * handles to destroyed entities never alias new ones.
+     */
+    using Entity = uint32_t;
+
+    static constexpr Entity NULL_ENTITY = 0xFFFFFFFFu;
+
+    namespace EntityTraits {
+        static constexpr uint32_t INDEX_BITS = 20;
+        static constexpr uint32_t INDEX_MASK = (1u << INDEX_BITS) - 1;
+        static constexpr uint32_t VERSION_MASK = 0xFFFu;
+        static constexpr uint32_t MAX_ENTITIES = INDEX_MASK; // INDEX_MASK itself is reserved for NULL_ENTITY
+
+        inline constexpr uint32_t GetIndex(Entity entity) { return entity & INDEX_MASK; }
+        inline constexpr uint32_t GetVersion(Entity entity) { return (entity >> INDEX_BITS) & VERSION_MASK; }
+        inline constexpr Entity Make(uint32_t index, uint32_t version) {
+            return (index & INDEX_MASK) | ((version & VERSION_MASK) << INDEX_BITS);
+        }
+    }
+
+} // namespace ecs
@@ -0,0 +1,154 @@
+#pragma once
+
+#include "ComponentPool.h"
+#include "Entity.h"
+#include "TransformPool.h"
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace ecs {
+
+    /**
+     * Entity Registry
+     *
+     * Creates entities and owns one packed ComponentPool per component
+     * type. Components of a type sit contiguously in memory, so systems
+     * walk plain arrays instead of chasing per-object heap pointers.
+     * Transforms are stored field by field (structure of arrays, see
+     * TransformPool.h): Get/Add/Each hand out an ecs::TransformRef into
+     * the field arrays instead of a core::Transform&.
+     *
+     * Usage:
+     *   auto& registry = core::Engine::Entities();
+     *
+     *   ecs::Entity player = registry.Create();
+     *   registry.Add<core::Transform>(player, glm::vec2(100.0f, 100.0f));
+     *   registry.Add<rendering::Sprite>(player, playerTexture);
+     *   registry.Add<physics::RigidBody>(player, registry.Get<core::Transform>(player),
+     *                                    physics::RigidBody::Type::Dynamic);
+     *
+     *   registry.Each<core::Transform, Velocity>([&](ecs::Entity, ecs::TransformRef t, Velocity& v) {
+     *       t.Translate(v.value * deltaTime);
+     *   });
+     *
+     * Pools with a transform and a sprite are drawn by the engine every
+     * frame, and rigid bodies that moved write their pose back into the
+     * entity's transform after the physics steps (see ecs/Systems.h).
+     */
+    class Registry {
+    public:
+        Registry();
+        ~Registry();
+
+        Registry(const Registry&) = delete;
+        Registry& operator=(const Registry&) = delete;
+
+        // Entity lifecycle
+        Entity Create();
+        void Destroy(Entity entity); // Removes all of the entity's components
+        bool IsAlive(Entity entity) const;
+        size_t GetEntityCount() const { return m_aliveCount; }
+        void Clear();
+
+        // Components (components with a SetEntity(Entity) member are told their owner, e.g. RigidBody)
+        template<typename T, typename... Args>
+        decltype(auto) Add(Entity entity, Args&&... args) {
+            decltype(auto) component = GetPool<T>().Add(entity, std::forward<Args>(args)...);
+            if constexpr (requires(T& c, Entity e) { c.SetEntity(e); }) {
+                component.SetEntity(entity);
+            }
+            return component;
+        }
+
+        template<typename T>
+        void Remove(Entity entity) {
+            if (auto* pool = FindPool<T>()) {
+                pool->Remove(entity);
+            }
+        }
+
+        template<typename T>
+        bool Has(Entity entity) const {
+            const auto* pool = FindPool<T>();
+            return pool && pool->Contains(entity);
+        }
+
+        // T& (TransformRef for transforms)
+        template<typename T>
+        decltype(auto) Get(Entity entity) { return GetPool<T>().Get(entity); }
+
+        // T* (std::optional<TransformRef> for transforms), empty if the entity has no T
+        template<typename T>
+        auto TryGet(Entity entity) -> decltype(std::declval<ComponentPool<T>&>().TryGet(entity)) {
+            auto* pool = FindPool<T>();
+            return pool ? pool->TryGet(entity) : decltype(pool->TryGet(entity)){};
+        }
+
+        // Pool access (creates the pool on first use)
+        template<typename T>
+        ComponentPool<T>& GetPool() {
+            const size_t typeId = GetTypeId<T>();
+            if (typeId >= m_pools.size()) {
+                m_pools.resize(typeId + 1);
+            }
+            if (!m_pools[typeId]) {
+                m_pools[typeId] = std::make_unique<ComponentPool<T>>();
+            }
+            return static_cast<ComponentPool<T>&>(*m_pools[typeId]);
+        }
+
+        template<typename T>
+        ComponentPool<T>* FindPool() {
+            const size_t typeId = GetTypeId<T>();
+            return typeId < m_pools.size() ? static_cast<ComponentPool<T>*>(m_pools[typeId].get()) : nullptr;
+        }
+
+        template<typename T>
+        const ComponentPool<T>* FindPool() const {
+            const size_t typeId = GetTypeId<T>();
+            return typeId < m_pools.size() ? static_cast<const ComponentPool<T>*>(m_pools[typeId].get()) : nullptr;
+        }
+
+        // Visit every entity that has all listed components: func(Entity, T&, Others&...), with
+        // transforms passed as ecs::TransformRef. Walks T's dense array, so list the rarest
+        // component first. Don't add/remove components of the visited types inside the callback.
+        template<typename T, typename... Others, typename Func>
+        void Each(Func&& func) {
+            ComponentPool<T>* pool = FindPool<T>();
+            if (!pool || (... || !FindPool<Others>())) {
+                return;
+            }
+
+            const std::vector<Entity>& entities = pool->GetEntities();
+            for (size_t i = 0; i < entities.size(); ++i) {
+                const Entity entity = entities[i];
+                if ((... && FindPool<Others>()->Contains(entity))) {
+                    func(entity, pool->GetAt(static_cast<uint32_t>(i)), FindPool<Others>()->Get(entity)...);
+                }
+            }
+        }
+
+    private:
+        static size_t NextTypeId();
+
+        template<typename T>
+        static size_t GetTypeId() {
+            static const size_t id = NextTypeId();
+            return id;
+        }
+
+        struct Slot {
+            Entity handle;      // Current handle (index + version); next one to hand out while free
+            bool alive = false;
+        };
+
+        std::vector<Slot> m_slots;
+        std::vector<uint32_t> m_freeIndices;  // Destroyed slots ready for reuse
+        size_t m_aliveCount = 0;
+
+        std::vector<std::unique_ptr<IComponentPool>> m_pools; // Indexed by component type id
+    };
+
+} // namespace ecs
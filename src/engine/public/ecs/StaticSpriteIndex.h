@@ -0,0 +1,57 @@
+#pragma once
+
+#include "Entity.h"
+#include "engine/public/core/Bounds.h"
+#include "engine/public/core/SpatialGrid.h"
+#include <cstdint>
+#include <vector>
+
+namespace ecs {
+
+    class Registry;
+
+    /**
+     * Tag component for sprites that never move (level geometry, decoration).
+     * Tagged entities are drawn through the StaticSpriteIndex instead of
+     * being visited every frame.
+     */
+    struct StaticSprite {};
+
+    /**
+     * Static Sprite Index
+     *
+     * Uniform grid (core::SpatialGrid) over the world bounds of every entity
+     * with Transform + Sprite + StaticSprite. SubmitSprites queries it with
+     * the renderer's view rectangle, so only the visible cells are walked.
+     *
+     * The index rebuilds itself when StaticSprite tags are added or removed
+     * (including by destroying entities) and when a tagged sprite's texture
+     * finishes loading. Moving, rotating or resizing a tagged entity is not
+     * detected - call Invalidate() afterwards.
+     */
+    class StaticSpriteIndex {
+    public:
+        explicit StaticSpriteIndex(float cellSize = 256.0f);
+
+        void SetCellSize(float cellSize);
+        void Invalidate() { m_dirty = true; }
+
+        // Rebuild if anything changed since the last call
+        void Update(Registry& registry);
+
+        // Tagged entities whose bounds overlap area, in tag pool order (valid until the next query)
+        const std::vector<Entity>& Query(const core::Bounds& area);
+
+        size_t GetEntityCount() const { return m_grid.GetItemCount(); }
+
+    private:
+        void Rebuild(Registry& registry);
+
+        core::SpatialGrid m_grid;
+        std::vector<Entity> m_loading;  // Indexed while their texture was still streaming (size unknown)
+        std::vector<Entity> m_results;
+        uint32_t m_tagRevision = 0;
+        bool m_dirty = true;
+    };
+
+} // namespace ecs
@@ -0,0 +1,40 @@
+#pragma once
+
+namespace physics {
+    class Physics;
+}
+
+namespace rendering {
+    class Renderer;
+}
+
+namespace ecs {
+
+    class Registry;
+    class StaticSpriteIndex;
+
+    /**
+     * Built-in Systems
+     *
+     * Linear passes over the registry's packed pools, run by the engine:
+     * - SyncPhysicsTransforms after the fixed physics steps of a frame
+     * - UpdateAnimations right after it, before the game's Update()
+     * - SubmitSprites at the start of the render phase (before the game's
+     *   own Render(), so game-drawn sprites and text appear on top)
+     */
+
+    // Copy the poses from the physics move list into the Transforms of the owning entities
+    void SyncPhysicsTransforms(Registry& registry, const physics::Physics& physics);
+
+    // Advance the clock of every animation::Animator (the frames themselves are resolved by SubmitSprites)
+    void UpdateAnimations(Registry& registry, float deltaTime);
+
+    // Draw every entity that has both a Transform and a Sprite (animated ones with their Animator's
+    // current frame, looked up only if the sprite may be on screen). Entities with a RigidBody are drawn
+    // at their pose blended between the last two physics steps (alpha = Engine::GetInterpolationAlpha()).
+    // With a static index (and culling enabled), StaticSprite-tagged entities are drawn first, looked up
+    // from the grid cells under the view instead of being visited one by one.
+    void SubmitSprites(Registry& registry, rendering::Renderer& renderer, float alpha = 1.0f,
+                       StaticSpriteIndex* staticIndex = nullptr);
+
+} // namespace ecs
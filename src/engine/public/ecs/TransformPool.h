@@ -0,0 +1,135 @@
+#pragma once
+
+#include "ComponentPool.h"
+#include "engine/public/core/Transform.h"
+#include <glm/glm.hpp>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace ecs {
+
+    /**
+     * Transform Reference
+     *
+     * What the transform pool hands out instead of a core::Transform&:
+     * references into its field arrays, with the Transform helpers games
+     * use on them. Converts to a core::Transform copy where a whole one is
+     * needed. Invalidated by Add/Remove on the pool, like a T&.
+     */
+    struct TransformRef {
+        glm::vec2& position;
+        float& rotation;   // Degrees
+        glm::vec2& scale;
+
+        TransformRef(glm::vec2& pos, float& rot, glm::vec2& scl) : position(pos), rotation(rot), scale(scl) {}
+        TransformRef(const TransformRef&) = default;
+
+        operator core::Transform() const { return core::Transform(position, rotation, scale); }
+
+        // Assigning writes through to the pool
+        TransformRef& operator=(const core::Transform& transform) {
+            position = transform.position;
+            rotation = transform.rotation;
+            scale = transform.scale;
+            return *this;
+        }
+        TransformRef& operator=(const TransformRef& other) { return *this = static_cast<core::Transform>(other); }
+
+        void SetPosition(float x, float y) { position = {x, y}; }
+        void SetPosition(const glm::vec2& pos) { position = pos; }
+        void SetRotation(float degrees) { rotation = degrees; }
+        void SetScale(float uniformScale) { scale = {uniformScale, uniformScale}; }
+        void SetScale(const glm::vec2& scl) { scale = scl; }
+        void Translate(const glm::vec2& delta) { position += delta; }
+        void Rotate(float deltaDegrees) { rotation += deltaDegrees; }
+    };
+
+    /**
+     * Transform Pool
+     *
+     * Structure-of-arrays pool for core::Transform: positions, rotations
+     * and scales live in three separate dense arrays, so systems that only
+     * touch part of the pose (the physics sync writes positions and
+     * rotations, drawing a simulated body reads only its scale) walk just
+     * the fields they use. Same sparse-set indexing as every other pool;
+     * slot i of each field array belongs to GetEntities()[i].
+     */
+    template<>
+    class ComponentPool<core::Transform> final : public EntitySet {
+    public:
+        // Constructor arguments of core::Transform
+        template<typename... Args>
+        TransformRef Add(Entity entity, Args&&... args) {
+            const core::Transform transform(std::forward<Args>(args)...);
+            const uint32_t slot = Insert(entity);
+            m_positions.push_back(transform.position);
+            m_rotations.push_back(transform.rotation);
+            m_scales.push_back(transform.scale);
+            return GetAt(slot);
+        }
+
+        void Remove(Entity entity) override {
+            if (!Contains(entity)) {
+                return;
+            }
+
+            const uint32_t slot = Erase(entity);
+            if (slot != m_positions.size() - 1) {
+                m_positions[slot] = m_positions.back();
+                m_rotations[slot] = m_rotations.back();
+                m_scales[slot] = m_scales.back();
+            }
+            m_positions.pop_back();
+            m_rotations.pop_back();
+            m_scales.pop_back();
+        }
+
+        void Clear() override {
+            ClearEntities();
+            m_positions.clear();
+            m_rotations.clear();
+            m_scales.clear();
+        }
+
+        TransformRef Get(Entity entity) {
+            assert(Contains(entity) && "Entity does not have this component");
+            return GetAt(Find(entity));
+        }
+
+        core::Transform Get(Entity entity) const {
+            assert(Contains(entity) && "Entity does not have this component");
+            return GetAt(Find(entity));
+        }
+
+        std::optional<TransformRef> TryGet(Entity entity) {
+            const uint32_t slot = Find(entity);
+            return slot != NPOS ? std::optional<TransformRef>(GetAt(slot)) : std::nullopt;
+        }
+
+        // Transform in a dense slot
+        TransformRef GetAt(uint32_t slot) { return {m_positions[slot], m_rotations[slot], m_scales[slot]}; }
+        core::Transform GetAt(uint32_t slot) const { return core::Transform(m_positions[slot], m_rotations[slot], m_scales[slot]); }
+
+        void Reserve(size_t capacity) {
+            ReserveEntities(capacity);
+            m_positions.reserve(capacity);
+            m_rotations.reserve(capacity);
+            m_scales.reserve(capacity);
+        }
+
+        // Field arrays (index i belongs to GetEntities()[i]); write through them, never resize
+        std::vector<glm::vec2>& GetPositions() { return m_positions; }
+        const std::vector<glm::vec2>& GetPositions() const { return m_positions; }
+        std::vector<float>& GetRotations() { return m_rotations; }
+        const std::vector<float>& GetRotations() const { return m_rotations; }
+        std::vector<glm::vec2>& GetScales() { return m_scales; }
+        const std::vector<glm::vec2>& GetScales() const { return m_scales; }
+
+    private:
+        std::vector<glm::vec2> m_positions;
+        std::vector<float> m_rotations;
+        std::vector<glm::vec2> m_scales;
+    };
+
+} // namespace ecs
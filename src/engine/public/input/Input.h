@@ -1,29 +1,162 @@
 #pragma once
 
+#include "engine/public/core/RingBuffer.h"
+#include "engine/public/utils/Config.h"
 #include <SDL.h>
+#include <array>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace input {
+
+    enum class InputEventType : uint8_t {
+        KeyDown,
+        KeyUp,
+        MouseButtonDown,
+        MouseButtonUp,
+        MouseMotion,
+        MouseWheel
+    };
+
+    /**
+     * Input event as captured from SDL
+     */
+    struct InputEvent {
+        InputEventType type = InputEventType::KeyDown;
+        bool repeat = false;     // Key auto-repeat
+        int code = 0;            // SDL_Scancode or SDL mouse button
+        int x = 0, y = 0;        // Mouse position, or wheel delta
+        Uint32 timestamp = 0;    // SDL event time in milliseconds (SDL_GetTicks clock)
+    };
+
+    /**
+     * Input
+     *
+     * Event-driven keyboard and mouse state. HandleEvent only copies the
+     * event into a lock-free ring buffer; Update drains it once per frame
+     * in timestamp order, so presses shorter than a frame still register
+     * and every event keeps the time SDL received it. Motion and wheel
+     * events stop being queued once the buffer is getting full and are
+     * merged into one pending event instead, so a burst of them after a
+     * hitch never crowds out key and button events (a lost release would
+     * leave the key held).
+     *
+     * "Just pressed/released" depends on where it's asked:
+     * - in Update/Render: happened since the previous frame
+     * - in FixedUpdate: happened since the previous fixed step, so a press
+     *   is seen by exactly one fixed step even on frames that run none
+     *
+     * Actions are compiled from "input.key_bindings" in settings.json
+     * (action -> key name or list of key names, SDL scancode names such as
+     * "W", "Space", "Escape") into a flat per-scancode lookup, and are
+     * recompiled whenever the bindings change.
+     *
+     * Usage:
+     *   auto& input = core::Engine::Input();
+     *   if (input.IsActionJustPressed("jump")) { ... }
+     *
+     *   int jump = input.GetActionId("jump"); // Skips the name lookup on hot paths
+     *   if (input.IsActionPressed(jump)) { ... }
+     */
     class Input {
     public:
+        static constexpr size_t EVENT_CAPACITY = 512;
+        static constexpr int MAX_ACTIONS = 64;
+
         Input();
         ~Input();
-        
-        void Update();
+
+        // System lifecycle
+        bool Initialize();
+        void Shutdown();
+
+        // Engine hooks
+        void Update(); // Once per frame, after events were handled
         void HandleEvent(const SDL_Event& event);
-        
+        void BeginFixedStep();
+        void EndFixedStep();
+
+        // Keys
         bool IsKeyPressed(SDL_Scancode key) const;
         bool IsKeyJustPressed(SDL_Scancode key) const;
+        bool IsKeyJustReleased(SDL_Scancode key) const;
+
+        // Mouse (SDL_BUTTON_LEFT, ...)
         bool IsMouseButtonPressed(int button) const;
-        
+        bool IsMouseButtonJustPressed(int button) const;
+        bool IsMouseButtonJustReleased(int button) const;
         void GetMousePosition(int& x, int& y) const;
-        
+        void GetMouseWheel(int& x, int& y) const; // Scrolled this frame
+
+        // Actions (from input.key_bindings)
+        int GetActionId(const std::string& action) const; // -1 if not bound
+        bool IsActionPressed(int action) const;
+        bool IsActionJustPressed(int action) const;
+        bool IsActionJustReleased(int action) const;
+        Uint32 GetActionPressTime(int action) const; // Timestamp of the last press, 0 if never
+        bool IsActionPressed(const std::string& action) const;
+        bool IsActionJustPressed(const std::string& action) const;
+        bool IsActionJustReleased(const std::string& action) const;
+        void LoadBindings();
+
+        // Events drained by the last Update, oldest first
+        const std::vector<InputEvent>& GetFrameEvents() const { return m_frameEvents; }
+        uint64_t GetDroppedEventCount() const { return m_droppedEvents; }
+
     private:
-        const Uint8* m_currentKeyState;
-        Uint8* m_previousKeyState;
-        int m_numKeys;
-        
-        Uint32 m_currentMouseState;
-        Uint32 m_previousMouseState;
-        int m_mouseX, m_mouseY;
+        struct ButtonState {
+            bool down = false;
+            uint64_t pressedFrame = 0;   // Frame serial of the last press
+            uint64_t releasedFrame = 0;
+            uint64_t pressedStep = 0;    // Fixed step that reports the last press
+            uint64_t releasedStep = 0;
+            Uint32 pressTime = 0;
+        };
+
+        struct ActionState {
+            std::string name;
+            int heldKeys = 0; // Bound keys currently down
+            ButtonState state;
+        };
+
+        void ApplyEvent(const InputEvent& event);
+        void MergeEvent(const InputEvent& event);
+        void SetButton(ButtonState& state, bool down, Uint32 timestamp);
+        void SetKeyActions(SDL_Scancode key, bool down, Uint32 timestamp);
+        bool WasPressed(const ButtonState& state) const;
+        bool WasReleased(const ButtonState& state) const;
+        const ButtonState* GetMouseButton(int button) const;
+        const ActionState* GetAction(int action) const;
+
+        static constexpr int MOUSE_BUTTON_COUNT = 8;
+        static constexpr size_t BUTTON_EVENT_RESERVE = 128; // Slots motion and wheel events never take
+
+        core::RingBuffer<InputEvent, EVENT_CAPACITY> m_events;
+        std::vector<InputEvent> m_frameEvents;
+        uint64_t m_droppedEvents = 0;
+        bool m_reportDrops = true;
+        InputEvent m_pendingMotion; // Merged while the buffer is nearly full
+        InputEvent m_pendingWheel;
+        bool m_hasPendingMotion = false;
+        bool m_hasPendingWheel = false;
+
+        std::array<ButtonState, SDL_NUM_SCANCODES> m_keys{};
+        std::array<ButtonState, MOUSE_BUTTON_COUNT> m_mouseButtons{};
+        int m_mouseX = 0, m_mouseY = 0;
+        int m_wheelX = 0, m_wheelY = 0;
+
+        // Flat action lookup: bit i of a key's mask = bound to action i
+        std::vector<ActionState> m_actions;
+        std::unordered_map<std::string, int> m_actionIds;
+        std::array<uint64_t, SDL_NUM_SCANCODES> m_keyActions{};
+
+        uint64_t m_frame = 0;
+        uint64_t m_step = 0;
+        bool m_inFixedStep = false;
+
+        utils::ConfigSubscription m_bindingsSubscription = 0;
+        bool m_initialized = false;
     };
-}
\ No newline at end of file
+}
@@ -0,0 +1,148 @@
+#pragma once
+
+#include "engine/public/core/Bounds.h"
+#include "engine/public/rendering/QuadMesh.h"
+#include <glm/glm.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace rendering {
+    class Texture;
+}
+
+namespace particles {
+
+    class ParticleSystem;
+
+    /**
+     * Emitter Settings
+     *
+     * What an emitter spawns and how its particles move and fade, usually
+     * loaded from JSON (ParticleSystem::LoadEmitter):
+     *
+     *   {
+     *     "texture": "spark.png",
+     *     "max_particles": 2000,
+     *     "rate": 400, "burst": 0, "duration": 0,
+     *     "lifetime": [0.6, 1.2], "speed": [80, 160],
+     *     "direction": -90, "spread": 40, "spawn_radius": 4,
+     *     "gravity": [0, 300], "drag": 0.5,
+     *     "size": [6, 1],
+     *     "color": [[1.0, 0.8, 0.3, 1.0], [1.0, 0.2, 0.0, 0.0]]
+     *   }
+     *
+     * "atlas" (a directory, see rendering::TextureAtlas) plus "region" can
+     * replace "texture". Ranges are [min, max] (a single number for both),
+     * angles are degrees, "size" and "color" go from birth to death.
+     * "duration" 0 emits until Stop(). Paths are relative to the file.
+     */
+    struct EmitterSettings {
+        std::shared_ptr<rendering::Texture> texture;
+        glm::vec4 uvRect = {0.0f, 0.0f, 1.0f, 1.0f};
+
+        size_t maxParticles = 1000;
+        float rate = 50.0f;                          // Particles per second
+        size_t burst = 0;                            // Emitted at once on Start()
+        float duration = 0.0f;                       // Seconds of emission (0 = until stopped)
+
+        glm::vec2 lifetime = {1.0f, 1.0f};           // Seconds, min/max
+        glm::vec2 speed = {50.0f, 100.0f};           // Units per second, min/max
+        float direction = -90.0f;                    // Degrees (y down: -90 is up)
+        float spread = 30.0f;                        // Full cone angle around direction
+        float spawnRadius = 0.0f;                    // Particles start anywhere within this disc
+
+        glm::vec2 gravity = {0.0f, 0.0f};            // Acceleration, units per second squared
+        float drag = 0.0f;                           // Velocity lost per second (fraction)
+
+        float startSize = 8.0f;
+        float endSize = 8.0f;
+        glm::vec4 startColor = {1.0f, 1.0f, 1.0f, 1.0f};
+        glm::vec4 endColor = {1.0f, 1.0f, 1.0f, 0.0f};
+
+        static std::shared_ptr<EmitterSettings> Load(const std::string& path); // nullptr on error
+    };
+
+    /**
+     * Particle Emitter
+     *
+     * One effect instance and its live particles, stored as structure of
+     * arrays (position, velocity, age and inverse lifetime each in their
+     * own float array) so the update and vertex kernels are straight loops
+     * over contiguous floats that the compiler vectorizes. Size and colour
+     * are functions of normalized age: sizes are interpolated and colours
+     * read from a precomputed ramp, so neither is stored per particle.
+     *
+     * Emitters are created and simulated by the ParticleSystem. Drop the
+     * handle of a one-shot effect and it is removed once its last particle
+     * has died; a held handle keeps the emitter (and lets you move, stop
+     * and restart it).
+     *
+     * Usage:
+     *   auto& particles = core::Engine::Particles();
+     *   auto sparks = particles.CreateEmitter(particles.LoadEmitter("assets/particles/sparks.json"), position);
+     *   sparks->SetPosition(player.position);   // Follows the player; live particles stay where they are
+     *   sparks->Stop();                         // Existing particles finish their lifetime
+     */
+    class ParticleEmitter {
+    public:
+        ParticleEmitter(std::shared_ptr<const EmitterSettings> settings, const glm::vec2& position, uint32_t seed);
+
+        ParticleEmitter(const ParticleEmitter&) = delete;
+        ParticleEmitter& operator=(const ParticleEmitter&) = delete;
+
+        // Emission
+        void Start();                 // Restarts the duration and fires the burst
+        void Stop() { m_emitting = false; }
+        void Emit(size_t count);      // Extra particles right now (capped at maxParticles)
+        void Clear();                 // Kills every live particle
+        void SetPosition(const glm::vec2& position) { m_position = position; }
+        const glm::vec2& GetPosition() const { return m_position; }
+
+        // State
+        const EmitterSettings& GetSettings() const { return *m_settings; }
+        size_t GetParticleCount() const { return m_count; }
+        bool IsEmitting() const { return m_emitting; }
+        bool IsAlive() const { return m_emitting || m_count > 0; }
+        const core::Bounds& GetBounds() const { return m_bounds; } // Of last update's particles, sizes included
+
+    private:
+        friend class ParticleSystem;
+
+        static constexpr size_t COLOR_RAMP_SIZE = 64;
+
+        // Kernels (ParticleSystem runs Simulate and BuildVertices on ranges across the job system)
+        void Simulate(size_t begin, size_t end, float deltaTime);
+        void Retire();                // Removes dead particles and recomputes the bounds
+        void UpdateEmission(float deltaTime);
+        void BuildVertices(size_t begin, size_t end);
+
+        void Spawn(size_t count);
+        void Resize(size_t capacity);
+
+        std::shared_ptr<const EmitterSettings> m_settings;
+        glm::vec2 m_position;
+        std::mt19937 m_random;
+        bool m_emitting = true;
+        float m_elapsed = 0.0f;       // Since Start()
+        float m_emitDebt = 0.0f;      // Fractional particles carried over to the next update
+
+        // Particle storage, m_count live entries at the front of each array
+        size_t m_count = 0;
+        std::vector<float> m_positionX;
+        std::vector<float> m_positionY;
+        std::vector<float> m_velocityX;
+        std::vector<float> m_velocityY;
+        std::vector<float> m_age;
+        std::vector<float> m_inverseLifetime;
+
+        std::array<uint32_t, COLOR_RAMP_SIZE> m_colorRamp; // Packed RGBA by normalized age
+        std::vector<rendering::MeshVertex> m_vertices;    // Four per live particle, rebuilt every draw
+        core::Bounds m_bounds;
+    };
+
+} // namespace particles
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "ParticleEmitter.h"
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace core {
+    class JobSystem;
+}
+
+namespace rendering {
+    class Renderer;
+}
+
+namespace particles {
+
+    /**
+     * Particle System
+     *
+     * Owns every live ParticleEmitter and runs them from the engine loop:
+     * - Update (after the game's Update): particles are integrated in
+     *   ranges of "particles.job_batch_size" across the job system, then
+     *   each emitter drops its dead particles and spawns new ones.
+     * - Draw (after entity sprites, before the game's Render): emitters
+     *   whose bounds reach the view build their quads across the job
+     *   system, then each one is appended to the sprite batch in one
+     *   bulk copy - one draw call per emitter texture run.
+     *
+     * Keep the particles of many emitters on one atlas page (the
+     * "atlas"/"region" settings) and consecutive emitters share a batch.
+     *
+     * Usage:
+     *   auto settings = core::Engine::Particles().LoadEmitter("assets/particles/explosion.json");
+     *   core::Engine::Particles().CreateEmitter(settings, position); // One-shot: handle not kept
+     */
+    class ParticleSystem {
+    public:
+        ParticleSystem();
+        ~ParticleSystem();
+
+        ParticleSystem(const ParticleSystem&) = delete;
+        ParticleSystem& operator=(const ParticleSystem&) = delete;
+
+        bool Initialize();
+        void Shutdown();
+
+        // Emitter settings from JSON, cached by path
+        std::shared_ptr<const EmitterSettings> LoadEmitter(const std::string& path);
+        void UnloadEmitter(const std::string& path);
+
+        // Emitters (started right away; destroyed once finished if nobody else holds the handle)
+        std::shared_ptr<ParticleEmitter> CreateEmitter(std::shared_ptr<const EmitterSettings> settings, const glm::vec2& position);
+        void DestroyEmitter(const std::shared_ptr<ParticleEmitter>& emitter);
+        void Clear();
+
+        // Called by the engine
+        void Update(float deltaTime);
+        void Draw(rendering::Renderer& renderer);
+
+        // Info
+        size_t GetEmitterCount() const { return m_emitters.size(); }
+        size_t GetParticleCount() const;
+
+    private:
+        struct Range {
+            ParticleEmitter* emitter = nullptr;
+            size_t begin = 0;
+            size_t end = 0;
+        };
+
+        // Splits the particles of the given emitters into job-sized ranges; false if not worth spreading out
+        bool BuildRanges(const std::vector<ParticleEmitter*>& emitters);
+
+        std::vector<std::shared_ptr<ParticleEmitter>> m_emitters;
+        std::unordered_map<std::string, std::shared_ptr<const EmitterSettings>> m_settings;
+
+        // Scratch, reused every frame
+        std::vector<ParticleEmitter*> m_active;
+        std::vector<Range> m_ranges;
+
+        core::JobSystem* m_jobs = nullptr;
+        size_t m_batchSize = 4096;
+        uint32_t m_nextSeed = 1;
+        bool m_initialized = false;
+    };
+
+} // namespace particles
@@ -1,8 +1,56 @@
 #pragma once
 
 #include <box2d/box2d.h>
+#include <glm/glm.hpp>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace core {
+    class JobCounter;
+}
+
+namespace rendering {
+    class Renderer;
+}
 
 namespace physics {
+
+    /**
+     * Pose of a body that moved during the last fixed step(s), read from Box2D's move events
+     */
+    struct BodyMove {
+        b2BodyId bodyId = b2_nullBodyId;
+        void* userData = nullptr;          // Owning RigidBody (use RigidBody::FromBodyId(bodyId) - it may be gone by now)
+        glm::vec2 position = {0.0f, 0.0f};
+        float rotation = 0.0f;             // Degrees
+        bool fellAsleep = false;
+    };
+
+    /**
+     * Physics System
+     * 
+     * Owns the Box2D world and steps it at a fixed timestep. After each
+     * step the world's move events are folded into a compact list holding
+     * only the bodies that moved (one entry per body, latest pose wins),
+     * so transforms can be synced in one linear pass instead of querying
+     * every body. The list covers all steps since ClearMovedBodies(),
+     * which the engine calls once per frame before its fixed-step loop.
+     * 
+     * Each RigidBody's previous/current pose is updated around every step
+     * for render interpolation. Bodies created directly through the world
+     * id must leave their user data null (it is reserved for RigidBody).
+     * 
+     * Box2D's solver tasks run on the engine job system. Worker and
+     * substep counts come from "physics.worker_count" (0 = every job
+     * system thread) and "physics.substep_count".
+     * 
+     * With "physics.debug_draw" on, the engine draws every shape and joint
+     * through the renderer's primitive batch after the game's own rendering.
+     */
     class Physics {
     public:
         Physics();
@@ -16,6 +64,10 @@ namespace physics {
         // Physics configuration
         static constexpr float RECOMMENDED_TIMESTEP = 1.0f / 60.0f;  // 60 Hz
         
+        void SetSubStepCount(int subStepCount);
+        int GetSubStepCount() const { return m_subStepCount; }
+        int GetWorkerCount() const { return m_workerCount; }
+        
         void SetGravity(float x, float y);
         void GetGravity(float& x, float& y) const;
         void DisableGravity() { SetGravity(0.0f, 0.0f); }
@@ -23,8 +75,45 @@ namespace physics {
         // World access (for creating bodies, joints, etc.)
         b2WorldId GetWorldId() const { return m_worldId; }
         
+        // Bodies moved since the last ClearMovedBodies() (entries may refer to bodies destroyed since)
+        const std::vector<BodyMove>& GetMovedBodies() const { return m_movedBodies; }
+        void ClearMovedBodies();
+        
+        // Debug visualisation (shapes filled translucent with an outline, joints as lines)
+        void DebugDraw(rendering::Renderer& renderer);
+        void SetDebugDrawEnabled(bool enabled) { m_debugDrawEnabled = enabled; }
+        bool IsDebugDrawEnabled() const { return m_debugDrawEnabled; }
+        
     private:
+        void CollectMoveEvents();
+        
+        // Box2D task interface (runs task ranges on the job system)
+        static void* EnqueueTask(b2TaskCallback* task, int32_t itemCount, int32_t minRange, void* taskContext, void* userContext);
+        static void FinishTask(void* userTask, void* userContext);
+        
+        static constexpr int MAX_PHYSICS_TASKS = 64; // Per step; extra tasks run inline
+        static constexpr int MAX_PHYSICS_WORKERS = 64; // Worker slots fit one 64-bit mask
+        
+        // Unique workerIndex (< Box2D worker count) for each range while it runs
+        uint32_t AcquireWorkerSlot();
+        void ReleaseWorkerSlot(uint32_t slot);
+        
         b2WorldId m_worldId;
         bool m_initialized;
+        
+        std::vector<BodyMove> m_movedBodies;
+        std::unordered_map<int32_t, size_t> m_movedBodyIndex; // Body index -> slot in m_movedBodies
+        int m_stepsSinceClear = 0;
+        std::vector<b2BodyId> m_lastStepMoved; // Need their previous pose saved before the next step
+        
+        // Step settings
+        int m_subStepCount = 4;
+        int m_workerCount = 1;
+        bool m_debugDrawEnabled = false;
+        
+        // Task fences handed to Box2D, recycled every step
+        std::array<std::unique_ptr<core::JobCounter>, MAX_PHYSICS_TASKS> m_taskCounters;
+        int m_taskCount = 0;
+        std::atomic<uint64_t> m_freeWorkerSlots{1}; // Bit per Box2D worker index not in use
     };
 }
\ No newline at end of file
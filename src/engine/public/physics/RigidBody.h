@@ -3,9 +3,20 @@
 #include "engine/public/core/Transform.h"
 #include <box2d/box2d.h>
 #include <glm/glm.hpp>
+#include <cstdint>
 
 namespace physics {
     
+    /**
+     * Rigid Body
+     * 
+     * Owns a Box2D body. Keeps the pose of the last two physics steps
+     * (updated from the world's move events), so rendering can blend
+     * between them with the engine's interpolation alpha while physics
+     * runs at a lower fixed rate than the display.
+     * 
+     * The Box2D body's user data points back at this object.
+     */
     class RigidBody {
     public:
         enum class Type { Static, Kinematic, Dynamic };
@@ -13,11 +24,22 @@ namespace physics {
         RigidBody(const core::Transform& initialTransform, Type type);
         ~RigidBody();
         
-        // Manual sync methods (user calls these)
+        // Owns its Box2D body - non-copyable but movable (so it can live in packed component pools)
+        RigidBody(const RigidBody&) = delete;
+        RigidBody& operator=(const RigidBody&) = delete;
+        RigidBody(RigidBody&& other) noexcept;
+        RigidBody& operator=(RigidBody&& other) noexcept;
+        
+        // Manual sync methods (user calls these). Setting the pose teleports - no interpolation from the old one.
         void SetPosition(const glm::vec2& position);
         void SetRotation(float degrees);
-        glm::vec2 GetPosition() const;
-        float GetRotation() const;
+        glm::vec2 GetPosition() const { return m_currentPosition; }  // As of the last physics step
+        float GetRotation() const { return m_currentRotation; }
+        
+        // Pose blended between the previous and the last physics step (alpha from Engine::GetInterpolationAlpha())
+        glm::vec2 GetInterpolatedPosition(float alpha) const;
+        float GetInterpolatedRotation(float alpha) const;
+        core::Transform GetInterpolatedTransform(float alpha, const glm::vec2& scale = {1.0f, 1.0f}) const;
         
         // Physics control
         void ApplyForce(const glm::vec2& force);
@@ -37,11 +59,32 @@ namespace physics {
         // Utility
         bool IsValid() const;
         Type GetType() const { return m_type; }
+        b2BodyId GetBodyId() const { return m_bodyId; }
+        
+        // Owning entity (set automatically when added to an ecs::Registry; 0xFFFFFFFF if none)
+        void SetEntity(uint32_t entity) { m_entity = entity; }
+        uint32_t GetEntity() const { return m_entity; }
+        
+        // Map a Box2D body (e.g. from a move event) back to its RigidBody - nullptr for bodies not created here
+        static RigidBody* FromBodyId(b2BodyId bodyId);
         
     private:
-        b2BodyId m_bodyId;
+        friend class Physics;
+        
+        // Called by Physics around each step
+        void SavePreviousPose();
+        void SetCurrentPose(const glm::vec2& position, float rotation);
+        
+        b2BodyId m_bodyId = b2_nullBodyId;
         Type m_type;
         bool m_valid = false;
+        uint32_t m_entity = 0xFFFFFFFFu;
+        
+        // Last two simulated poses
+        glm::vec2 m_previousPosition = {0.0f, 0.0f};
+        glm::vec2 m_currentPosition = {0.0f, 0.0f};
+        float m_previousRotation = 0.0f;  // Degrees
+        float m_currentRotation = 0.0f;
     };
     
 } // namespace physics
\ No newline at end of file
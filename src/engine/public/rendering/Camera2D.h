@@ -0,0 +1,60 @@
+#pragma once
+
+#include "engine/public/core/Bounds.h"
+#include <glm/glm.hpp>
+
+namespace rendering {
+
+    /**
+     * 2D Camera
+     *
+     * Position is the world point shown at the centre of the viewport;
+     * zoom > 1 magnifies, rotation (degrees) turns the view. Produces the
+     * view/projection pair the renderer consumes (y-down, origin top-left
+     * of the viewport like the default projection) and the world rectangle
+     * it can see, which the renderer uses for culling.
+     *
+     * Usage:
+     *   rendering::Camera2D camera(window.GetWidth(), window.GetHeight());
+     *   camera.SetPosition(player.position);
+     *   renderer.SetCamera(camera); // Before drawing the world
+     */
+    class Camera2D {
+    public:
+        Camera2D() = default;
+        Camera2D(float viewportWidth, float viewportHeight);
+
+        void SetViewportSize(float width, float height);
+        const glm::vec2& GetViewportSize() const { return m_viewportSize; }
+
+        void SetPosition(const glm::vec2& position) { m_position = position; }
+        void Move(const glm::vec2& delta) { m_position += delta; }
+        const glm::vec2& GetPosition() const { return m_position; }
+
+        void SetZoom(float zoom); // Clamped to a small positive minimum
+        float GetZoom() const { return m_zoom; }
+
+        void SetRotation(float degrees) { m_rotation = degrees; }
+        float GetRotation() const { return m_rotation; }
+
+        // Matrices for Renderer::SetViewMatrix/SetProjectionMatrix (Renderer::SetCamera sets both)
+        glm::mat4 GetViewMatrix() const;
+        glm::mat4 GetProjectionMatrix() const;
+
+        // World-space rectangle covering everything visible (axis-aligned, so larger than the view when rotated)
+        core::Bounds GetViewBounds() const;
+
+        // Conversion between viewport pixels and world coordinates (e.g. mouse picking)
+        glm::vec2 ScreenToWorld(const glm::vec2& screen) const;
+        glm::vec2 WorldToScreen(const glm::vec2& world) const;
+
+    private:
+        static constexpr float MIN_ZOOM = 0.01f;
+
+        glm::vec2 m_viewportSize = {1280.0f, 720.0f};
+        glm::vec2 m_position = {640.0f, 360.0f};
+        float m_zoom = 1.0f;
+        float m_rotation = 0.0f;
+    };
+
+} // namespace rendering
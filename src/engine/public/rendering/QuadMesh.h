@@ -0,0 +1,58 @@
+#pragma once
+
+#include "engine/public/core/Bounds.h"
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <cstdint>
+
+namespace rendering {
+
+    /**
+     * Vertex layout shared by the sprite batch and static quad meshes
+     * (world position + texture coordinates + packed RGBA tint)
+     */
+    struct MeshVertex {
+        glm::vec2 position;
+        glm::vec2 texCoord;
+        uint32_t color;
+    };
+
+    /**
+     * Quad Mesh
+     *
+     * Static vertex buffer of textured quads (four vertices each, top-left,
+     * top-right, bottom-right, bottom-left) built once and drawn with
+     * Renderer::DrawMesh in a single call, using the sprite shader and the
+     * renderer's shared quad index buffer. Meant for content that never
+     * changes after load, such as tilemap chunks.
+     *
+     * Create and destroy on the main thread. Hold it in a shared_ptr: in
+     * render thread mode queued frames keep meshes alive until they have
+     * been drawn.
+     */
+    class QuadMesh {
+    public:
+        static constexpr size_t MAX_QUADS = 4096; // Size of the renderer's shared index buffer
+
+        QuadMesh() = default;
+        ~QuadMesh();
+
+        QuadMesh(const QuadMesh&) = delete;
+        QuadMesh& operator=(const QuadMesh&) = delete;
+
+        // Upload vertexCount / 4 quads (at most MAX_QUADS); bounds are computed from the vertices
+        bool Build(const MeshVertex* vertices, size_t vertexCount);
+        void Destroy();
+
+        bool IsValid() const { return m_buffer != 0 && m_quadCount > 0; }
+        unsigned int GetBuffer() const { return m_buffer; }
+        size_t GetQuadCount() const { return m_quadCount; }
+        const core::Bounds& GetBounds() const { return m_bounds; }
+
+    private:
+        unsigned int m_buffer = 0;
+        size_t m_quadCount = 0;
+        core::Bounds m_bounds;
+    };
+
+} // namespace rendering
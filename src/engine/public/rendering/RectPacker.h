@@ -0,0 +1,48 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <vector>
+
+namespace rendering {
+
+    /**
+     * Rectangle Packer
+     *
+     * MaxRects bin packer (best short side fit) for placing rectangles into
+     * a fixed-size page. Used by texture and glyph atlases.
+     *
+     * Supports both offline packing (insert everything sorted largest first)
+     * and online packing (insert rectangles as they arrive).
+     *
+     * Usage:
+     *   RectPacker packer(1024, 1024);
+     *   glm::ivec2 position;
+     *   if (packer.Insert(64, 32, position)) { ... }
+     */
+    class RectPacker {
+    public:
+        RectPacker() = default;
+        RectPacker(int width, int height);
+
+        // Reset to an empty page of the given size
+        void Reset(int width, int height);
+
+        // Find a spot for a width x height rectangle. Returns false if it doesn't fit.
+        bool Insert(int width, int height, glm::ivec2& outPosition);
+
+        // Properties
+        int GetWidth() const { return m_width; }
+        int GetHeight() const { return m_height; }
+        float GetOccupancy() const; // Used area / total area (0-1)
+
+    private:
+        void SplitFreeRects(const glm::ivec4& usedRect);
+        void PruneFreeRects();
+
+        int m_width = 0;
+        int m_height = 0;
+        size_t m_usedArea = 0;
+        std::vector<glm::ivec4> m_freeRects; // x, y, width, height
+    };
+
+} // namespace rendering
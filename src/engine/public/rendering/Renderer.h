@@ -1,10 +1,24 @@
 #pragma once
 
+#include "QuadMesh.h"
+#include "ShaderProgram.h"
+#include "engine/public/core/Bounds.h"
 #include <glm/glm.hpp>
+#include <array>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 namespace rendering {
+    class Camera2D;
     class Window;
     class Sprite;
+    class Texture;
+    struct SpriteFrame;
 }
 
 namespace core {
@@ -13,6 +27,47 @@ namespace core {
 
 namespace rendering {
     
+    /**
+     * Per-frame rendering statistics
+     *
+     * Reset in BeginFrame(). Use Renderer::GetLastFrameStats() to read the
+     * totals of the previously completed frame.
+     */
+    struct RenderStats {
+        uint32_t drawCalls = 0;   // Total GL draw calls issued
+        uint32_t flushes = 0;     // Sprite batch submissions
+        uint32_t sprites = 0;     // Quads submitted (DrawSprite + DrawQuad)
+        uint32_t vertices = 0;    // Vertices uploaded by the sprite and primitive batches
+        uint32_t primitives = 0;  // Shapes submitted (rectangles, lines, circles, polygons)
+        uint32_t culled = 0;      // Quads and meshes skipped because they were entirely outside the view
+        uint32_t meshes = 0;      // Static quad meshes drawn (DrawMesh)
+    };
+
+    /**
+     * Renderer
+     * 
+     * Batched sprite renderer on an OpenGL 2.1 context.
+     * 
+     * Untextured shapes (rectangles, lines, circles, convex polygons) go
+     * through a second batch with its own shader, drawn as plain triangles
+     * from one dynamic vertex buffer. Only one of the two batches is open
+     * at a time: switching between sprites and shapes flushes the other,
+     * so draw order is kept and runs of shapes cost a single draw call.
+     * 
+     * Culling ("graphics.culling"): the world rectangle visible through the
+     * current view/projection is recomputed whenever either matrix changes,
+     * and quads (sprites, glyphs, tiles) whose bounds miss it are dropped
+     * before they reach the batch.
+     * 
+     * Render thread mode ("graphics.render_thread"): draw calls only record
+     * compact commands into a per-frame command buffer. Present() hands the
+     * frame to a dedicated thread that owns a second, shared GL context,
+     * replays it and swaps, while the main thread simulates the next frame.
+     * "graphics.frames_in_flight" (2 or 3) frames are buffered; Present()
+     * blocks only when all of them are still queued. The main thread's own
+     * context stays current for resource work (texture creation/uploads),
+     * which is shared with the render context.
+     */
     class Renderer {
     public:
         Renderer();
@@ -21,8 +76,12 @@ namespace rendering {
         bool Initialize(Window* window);
         void Shutdown();
         
+        // Frame bracket - sprites drawn between these calls are batched
         void BeginFrame();
         void EndFrame();
+        void Present(); // Swap buffers (or submit the frame to the render thread)
+        bool SetSwapInterval(int interval); // 0 = immediate, 1 = vsync, -1 = adaptive vsync; false if unsupported
+        int GetSwapInterval() const { return m_swapInterval; }
         void Clear(float r = 0.0f, float g = 0.0f, float b = 0.0f, float a = 1.0f);
         
         // Sprite rendering
@@ -30,29 +89,184 @@ namespace rendering {
         void DrawSprite(const Sprite* sprite, const glm::vec2& position);
         void DrawSprite(const Sprite* sprite, const glm::vec2& position, float rotation);
         void DrawSprite(const Sprite* sprite, const glm::vec2& position, float rotation, const glm::vec2& scale);
+        // Animation frame: texture, UVs and size as given (no source rect lookup); origin and tint from the sprite
+        void DrawSprite(const Sprite* sprite, const core::Transform& transform,
+                        const std::shared_ptr<Texture>& texture, const SpriteFrame& frame);
+        
+        // Raw textured quad through the sprite batch (corners in world space: top-left, top-right,
+        // bottom-right, bottom-left; uvRect = u0, v0, u1, v1). Used for glyph and tile quads.
+        void DrawQuad(const std::shared_ptr<Texture>& texture, const glm::vec2 corners[4],
+                      const glm::vec4& uvRect, const glm::vec4& color);
+        void DrawQuad(const std::shared_ptr<Texture>& texture, const glm::vec2 corners[4],
+                      const glm::vec2 texCoords[4], const glm::vec4& color); // Per-corner UVs (flipped/rotated tiles)
+        // Prebuilt quads (four vertices each, same corner order) appended to the sprite batch in bulk.
+        // Not culled - the caller checks its own bounds first (used by the particle system).
+        void DrawQuads(const std::shared_ptr<Texture>& texture, const MeshVertex* vertices, size_t quadCount);
         
-        // Primitive rendering
+        // Prebuilt static quads in one draw call (ends the current batch; culled by the mesh bounds)
+        void DrawMesh(const std::shared_ptr<QuadMesh>& mesh, const std::shared_ptr<Texture>& texture);
+
+        // Primitive rendering (world space; rectangle position is the top-left corner, outlines grow inwards)
         void DrawRectangle(const glm::vec2& position, const glm::vec2& size, const glm::vec4& color);
+        void DrawRectangleOutline(const glm::vec2& position, const glm::vec2& size, const glm::vec4& color, float thickness = 1.0f);
         void DrawLine(const glm::vec2& start, const glm::vec2& end, const glm::vec4& color, float thickness = 1.0f);
+        void DrawCircle(const glm::vec2& center, float radius, const glm::vec4& color, int segments = 0); // 0 = from radius
+        void DrawCircleOutline(const glm::vec2& center, float radius, const glm::vec4& color, float thickness = 1.0f, int segments = 0);
+        void DrawPolygon(const glm::vec2* points, size_t count, const glm::vec4& color); // Convex, filled
+        void DrawPolygonOutline(const glm::vec2* points, size_t count, const glm::vec4& color, float thickness = 1.0f);
+
+        // Texture drawn in place of sprites whose texture is still loading asynchronously
+        void SetPlaceholderTexture(std::shared_ptr<Texture> texture);
+        const std::shared_ptr<Texture>& GetPlaceholderTexture() const { return m_placeholderTexture; }
+
+        // Batch control
+        void Flush(); // Submit any pending sprites immediately
+        void SetBatchingEnabled(bool enabled); // Disable to draw every sprite immediately (debugging)
+        bool IsBatchingEnabled() const { return m_batchingEnabled; }
+
+        // Statistics
+        const RenderStats& GetFrameStats() const { return m_frameStats; }         // Current frame (in progress)
+        const RenderStats& GetLastFrameStats() const { return m_lastFrameStats; } // Last completed frame
+
+        // SDL_GLContext of the renderer (for tools that share it, e.g. ImGui)
+        void* GetContext() const { return m_context; }
+        bool IsRenderThreadEnabled() const { return m_renderThreadEnabled; }
+        void WaitForQueuedFrames(); // Render thread mode: block until every submitted frame was drawn (before rewriting a texture in place)
         
         // Camera/View management
+        void SetCamera(const Camera2D& camera); // Sets both matrices from the camera
         void SetViewMatrix(const glm::mat4& view);
         void SetProjectionMatrix(const glm::mat4& projection);
         void SetOrthographicProjection(float left, float right, float bottom, float top);
         
+        // Visibility culling against the current view
+        void SetCullingEnabled(bool enabled) { m_cullingEnabled = enabled; }
+        bool IsCullingEnabled() const { return m_cullingEnabled; }
+        const core::Bounds& GetViewBounds() const { return m_viewBounds; } // World rectangle currently visible
+        bool IsVisible(const core::Bounds& bounds) const { return !m_cullingEnabled || m_viewBounds.Overlaps(bounds); }
+
     private:
+        // Batched sprite vertex - same layout as static meshes so both go through the sprite shader
+        using SpriteVertex = MeshVertex;
+
+        // Untextured primitive vertex (position + packed RGBA color)
+        struct PrimitiveVertex {
+            glm::vec2 position;
+            uint32_t color;
+        };
+
+        // Recorded command (render thread mode) - vertices live in the frame's shared vertex arrays
+        struct RenderCommand {
+            enum class Type : uint8_t { Clear, DrawBatch, DrawPrimitives, DrawMesh };
+            Type type = Type::DrawBatch;
+            uint32_t firstVertex = 0;
+            uint32_t vertexCount = 0;
+            uint32_t matrixIndex = 0;     // Into RenderFrame::matrices
+            Texture* texture = nullptr;   // Kept alive by RenderFrame::textures
+            const QuadMesh* mesh = nullptr; // Kept alive by RenderFrame::meshes
+            glm::vec4 clearColor = {0.0f, 0.0f, 0.0f, 1.0f};
+        };
+
+        struct RenderFrame {
+            std::vector<SpriteVertex> vertices;
+            std::vector<PrimitiveVertex> primitiveVertices;
+            std::vector<RenderCommand> commands;
+            std::vector<glm::mat4> matrices;
+            std::vector<std::shared_ptr<Texture>> textures; // Released on the main thread when the slot is reused
+            std::vector<std::shared_ptr<QuadMesh>> meshes;  // Same - mesh buffers are deleted on the main context
+            bool inFlight = false;                          // Guarded by m_frameMutex
+        };
+
+        static constexpr size_t MAX_BATCH_SPRITES = 4096;
+        static constexpr size_t VERTICES_PER_SPRITE = 4;
+        static constexpr size_t INDICES_PER_SPRITE = 6;
+        static constexpr size_t MAX_PRIMITIVE_VERTICES = 3 * 8192; // Triangles per primitive flush * 3
+        static constexpr int MAX_FRAMES_IN_FLIGHT = 3;
+        static_assert(QuadMesh::MAX_QUADS == MAX_BATCH_SPRITES, "Meshes are drawn with the sprite batch's index buffer");
+
         void SetupSpriteShader();
         void SetupQuadMesh();
+        void SetupPlaceholderTexture();
+        void SetupPrimitiveBatch();
+        void FlushBatches(); // Both batches (only one of them holds vertices at a time)
+        void FlushSpriteBatch();
+        void SubmitSpriteQuad(const std::shared_ptr<Texture>& texture, const glm::vec2& size, const glm::vec2& origin,
+                              const core::Transform& transform, const glm::vec4& uvRect, const glm::vec4& tint);
+        void RecordBatch();
+        void DrawBatch(const SpriteVertex* vertices, size_t vertexCount, const Texture& texture, const glm::mat4& viewProjection);
+        void DrawQuadBuffer(unsigned int vertexBuffer, size_t quadCount, const Texture& texture, const glm::mat4& viewProjection);
+        
+        // Primitive batch: reserve room for vertexCount vertices (a multiple of 3), fill them, then EndPrimitive()
+        PrimitiveVertex* BeginPrimitive(size_t vertexCount);
+        void EndPrimitive();
+        void FlushPrimitiveBatch();
+        void RecordPrimitives();
+        void DrawPrimitives(const PrimitiveVertex* vertices, size_t vertexCount, const glm::mat4& viewProjection);
+        uint32_t RecordViewProjection(RenderFrame& frame);
+        void UpdateViewBounds();
+
+        // Render thread
+        bool StartRenderThread(int framesInFlight, int swapInterval);
+        void StopRenderThread();
+        void RenderThreadLoop();
+        void ExecuteFrame(const RenderFrame& frame);
+        void SubmitFrame();
         
         void* m_context; // SDL_GLContext (using void* to avoid including SDL_opengl.h in header)
+        Window* m_window = nullptr;
+        
+        // Shader program for sprite rendering (handles resolved once in SetupSpriteShader)
+        ShaderProgram m_spriteShader;
+        int m_uMVP = -1;
+        int m_uTexture = -1;
+        int m_aPos = -1;
+        int m_aTexCoord = -1;
+        int m_aColor = -1;
+        unsigned int m_quadVBO = 0;   // Dynamic vertex buffer for the sprite batch
+        unsigned int m_quadIBO = 0;   // Static index buffer (two triangles per sprite)
+
+        // Sprite batch state
+        std::vector<SpriteVertex> m_batchVertices;
+        std::shared_ptr<Texture> m_batchTexture; // Keeps the texture alive until the batch is flushed
+        bool m_inFrame = false;
+        bool m_batchingEnabled = true;
+        std::shared_ptr<Texture> m_placeholderTexture;
+        size_t m_batchStart = 0; // First vertex of the open batch (render thread mode keeps the whole frame)
         
-        // Shader program for sprite rendering
-        unsigned int m_spriteShader = 0;
-        unsigned int m_quadVBO = 0;
+        // Primitive batch state
+        ShaderProgram m_primitiveShader;
+        int m_uPrimitiveMVP = -1;
+        int m_aPrimitivePos = -1;
+        int m_aPrimitiveColor = -1;
+        unsigned int m_primitiveVBO = 0;
+        std::vector<PrimitiveVertex> m_primitiveVertices;
+        size_t m_primitiveStart = 0; // Same as m_batchStart, for the primitive batch
+
+        // Render thread state
+        bool m_renderThreadEnabled = false;
+        void* m_renderContext = nullptr; // Shared SDL_GLContext owned by the render thread
+        std::thread m_renderThread;
+        std::mutex m_frameMutex;
+        std::condition_variable m_frameSubmitted;
+        std::condition_variable m_frameFreed;
+        std::array<RenderFrame, MAX_FRAMES_IN_FLIGHT> m_frames;
+        std::deque<int> m_submittedFrames;
+        int m_framesInFlight = 2;
+        int m_recordFrame = 0;
+        int m_swapInterval = 1;          // Guarded by m_frameMutex while the render thread runs
+        bool m_swapIntervalPending = false; // Render thread applies m_swapInterval and sets the result
+        bool m_swapIntervalResult = false;
+        bool m_stopRenderThread = false;
+
+        // Statistics
+        RenderStats m_frameStats;
+        RenderStats m_lastFrameStats;
         
         // Matrices
         glm::mat4 m_viewMatrix = glm::mat4(1.0f);
         glm::mat4 m_projectionMatrix = glm::mat4(1.0f);
+        core::Bounds m_viewBounds;
+        bool m_cullingEnabled = true;
         
         bool m_initialized = false;
     };
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace rendering {
+
+    /**
+     * Shader Program
+     *
+     * Wraps an OpenGL shader program. All active uniform and attribute
+     * locations are resolved once at link time, so hot paths never do string
+     * lookups. Uniform setters remember the last uploaded value and skip the
+     * GL call when nothing changed.
+     *
+     * The currently bound program is tracked globally so Bind() is free when
+     * the program is already in use.
+     *
+     * Usage:
+     *   ShaderProgram shader;
+     *   shader.Compile(vertexSource, fragmentSource);
+     *   int mvp = shader.GetUniform("u_MVP");   // Once, at setup
+     *   shader.Bind();
+     *   shader.SetUniform(mvp, viewProjection); // Every frame
+     */
+    class ShaderProgram {
+    public:
+        ShaderProgram();
+        ~ShaderProgram();
+
+        // Non-copyable but movable
+        ShaderProgram(const ShaderProgram&) = delete;
+        ShaderProgram& operator=(const ShaderProgram&) = delete;
+        ShaderProgram(ShaderProgram&& other) noexcept;
+        ShaderProgram& operator=(ShaderProgram&& other) noexcept;
+
+        // Building
+        bool Compile(const char* vertexSource, const char* fragmentSource);
+        void Destroy();
+
+        // Binding (skips glUseProgram if already bound)
+        void Bind() const;
+        static void Unbind();
+        static void InvalidateBindingCache(); // Call after external code changed the bound program
+
+        // Location lookup (resolved at link time - call once during setup, not per frame)
+        int GetUniform(const std::string& name) const;   // Handle for SetUniform, -1 if not active
+        int GetAttribLocation(const std::string& name) const; // GL attribute location, -1 if not active
+
+        // Typed uniform setters (program must be bound). Redundant uploads are skipped.
+        void SetUniform(int uniform, int value);
+        void SetUniform(int uniform, float value);
+        void SetUniform(int uniform, const glm::vec2& value);
+        void SetUniform(int uniform, const glm::vec4& value);
+        void SetUniform(int uniform, const glm::mat4& value);
+
+        // Properties
+        unsigned int GetID() const { return m_programID; }
+        bool IsValid() const { return m_programID != 0; }
+
+    private:
+        struct UniformSlot {
+            int location = -1;
+            int componentCount = 0;   // Number of valid floats in the cached value
+            float cachedValue[16] = {};
+        };
+
+        bool UpdateCache(int uniform, const float* values, int count);
+        void ResolveLocations();
+
+        unsigned int m_programID = 0;
+        std::vector<UniformSlot> m_uniforms;
+        std::unordered_map<std::string, int> m_uniformIndices;
+        std::unordered_map<std::string, int> m_attribLocations;
+
+        static thread_local unsigned int s_boundProgram; // Per thread = per GL context (render thread has its own)
+    };
+
+} // namespace rendering
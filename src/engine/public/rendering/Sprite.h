@@ -1,11 +1,22 @@
 #pragma once
 
 #include "Texture.h"
+#include "engine/public/core/Bounds.h"
 #include <glm/glm.hpp>
 #include <memory>
 
+namespace core {
+    struct Transform;
+}
+
 namespace rendering {
 
+    // One precomputed sprite sheet frame, ready for the sprite batch (see animation::AnimationClip)
+    struct SpriteFrame {
+        glm::vec4 uvRect = {0.0f, 0.0f, 1.0f, 1.0f}; // u0, v0, u1, v1
+        glm::vec2 size = {0.0f, 0.0f};                // In pixels
+    };
+
     /**
      * Sprite Class
      * 
@@ -17,6 +28,7 @@ namespace rendering {
      * - Sprite sheet sub-rectangles
      * - Custom origin points (pivot)
      * - Tinting/coloring
+     * - Placeholder while an async texture load is still in flight
      */
     class Sprite {
     public:
@@ -31,13 +43,13 @@ namespace rendering {
         
         // Texture management
         void SetTexture(std::shared_ptr<Texture> texture);
-        std::shared_ptr<Texture> GetTexture() const { return m_texture; }
+        const std::shared_ptr<Texture>& GetTexture() const { return m_texture; }
         
         // Source rectangle (for sprite sheets)
         void SetSourceRect(const glm::ivec4& rect); // x, y, width, height
         void SetSourceRect(int x, int y, int width, int height);
-        void UseFullTexture(); // Reset to use entire texture
-        const glm::ivec4& GetSourceRect() const { return m_sourceRect; }
+        void UseFullTexture(); // Reset to use entire texture (follows the texture size, even once an async load finishes)
+        glm::ivec4 GetSourceRect() const;
         
         // Origin/pivot point (relative to source rectangle)
         void SetOrigin(const glm::vec2& origin); // 0,0 = top-left, 0.5,0.5 = center
@@ -57,6 +69,12 @@ namespace rendering {
         glm::ivec2 GetSize() const;
         int GetWidth() const;
         int GetHeight() const;
+        core::Bounds GetWorldBounds(const core::Transform& transform) const; // Of the rotated/scaled quad (culling)
+        
+        // Async loading - while the texture is pending the renderer draws its placeholder texture instead
+        void SetPlaceholderEnabled(bool enabled) { m_placeholderEnabled = enabled; }
+        bool IsPlaceholderEnabled() const { return m_placeholderEnabled; }
+        bool IsLoading() const { return m_texture && m_texture->IsPending(); }
         
         // Utility
         bool IsValid() const { return m_texture && m_texture->IsValid(); }
@@ -66,8 +84,10 @@ namespace rendering {
         
         std::shared_ptr<Texture> m_texture;
         glm::ivec4 m_sourceRect = {0, 0, 0, 0}; // x, y, width, height
+        bool m_useFullTexture = true;           // Source rect tracks the whole texture
         glm::vec2 m_origin = {0.0f, 0.0f};      // Normalized origin point
         glm::vec4 m_tint = {1.0f, 1.0f, 1.0f, 1.0f}; // RGBA tint
+        bool m_placeholderEnabled = true;
     };
 
 } // namespace rendering
\ No newline at end of file
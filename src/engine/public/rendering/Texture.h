@@ -1,16 +1,57 @@
 #pragma once
 
 #include <glad/glad.h>
+#include <cstddef>
 #include <string>
+#include <vector>
 #include <glm/glm.hpp>
 
 namespace rendering {
 
+    // One mip level inside ImageData::pixels
+    struct ImageLevel {
+        size_t offset = 0;
+        size_t size = 0;
+        int width = 0;
+        int height = 0;
+    };
+
+    /**
+     * Decoded image pixels (CPU side, no GL objects - safe to produce on worker threads)
+     * 
+     * Either raw pixels with 'channels' bytes each, or precompressed blocks
+     * (compressedFormat = GL internal format, from a .dds/.ktx2 file). With
+     * a mip chain, levels lists every level (largest first) inside pixels;
+     * empty levels means one raw level covering all of pixels.
+     */
+    struct ImageData {
+        std::vector<unsigned char> pixels;
+        int width = 0;
+        int height = 0;
+        int channels = 0;
+        unsigned int compressedFormat = 0;
+        std::vector<ImageLevel> levels;
+    };
+
+    /**
+     * Texture sampling preset ("graphics.texture_filtering": "nearest", "linear" or "trilinear").
+     * Nearest suits pixel art; trilinear blends between mip levels (same as linear without mips).
+     */
+    enum class TextureFilter { Nearest, Linear, Trilinear };
+
     /**
      * Texture Class
      * 
      * Wraps OpenGL texture functionality.
      * Handles loading, binding, and basic texture operations.
+     * 
+     * Files: anything SDL_image reads (expanded to RGBA8), plus .dds and
+     * .ktx2 containers with BCn/ETC2 blocks, uploaded as is through
+     * glCompressedTexImage2D (see TextureContainer.h). Mip chains stored
+     * in a container are always used; "graphics.generate_mipmaps" builds
+     * one on the CPU (at decode time, so off the main thread for async
+     * loads) for other images. New textures sample with the default filter
+     * ("graphics.texture_filtering").
      */
     class Texture {
     public:
@@ -26,29 +67,73 @@ namespace rendering {
         // Loading
         bool LoadFromFile(const std::string& filepath);
         bool LoadFromMemory(const unsigned char* data, int width, int height, int channels);
+        bool LoadFromImage(const ImageData& image, const std::string& sourcePath = "");
+        bool Reload(); // Decode the source file again into the same GL texture (keeps the ID; false leaves the old contents, e.g. on a size change)
+        
+        // Decode an image file to RGBA pixels (or container blocks) without touching GL (thread-safe)
+        static bool DecodeFile(const std::string& filepath, ImageData& image);
+        
+        // Append a box-filtered mip chain to raw image pixels (thread-safe)
+        static void GenerateMipmaps(ImageData& image);
+        
+        // Defaults for new textures (set by the renderer from config)
+        static void SetDefaultFilter(TextureFilter filter);
+        static TextureFilter GetDefaultFilter();
+        static TextureFilter ParseFilter(const std::string& name); // Unknown names fall back to Linear
+        static void SetGenerateMipmaps(bool generate);
+        static bool GetGenerateMipmaps();
         
-        // Binding
+        // Async loading state (set while a decode/upload is outstanding)
+        void SetPending(bool pending) { m_pending = pending; }
+        bool IsPending() const { return m_pending; }
+        
+        // Replace a sub-rectangle of level 0 (data uses the texture's channel count; not for compressed textures)
+        bool UpdateRegion(int x, int y, int width, int height, const unsigned char* data);
+        
+        // Binding (redundant binds of an already bound texture are skipped)
         void Bind(unsigned int slot = 0) const;
         void Unbind() const;
+        static void InvalidateBindingCache(); // Call after external code changed texture bindings
         
         // Properties
         unsigned int GetID() const { return m_textureID; }
         int GetWidth() const { return m_width; }
         int GetHeight() const { return m_height; }
         glm::ivec2 GetSize() const { return {m_width, m_height}; }
+        int GetChannels() const { return m_channels; }
+        int GetMipLevels() const { return m_mipLevels; }
+        bool IsCompressed() const { return m_compressedFormat != 0; }
+        unsigned int GetCompressedFormat() const { return m_compressedFormat; }
+        const std::string& GetFilePath() const { return m_filepath; }
         bool IsValid() const { return m_textureID != 0; }
         
+        // GPU memory estimate: bytes uploaded for every mip level (compressed size for block formats, 0 until uploaded)
+        size_t GetMemoryUsage() const { return m_textureID != 0 ? m_memoryBytes : 0; }
+        
         // Texture settings
+        void SetFilter(TextureFilter filter); // Picks the mipmapped min filter when the texture has mips
         void SetFilterMode(GLenum minFilter, GLenum magFilter);
         void SetWrapMode(GLenum wrapS, GLenum wrapT);
         
     private:
         void Cleanup();
+        bool CreateGLTexture(const unsigned char* data, int width, int height, int channels);
+        bool CreateGLTexture(const ImageData& image);
+        
+        // Bound texture tracking (per texture unit; per thread = per GL context)
+        static constexpr unsigned int MAX_TRACKED_SLOTS = 16;
+        static void BindTextureID(unsigned int slot, unsigned int textureID);
+        static thread_local unsigned int s_boundTextures[MAX_TRACKED_SLOTS];
+        static thread_local unsigned int s_activeSlot;
         
         unsigned int m_textureID = 0;
         int m_width = 0;
         int m_height = 0;
         int m_channels = 0;
+        int m_mipLevels = 0;
+        unsigned int m_compressedFormat = 0;
+        size_t m_memoryBytes = 0;
+        bool m_pending = false;
         std::string m_filepath;
     };
 
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "Sprite.h"
+#include <glm/glm.hpp>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace rendering {
+
+    class Texture;
+
+    /**
+     * Atlas build options
+     */
+    struct AtlasOptions {
+        int pageSize = 2048;    // Width and height of each atlas page
+        int padding = 2;        // Transparent gap between packed images (avoids filtering bleed)
+        std::string cachePath;  // Base path for the cached layout + page images (empty = no cache)
+    };
+
+    /**
+     * Texture Atlas
+     *
+     * Packs many images into one or more large texture pages so sprites from
+     * the same atlas can share a texture (and therefore a sprite batch).
+     * Regions are named after the source file path relative to the atlas
+     * directory, without extension (e.g. "player/idle_0").
+     *
+     * When a cache path is set, the packed layout is written to
+     * "{cachePath}.json" and each page to "{cachePath}_{page}.png". Later
+     * builds reuse the cache as long as the source files are unchanged.
+     *
+     * Usage:
+     *   auto atlas = core::Engine::Resources().LoadAtlas("ui", "assets/textures/ui");
+     *   rendering::Sprite button = atlas->CreateSprite("button_normal");
+     */
+    class TextureAtlas {
+    public:
+        struct Region {
+            int page = 0;
+            glm::ivec4 rect = {0, 0, 0, 0}; // x, y, width, height in page pixels
+        };
+
+        TextureAtlas();
+        ~TextureAtlas();
+
+        // Building
+        bool BuildFromDirectory(const std::string& directory, const AtlasOptions& options = {});
+        bool BuildFromFiles(const std::vector<std::string>& imagePaths, const AtlasOptions& options = {},
+                            const std::string& baseDirectory = "");
+
+        // Region access
+        bool HasRegion(const std::string& name) const;
+        const Region* GetRegion(const std::string& name) const;
+        Sprite CreateSprite(const std::string& regionName) const;
+        std::vector<std::string> GetRegionNames() const;
+
+        // Page access
+        size_t GetPageCount() const { return m_pages.size(); }
+        std::shared_ptr<Texture> GetPageTexture(int page) const;
+
+        // Info
+        size_t GetRegionCount() const { return m_regions.size(); }
+        bool IsValid() const { return !m_pages.empty(); }
+
+    private:
+        struct SourceImage {
+            std::string path;
+            std::string regionName;
+            uintmax_t fileSize = 0;
+            long long modifiedTime = 0;
+        };
+
+        bool Pack(const std::vector<SourceImage>& sources, const AtlasOptions& options);
+        bool LoadCache(const std::vector<SourceImage>& sources, const AtlasOptions& options);
+        bool WriteCache(const std::vector<SourceImage>& sources, const AtlasOptions& options,
+                        const std::vector<std::vector<unsigned char>>& pagePixels) const;
+        static std::string GetPageCachePath(const std::string& cachePath, size_t page);
+
+        std::vector<std::shared_ptr<Texture>> m_pages;
+        std::unordered_map<std::string, Region> m_regions;
+    };
+
+} // namespace rendering
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace rendering {
+
+    struct ImageData;
+
+    /**
+     * Precompressed texture containers
+     *
+     * Reads .dds and .ktx2 files into ImageData without decoding them: the
+     * mip levels stay in their GPU block format (BC1-BC5, BC7, ETC2/EAC) or
+     * as raw RGBA8, ready for glCompressedTexImage2D / glTexImage2D.
+     *
+     * Only plain 2D textures are supported (no cube maps, arrays or volume
+     * textures) and KTX2 files must not be supercompressed (no Basis
+     * Universal / Zstandard). sRGB formats load as their UNORM equivalent,
+     * matching how PNGs are sampled.
+     */
+
+    // True for paths ending in .dds or .ktx2 (any case)
+    bool IsTextureContainer(const std::string& path);
+
+    // Parse a container file (CPU only - safe on worker threads)
+    bool LoadTextureContainer(const std::string& path, ImageData& image);
+
+    // Whether the current GL context can sample a compressed format (main thread)
+    bool IsCompressedFormatSupported(unsigned int glFormat);
+
+    // Readable name of a compressed GL format ("BC3", "ETC2 RGBA", ...)
+    const char* GetCompressedFormatName(unsigned int glFormat);
+
+} // namespace rendering
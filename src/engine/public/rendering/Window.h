@@ -9,7 +9,7 @@ namespace rendering {
         Window();
         ~Window();
         
-        bool Initialize(const std::string& title, int width, int height);
+        bool Initialize(const std::string& title, int width, int height, bool hidden = false);
         void Shutdown();
         
         SDL_Window* GetSDLWindow() const { return m_window; }
@@ -4,12 +4,42 @@
 #include <string>
 #include <vector>
 #include <optional>
+#include <cstdint>
+#include <set>
+#include <unordered_map>
 #include <unordered_set>
 #include <filesystem>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <spdlog/spdlog.h>
 
+namespace core {
+    class JobCounter;
+}
+
 namespace save {
 
+    // Encoding of the save document on disk
+    enum class SaveFormat {
+        Json,         // Text (pretty printed unless compressed)
+        MessagePack,  // nlohmann::json::to_msgpack
+        Cbor          // nlohmann::json::to_cbor
+    };
+
+    // Called from SaveManager::Update() on the main thread once an async save finishes
+    using SaveCallback = std::function<void(bool success, const std::string& filePath)>;
+
+    // Save header as stored in the directory index (no need to open the save itself)
+    struct SaveInfo {
+        std::string filename;
+        std::string type;
+        std::string timestamp;
+        std::string version;
+        uint64_t sizeBytes = 0;
+    };
+
     /**
      * Save Manager
      * 
@@ -20,12 +50,37 @@ namespace save {
      * - Type-safe save/load with automatic type registration
      * - Multiple save slots with unlimited saves per slot
      * - One quicksave per type (PlayerData quicksave, GameState quicksave, etc.)
-     * - JSON format with automatic timestamped file naming
+     * - JSON, MessagePack or CBOR encoding with optional LZ4 compression
+     * - Automatic timestamped file naming
+     * - Atomic writes (temp file + rename), so a crash never leaves a torn save
+     * - Async saves: the data is snapshotted on the calling thread, then
+     *   encoded, compressed and written on the job system
      * - Cross-platform save directory management
+     *
+     * Plain JSON saves keep the .json extension. Binary or compressed saves
+     * use .sav files with a small header (magic, encoding, compression and
+     * uncompressed size); loading detects the encoding from the file, so
+     * changing "save.format" or "save.compression" keeps old saves readable.
+     *
+     * Each slot and quicksave type directory has a "saves.index" file with
+     * the header (SaveInfo) of every save in it, updated on every save and
+     * delete. Listings and GetSaveInfos() read only that index (once, then
+     * cached), never the saves. A missing or unreadable index is rebuilt
+     * from the directory; call RebuildIndexes() after copying saves in by hand.
+     *
+     * Incremental saves (SaveIncremental) are for large state saved often:
+     * the slot keeps one chain in "{slot}/incremental/", a base snapshot
+     * followed by deltas. Each top-level key of the serialized data is
+     * hashed; a delta only contains the keys whose hash changed (plus the
+     * keys that were removed). After "save.max_deltas" deltas, or once the
+     * deltas outgrow the base, the next save writes a new base and the old
+     * chain is deleted (CompactIncremental() does this on demand).
+     * LoadIncremental() applies the deltas to the base.
      * 
      * File Structure:
      *   {user_documents}/{game_name}/saves/
      *   ├── main-game/
+     *   │   ├── saves.index
      *   │   ├── MyGame_main-game_2025-08-11_14-30-45.json
      *   │   └── MyGame_main-game_2025-08-11_15-22-10.json
      *   └── quicksave/
@@ -45,6 +100,14 @@ namespace save {
      *   auto data = saveManager->Load<PlayerData>("main-game", "filename.json");
      *   saveManager->Quicksave<PlayerData>(playerData);
      *   auto quickData = saveManager->LoadQuicksave<PlayerData>();
+     *
+     *   // Autosave without hitching the frame
+     *   saveManager->SaveAsync<PlayerData>("main-game", playerData,
+     *       [](bool ok, const std::string& path) { ... });
+     *
+     *   // Large world state: only changed top-level keys hit the disk
+     *   saveManager->SaveIncrementalAsync<WorldState>("autosave", world);
+     *   auto world = saveManager->LoadIncremental<WorldState>("autosave");
      */
     class SaveManager {
     public:
@@ -59,7 +122,11 @@ namespace save {
         // Configuration (implemented in .cpp)
         void SetGameName(const std::string& gameName);
         void SetSaveDirectory(const std::string& directory);
-        void SetCompressionEnabled(bool enabled);
+        void SetCompressionEnabled(bool enabled);  // LZ4
+        void SetFormat(SaveFormat format);
+        SaveFormat GetFormat() const { return m_format; }
+        bool IsCompressionEnabled() const { return m_compressionEnabled; }
+        static SaveFormat ParseFormat(const std::string& name); // "json", "msgpack" or "cbor"
 
         // Type-safe save operations (templates - must be in header)
         template<typename T>
@@ -68,6 +135,33 @@ namespace save {
         template<typename T>
         bool Quicksave(const T& data);
 
+        // Async save operations: snapshot now, encode and write on a worker.
+        // Return false if the save could not be queued (callback is not called then).
+        template<typename T>
+        bool SaveAsync(const std::string& slotName, const T& data, SaveCallback callback = nullptr);
+
+        template<typename T>
+        bool QuicksaveAsync(const T& data, SaveCallback callback = nullptr);
+
+        // Incremental saves: base + deltas of changed top-level keys, one chain per slot
+        template<typename T>
+        bool SaveIncremental(const std::string& slotName, const T& data);
+
+        template<typename T>
+        bool SaveIncrementalAsync(const std::string& slotName, const T& data, SaveCallback callback = nullptr);
+
+        template<typename T>
+        std::optional<T> LoadIncremental(const std::string& slotName);
+
+        bool CompactIncremental(const std::string& slotName); // Fold the deltas into a new base now
+        bool HasIncrementalSave(const std::string& slotName);
+        void SetMaxDeltas(size_t count) { m_maxDeltas = count; }
+
+        // Async save completion (main thread)
+        void Update();                    // Runs callbacks of finished async saves
+        bool HasPendingSaves() const;
+        void WaitForPendingSaves();       // Blocks until every queued save is on disk
+
         // Type-safe load operations (templates - must be in header)
         template<typename T>
         std::optional<T> Load(const std::string& slotName, const std::string& filename);
@@ -79,6 +173,10 @@ namespace save {
         std::vector<std::string> GetSavesInSlot(const std::string& slotName) const;
         std::vector<std::string> GetAllSlots() const;
         std::vector<std::string> GetQuicksaveTypes() const;
+        std::vector<SaveInfo> GetSaveInfos(const std::string& slotName) const; // Oldest first
+        std::optional<SaveInfo> GetSaveInfo(const std::string& slotName, const std::string& filename) const;
+        std::optional<SaveInfo> GetQuicksaveInfo(const std::string& typeName) const; // Newest
+        void RebuildIndexes();
         bool DeleteSave(const std::string& slotName, const std::string& filename);
         bool DeleteSlot(const std::string& slotName);
         bool DeleteQuicksave(const std::string& typeName);
@@ -90,6 +188,7 @@ namespace save {
         template<typename T>
         bool QuicksaveExists() const;
         size_t GetSlotSaveCount(const std::string& slotName) const;
+        static bool IsSaveFile(const std::filesystem::path& path); // .json or .sav
 
         // Path helpers (implemented in .cpp)
         std::string GetSaveDirectory() const;
@@ -101,12 +200,67 @@ namespace save {
         std::string GetDefaultSaveDirectory() const;
         std::string GenerateTimestamp() const;
         std::string GenerateSaveFilename(const std::string& slotName) const;
+        std::string GetFileExtension() const;
         bool EnsureDirectoryExists(const std::string& path) const;
         bool SaveJson(const std::string& filePath, const nlohmann::json& data);
-        std::optional<nlohmann::json> LoadJson(const std::string& filePath);
+        static std::optional<nlohmann::json> LoadJson(const std::string& filePath);
+        bool QueueSave(std::string filePath, nlohmann::json saveData, bool replaceOlder, SaveCallback callback);
+        bool SubmitSaveJob(std::function<bool(std::string& filePath)> work, SaveCallback callback);
+
+        // Encode + compress + atomic write (thread safe, used by sync and async saves)
+        static bool WriteSaveFile(const std::string& filePath, const nlohmann::json& data, SaveFormat format, bool compress,
+                                  uint64_t* bytesWritten = nullptr);
+        // Deletes the other saves in a quicksave directory that sort before keepFilename
+        void RemoveOlderSaves(const std::string& directory, const std::string& keepFilename);
+
+        // Incremental chains (thread safe - async saves write from workers)
+        struct IncrementalChain {
+            bool loaded = false;
+            std::string baseFilename;                            // Empty = next save writes a base
+            std::vector<std::string> deltas;                     // Applied in order on top of the base
+            std::unordered_map<std::string, uint64_t> hashes;    // Per top-level key of the last written state
+            uint64_t baseBytes = 0;
+            uint64_t deltaBytes = 0;
+            uint64_t nextSequence = 1;                           // File sequence number
+            uint64_t lastSnapshot = 0;                           // Newest snapshot written (older ones are dropped)
+        };
+        // Settings a chain write uses, copied on the calling thread (the setters may run while a worker writes)
+        struct ChainSettings {
+            std::string directory;   // GetIncrementalPath(slot)
+            std::string gameName;
+            std::string extension;
+            SaveFormat format = SaveFormat::Json;
+            bool compress = false;
+            size_t maxDeltas = 16;
+        };
+        std::string GetIncrementalPath(const std::string& slotName) const;
+        ChainSettings GetChainSettings(const std::string& slotName) const;
+        bool WriteIncremental(const std::string& slotName, const ChainSettings& settings, nlohmann::json saveData, uint64_t snapshot,
+                              std::string* writtenPath = nullptr);
+        std::optional<nlohmann::json> LoadIncrementalData(const std::string& slotName);
+        // m_chainMutex must be held for these
+        IncrementalChain& GetChain(const std::string& slotName, const std::string& directory);
+        bool WriteChain(const std::string& slotName, const ChainSettings& settings, nlohmann::json saveData, uint64_t snapshot,
+                        bool forceBase, std::string* writtenPath);
+        std::optional<nlohmann::json> ReadChain(const std::string& slotName);
+
+        // Directory index (thread safe - async saves record from workers)
+        struct SaveIndex {
+            std::vector<SaveInfo> saves; // Sorted by filename (= by timestamp)
+        };
+        SaveIndex& GetIndex(const std::string& directory) const; // m_indexMutex must be held
+        void ScanDirectories() const;                           // m_indexMutex must be held
+        void RecordSave(const std::string& filePath, const nlohmann::json& saveData, uint64_t sizeBytes);
+        void RecordDelete(const std::string& directory, const std::string& filename);
+        void ForgetDirectory(const std::string& directory);
+        void ClearCaches();
 
         // Template helpers (must be in header)
         template<typename T>
+        nlohmann::json MakeSaveData(const T& data) const;
+        template<typename T>
+        std::optional<T> ReadSaveData(const std::string& filePath);
+        template<typename T>
         std::string GenerateQuicksaveFilename() const;
         template<typename T>
         std::string GetQuicksaveTypePath() const;
@@ -118,9 +272,33 @@ namespace save {
         // Member variables
         bool m_initialized = false;
         bool m_compressionEnabled = false;
+        SaveFormat m_format = SaveFormat::Json;
         std::string m_gameName = "UnknownGame";
         std::string m_saveDirectory;
         std::unordered_set<std::string> m_registeredTypes;
+
+        // Index cache (directory path -> index), loaded on first use
+        mutable std::mutex m_indexMutex;
+        mutable std::unordered_map<std::string, SaveIndex> m_indexes;
+        mutable std::set<std::string> m_slotNames;
+        mutable std::set<std::string> m_quicksaveTypes;
+        mutable bool m_directoriesScanned = false;
+
+        // Incremental chains (slot name -> chain)
+        std::mutex m_chainMutex;
+        std::unordered_map<std::string, IncrementalChain> m_chains;
+        std::atomic<uint64_t> m_snapshotCounter{0};
+        size_t m_maxDeltas = 16;
+
+        // Async saves
+        struct CompletedSave {
+            SaveCallback callback;
+            bool success = false;
+            std::string filePath;
+        };
+        std::unique_ptr<core::JobCounter> m_pendingSaves;
+        std::mutex m_completedMutex;
+        std::vector<CompletedSave> m_completedSaves;
     };
 
     // Template implementations (must be in header)
@@ -139,13 +317,7 @@ namespace save {
         RegisterTypeIfNeeded<T>();
 
         try {
-            nlohmann::json jsonData = data;
-
-            nlohmann::json saveData;
-            saveData["version"] = "1.0.0";
-            saveData["timestamp"] = GenerateTimestamp();
-            saveData["type"] = GetTypeName<T>();
-            saveData["data"] = jsonData;
+            nlohmann::json saveData = MakeSaveData(data);
 
             std::string filename = GenerateSaveFilename(slotName);
             std::string slotPath = GetSlotPath(slotName);
@@ -180,13 +352,7 @@ namespace save {
         RegisterTypeIfNeeded<T>();
 
         try {
-            nlohmann::json jsonData = data;
-
-            nlohmann::json saveData;
-            saveData["version"] = "1.0.0";
-            saveData["timestamp"] = GenerateTimestamp();
-            saveData["type"] = GetTypeName<T>();
-            saveData["data"] = jsonData;
+            nlohmann::json saveData = MakeSaveData(data);
 
             std::string filename = GenerateQuicksaveFilename<T>();
             std::string quicksavePath = GetQuicksaveTypePath<T>();
@@ -198,12 +364,10 @@ namespace save {
 
             std::string fullPath = quicksavePath + "/" + filename;
 
-            if (QuicksaveExists<T>()) {
-                DeleteQuicksave(GetTypeName<T>());
-            }
-
+            // Replace the previous quicksave only once the new one is safely written
             bool success = SaveJson(fullPath, saveData);
             if (success) {
+                RemoveOlderSaves(quicksavePath, filename);
                 spdlog::info("Quicksaved {}: {}", GetTypeName<T>(), filename);
             }
 
@@ -216,99 +380,185 @@ namespace save {
     }
 
     template<typename T>
-    std::optional<T> SaveManager::Load(const std::string& slotName, const std::string& filename) {
+    bool SaveManager::SaveAsync(const std::string& slotName, const T& data, SaveCallback callback) {
         if (!m_initialized) {
             spdlog::error("SaveManager not initialized");
-            return std::nullopt;
+            return false;
         }
 
-        if (slotName.empty() || filename.empty()) {
-            spdlog::error("Slot name and filename cannot be empty");
-            return std::nullopt;
+        if (slotName.empty()) {
+            spdlog::error("Save slot name cannot be empty");
+            return false;
         }
 
+        RegisterTypeIfNeeded<T>();
+
         try {
-            std::string fullPath = GetSlotPath(slotName) + "/" + filename;
+            // Snapshot on the calling thread - the game may change data next frame
+            nlohmann::json saveData = MakeSaveData(data);
 
-            auto jsonData = LoadJson(fullPath);
-            if (!jsonData.has_value()) {
-                spdlog::error("Failed to load save file: {}", fullPath);
-                return std::nullopt;
+            std::string slotPath = GetSlotPath(slotName);
+            if (!EnsureDirectoryExists(slotPath)) {
+                spdlog::error("Failed to create save slot directory: {}", slotPath);
+                return false;
             }
 
-            if (!jsonData->contains("version") || !jsonData->contains("data")) {
-                spdlog::error("Invalid save file format: {}", fullPath);
-                return std::nullopt;
+            return QueueSave(slotPath + "/" + GenerateSaveFilename(slotName), std::move(saveData), false, std::move(callback));
+
+        } catch (const std::exception& e) {
+            spdlog::error("Failed to save to slot '{}': {}", slotName, e.what());
+            return false;
+        }
+    }
+
+    template<typename T>
+    bool SaveManager::QuicksaveAsync(const T& data, SaveCallback callback) {
+        if (!m_initialized) {
+            spdlog::error("SaveManager not initialized");
+            return false;
+        }
+
+        RegisterTypeIfNeeded<T>();
+
+        try {
+            nlohmann::json saveData = MakeSaveData(data);
+
+            std::string quicksavePath = GetQuicksaveTypePath<T>();
+            if (!EnsureDirectoryExists(quicksavePath)) {
+                spdlog::error("Failed to create quicksave directory: {}", quicksavePath);
+                return false;
             }
 
-            std::string version = (*jsonData)["version"];
-            if (version != "1.0.0") {
-                spdlog::error("Incompatible save file version '{}': {}", version, fullPath);
+            return QueueSave(quicksavePath + "/" + GenerateQuicksaveFilename<T>(), std::move(saveData), true, std::move(callback));
+
+        } catch (const std::exception& e) {
+            spdlog::error("Failed to quicksave {}: {}", GetTypeName<T>(), e.what());
+            return false;
+        }
+    }
+
+    template<typename T>
+    bool SaveManager::SaveIncremental(const std::string& slotName, const T& data) {
+        if (!m_initialized) {
+            spdlog::error("SaveManager not initialized");
+            return false;
+        }
+
+        if (slotName.empty()) {
+            spdlog::error("Save slot name cannot be empty");
+            return false;
+        }
+
+        RegisterTypeIfNeeded<T>();
+
+        try {
+            return WriteIncremental(slotName, GetChainSettings(slotName), MakeSaveData(data), ++m_snapshotCounter);
+        } catch (const std::exception& e) {
+            spdlog::error("Failed to save incrementally to slot '{}': {}", slotName, e.what());
+            return false;
+        }
+    }
+
+    template<typename T>
+    bool SaveManager::SaveIncrementalAsync(const std::string& slotName, const T& data, SaveCallback callback) {
+        if (!m_initialized) {
+            spdlog::error("SaveManager not initialized");
+            return false;
+        }
+
+        if (slotName.empty()) {
+            spdlog::error("Save slot name cannot be empty");
+            return false;
+        }
+
+        RegisterTypeIfNeeded<T>();
+
+        try {
+            // Snapshot now (data and settings); hashing, diffing and writing happen on the worker
+            const uint64_t snapshot = ++m_snapshotCounter;
+            auto work = [this, slotName, settings = GetChainSettings(slotName), saveData = MakeSaveData(data),
+                         snapshot](std::string& writtenPath) mutable {
+                return WriteIncremental(slotName, settings, std::move(saveData), snapshot, &writtenPath);
+            };
+            return SubmitSaveJob(std::move(work), std::move(callback));
+
+        } catch (const std::exception& e) {
+            spdlog::error("Failed to save incrementally to slot '{}': {}", slotName, e.what());
+            return false;
+        }
+    }
+
+    template<typename T>
+    std::optional<T> SaveManager::LoadIncremental(const std::string& slotName) {
+        if (!m_initialized) {
+            spdlog::error("SaveManager not initialized");
+            return std::nullopt;
+        }
+
+        try {
+            auto saveData = LoadIncrementalData(slotName);
+            if (!saveData.has_value()) {
                 return std::nullopt;
             }
 
-            T result = (*jsonData)["data"];
+            T result = (*saveData)["data"];
 
-            spdlog::info("Loaded from slot '{}': {}", slotName, filename);
+            spdlog::info("Loaded incremental save from slot '{}'", slotName);
             return result;
 
         } catch (const std::exception& e) {
-            spdlog::error("Failed to load from slot '{}', file '{}': {}", slotName, filename, e.what());
+            spdlog::error("Failed to load incremental save from slot '{}': {}", slotName, e.what());
             return std::nullopt;
         }
     }
 
     template<typename T>
-    std::optional<T> SaveManager::LoadQuicksave() {
+    std::optional<T> SaveManager::Load(const std::string& slotName, const std::string& filename) {
         if (!m_initialized) {
             spdlog::error("SaveManager not initialized");
             return std::nullopt;
         }
 
-        if (!QuicksaveExists<T>()) {
-            spdlog::info("No quicksave found for type {}", GetTypeName<T>());
+        if (slotName.empty() || filename.empty()) {
+            spdlog::error("Slot name and filename cannot be empty");
             return std::nullopt;
         }
 
         try {
-            std::string quicksavePath = GetQuicksaveTypePath<T>();
-            std::vector<std::string> saves;
-
-            if (std::filesystem::exists(quicksavePath)) {
-                for (const auto& entry : std::filesystem::directory_iterator(quicksavePath)) {
-                    if (entry.is_regular_file() && entry.path().extension() == ".json") {
-                        saves.push_back(entry.path().filename().string());
-                    }
-                }
-            }
+            std::string fullPath = GetSlotPath(slotName) + "/" + filename;
 
-            if (saves.empty()) {
-                spdlog::info("No quicksave found for type {}", GetTypeName<T>());
-                return std::nullopt;
+            auto result = ReadSaveData<T>(fullPath);
+            if (result.has_value()) {
+                spdlog::info("Loaded from slot '{}': {}", slotName, filename);
             }
+            return result;
 
-            std::string fullPath = quicksavePath + "/" + saves[0];
-
-            auto jsonData = LoadJson(fullPath);
-            if (!jsonData.has_value()) {
-                spdlog::error("Failed to load quicksave file: {}", fullPath);
-                return std::nullopt;
-            }
+        } catch (const std::exception& e) {
+            spdlog::error("Failed to load from slot '{}', file '{}': {}", slotName, filename, e.what());
+            return std::nullopt;
+        }
+    }
 
-            if (!jsonData->contains("version") || !jsonData->contains("data")) {
-                spdlog::error("Invalid quicksave file format: {}", fullPath);
-                return std::nullopt;
-            }
+    template<typename T>
+    std::optional<T> SaveManager::LoadQuicksave() {
+        if (!m_initialized) {
+            spdlog::error("SaveManager not initialized");
+            return std::nullopt;
+        }
 
-            std::string version = (*jsonData)["version"];
-            if (version != "1.0.0") {
-                spdlog::error("Incompatible quicksave version '{}': {}", version, fullPath);
+        try {
+            auto info = GetQuicksaveInfo(GetTypeName<T>());
+            if (!info.has_value()) {
+                spdlog::info("No quicksave found for type {}", GetTypeName<T>());
                 return std::nullopt;
             }
 
-            T result = (*jsonData)["data"];
+            std::string fullPath = GetQuicksaveTypePath<T>() + "/" + info->filename;
 
-            spdlog::info("Loaded quicksave for {}: {}", GetTypeName<T>(), saves[0]);
+            auto result = ReadSaveData<T>(fullPath);
+            if (result.has_value()) {
+                spdlog::info("Loaded quicksave for {}: {}", GetTypeName<T>(), info->filename);
+            }
             return result;
 
         } catch (const std::exception& e) {
@@ -319,19 +569,7 @@ namespace save {
 
     template<typename T>
     bool SaveManager::QuicksaveExists() const {
-        std::string quicksavePath = GetQuicksaveTypePath<T>();
-        
-        if (!std::filesystem::exists(quicksavePath)) {
-            return false;
-        }
-
-        for (const auto& entry : std::filesystem::directory_iterator(quicksavePath)) {
-            if (entry.is_regular_file() && entry.path().extension() == ".json") {
-                return true;
-            }
-        }
-
-        return false;
+        return GetQuicksaveInfo(GetTypeName<T>()).has_value();
     }
 
     template<typename T>
@@ -339,9 +577,42 @@ namespace save {
         return GetQuicksavePath() + "/" + GetTypeName<T>();
     }
 
+    template<typename T>
+    nlohmann::json SaveManager::MakeSaveData(const T& data) const {
+        nlohmann::json saveData;
+        saveData["version"] = "1.0.0";
+        saveData["timestamp"] = GenerateTimestamp();
+        saveData["type"] = GetTypeName<T>();
+        saveData["data"] = data;
+        return saveData;
+    }
+
+    template<typename T>
+    std::optional<T> SaveManager::ReadSaveData(const std::string& filePath) {
+        auto jsonData = LoadJson(filePath);
+        if (!jsonData.has_value()) {
+            spdlog::error("Failed to load save file: {}", filePath);
+            return std::nullopt;
+        }
+
+        if (!jsonData->contains("version") || !jsonData->contains("data")) {
+            spdlog::error("Invalid save file format: {}", filePath);
+            return std::nullopt;
+        }
+
+        std::string version = (*jsonData)["version"];
+        if (version != "1.0.0") {
+            spdlog::error("Incompatible save file version '{}': {}", version, filePath);
+            return std::nullopt;
+        }
+
+        T result = (*jsonData)["data"];
+        return result;
+    }
+
     template<typename T>
     std::string SaveManager::GenerateQuicksaveFilename() const {
-        return m_gameName + "_" + GetTypeName<T>() + "_quicksave_" + GenerateTimestamp() + ".json";
+        return m_gameName + "_" + GetTypeName<T>() + "_quicksave_" + GenerateTimestamp() + GetFileExtension();
     }
 
     template<typename T>
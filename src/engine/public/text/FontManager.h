@@ -1,18 +1,32 @@
 #pragma once
 
 #include <SDL_ttf.h>
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <unordered_map>
 #include <memory>
+#include <vector>
 
 namespace text {
 
+    class GlyphAtlas;
+    class GlyphMetrics;
+
     /**
      * Font Manager
      * 
      * Manages loading, caching, and cleanup of TTF fonts.
      * Supports multiple sizes of the same font file.
      * 
+     * Each font file is read into memory once (or used in place from the
+     * asset archive) and shared by every size through TTF_OpenFontRW. A
+     * size is only opened on first use (GetFont, text measuring or glyph
+     * atlas), and names asking for the same file and size share one
+     * TTF_Font, glyph atlas and glyph metrics cache. Where a file name resolved to (assets,
+     * system font directories or the system fallbacks) is probed once and
+     * remembered for the session.
+     * 
      * Usage:
      *   fontManager->LoadFont("arial.ttf", "arial", 24);
      *   fontManager->LoadFont("arial.ttf", "arial_large", 48);
@@ -30,8 +44,12 @@ namespace text {
 
         // Font loading/management
         bool LoadFont(const std::string& filepath, const std::string& name, int size);
+        bool LoadFont(const std::vector<std::string>& candidates, const std::string& name, int size); // First that resolves
         void UnloadFont(const std::string& name);
         void UnloadAll();
+        
+        // Re-read a loose font file in use; returns the font names using it (their text caches need clearing)
+        std::vector<std::string> ReloadFontFile(const std::string& path);
 
         // Font access
         TTF_Font* GetFont(const std::string& name) const;
@@ -53,16 +71,54 @@ namespace text {
         const std::string& GetDefaultFont() const { return m_defaultFont; }
         TTF_Font* GetDefaultFontHandle() const;
 
+        // Glyph atlas (created on first use, one per loaded font name/size)
+        GlyphAtlas* GetGlyphAtlas(const std::string& fontName);
+        void SetGlyphAtlasPageSize(int pageSize);
+        void ClearGlyphAtlases();
+
+        // Advance/kerning cache for text layout (created on first use, shared like the glyph atlas)
+        GlyphMetrics* GetGlyphMetrics(const std::string& fontName);
+
     private:
-        struct FontData {
-            TTF_Font* font = nullptr;
-            std::string filepath;
+        // Font file contents, shared by all sizes
+        struct FontFile {
+            std::string path;
+            std::vector<uint8_t> bytes;     // Loose files (empty when packed)
+            const uint8_t* data = nullptr;  // bytes, or the archive mapping
+            size_t size = 0;
+        };
+
+        // One size of one file, opened on first use
+        struct FontFace {
+            ~FontFace();
+            TTF_Font* Open();
+
+            std::shared_ptr<FontFile> file;
             int size = 0;
+            TTF_Font* font = nullptr;
+            bool failed = false;
+            std::unique_ptr<GlyphAtlas> glyphAtlas;
+            std::unique_ptr<GlyphMetrics> glyphMetrics;
         };
 
+        struct FontData {
+            std::shared_ptr<FontFace> face;
+        };
+
+        std::string ResolveFontPath(const std::string& filepath);
+        std::shared_ptr<FontFile> LoadFontFile(const std::string& path);
+        std::shared_ptr<FontFace> GetFace(const std::shared_ptr<FontFile>& file, int size);
+        FontFace* FindFace(const std::string& name) const; // With the default font fallback
+
         bool m_initialized = false;
         std::unordered_map<std::string, FontData> m_fonts;
+        std::unordered_map<std::string, std::string> m_resolvedPaths; // Requested file -> path ("" = not found)
+        std::unordered_map<std::string, std::weak_ptr<FontFile>> m_files;
+        std::unordered_map<std::string, std::weak_ptr<FontFace>> m_faces; // "path#size"
+        std::string m_fallbackPath;
+        bool m_fallbackResolved = false;
         std::string m_defaultFont;
+        int m_glyphAtlasPageSize = 512;
     };
 
 } // namespace text
\ No newline at end of file
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "engine/public/rendering/RectPacker.h"
+#include <SDL_ttf.h>
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace rendering {
+    class Texture;
+}
+
+namespace text {
+
+    /**
+     * Rasterized glyph inside a glyph atlas page
+     */
+    struct Glyph {
+        int page = -1;                         // Atlas page, -1 if the glyph has no visible pixels
+        glm::ivec2 size = {0, 0};              // Quad size in pixels
+        glm::vec4 uvRect = {0, 0, 0, 0};       // u0, v0, u1, v1
+        int advance = 0;                       // Horizontal pen advance in pixels
+    };
+
+    /**
+     * Glyph Atlas
+     *
+     * Rasterizes glyphs of a single font (font file + size) on demand into
+     * shared atlas pages. Glyphs are stored white so the renderer can tint
+     * them with the text color, which means one atlas serves every color.
+     * When a page is full another one is added - existing glyphs never move,
+     * so quads already queued in a sprite batch stay valid.
+     *
+     * Once the glyphs of a string are warm, drawing it again (with any
+     * content made of the same glyphs) costs no texture uploads.
+     *
+     * Usage:
+     *   text::GlyphAtlas* atlas = fontManager->GetGlyphAtlas("default");
+     *   const text::Glyph* glyph = atlas->GetGlyph('A');
+     */
+    class GlyphAtlas {
+    public:
+        GlyphAtlas(TTF_Font* font, int pageSize);
+        ~GlyphAtlas();
+
+        // Non-copyable (owns GPU pages)
+        GlyphAtlas(const GlyphAtlas&) = delete;
+        GlyphAtlas& operator=(const GlyphAtlas&) = delete;
+
+        // Glyph access (rasterizes and uploads the glyph on first use)
+        const Glyph* GetGlyph(uint32_t codepoint);
+        int GetKerning(uint32_t previous, uint32_t codepoint) const;
+
+        // Page access
+        std::shared_ptr<rendering::Texture> GetPageTexture(int page) const;
+        size_t GetPageCount() const { return m_pages.size(); }
+
+        // Drop every glyph and page (e.g. after changing font hinting)
+        void Clear();
+
+        // Info
+        TTF_Font* GetFont() const { return m_font; }
+        size_t GetGlyphCount() const { return m_glyphs.size(); }
+        size_t GetUploadCount() const { return m_uploadCount; } // Total glyph uploads since creation
+
+        // Decode the UTF-8 codepoint at index and advance index past it (invalid bytes yield U+FFFD)
+        static uint32_t NextCodepoint(const std::string& text, size_t& index);
+
+    private:
+        bool RasterizeGlyph(uint32_t codepoint, Glyph& glyph);
+        bool AddPage();
+
+        static constexpr int GLYPH_PADDING = 1; // Transparent gap between glyphs (avoids filtering bleed)
+
+        TTF_Font* m_font = nullptr; // Owned by FontManager
+        int m_pageSize = 512;
+        std::vector<std::shared_ptr<rendering::Texture>> m_pages;
+        rendering::RectPacker m_packer; // Packs into the last page
+        std::unordered_map<uint32_t, Glyph> m_glyphs;
+        size_t m_uploadCount = 0;
+    };
+
+} // namespace text
@@ -14,7 +14,8 @@ namespace text {
 
     enum class TextRenderMode {
         Cached,     // Pre-render to texture (default, good for static text)
-        Immediate   // Render each frame (good for dynamic text)
+        Immediate,  // Render each frame (good for one-off text)
+        GlyphAtlas  // Batched quads from a shared glyph atlas (best for frequently changing text)
     };
 
     /**
@@ -27,7 +28,7 @@ namespace text {
      * - Font selection and styling
      * - Color and effects (outline, shadow)
      * - Alignment and word wrapping
-     * - Render mode selection (cached vs immediate)
+     * - Render mode selection (cached, immediate or glyph atlas)
      */
     class Text {
     public:
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <SDL_ttf.h>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace text {
+
+    /**
+     * Glyph Metrics
+     *
+     * Advance and kerning cache for a single font (font file + size). Every
+     * codepoint and kerning pair is asked from SDL_ttf once; afterwards
+     * measuring a string is a table lookup per glyph. ASCII advances live in
+     * a flat array since they make up most game text.
+     *
+     * Advances are the same values GlyphAtlas uses, so widths measured here
+     * line up exactly with glyph atlas rendering - without rasterizing anything.
+     */
+    class GlyphMetrics {
+    public:
+        explicit GlyphMetrics(TTF_Font* font);
+
+        int GetAdvance(uint32_t codepoint);
+        int GetKerning(uint32_t previous, uint32_t codepoint); // 0 when previous is 0
+        int GetLineSkip() const;
+
+        TTF_Font* GetFont() const { return m_font; }
+
+    private:
+        int MeasureAdvance(uint32_t codepoint);
+
+        static constexpr int ASCII_COUNT = 128;
+
+        TTF_Font* m_font = nullptr; // Owned by FontManager
+        int m_asciiAdvances[ASCII_COUNT];
+        std::unordered_map<uint32_t, int> m_advances;
+        std::unordered_map<uint64_t, int> m_kerning; // (previous << 32) | codepoint
+    };
+
+    struct TextLayoutOptions {
+        bool wordWrap = false;
+        float maxWidth = 0.0f;        // Soft breaks only when > 0
+        bool kerning = true;
+        float kerningAdjustment = 0.0f;
+    };
+
+    /**
+     * A line of a text layout (a byte range of the laid out content)
+     */
+    struct TextLine {
+        size_t offset = 0;
+        size_t length = 0;
+        int width = 0;
+    };
+
+    /**
+     * Text Layout
+     *
+     * Line breaking for a string in one pass: each glyph is measured once
+     * through GlyphMetrics and the line is broken at the last space that
+     * still fits, so the cost is linear in the length of the text no matter
+     * how long the lines are. Lines reference the source string by offset,
+     * nothing is copied.
+     *
+     * With word wrap, '\n' always starts a new line and spaces at a soft
+     * break are dropped; a single word wider than maxWidth gets a line of
+     * its own. Without word wrap the whole string is one line.
+     *
+     * Usage:
+     *   text::TextLayout layout;
+     *   layout.Build(content, *fontManager->GetGlyphMetrics("default"), options);
+     *   for (const auto& line : layout.GetLines()) { ... }
+     */
+    class TextLayout {
+    public:
+        // Rebuild for content (reuses the line storage)
+        void Build(const std::string& content, GlyphMetrics& metrics, const TextLayoutOptions& options);
+        void Clear();
+
+        const std::vector<TextLine>& GetLines() const { return m_lines; }
+        int GetWidth() const { return m_width; }           // Widest line
+        int GetLineSkip() const { return m_lineSkip; }     // Font line skip (before line spacing)
+        size_t GetSourceLength() const { return m_sourceLength; }
+        bool IsEmpty() const { return m_lines.empty(); }
+
+    private:
+        void AddLine(size_t offset, size_t end, float width);
+
+        std::vector<TextLine> m_lines;
+        int m_width = 0;
+        int m_lineSkip = 0;
+        size_t m_sourceLength = 0;
+    };
+
+} // namespace text
@@ -2,7 +2,9 @@
 
 #include "FontManager.h"
 #include "Text.h"
+#include "TextLayout.h"
 #include <glm/glm.hpp>
+#include <cstdint>
 #include <memory>
 #include <unordered_map>
 #include <string>
@@ -20,6 +22,17 @@ namespace core {
 
 namespace text {
 
+    /**
+     * Text texture cache statistics
+     */
+    struct TextCacheStats {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t evictions = 0;
+        size_t entries = 0;
+        size_t layouts = 0; // Cached text layouts
+    };
+
     /**
      * Text Renderer
      * 
@@ -29,8 +42,9 @@ namespace text {
      * Features:
      * - Cached rendering (text to texture, then draw texture)
      * - Immediate rendering (render text directly each frame)
+     * - Glyph atlas rendering (batched glyph quads, no uploads once glyphs are warm)
      * - Text effects (outline, shadow)
-     * - Alignment and word wrapping
+     * - Alignment and word wrapping (layouts cached and shared by measuring and drawing)
      * - Memory management for cached textures
      */
     class TextRenderer {
@@ -60,6 +74,8 @@ namespace text {
         void ClearCacheForFont(const std::string& fontName);
         void SetMaxCacheSize(size_t maxSizeMB);
         size_t GetCacheMemoryUsage() const;
+        TextCacheStats GetCacheStats() const;
+        void ResetCacheStats();
 
         // Configuration
         void LoadConfigFromSettings();
@@ -69,25 +85,38 @@ namespace text {
             std::shared_ptr<rendering::Texture> texture;
             glm::ivec2 size;
             size_t memorySize; // In bytes
-            mutable size_t lastUsedFrame; // For LRU eviction
+            std::string fontName; // For per-font invalidation
+            uint64_t key = 0;
             
-            // Text properties hash for cache key validation
-            std::string textHash;
+            // Intrusive LRU list links (most recently used at the head)
+            CachedTextData* lruPrev = nullptr;
+            CachedTextData* lruNext = nullptr;
+        };
+
+        struct CachedLayout {
+            TextLayout layout;
+            std::string fontName; // For per-font invalidation
+            size_t lastUsedFrame = 0;
         };
 
         // Internal rendering methods
         void RenderImmediate(const Text& text, const glm::vec2& position, float rotation, const glm::vec2& scale);
         std::shared_ptr<rendering::Texture> RenderToTexture(const Text& text);
         void RenderCached(const Text& text, const glm::vec2& position, float rotation, const glm::vec2& scale);
+        void RenderGlyphAtlas(const Text& text, const glm::vec2& position, float rotation, const glm::vec2& scale);
 
         // Text processing
-        std::vector<std::string> WrapText(const std::string& content, const std::string& fontName, float maxWidth);
-        std::string GenerateTextHash(const Text& text);
+        const TextLayout* GetLayout(const Text& text); // Cached, valid until the next Update
+        uint64_t GenerateLayoutKey(const Text& text) const;
+        static uint64_t GenerateCacheKey(const Text& text);
         glm::ivec2 CalculateTextSize(const Text& text);
 
         // Cache management
         void EvictOldCacheEntries();
-        void RemoveCacheEntry(const std::string& key);
+        void EvictOldLayouts();
+        void RemoveCacheEntry(uint64_t key);
+        void LinkLRUFront(CachedTextData* entry);
+        void UnlinkLRU(CachedTextData* entry);
 
         // Effect rendering helpers
         void RenderTextWithEffects(const Text& text, const glm::vec2& position, float rotation, const glm::vec2& scale);
@@ -102,17 +131,24 @@ namespace text {
         rendering::Renderer* m_renderer = nullptr;
         bool m_initialized = false;
         
-        // Cache system
-        std::unordered_map<std::string, CachedTextData> m_textCache;
+        // Cache system (map nodes are stable, so the LRU list links point straight at them)
+        std::unordered_map<uint64_t, CachedTextData> m_textCache;
+        CachedTextData* m_lruHead = nullptr;
+        CachedTextData* m_lruTail = nullptr;
+        TextCacheStats m_cacheStats;
         size_t m_maxCacheSize = 64 * 1024 * 1024; // 64MB default
         size_t m_currentCacheSize = 0;
         mutable size_t m_currentFrame = 0;
         
+        // Layout cache (keyed by content, font and wrapping; dropped after going unused for a while)
+        std::unordered_map<uint64_t, CachedLayout> m_layoutCache;
+        
         // Configuration (loaded from settings)
         bool m_enableCache = true;
         bool m_enableKerning = true;
         float m_kerningAdjustment = 0.0f;
         int m_hinting = 0; // TTF hinting mode
+        int m_glyphAtlasPageSize = 512;
     };
 
 } // namespace text
\ No newline at end of file
@@ -0,0 +1,158 @@
+#pragma once
+
+#include "engine/public/core/Bounds.h"
+#include "engine/public/rendering/QuadMesh.h"
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace rendering {
+    class Renderer;
+    class Texture;
+}
+
+namespace tilemap {
+
+    /**
+     * Tilemap
+     *
+     * Orthogonal Tiled (.tmx) map loaded through tmxlite. At load time each
+     * tile layer is cut into square chunks (32x32 tiles by default) and
+     * every chunk's static tiles are baked into one QuadMesh per tileset,
+     * so a layer draws in one call per visible chunk. Chunks outside the
+     * renderer's view are skipped.
+     *
+     * Animated tiles are kept out of the static meshes and re-emitted each
+     * frame through the sprite batch (only for visible chunks), so nothing
+     * static is ever rebuilt. Tile flip flags, layer offsets, opacity and
+     * visibility are honoured; finite and infinite maps are supported.
+     * Image-collection tilesets (one image per tile) are not.
+     *
+     * Loading is split in two for streaming (see world::WorldStreamer):
+     * Parse() reads the file and builds all vertex data without touching
+     * GL or the ResourceManager, so it may run on a worker thread; Upload()
+     * then loads the tileset textures and creates the meshes on the main
+     * thread. Load() does both.
+     *
+     * Usage:
+     *   tilemap::Tilemap map;
+     *   map.Load("assets/maps/level1.tmx");
+     *   // Update(): map.Update(deltaTime);
+     *   // Render(): map.Draw(core::Engine::Renderer());
+     */
+    class Tilemap {
+    public:
+        static constexpr int DEFAULT_CHUNK_SIZE = 32;
+
+        explicit Tilemap(int chunkSize = DEFAULT_CHUNK_SIZE); // Tiles per chunk side (1-64)
+        ~Tilemap();
+
+        Tilemap(const Tilemap&) = delete;
+        Tilemap& operator=(const Tilemap&) = delete;
+
+        // origin = world position of the map's top-left corner
+        bool Load(const std::string& path, const glm::vec2& origin = {0.0f, 0.0f});
+        bool Parse(const std::string& path, const glm::vec2& origin = {0.0f, 0.0f}); // No GL - any thread
+        bool Upload(bool asyncTextures = false);                                     // Main thread, after Parse()
+        void Unload();
+        bool IsParsed() const { return m_parsed; }
+        bool IsLoaded() const { return m_loaded; }
+
+        // Advance tile animations
+        void Update(float deltaTime);
+
+        // Draw all visible layers in map order, or a single one (e.g. to put sprites between layers)
+        void Draw(rendering::Renderer& renderer) const;
+        void DrawLayer(rendering::Renderer& renderer, size_t layerIndex) const;
+
+        // Layers (tile layers only, in map order)
+        size_t GetLayerCount() const { return m_layers.size(); }
+        const std::string& GetLayerName(size_t layerIndex) const;
+        int FindLayer(const std::string& name) const; // -1 if not found
+        void SetLayerVisible(size_t layerIndex, bool visible);
+        bool IsLayerVisible(size_t layerIndex) const;
+
+        // Map geometry
+        const glm::ivec2& GetSizeInTiles() const { return m_sizeInTiles; }
+        const glm::ivec2& GetTileSize() const { return m_tileSize; }
+        glm::vec2 GetPixelSize() const { return glm::vec2(m_sizeInTiles * m_tileSize); }
+        const glm::vec2& GetOrigin() const { return m_origin; }
+
+        // Rectangles (world space) of the objects in object layers named "collision" (any case)
+        const std::vector<core::Bounds>& GetColliders() const { return m_colliders; }
+
+        // Memory info (valid after Parse): chunk vertex data, and the tileset images the map uses
+        size_t GetMeshMemoryUsage() const;
+        size_t GetTilesetCount() const { return m_tilesets.size(); }
+        const std::string& GetTilesetImagePath(size_t tilesetIndex) const;
+        glm::ivec2 GetTilesetImageSize(size_t tilesetIndex) const;
+
+    private:
+        struct Tileset {
+            std::string imagePath;              // Empty for unsupported tilesets (their tiles are skipped)
+            std::shared_ptr<rendering::Texture> texture;
+            uint32_t firstGid = 0;
+            uint32_t lastGid = 0;
+            glm::ivec2 tileSize = {0, 0};
+            int columns = 0;
+            int spacing = 0;
+            int margin = 0;
+            glm::vec2 imageSize = {0.0f, 0.0f};
+        };
+
+        struct Animation {
+            size_t tileset = 0;
+            std::vector<glm::vec4> frameUVs;   // u0, v0, u1, v1 per frame
+            std::vector<float> frameEndsMs;    // Cumulative end time of each frame
+            float durationMs = 0.0f;
+            size_t currentFrame = 0;
+        };
+
+        struct AnimatedTile {
+            glm::vec2 corners[4];
+            uint32_t animation = 0;
+            uint8_t flipFlags = 0;
+        };
+
+        struct ChunkMesh {
+            size_t tileset = 0;
+            std::shared_ptr<rendering::QuadMesh> mesh;
+            std::vector<rendering::MeshVertex> vertices; // Built by Parse(), released by Upload()
+            size_t quadCount = 0;
+        };
+
+        struct Chunk {
+            core::Bounds bounds;
+            std::vector<ChunkMesh> meshes;
+            std::vector<AnimatedTile> animatedTiles;
+        };
+
+        struct Layer {
+            std::string name;
+            bool visible = true;
+            float opacity = 1.0f;
+            std::vector<Chunk> chunks;
+        };
+
+        int FindTileset(uint32_t gid) const;
+        glm::vec4 GetTileUVRect(const Tileset& tileset, uint32_t gid) const;
+        int FindAnimation(uint32_t gid) const;
+
+        int m_chunkSize;
+        bool m_parsed = false;
+        bool m_loaded = false;
+        glm::vec2 m_origin = {0.0f, 0.0f};
+        glm::ivec2 m_sizeInTiles = {0, 0};
+        glm::ivec2 m_tileSize = {0, 0};
+
+        std::vector<Tileset> m_tilesets;
+        std::vector<Layer> m_layers;
+        std::vector<core::Bounds> m_colliders;
+        std::vector<Animation> m_animations;
+        std::vector<uint32_t> m_animationGids; // Parallel to m_animations (dedup lookup at load)
+        float m_animationTimeMs = 0.0f;
+    };
+
+} // namespace tilemap
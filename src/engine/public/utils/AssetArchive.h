@@ -0,0 +1,72 @@
+#pragma once
+
+#include "engine/public/utils/MappedFile.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace utils {
+
+    // One file inside an archive (points into the mapping)
+    struct AssetView {
+        const uint8_t* data = nullptr;
+        size_t size = 0;
+
+        explicit operator bool() const { return data != nullptr; }
+    };
+
+    /**
+     * Asset Archive
+     *
+     * Read-only pack of asset files, memory-mapped as a whole:
+     *
+     *   header | table of contents (sorted by path hash) | paths | file data
+     *
+     * Lookups hash the normalized path (FNV-1a 64, '/' separators) and
+     * binary search the table, comparing paths only on a hash match. File
+     * data is stored uncompressed and 16 byte aligned, so a loader can read
+     * it in place (SDL_RWFromConstMem). Lookups never modify the archive
+     * and are safe from any thread.
+     *
+     * Paths keep their top directory, e.g. packing "assets/" stores
+     * "assets/textures/player.png" - the same path used for loose files.
+     */
+    class AssetArchive {
+    public:
+        bool Open(const std::string& path);
+        void Close();
+        bool IsOpen() const { return m_file.IsOpen(); }
+        const std::string& GetPath() const { return m_file.GetPath(); }
+
+        AssetView Find(std::string_view path) const;
+        bool Contains(std::string_view path) const { return static_cast<bool>(Find(path)); }
+        size_t GetFileCount() const { return m_entries.size(); }
+
+        // File produced at pack time (e.g. a sound bank), stored as path ("assets/...") in place of any loose one
+        struct GeneratedFile {
+            std::string path;
+            std::string file; // Where it was written on disk
+        };
+
+        // Pack every file under directory (dot files skipped), plus the generated ones, into outputPath
+        static bool Build(const std::string& directory, const std::string& outputPath,
+                          const std::vector<GeneratedFile>& generated = {});
+
+        static std::string NormalizePath(std::string_view path);
+        static uint64_t HashPath(std::string_view normalizedPath);
+
+    private:
+        struct Entry {
+            uint64_t hash = 0;
+            uint64_t offset = 0;
+            uint64_t size = 0;
+            std::string_view path; // Into the mapping
+        };
+
+        MappedFile m_file;
+        std::vector<Entry> m_entries; // Sorted by hash
+    };
+
+} // namespace utils
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "engine/public/utils/AssetArchive.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+struct SDL_RWops;
+
+namespace utils {
+
+    /**
+     * Asset file access
+     *
+     * Every engine loader opens asset files through these functions: a path
+     * is looked up in the mounted archive first (zero copy - SDL_RWops over
+     * the mapping) and falls back to the loose file on disk, so a packed
+     * build and a development checkout use the same paths.
+     *
+     * Mount/unmount only while no loads are in flight (the engine mounts
+     * "resources.archive" before any system starts and unmounts it last);
+     * the lookups themselves are safe from any thread.
+     */
+
+    bool MountAssetArchive(const std::string& path);
+    void UnmountAssetArchive();
+    bool IsAssetArchiveMounted();
+
+    bool AssetExists(const std::string& path);
+
+    // Read stream for an asset, nullptr if missing (SDL error set). Pass freesrc = 1 to SDL loaders.
+    SDL_RWops* OpenAsset(const std::string& path);
+
+    // Asset data in place, only for packed assets (empty view for loose files)
+    AssetView FindPackedAsset(const std::string& path);
+
+    // Copy of the whole file, for parsers that need owned data
+    bool ReadAsset(const std::string& path, std::vector<uint8_t>& bytes);
+    bool ReadAssetText(const std::string& path, std::string& text);
+
+} // namespace utils
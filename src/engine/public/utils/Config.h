@@ -1,11 +1,20 @@
 #pragma once
 
 #include <nlohmann/json.hpp>
+#include <atomic>
+#include <cstdint>
+#include <functional>
 #include <string>
 #include <memory>
+#include <type_traits>
+#include <vector>
 
 namespace utils {
     
+    // Called with the path that changed ("" when everything may have changed: Load, Reset)
+    using ConfigCallback = std::function<void(const std::string& path)>;
+    using ConfigSubscription = uint32_t;
+    
     /**
      * Configuration Management System
      * 
@@ -19,6 +28,12 @@ namespace utils {
      *   int width = config->GetInt("window.width", 1280);
      *   config->SetBool("graphics.vsync", true);
      *   config->Save();
+     *
+     * The string getters split and walk the path on every call - fine for
+     * initialization, but per frame reads should use ConfigKey<T> (below).
+     * Every Set*, Load and Reset bumps a global generation counter that
+     * ConfigKeys compare against, and notifies subscribers whose path is
+     * on the changed branch ("audio" sees "audio.music_volume" and vice versa).
      */
     class Config {
     public:
@@ -29,6 +44,7 @@ namespace utils {
         bool Load(const std::string& filename = "settings.json");
         bool Save(const std::string& filename = "");
         void LoadDefaults();
+        size_t Reload(); // Re-read the loaded file and notify only the keys that changed; returns how many
         
         // Getters with default values
         int GetInt(const std::string& path, int defaultValue = 0) const;
@@ -42,6 +58,11 @@ namespace utils {
         void SetBool(const std::string& path, bool value);
         void SetString(const std::string& path, const std::string& value);
         
+        // Change notification (main thread)
+        ConfigSubscription Subscribe(const std::string& path, ConfigCallback callback); // "" = any change
+        void Unsubscribe(ConfigSubscription subscription);
+        static uint64_t GetGeneration() { return s_generation.load(std::memory_order_relaxed); }
+        
         // Advanced access
         nlohmann::json GetSection(const std::string& path) const;
         void SetSection(const std::string& path, const nlohmann::json& section);
@@ -61,13 +82,93 @@ namespace utils {
         // Helper functions
         nlohmann::json* GetValuePointer(const std::string& path, bool createPath = false);
         const nlohmann::json* GetValuePointer(const std::string& path) const;
-        std::vector<std::string> SplitPath(const std::string& path) const;
         void CreateDefaultConfig();
+        void NotifyChanged(const std::string& path);
+        
+        struct Subscriber {
+            ConfigSubscription id = 0;
+            std::string path;
+            ConfigCallback callback;
+        };
         
         static std::shared_ptr<Config> s_instance;
+        static std::atomic<uint64_t> s_generation; // Starts at 1 - 0 means "never resolved" to a ConfigKey
         nlohmann::json m_config;
         std::string m_configPath;
         bool m_hasUnsavedChanges = false;
+        std::vector<Subscriber> m_subscribers;
+        ConfigSubscription m_nextSubscription = 1;
+    };
+    
+    /**
+     * Config Key
+     * 
+     * A config value resolved once from its dotted path and cached. Get()
+     * compares the config generation and only walks the json tree again
+     * after a Set*, Load or Reset - so a hot path read is one load and a
+     * compare, with no allocation. Supports int, float, bool and std::string.
+     * Like Config itself, keys are for the main thread.
+     * 
+     * Example usage:
+     *   static const utils::ConfigKey<bool> s_showFps("game.show_fps", false);
+     *   if (s_showFps.Get()) { ... }
+     */
+    template<typename T>
+    class ConfigKey {
+        static_assert(std::is_same_v<T, int> || std::is_same_v<T, float> || std::is_same_v<T, bool> || std::is_same_v<T, std::string>,
+                      "ConfigKey supports int, float, bool and std::string");
+    public:
+        ConfigKey(std::string path, T defaultValue = T{})
+            : m_path(std::move(path)), m_default(std::move(defaultValue)), m_value(m_default) {}
+        
+        const T& Get() const {
+            const uint64_t generation = Config::GetGeneration();
+            if (generation != m_generation) {
+                Resolve();
+                m_generation = generation;
+            }
+            return m_value;
+        }
+        
+        void Set(const T& value) const;
+        const std::string& GetPath() const { return m_path; }
+        const T& GetDefault() const { return m_default; }
+        
+    private:
+        void Resolve() const;
+        
+        std::string m_path;
+        T m_default;
+        mutable T m_value;
+        mutable uint64_t m_generation = 0;
     };
     
+    template<typename T>
+    void ConfigKey<T>::Resolve() const {
+        auto config = Config::Instance();
+        if constexpr (std::is_same_v<T, int>) {
+            m_value = config->GetInt(m_path, m_default);
+        } else if constexpr (std::is_same_v<T, float>) {
+            m_value = config->GetFloat(m_path, m_default);
+        } else if constexpr (std::is_same_v<T, bool>) {
+            m_value = config->GetBool(m_path, m_default);
+        } else {
+            m_value = config->GetString(m_path, m_default);
+        }
+    }
+    
+    template<typename T>
+    void ConfigKey<T>::Set(const T& value) const {
+        auto config = Config::Instance();
+        if constexpr (std::is_same_v<T, int>) {
+            config->SetInt(m_path, value);
+        } else if constexpr (std::is_same_v<T, float>) {
+            config->SetFloat(m_path, value);
+        } else if constexpr (std::is_same_v<T, bool>) {
+            config->SetBool(m_path, value);
+        } else {
+            config->SetString(m_path, value);
+        }
+    }
+    
 } // namespace utils
\ No newline at end of file
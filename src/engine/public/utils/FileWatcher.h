@@ -0,0 +1,79 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace utils {
+
+    /**
+     * File Watcher
+     *
+     * Reports files written, created or renamed anywhere below a directory,
+     * using the OS notification API on a background thread: inotify on
+     * Linux (one watch per directory, new directories are picked up as
+     * they appear), FSEvents on macOS and ReadDirectoryChangesW on Windows.
+     * Nothing is scanned or polled - an idle watcher costs a sleeping
+     * thread.
+     *
+     * Paths are reported relative to the working directory in generic form
+     * ("assets/textures/player.png"), as the engine's loaders name them.
+     * A file saved in several writes may be reported several times; filter
+     * with a short settle delay (see HotReloader).
+     *
+     * Usage:
+     *   utils::FileWatcher watcher;
+     *   watcher.Start("assets");
+     *   for (const std::string& path : watcher.TakeChanges()) { ... } // Any thread
+     */
+    class FileWatcher {
+    public:
+        FileWatcher() = default;
+        ~FileWatcher();
+
+        FileWatcher(const FileWatcher&) = delete;
+        FileWatcher& operator=(const FileWatcher&) = delete;
+
+        bool Start(const std::string& directory); // False if the directory or the platform's API is unavailable
+        void Stop();
+        bool IsRunning() const { return m_running; }
+        const std::string& GetDirectory() const { return m_directory; }
+
+        // Changed files since the last call, oldest first, without duplicates
+        std::vector<std::string> TakeChanges();
+
+    private:
+        void PushChange(const std::string& path); // Called by the platform thread/callback
+        void Run();
+
+        std::string m_directory;
+        std::thread m_thread;
+        std::atomic<bool> m_running{false};
+
+        std::mutex m_mutex;
+        std::vector<std::string> m_changes;
+
+#if defined(_WIN32)
+        void* m_directoryHandle = nullptr;
+        void* m_stopEvent = nullptr;
+#elif defined(__APPLE__)
+        // FSEventStreamCallback (ConstFSEventStreamRef, FSEventStreamEventFlags, FSEventStreamEventId)
+        static void OnEvents(const struct __FSEventStream* stream, void* context, size_t count, void* paths,
+                             const uint32_t* flags, const uint64_t* ids);
+        void* m_stream = nullptr;       // FSEventStreamRef
+        void* m_queue = nullptr;        // dispatch_queue_t the stream reports on
+        std::string m_resolvedRoot;     // FSEvents reports real paths (symlinks resolved)
+#elif defined(__linux__)
+        void AddWatches(const std::string& directory); // The directory and everything below it
+        int m_inotify = -1;
+        int m_wakeFd = -1;              // eventfd that ends the poll in Stop()
+        std::unordered_map<int, std::string> m_watches; // Watch descriptor -> directory
+#endif
+    };
+
+} // namespace utils
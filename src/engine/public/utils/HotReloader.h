@@ -0,0 +1,84 @@
+#pragma once
+
+#include "FileWatcher.h"
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace utils {
+
+    // Called on the main thread with the changed file ("assets/levels/forest.json")
+    using HotReloadCallback = std::function<void(const std::string& path)>;
+    using HotReloadSubscription = uint32_t;
+
+    /**
+     * Hot Reloader
+     *
+     * Watches assets/ with a FileWatcher and, once per frame on the main
+     * thread, reloads only what a changed file feeds:
+     * - Images: the cached Texture is decoded again into the same object
+     *   and GL texture, so Sprites and entities holding it see the new
+     *   pixels without being touched. The size must not change (frame,
+     *   tile and particle UVs were built from it - those reloads are
+     *   refused), and queued render thread frames are drained first.
+     * - Fonts: every size of the file is reopened on next use, and only
+     *   the TextRenderer entries of the font names using it are dropped.
+     * - Sounds: the Mix_Chunk of each non-bank sound loaded from the file.
+     * - settings.json: re-read and diffed; subscribers of the changed keys
+     *   are notified (Config::Reload), as if each key had been Set.
+     * Anything else (levels, emitters, animation sets) is left to
+     * subscribers by path prefix, called after the built-in handlers.
+     *
+     * A file is handled once it has been quiet for "hot_reload.debounce_ms",
+     * so an editor's save (often several writes) reloads it once. Only
+     * built into dev builds (ENGINE_HOT_RELOAD_ENABLED, never in Release);
+     * there it can be disabled with "hot_reload.enabled",
+     * EngineOptions::hotReload (tools that write under assets/ themselves)
+     * and is off while an asset archive is mounted.
+     *
+     * Usage:
+     *   core::Engine::HotReload().Subscribe("assets/levels/", [](const std::string& path) { ReloadLevel(path); });
+     */
+    class HotReloader {
+    public:
+        HotReloader() = default;
+        ~HotReloader();
+
+        HotReloader(const HotReloader&) = delete;
+        HotReloader& operator=(const HotReloader&) = delete;
+
+        bool Initialize(bool watch = true); // Not watching (disabled, packed assets or no watcher) is not an error
+        void Shutdown();
+        bool IsWatching() const { return m_watcher.IsRunning(); }
+
+        // Called by the engine at the start of every frame
+        void Update();
+
+        // Callbacks for changed files starting with prefix ("" = every file)
+        HotReloadSubscription Subscribe(const std::string& prefix, HotReloadCallback callback);
+        void Unsubscribe(HotReloadSubscription subscription);
+
+        // Run the handlers for a file now, as if it had changed
+        void Reload(const std::string& path);
+
+    private:
+        using Clock = std::chrono::steady_clock;
+
+        struct Subscriber {
+            HotReloadSubscription id = 0;
+            std::string prefix;
+            HotReloadCallback callback;
+        };
+
+        FileWatcher m_watcher;
+        std::unordered_map<std::string, Clock::time_point> m_pending; // Path -> last reported change
+        std::chrono::milliseconds m_debounce{100};
+        std::vector<Subscriber> m_subscribers;
+        HotReloadSubscription m_nextSubscription = 1;
+        bool m_initialized = false;
+    };
+
+} // namespace utils
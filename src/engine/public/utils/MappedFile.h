@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace utils {
+
+    /**
+     * Mapped File
+     *
+     * Read-only memory mapping of a whole file (mmap on POSIX, a file
+     * mapping on Windows). Pages are only read from disk when touched, so
+     * opening a large archive costs nothing up front, and the OS can share
+     * and drop the pages like any other file cache.
+     *
+     * The data stays valid until Close() or destruction; anything pointing
+     * into it must be released first. Empty files open with no data.
+     */
+    class MappedFile {
+    public:
+        MappedFile() = default;
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+        MappedFile(MappedFile&& other) noexcept;
+        MappedFile& operator=(MappedFile&& other) noexcept;
+
+        bool Open(const std::string& path);
+        void Close();
+
+        bool IsOpen() const { return m_open; }
+        const uint8_t* GetData() const { return m_data; }
+        size_t GetSize() const { return m_size; }
+        const std::string& GetPath() const { return m_path; }
+
+    private:
+        void MoveFrom(MappedFile& other);
+
+        const uint8_t* m_data = nullptr;
+        size_t m_size = 0;
+        std::string m_path;
+        bool m_open = false;
+
+#ifdef _WIN32
+        void* m_file = nullptr;
+        void* m_mapping = nullptr;
+#else
+        int m_fd = -1;
+#endif
+    };
+
+} // namespace utils
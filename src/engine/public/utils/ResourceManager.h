@@ -1,11 +1,27 @@
 #pragma once
 
+#include <cstdint>
+#include <deque>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <string>
+#include <vector>
+
+namespace core {
+    class JobCounter;
+}
 
 namespace rendering {
     class Texture;
+    class TextureAtlas;
+    class Sprite;
+    struct AtlasOptions;
+}
+
+namespace animation {
+    class AnimationSet;
 }
 
 namespace text {
@@ -14,6 +30,45 @@ namespace text {
 
 namespace utils {
     
+    // Called on the main thread once an async texture load finished (success = texture is usable)
+    using TextureLoadCallback = std::function<void(const std::shared_ptr<rendering::Texture>& texture, bool success)>;
+    
+    // One cached texture (or atlas page) as seen by GetTextureStats()
+    struct TextureStats {
+        std::string name;             // File path, or "atlas:<name>#<page>"
+        int width = 0;
+        int height = 0;
+        int mipLevels = 0;
+        size_t bytes = 0;             // GPU memory estimate (see Texture::GetMemoryUsage)
+        long references = 0;          // Owners besides the cache
+        bool retained = false;        // Unreferenced, kept warm by the cache until the budget needs the space
+        bool pending = false;         // Async load still outstanding
+        uint64_t framesSinceUse = 0;  // Frames since something besides the cache last held it
+    };
+    
+    /**
+     * Resource Manager
+     * 
+     * Caches textures and atlases by path/name.
+     * 
+     * Async texture loading:
+     * - LoadTextureAsync() returns a pending texture immediately; the file is
+     *   decoded on the job system and the GL upload happens on the main thread
+     *   in ProcessUploads(), bounded by a per-frame time budget.
+     * - Sprites using a pending texture draw the renderer's placeholder.
+     * - At most "resources.max_pending_uploads" decodes are in flight or waiting
+     *   for upload; further requests queue until a slot frees up.
+     * 
+     * Texture budget:
+     * - The cache holds textures strongly. A texture nothing else references
+     *   any more is "retained": it stays warm so the next request does not
+     *   reload it from disk.
+     * - Once per frame (in ProcessUploads) the cache's GPU memory is checked
+     *   against "resources.texture_budget_mb"; while it is over, retained
+     *   textures are dropped least recently used first. Referenced textures
+     *   are never evicted, so the budget can be exceeded by live content
+     *   (a warning is logged).
+     */
     class ResourceManager {
     public:
         ResourceManager();
@@ -22,19 +77,86 @@ namespace utils {
         bool Initialize();
         void Shutdown();
         
-        // Automatic loading with caching
+        // Automatic loading with caching (returns the cached texture as is, even while it is still pending)
         std::shared_ptr<rendering::Texture> LoadTexture(const std::string& path);
         
+        // Async loading - texture stays pending (IsPending()) until uploaded by ProcessUploads()
+        std::shared_ptr<rendering::Texture> LoadTextureAsync(const std::string& path, TextureLoadCallback callback = nullptr);
+        
+        // Upload decoded textures to the GPU (main thread, once per frame; always uploads at least one)
+        void ProcessUploads();                // Budget from "resources.upload_budget_ms"
+        void ProcessUploads(float budgetMs);
+        bool HasPendingLoads() const { return !m_asyncLoads.empty(); }
+        size_t GetPendingLoadCount() const { return m_asyncLoads.size(); }
+        
         // Manual resource management
         void UnloadTexture(const std::string& path);
         void UnloadAllTextures();
+        bool ReloadTexture(const std::string& path); // Re-decode a cached texture in place (same object and GL ID); false if not cached
+        
+        // Texture atlases (many images packed into shared pages)
+        std::shared_ptr<rendering::TextureAtlas> LoadAtlas(const std::string& name, const std::string& directory);
+        std::shared_ptr<rendering::TextureAtlas> LoadAtlas(const std::string& name, const std::string& directory,
+                                                           const rendering::AtlasOptions& options);
+        std::shared_ptr<rendering::TextureAtlas> LoadAtlas(const std::string& name, const std::vector<std::string>& imagePaths,
+                                                           const rendering::AtlasOptions& options);
+        std::shared_ptr<rendering::TextureAtlas> GetAtlas(const std::string& name) const;
+        rendering::Sprite CreateAtlasSprite(const std::string& atlasName, const std::string& regionName) const;
+        void UnloadAtlas(const std::string& name);
+        
+        // Animation sets (clips on a sprite sheet or atlas, see animation::AnimationSet)
+        std::shared_ptr<animation::AnimationSet> LoadAnimations(const std::string& path);
+        void UnloadAnimations(const std::string& path);
         
         // Resource info
         size_t GetTextureCount() const;
-        size_t GetMemoryUsage() const;
+        size_t GetAtlasCount() const;
+        size_t GetMemoryUsage() const;          // Cached textures and atlas pages, in bytes
+        size_t GetRetainedMemoryUsage() const;  // Part of it held only by the cache
+        
+        // Texture budget (bytes, 0 = unlimited); evicts retained textures right away if now over
+        void SetTextureBudget(size_t bytes);
+        size_t GetTextureBudget() const { return m_textureBudget; }
+        void TrimTextures(size_t targetBytes);  // Drop retained textures until usage <= targetBytes
+        
+        // Per-texture breakdown, largest first (also shown in the profiler overlay)
+        std::vector<TextureStats> GetTextureStats() const;
+        void DumpTextureStats() const;          // Log the breakdown
         
     private:
-        std::unordered_map<std::string, std::weak_ptr<rendering::Texture>> m_textures;
+        struct CachedTexture {
+            std::shared_ptr<rendering::Texture> texture; // The cache's own (retaining) reference
+            uint64_t lastUsedFrame = 0;                  // Last frame someone else held it
+        };
+        
+        void UpdateTextureUsage();
+        void EnforceTextureBudget();
+        
+        struct AsyncTextureLoad; // One outstanding async texture load (defined in the .cpp)
+        
+        void StartQueuedLoads();
+        void StartDecode(const std::shared_ptr<AsyncTextureLoad>& load);
+        void FinishLoad(AsyncTextureLoad& load);
+        
+        std::unordered_map<std::string, CachedTexture> m_textures;
+        std::unordered_map<std::string, std::shared_ptr<rendering::TextureAtlas>> m_atlases;
+        std::unordered_map<std::string, std::shared_ptr<animation::AnimationSet>> m_animationSets;
+        
+        // Async loading state (main thread, except m_decodedLoads which workers push to)
+        std::unordered_map<std::string, std::shared_ptr<AsyncTextureLoad>> m_asyncLoads;
+        std::deque<std::shared_ptr<AsyncTextureLoad>> m_queuedLoads;   // Waiting for a decode slot
+        std::deque<std::shared_ptr<AsyncTextureLoad>> m_decodedLoads;  // Waiting for GPU upload
+        std::mutex m_decodedMutex;
+        std::unique_ptr<core::JobCounter> m_decodeCounter;
+        size_t m_activeDecodes = 0;      // Started and not yet uploaded
+        size_t m_maxPendingUploads = 32;
+        float m_uploadBudgetMs = 2.0f;
+        
+        // Texture budget state
+        size_t m_textureBudget = 0;
+        uint64_t m_frame = 0;
+        bool m_budgetWarned = false;
+        
         bool m_initialized = false;
     };
 }
\ No newline at end of file
@@ -0,0 +1,148 @@
+#pragma once
+
+#include "engine/public/core/Bounds.h"
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace core {
+    class JobCounter;
+}
+
+namespace physics {
+    class RigidBody;
+}
+
+namespace rendering {
+    class Renderer;
+}
+
+namespace tilemap {
+    class Tilemap;
+}
+
+namespace world {
+
+    // Per resource class limits for everything the streamer keeps resident (0 = unlimited)
+    struct StreamingBudgets {
+        size_t textureBytes = 0;   // Tileset images (estimated at 4 bytes per texel, shared images counted once)
+        size_t meshBytes = 0;      // Chunk vertex buffers
+        size_t colliderCount = 0;  // Static boxes in the physics world
+    };
+
+    struct StreamingStats {
+        size_t regions = 0;
+        size_t resident = 0;
+        size_t loading = 0;        // Parse jobs in flight
+        size_t textureBytes = 0;
+        size_t meshBytes = 0;
+        size_t colliders = 0;
+        uint32_t loads = 0;        // Regions made resident since LoadWorld()
+        uint32_t evictions = 0;
+    };
+
+    /**
+     * World Streamer
+     *
+     * Keeps only the part of a large level near the camera in memory. The
+     * level is a set of regions, each its own Tiled map: usually a Tiled
+     * .world file (LoadWorld), or regions added by hand (AddRegion).
+     *
+     * Every frame (Engine::Update, with the renderer's view rectangle):
+     * - Regions within "streaming.load_radius" of the view are parsed on
+     *   the job system (file IO, tmx parsing and chunk vertex building).
+     * - Parsed regions are activated on the main thread, at most
+     *   "streaming.max_activations_per_frame" per frame: chunk meshes are
+     *   created, tileset textures load asynchronously through the
+     *   ResourceManager, and rectangles from the map's "collision" object
+     *   layer become one static RigidBody with a box collider each.
+     * - Regions beyond "streaming.unload_radius" are evicted, releasing
+     *   their meshes, physics body and tileset textures (dropped from the
+     *   ResourceManager cache once no resident region uses them, so the
+     *   texture budget follows what is really freed).
+     *
+     * Activation respects per-class budgets (StreamingBudgets): when a
+     * region would not fit, resident regions outside the load radius are
+     * evicted farthest first. A region that still does not fit stays
+     * parsed (not drawn) and a warning is logged.
+     *
+     * Resident regions are drawn by the engine below entity sprites.
+     */
+    class WorldStreamer {
+    public:
+        WorldStreamer();
+        ~WorldStreamer();
+
+        WorldStreamer(const WorldStreamer&) = delete;
+        WorldStreamer& operator=(const WorldStreamer&) = delete;
+
+        bool Initialize();
+        void Shutdown();
+
+        // Regions
+        bool LoadWorld(const std::string& path);  // Tiled .world file (replaces all regions)
+        size_t AddRegion(const std::string& mapPath, const glm::vec2& position, const glm::vec2& size);
+        void Clear();                             // Evict and forget all regions
+        bool HasRegions() const { return !m_regions.empty(); }
+        size_t GetRegionCount() const { return m_regions.size(); }
+        bool IsRegionResident(size_t regionIndex) const;
+        const tilemap::Tilemap* GetRegionMap(size_t regionIndex) const; // nullptr unless resident
+
+        // Per frame (main thread)
+        void Update(const core::Bounds& focus, float deltaTime);
+        void Draw(rendering::Renderer& renderer) const;
+
+        // Settings
+        void SetLoadRadius(float radius) { m_loadRadius = radius; }
+        void SetUnloadRadius(float radius) { m_unloadRadius = radius; }
+        void SetBudgets(const StreamingBudgets& budgets) { m_budgets = budgets; }
+        const StreamingBudgets& GetBudgets() const { return m_budgets; }
+
+        const StreamingStats& GetStats() const { return m_stats; }
+
+    private:
+        enum class RegionState { Unloaded, Loading, Parsed, Resident, Failed };
+
+        struct Region {
+            std::string mapPath;
+            core::Bounds bounds;
+            RegionState state = RegionState::Unloaded;
+            std::shared_ptr<tilemap::Tilemap> map;        // Shared with the parse job
+            std::unique_ptr<core::JobCounter> parseJob;
+            std::unique_ptr<physics::RigidBody> body;     // Static colliders (Resident only)
+            bool budgetWarned = false;
+        };
+
+        struct RegionCost {
+            size_t textureBytes = 0; // Images not already resident
+            size_t meshBytes = 0;
+            size_t colliders = 0;
+        };
+
+        void StartLoad(Region& region);
+        bool Activate(Region& region, const core::Bounds& loadArea);
+        void Evict(Region& region);
+        void WaitForLoads();
+
+        RegionCost GetCost(const Region& region) const;
+        bool Fits(const RegionCost& cost) const;
+
+        std::vector<Region> m_regions;
+        std::unordered_map<std::string, size_t> m_textureRefs; // Image path -> resident regions using it
+        core::Bounds m_focus;
+
+        float m_loadRadius = 512.0f;
+        float m_unloadRadius = 1024.0f;
+        int m_maxConcurrentLoads = 2;
+        int m_maxActivationsPerFrame = 1;
+        StreamingBudgets m_budgets;
+        StreamingStats m_stats;
+
+        bool m_initialized = false;
+    };
+
+} // namespace world
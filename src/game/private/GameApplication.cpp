@@ -37,8 +37,8 @@ void GameApplication::Update(float deltaTime) {
         spdlog::debug("W key pressed");
     }
     
-    // Example: Audio system access (immediate response)
-    if (core::Engine::Input().IsKeyJustPressed(SDL_SCANCODE_SPACE)) {
+    // Example: Audio system access (immediate response) - actions come from input.key_bindings
+    if (core::Engine::Input().IsActionJustPressed("jump")) {
         // core::Engine::Audio().PlaySound("jump.wav");
     }
 }
@@ -59,6 +59,9 @@ void GameApplication::FixedUpdate(float fixedDeltaTime) {
     
     // Example: Physics system access
     // core::Engine::Physics().SetGravity(0, 980);
+    
+    // Example: Input here is per step - every press is seen by exactly one fixed step
+    // if (core::Engine::Input().IsActionJustPressed("jump")) { playerBody.ApplyImpulse(...); }
 }
 
 void GameApplication::Render() {
@@ -71,6 +74,8 @@ void GameApplication::Render() {
     
     // Example: Engine API usage for rendering
     // core::Engine::Renderer().DrawSprite(&playerSprite, playerTransform);
+    // Physics bodies: draw between the last two fixed steps for smooth motion at any refresh rate
+    // core::Engine::Renderer().DrawSprite(&playerSprite, playerBody.GetInterpolatedTransform(core::Engine::GetInterpolationAlpha()));
     
     // Example: Text rendering
     // text::Text myText("Hello World", "default", text::Text::White);
@@ -0,0 +1,116 @@
+#include "engine/public/audio/AudioManager.h"
+#include "engine/public/utils/AssetArchive.h"
+#include "engine/public/utils/Config.h"
+#include <SDL.h>
+#include <nlohmann/json.hpp>
+#include <spdlog/spdlog.h>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+namespace fs = std::filesystem;
+
+// Sound bank manifests: "<bank>.json" files under audio/ with a "sounds" array (returns "<bank>", relative to audio/)
+std::vector<std::string> FindBankManifests(const fs::path& audioDirectory) {
+    std::vector<std::string> banks;
+    std::error_code ec;
+    for (fs::recursive_directory_iterator it(audioDirectory, ec), end; it != end; it.increment(ec)) {
+        if (ec) break;
+        if (!it->is_regular_file(ec) || it->path().extension() != ".json") continue;
+
+        std::ifstream file(it->path());
+        const nlohmann::json manifest = nlohmann::json::parse(file, nullptr, false);
+        if (manifest.is_discarded() || !manifest.contains("sounds") || !manifest["sounds"].is_array()) continue;
+
+        fs::path bank = it->path().lexically_relative(audioDirectory);
+        bank.replace_extension();
+        banks.push_back(bank.generic_string());
+    }
+    return banks;
+}
+
+// Decode every sound bank now rather than on the player's machine. SDL's dummy audio driver opens a device
+// with the format settings.json asks the game for, so the PCM is converted to what the game will play.
+bool BuildSoundBanks(const fs::path& stagingDirectory, std::vector<utils::AssetArchive::GeneratedFile>& generated) {
+    const std::vector<std::string> banks = FindBankManifests("assets/audio");
+    if (banks.empty()) {
+        return true;
+    }
+
+    std::error_code ec;
+    if (fs::exists("assets/settings.json", ec)) {
+        utils::Config::Instance()->Load("assets/settings.json");
+    }
+
+    SDL_setenv("SDL_AUDIODRIVER", "dummy", 1);
+    if (SDL_Init(SDL_INIT_AUDIO) != 0) {
+        spdlog::error("Failed to initialize SDL audio for sound banks: {}", SDL_GetError());
+        return false;
+    }
+
+    bool built = true;
+    {
+        audio::AudioManager audio;
+        built = audio.Initialize();
+        for (size_t i = 0; built && i < banks.size(); ++i) {
+            const fs::path output = stagingDirectory / banks[i];
+            fs::create_directories(output.parent_path(), ec);
+            built = audio.BuildSoundBank(banks[i], output.string());
+            if (built) {
+                generated.push_back({"assets/audio/" + banks[i], output.string()});
+            }
+        }
+        audio.Shutdown();
+    }
+
+    SDL_Quit();
+    return built;
+}
+
+} // anonymous namespace
+
+// Packs an asset directory into an archive the engine can mount, with its sound banks built:
+//   AssetPacker <assets directory> <output .pak>
+int main(int argc, char* argv[]) {
+    if (argc != 3) {
+        spdlog::error("Usage: {} <assets directory> <output .pak>", argc > 0 ? argv[0] : "AssetPacker");
+        return 1;
+    }
+
+    // Engine loaders use "assets/..." paths, so work from the directory that holds assets/
+    std::error_code ec;
+    fs::path assets = fs::absolute(argv[1], ec).lexically_normal();
+    if (!assets.has_filename()) {
+        assets = assets.parent_path(); // Trailing separator
+    }
+    const fs::path output = fs::absolute(argv[2], ec);
+    const fs::path staging = output.string() + ".banks";
+
+    std::vector<utils::AssetArchive::GeneratedFile> generated;
+    if (assets.filename() == "assets") {
+        fs::current_path(assets.parent_path(), ec);
+        if (ec || !BuildSoundBanks(staging, generated)) {
+            spdlog::error("Failed to build the sound banks in {}", assets.string());
+            return 1;
+        }
+    } else {
+        spdlog::warn("'{}' is not an assets/ directory - sound banks are not built", assets.string());
+    }
+
+    const bool packed = utils::AssetArchive::Build(assets.string(), output.string(), generated);
+    fs::remove_all(staging, ec);
+    if (!packed) {
+        return 1;
+    }
+
+    // Make sure what was written can be read back
+    utils::AssetArchive archive;
+    if (!archive.Open(output.string())) {
+        spdlog::error("Packed archive failed to open: {}", output.string());
+        return 1;
+    }
+    return 0;
+}
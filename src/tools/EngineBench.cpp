@@ -0,0 +1,594 @@
+#include "engine/public/core/Engine.h"
+#include "engine/public/core/FrameArena.h"
+#include "engine/public/core/FramePacer.h"
+#include "engine/public/core/IGameApplication.h"
+#include "engine/public/core/Transform.h"
+#include "engine/public/audio/AudioManager.h"
+#include "engine/public/debug/Profiler.h"
+#include "engine/public/ecs/Registry.h"
+#include "engine/public/particles/ParticleSystem.h"
+#include "engine/public/physics/Physics.h"
+#include "engine/public/physics/RigidBody.h"
+#include "engine/public/rendering/Renderer.h"
+#include "engine/public/rendering/Sprite.h"
+#include "engine/public/rendering/Texture.h"
+#include "engine/public/save/SaveManager.h"
+#include "engine/public/text/Text.h"
+#include "engine/public/text/TextRenderer.h"
+#include "engine/public/utils/Logger.h"
+
+#include <SDL.h>
+#include <nlohmann/json.hpp>
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+// Headless engine benchmark: runs the real engine loop (hidden window, no vsync, uncapped)
+// on reproducible stress scenes and writes frame time percentiles, draw calls and heap
+// allocations as JSON.
+//   EngineBench [--scene sprites,bodies,text,sounds,save,particles|all] [--count N] [--sounds M]
+//               [--frames F] [--warmup W] [--seed S] [--text-mode cached|immediate|atlas]
+//               [--offscreen] [--visible] [--output results.json]
+
+namespace {
+
+struct BenchSettings {
+    std::vector<std::string> scenes = {"sprites"};
+    int count = 1000;      // Sprites, bodies, labels, saved entities or live particles per scene
+    int sounds = 16;       // Concurrent voices in the sounds scene
+    int frames = 600;      // Measured frames
+    int warmup = 60;       // Frames run before measuring (caches, arena growth)
+    uint32_t seed = 1;
+    text::TextRenderMode textMode = text::TextRenderMode::Cached;
+    bool offscreen = false; // SDL offscreen video + dummy audio drivers (no display needed)
+    bool visible = false;
+    std::string outputPath = "bench_results.json";
+};
+
+BenchSettings s_settings;
+bool s_resultsWritten = false;
+
+struct Orbit {
+    glm::vec2 center = {0.0f, 0.0f};
+    float radius = 0.0f;
+    float phase = 0.0f;
+};
+
+struct SavedEntity {
+    float x = 0.0f;
+    float y = 0.0f;
+    float rotation = 0.0f;
+    int health = 0;
+    std::string name;
+    std::vector<int> inventory;
+    NLOHMANN_DEFINE_TYPE_INTRUSIVE(SavedEntity, x, y, rotation, health, name, inventory)
+};
+
+struct SavedWorld {
+    uint32_t seed = 0;
+    std::vector<SavedEntity> entities;
+    NLOHMANN_DEFINE_TYPE_INTRUSIVE(SavedWorld, seed, entities)
+};
+
+constexpr const char* TONE_FILE = "engine_bench_tone.wav";
+constexpr const char* TONE_PATH = "assets/audio/sfx/engine_bench_tone.wav"; // Where AudioManager looks for SFX
+constexpr const char* SAVE_SLOT = "bench";
+
+struct Summary {
+    double average = 0.0;
+    double p50 = 0.0;
+    double p90 = 0.0;
+    double p99 = 0.0;
+    double min = 0.0;
+    double max = 0.0;
+};
+
+// Nearest-rank percentiles over a copy of the samples
+Summary Summarize(std::vector<double> samples) {
+    Summary summary;
+    if (samples.empty()) return summary;
+
+    std::sort(samples.begin(), samples.end());
+    auto percentile = [&](double p) {
+        const size_t rank = static_cast<size_t>(std::ceil(p * static_cast<double>(samples.size())));
+        return samples[std::clamp<size_t>(rank, 1, samples.size()) - 1];
+    };
+
+    double total = 0.0;
+    for (double sample : samples) total += sample;
+    summary.average = total / static_cast<double>(samples.size());
+    summary.p50 = percentile(0.50);
+    summary.p90 = percentile(0.90);
+    summary.p99 = percentile(0.99);
+    summary.min = samples.front();
+    summary.max = samples.back();
+    return summary;
+}
+
+nlohmann::json ToJson(const Summary& summary) {
+    return {
+        {"average", summary.average}, {"p50", summary.p50}, {"p90", summary.p90},
+        {"p99", summary.p99}, {"min", summary.min}, {"max", summary.max}
+    };
+}
+
+double MillisecondsSince(uint64_t start) {
+    return static_cast<double>(SDL_GetPerformanceCounter() - start) * 1000.0 / static_cast<double>(SDL_GetPerformanceFrequency());
+}
+
+// Half a second of a 440 Hz sine, 16-bit mono PCM
+bool WriteToneFile(const std::filesystem::path& path) {
+    constexpr uint32_t sampleRate = 44100;
+    constexpr uint32_t sampleCount = sampleRate / 2;
+    constexpr uint32_t dataBytes = sampleCount * 2;
+
+    std::error_code error;
+    std::filesystem::create_directories(path.parent_path(), error);
+    std::ofstream file(path, std::ios::binary);
+    if (!file) return false;
+
+    auto write32 = [&](uint32_t value) {
+        const std::array<char, 4> bytes = {char(value), char(value >> 8), char(value >> 16), char(value >> 24)};
+        file.write(bytes.data(), 4);
+    };
+    auto write16 = [&](uint16_t value) {
+        const std::array<char, 2> bytes = {char(value), char(value >> 8)};
+        file.write(bytes.data(), 2);
+    };
+
+    file.write("RIFF", 4); write32(36 + dataBytes); file.write("WAVE", 4);
+    file.write("fmt ", 4); write32(16); write16(1); write16(1);
+    write32(sampleRate); write32(sampleRate * 2); write16(2); write16(16);
+    file.write("data", 4); write32(dataBytes);
+    for (uint32_t i = 0; i < sampleCount; ++i) {
+        const double t = static_cast<double>(i) / sampleRate;
+        write16(static_cast<uint16_t>(static_cast<int16_t>(std::sin(t * 440.0 * 6.283185307) * 8000.0)));
+    }
+    return static_cast<bool>(file);
+}
+
+/**
+ * Bench Application
+ *
+ * Builds the requested stress scenes from a fixed seed, records one sample
+ * per frame (frame time, last frame's draw calls, heap allocations) and
+ * writes the JSON report before asking the engine to quit.
+ */
+class BenchApplication : public core::IGameApplication {
+public:
+    bool Initialize() override {
+        // Measure the engine, not the display
+        core::Engine::Renderer().SetSwapInterval(0);
+        core::Engine::FramePacing().Configure(core::LoopMode::Uncapped, 0.0f, 0.0f);
+
+        std::mt19937 rng(s_settings.seed);
+        for (const std::string& scene : s_settings.scenes) {
+            if (scene == "sprites") CreateSprites(rng);
+            else if (scene == "bodies") CreateBodies(rng);
+            else if (scene == "text") CreateLabels();
+            else if (scene == "sounds") LoadTone();
+            else if (scene == "save") CreateSaveData(rng);
+            else if (scene == "particles") CreateParticles();
+            else {
+                spdlog::error("Unknown bench scene '{}'", scene);
+                return false;
+            }
+        }
+
+        const size_t samples = static_cast<size_t>(s_settings.frames);
+        m_frameMs.reserve(samples);
+        m_drawCalls.reserve(samples);
+        m_allocations.reserve(samples);
+        m_allocatedBytes.reserve(samples);
+        m_saveMs.reserve(samples);
+        m_loadMs.reserve(samples);
+        spdlog::info("Bench: {} frames ({} warmup), count {}, seed {}", s_settings.frames, s_settings.warmup,
+                     s_settings.count, s_settings.seed);
+        return true;
+    }
+
+    void Update(float deltaTime) override {
+        RecordFrame();
+        m_time += deltaTime;
+
+        auto& registry = core::Engine::Entities();
+        registry.Each<Orbit, core::Transform>([&](ecs::Entity, Orbit& orbit, ecs::TransformRef transform) {
+            const float angle = orbit.phase + m_time;
+            transform.position = orbit.center + glm::vec2(std::cos(angle), std::sin(angle)) * orbit.radius;
+            transform.rotation = angle * 57.2957795f;
+        });
+
+        for (size_t i = 0; i < m_labels.size(); ++i) {
+            m_labels[i].SetContent(fmt::format("Label {} frame {}", i, m_frame));
+        }
+
+        if (m_toneLoaded) KeepSoundsPlaying();
+        if (!m_saveData.entities.empty()) SaveAndLoad();
+
+        if (m_frame >= s_settings.warmup + s_settings.frames) {
+            WriteResults();
+            core::Engine::RequestQuit();
+        }
+        m_frame++;
+    }
+
+    void FixedUpdate(float) override {}
+
+    void Render() override {
+        auto& textRenderer = core::Engine::TextRenderer();
+        for (size_t i = 0; i < m_labels.size(); ++i) {
+            textRenderer.DrawText(m_labels[i], m_labelPositions[i]);
+        }
+    }
+
+    void Shutdown() override {
+        if (m_toneLoaded) {
+            core::Engine::Audio().StopAll();
+            core::Engine::Audio().UnloadSound("bench_tone");
+        }
+        std::error_code error;
+        std::filesystem::remove(TONE_PATH, error);
+        if (!m_saveDirectory.empty()) {
+            std::filesystem::remove_all(m_saveDirectory, error);
+        }
+    }
+
+private:
+    void CreateSprites(std::mt19937& rng) {
+        auto& registry = core::Engine::Entities();
+        const auto texture = GetTexture();
+        std::uniform_real_distribution<float> x(0.0f, 1280.0f), y(0.0f, 720.0f), radius(8.0f, 64.0f), phase(0.0f, 6.283f);
+
+        for (int i = 0; i < s_settings.count; ++i) {
+            const ecs::Entity entity = registry.Create();
+            const Orbit orbit{{x(rng), y(rng)}, radius(rng), phase(rng)};
+            registry.Add<core::Transform>(entity, orbit.center);
+            registry.Add<rendering::Sprite>(entity, texture).SetOriginToCenter();
+            registry.Add<Orbit>(entity, orbit);
+        }
+    }
+
+    void CreateBodies(std::mt19937& rng) {
+        auto& registry = core::Engine::Entities();
+        core::Engine::Physics().SetGravity(0.0f, 500.0f);
+
+        const ecs::Entity ground = registry.Create();
+        registry.Add<core::Transform>(ground, glm::vec2(640.0f, 700.0f));
+        registry.Add<physics::RigidBody>(ground, registry.Get<core::Transform>(ground), physics::RigidBody::Type::Static)
+            .AddBoxCollider(1280.0f, 20.0f);
+
+        // A loose grid dropped onto the ground, so bodies pile up and keep colliding
+        const auto texture = GetTexture();
+        const int columns = std::max(1, static_cast<int>(std::sqrt(static_cast<float>(s_settings.count))));
+        std::uniform_real_distribution<float> jitter(-2.0f, 2.0f);
+        for (int i = 0; i < s_settings.count; ++i) {
+            const ecs::Entity entity = registry.Create();
+            const glm::vec2 position(40.0f + (i % columns) * (1200.0f / columns) + jitter(rng),
+                                     650.0f - (i / columns) * 12.0f);
+            registry.Add<core::Transform>(entity, position);
+            registry.Add<rendering::Sprite>(entity, texture).SetOriginToCenter();
+            registry.Add<physics::RigidBody>(entity, registry.Get<core::Transform>(entity), physics::RigidBody::Type::Dynamic)
+                .AddBoxCollider(8.0f, 8.0f);
+        }
+    }
+
+    void CreateParticles() {
+        // Eight fountains that together keep about count particles alive
+        constexpr int EMITTERS = 8;
+        auto settings = std::make_shared<particles::EmitterSettings>();
+        settings->texture = GetTexture();
+        settings->lifetime = {1.0f, 2.0f};
+        settings->maxParticles = static_cast<size_t>(std::max(s_settings.count / EMITTERS, 1));
+        settings->rate = static_cast<float>(settings->maxParticles) / 1.5f;
+        settings->speed = {60.0f, 240.0f};
+        settings->spread = 60.0f;
+        settings->gravity = {0.0f, 150.0f};
+        settings->drag = 0.2f;
+        settings->startSize = 6.0f;
+        settings->endSize = 1.0f;
+        settings->endColor = {1.0f, 0.4f, 0.1f, 0.0f};
+
+        auto& particleSystem = core::Engine::Particles();
+        for (int i = 0; i < EMITTERS; ++i) {
+            m_emitters.push_back(particleSystem.CreateEmitter(settings, {80.0f + i * 160.0f, 600.0f}));
+        }
+    }
+
+    void CreateLabels() {
+        const int columns = std::max(1, static_cast<int>(std::sqrt(static_cast<float>(s_settings.count))));
+        m_labels.reserve(static_cast<size_t>(s_settings.count));
+        m_labelPositions.reserve(static_cast<size_t>(s_settings.count));
+        for (int i = 0; i < s_settings.count; ++i) {
+            text::Text& label = m_labels.emplace_back("", "default", text::Text::White);
+            label.SetRenderMode(s_settings.textMode);
+            m_labelPositions.emplace_back(10.0f + (i % columns) * (1260.0f / columns), 10.0f + (i / columns) * 18.0f);
+        }
+    }
+
+    void LoadTone() {
+        auto& audioManager = core::Engine::Audio();
+        if (!audioManager.IsInitialized()) {
+            spdlog::warn("Bench: audio is not available - skipping the sounds scene");
+            return;
+        }
+        if (!WriteToneFile(TONE_PATH) ||
+            !audioManager.LoadSound(TONE_FILE, "bench_tone", audio::AudioCategory::SFX)) {
+            spdlog::warn("Bench: could not create the test tone - skipping the sounds scene");
+            return;
+        }
+        m_voices.assign(static_cast<size_t>(s_settings.sounds), audio::INVALID_AUDIO_HANDLE);
+        m_toneLoaded = true;
+    }
+
+    void CreateSaveData(std::mt19937& rng) {
+        auto& saveManager = core::Engine::SaveManager();
+        if (!saveManager.IsInitialized()) {
+            spdlog::warn("Bench: save manager is not available - skipping the save scene");
+            return;
+        }
+
+        // Never touch the player's real saves
+        m_saveDirectory = (std::filesystem::temp_directory_path() / "engine_bench_saves").string();
+        saveManager.SetSaveDirectory(m_saveDirectory);
+
+        std::uniform_real_distribution<float> coordinate(0.0f, 10000.0f), rotation(0.0f, 360.0f);
+        std::uniform_int_distribution<int> health(0, 100), item(0, 999);
+        m_saveData.seed = s_settings.seed;
+        m_saveData.entities.resize(static_cast<size_t>(s_settings.count));
+        for (size_t i = 0; i < m_saveData.entities.size(); ++i) {
+            SavedEntity& entity = m_saveData.entities[i];
+            entity.x = coordinate(rng);
+            entity.y = coordinate(rng);
+            entity.rotation = rotation(rng);
+            entity.health = health(rng);
+            entity.name = fmt::format("entity_{}", i);
+            entity.inventory.resize(8);
+            for (int& slot : entity.inventory) slot = item(rng);
+        }
+    }
+
+    void KeepSoundsPlaying() {
+        auto& audioManager = core::Engine::Audio();
+        for (audio::AudioHandle& voice : m_voices) {
+            if (!audioManager.IsAudioPlaying(voice)) {
+                voice = audioManager.PlaySound("bench_tone", 0.1f);
+            }
+        }
+    }
+
+    void SaveAndLoad() {
+        auto& saveManager = core::Engine::SaveManager();
+        m_saveData.entities[m_frame % m_saveData.entities.size()].health++;
+
+        uint64_t start = SDL_GetPerformanceCounter();
+        const bool saved = saveManager.Save(SAVE_SLOT, m_saveData);
+        const double saveMs = MillisecondsSince(start);
+
+        const std::vector<std::string> saves = saveManager.GetSavesInSlot(SAVE_SLOT);
+        if (!saved || saves.empty()) {
+            m_saveFailures++;
+            return;
+        }
+
+        start = SDL_GetPerformanceCounter();
+        const auto loaded = saveManager.Load<SavedWorld>(SAVE_SLOT, saves.back());
+        const double loadMs = MillisecondsSince(start);
+        if (!loaded || loaded->entities.size() != m_saveData.entities.size()) {
+            m_saveFailures++;
+        }
+
+        for (const std::string& filename : saves) {
+            saveManager.DeleteSave(SAVE_SLOT, filename);
+        }
+        if (IsMeasuring()) {
+            m_saveMs.push_back(saveMs);
+            m_loadMs.push_back(loadMs);
+        }
+    }
+
+    std::shared_ptr<rendering::Texture> GetTexture() {
+        if (!m_texture) {
+            std::vector<unsigned char> pixels(16 * 16 * 4, 255);
+            m_texture = std::make_shared<rendering::Texture>();
+            m_texture->LoadFromMemory(pixels.data(), 16, 16, 4);
+        }
+        return m_texture;
+    }
+
+    bool IsMeasuring() const { return m_frame > s_settings.warmup && m_frame <= s_settings.warmup + s_settings.frames; }
+
+    // One sample per frame, taken at the start of Update: covers the whole previous frame
+    void RecordFrame() {
+        const uint64_t now = SDL_GetPerformanceCounter();
+#ifdef ENGINE_PROFILER_ENABLED
+        const uint64_t allocations = debug::GetAllocationCount();
+        const uint64_t allocatedBytes = debug::GetAllocatedBytes();
+#else
+        const uint64_t allocations = 0;
+        const uint64_t allocatedBytes = 0;
+#endif
+
+        if (IsMeasuring()) {
+            m_frameMs.push_back(static_cast<double>(now - m_lastFrameStart) * 1000.0 / static_cast<double>(SDL_GetPerformanceFrequency()));
+            m_drawCalls.push_back(core::Engine::Renderer().GetLastFrameStats().drawCalls);
+            m_allocations.push_back(static_cast<double>(allocations - m_lastAllocations));
+            m_allocatedBytes.push_back(static_cast<double>(allocatedBytes - m_lastAllocatedBytes));
+        }
+
+        m_lastFrameStart = now;
+        m_lastAllocations = allocations;
+        m_lastAllocatedBytes = allocatedBytes;
+    }
+
+    void WriteResults() {
+        const core::FrameArena& arena = core::Engine::FrameMemory();
+
+        nlohmann::json results;
+        results["scenes"] = s_settings.scenes;
+        results["count"] = s_settings.count;
+        results["sounds"] = s_settings.sounds;
+        results["frames"] = m_frameMs.size();
+        results["warmup"] = s_settings.warmup;
+        results["seed"] = s_settings.seed;
+#ifdef NDEBUG
+        results["assertions"] = false;
+#else
+        results["assertions"] = true;
+#endif
+        results["frame_ms"] = ToJson(Summarize(m_frameMs));
+        results["draw_calls"] = ToJson(Summarize(m_drawCalls));
+#ifdef ENGINE_PROFILER_ENABLED
+        results["allocations"] = ToJson(Summarize(m_allocations));
+        results["allocated_bytes"] = ToJson(Summarize(m_allocatedBytes));
+#else
+        results["allocations"] = nullptr; // Counted in profiled builds only
+        results["allocated_bytes"] = nullptr;
+#endif
+        results["frame_arena"] = {{"peak_bytes", arena.GetPeak()}, {"overflows", arena.GetOverflowCount()}};
+        results["entities"] = core::Engine::Entities().GetEntityCount();
+
+        if (!m_labels.empty()) {
+            const text::TextCacheStats stats = core::Engine::TextRenderer().GetCacheStats();
+            results["text_cache"] = {{"hits", stats.hits}, {"misses", stats.misses}, {"evictions", stats.evictions}};
+        }
+        if (m_toneLoaded) {
+            const audio::VoiceStats& stats = core::Engine::Audio().GetVoiceStats();
+            results["audio"] = {{"voices", stats.voices}, {"active", stats.active}, {"stolen", stats.stolen}, {"dropped", stats.dropped}};
+        }
+        if (!m_saveData.entities.empty()) {
+            results["save_ms"] = ToJson(Summarize(m_saveMs));
+            results["load_ms"] = ToJson(Summarize(m_loadMs));
+            results["save_failures"] = m_saveFailures;
+        }
+
+        std::ofstream file(s_settings.outputPath);
+        if (!file) {
+            spdlog::error("Bench: cannot write results to {}", s_settings.outputPath);
+            return;
+        }
+        file << results.dump(2) << "\n";
+        s_resultsWritten = true;
+
+        const Summary frameMs = Summarize(m_frameMs);
+        spdlog::info("Bench: frame p50 {:.3f} ms, p99 {:.3f} ms, max {:.3f} ms - results in {}",
+                     frameMs.p50, frameMs.p99, frameMs.max, s_settings.outputPath);
+    }
+
+    int m_frame = 0;
+    float m_time = 0.0f;
+
+    std::shared_ptr<rendering::Texture> m_texture;
+    std::vector<text::Text> m_labels;
+    std::vector<std::shared_ptr<particles::ParticleEmitter>> m_emitters;
+    std::vector<glm::vec2> m_labelPositions;
+    std::vector<audio::AudioHandle> m_voices;
+    bool m_toneLoaded = false;
+    SavedWorld m_saveData;
+    std::string m_saveDirectory;
+    size_t m_saveFailures = 0;
+
+    // Samples (measured frames only)
+    uint64_t m_lastFrameStart = 0;
+    uint64_t m_lastAllocations = 0;
+    uint64_t m_lastAllocatedBytes = 0;
+    std::vector<double> m_frameMs;
+    std::vector<double> m_drawCalls;
+    std::vector<double> m_allocations;
+    std::vector<double> m_allocatedBytes;
+    std::vector<double> m_saveMs;
+    std::vector<double> m_loadMs;
+};
+
+std::vector<std::string> SplitList(const std::string& list) {
+    std::vector<std::string> items;
+    size_t start = 0;
+    while (start <= list.size()) {
+        const size_t end = std::min(list.find(',', start), list.size());
+        if (end > start) items.push_back(list.substr(start, end - start));
+        start = end + 1;
+    }
+    return items;
+}
+
+bool ParseArguments(int argc, char* argv[]) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if (arg == "--offscreen") s_settings.offscreen = true;
+        else if (arg == "--visible") s_settings.visible = true;
+        else if (!hasValue) {
+            spdlog::error("Missing value for {}", arg);
+            return false;
+        }
+        else if (arg == "--scene") {
+            s_settings.scenes = SplitList(argv[++i]);
+            if (s_settings.scenes.size() == 1 && s_settings.scenes[0] == "all") {
+                s_settings.scenes = {"sprites", "bodies", "text", "sounds", "save", "particles"};
+            }
+        }
+        else if (arg == "--count") s_settings.count = std::max(0, std::atoi(argv[++i]));
+        else if (arg == "--sounds") s_settings.sounds = std::max(0, std::atoi(argv[++i]));
+        else if (arg == "--frames") s_settings.frames = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--warmup") s_settings.warmup = std::max(0, std::atoi(argv[++i]));
+        else if (arg == "--seed") s_settings.seed = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        else if (arg == "--output") s_settings.outputPath = argv[++i];
+        else if (arg == "--text-mode") {
+            const std::string mode = argv[++i];
+            s_settings.textMode = mode == "immediate" ? text::TextRenderMode::Immediate
+                                : mode == "atlas" ? text::TextRenderMode::GlyphAtlas
+                                : text::TextRenderMode::Cached;
+        }
+        else {
+            spdlog::error("Unknown argument {}", arg);
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+std::unique_ptr<core::IGameApplication> core::CreateGameApplication() {
+    return std::make_unique<BenchApplication>();
+}
+
+int main(int argc, char* argv[]) {
+    utils::Logger::Initialize();
+
+    if (!ParseArguments(argc, argv)) {
+        spdlog::error("Usage: {} [--scene sprites,bodies,text,sounds,save,particles|all] [--count N] [--sounds M] [--frames F] "
+                      "[--warmup W] [--seed S] [--text-mode cached|immediate|atlas] [--offscreen] [--visible] [--output file]",
+                      argc > 0 ? argv[0] : "EngineBench");
+        utils::Logger::Shutdown();
+        return 1;
+    }
+
+    // No display or sound card needed (SDL's offscreen driver still gives us a GL context)
+    if (s_settings.offscreen) {
+        SDL_setenv("SDL_VIDEODRIVER", "offscreen", 0);
+        SDL_setenv("SDL_AUDIODRIVER", "dummy", 0);
+    }
+
+    core::EngineOptions options;
+    options.hiddenWindow = !s_settings.visible;
+    options.saveConfigOnExit = false; // Benchmark runs never change the user's settings
+    options.hotReload = false;        // The bench writes its own files under assets/ (no reloads mid-measurement)
+
+    if (!core::Engine::Initialize(options)) {
+        spdlog::error("Failed to initialize engine");
+        core::Engine::Shutdown();
+        return 1;
+    }
+
+    core::Engine::Run();
+    core::Engine::Shutdown();
+    return s_resultsWritten ? 0 : 1;
+}